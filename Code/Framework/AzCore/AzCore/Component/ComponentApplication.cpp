@@ -929,6 +929,22 @@ namespace AZ
         SettingsRegistryInterface::Specializations specializations;
         SetSettingsRegistrySpecializations(specializations);
 
+        // If enabled, reuse the settings merged by the previous launch when none of the registry files changed since
+        auto registryImpl = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        AZ::IO::FixedMaxPath mergeCachePath;
+        AZStd::string mergeCacheKey;
+        const bool useMergeCache = registryImpl &&
+            SettingsRegistryMergeUtils::GetMergeCacheSettings(mergeCachePath, mergeCacheKey, registry, specializations, AZ_TRAIT_OS_PLATFORM_CODENAME);
+        if (useMergeCache && registryImpl->ReadMergeCache(mergeCachePath.c_str(), mergeCacheKey))
+        {
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+            // The cached settings already contain the command line, but the commands still need to run
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, true);
+#endif
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+            return;
+        }
+
         AZStd::vector<char> scratchBuffer;
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         // In development builds apply the o3de registry and the command line to allow early overrides. This will
@@ -973,6 +989,11 @@ namespace AZ
 #endif
         // Update the Runtime file paths in case the "{BootstrapSettingsRootKey}/assets" key was overriden by a setting registry
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+
+        if (useMergeCache)
+        {
+            registryImpl->WriteMergeCache(mergeCachePath.c_str(), mergeCacheKey);
+        }
     }
 
     void ComponentApplication::SetSettingsRegistrySpecializations(SettingsRegistryInterface::Specializations& specializations)
@@ -180,6 +180,7 @@ namespace AZ
              * By default, the event queue is disabled.
              */
             static const bool EnableEventQueue = Traits::EnableEventQueue;
+            static const bool EnableLockFreeEventQueue = Traits::EnableLockFreeEventQueue;
             static const bool EventQueueingActiveByDefault = Traits::EventQueueingActiveByDefault;
             static const bool EnableQueuedReferences = Traits::EnableQueuedReferences;
 
@@ -829,13 +830,11 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
+                context.m_queue.Queue(
                     [func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
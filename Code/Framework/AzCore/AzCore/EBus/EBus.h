@@ -153,6 +153,16 @@ namespace AZ
          */
         static const bool EnableEventQueue = false;
 
+        /**
+         * Specifies whether the event queue is lock-free.
+         * Events are then queued without taking the #EventQueueMutexType, and each queued
+         * event is stored in a pooled message instead of its own allocation. Use this for buses
+         * that many threads queue events on, such as results that are sent back to the main thread.
+         * Queued events must still be executed from one thread at a time.
+         * Used only when #EnableEventQueue is true.
+         */
+        static const bool EnableLockFreeEventQueue = false;
+
         /**
          * Specifies whether the bus should accept queued messages by default or not.
          * If set to false, Bus::AllowFunctionQueuing(true) must be called before events are accepted.
@@ -440,7 +450,8 @@ namespace AZ
         /**
          * Policy for the function queue.
          */
-        using QueuePolicy = EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>;
+        using QueuePolicy = typename AZStd::Utils::if_c<Traits::EnableEventQueue && Traits::EnableLockFreeEventQueue,
+            EBusLockFreeQueuePolicy<ThisType>, EBusQueuePolicy<Traits::EnableEventQueue, ThisType, EventQueueMutexType>>::type;
 
         /**
          * Enables custom logic to run when a handler connects to
@@ -66,6 +66,19 @@ namespace AZ
             {
                 return MidDispatchDisconnectFixer<Bus, PreHandler, PostHandler>(context, busId, AZStd::forward<PreHandler>(remove), AZStd::forward<PostHandler>(post));
             }
+
+            // Returns the interface of the only handler in handlers, or nullptr if there are none or more than one
+            template <typename Interface, typename HandlerList>
+            Interface* FindSoleHandler(const HandlerList& handlers)
+            {
+                auto handlerIt = handlers.begin();
+                if (handlerIt == handlers.end())
+                {
+                    return nullptr;
+                }
+                auto nextIt = handlerIt;
+                return ++nextIt == handlers.end() ? handlerIt->m_interface : nullptr;
+            }
         }
 
 // Executes router handling in a generic way
@@ -122,6 +135,14 @@ namespace AZ
                         if (addressIt != addresses.end())
                         {
                             HandlerHolder& holder = *addressIt;
+                            if (Interface* soleHandler = holder.m_soleHandler)
+                            {
+                                // Only one handler is connected, call it directly instead of walking the handlers
+                                CallstackEntry entry(context, &id);
+                                Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                                return;
+                            }
+
                             holder.add_ref();
 
                             auto& handlers = holder.m_handlers;
@@ -165,6 +186,14 @@ namespace AZ
                         if (addressIt != addresses.end())
                         {
                             HandlerHolder& holder = *addressIt;
+                            if (Interface* soleHandler = holder.m_soleHandler)
+                            {
+                                // Only one handler is connected, call it directly instead of walking the handlers
+                                CallstackEntry entry(context, &id);
+                                Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                                return;
+                            }
+
                             holder.add_ref();
 
                             auto& handlers = holder.m_handlers;
@@ -264,6 +293,14 @@ namespace AZ
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if (Interface* soleHandler = busPtr->m_soleHandler)
+                        {
+                            // Only one handler is connected, call it directly instead of walking the handlers
+                            CallstackEntry entry(context, &busPtr->m_busId);
+                            Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                            return;
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -300,6 +337,14 @@ namespace AZ
 
                         EBUS_DO_ROUTING(*context, &busPtr->m_busId, false, false);
 
+                        if (Interface* soleHandler = busPtr->m_soleHandler)
+                        {
+                            // Only one handler is connected, call it directly instead of walking the handlers
+                            CallstackEntry entry(context, &busPtr->m_busId);
+                            Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                            return;
+                        }
+
                         auto& handlers = busPtr->m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -682,6 +727,8 @@ namespace AZ
                 ContainerType& m_busContainer;
                 IdType m_busId;
                 typename HandlerStorage::StorageType m_handlers;
+                // Set while exactly one handler is connected, so events to this address can skip walking m_handlers
+                Interface* m_soleHandler = nullptr;
                 AZStd::atomic_uint m_refCount{ 0 };
 
                 HandlerHolder(ContainerType& storage, const IdType& id)
@@ -693,7 +740,9 @@ namespace AZ
                     : m_busContainer(rhs.m_busContainer)
                     , m_busId(rhs.m_busId)
                     , m_handlers(AZStd::move(rhs.m_handlers))
+                    , m_soleHandler(rhs.m_soleHandler)
                 {
+                    rhs.m_soleHandler = nullptr;
                     m_refCount.store(rhs.m_refCount.load());
                     rhs.m_refCount.store(0);
                 }
@@ -744,6 +793,7 @@ namespace AZ
 
                 HandlerHolder& holder = FindOrCreateHandlerHolder(id);
                 holder.m_handlers.insert(handler);
+                holder.m_soleHandler = FindSoleHandler<Interface>(holder.m_handlers);
                 handler.m_holder = &holder;
             }
 
@@ -752,6 +802,7 @@ namespace AZ
                 EBUS_ASSERT(handler.m_holder, "Internal error: disconnecting handler that is incompletely connected");
 
                 handler.m_holder->m_handlers.erase(handler);
+                handler.m_holder->m_soleHandler = FindSoleHandler<Interface>(handler.m_holder->m_handlers);
 
                 // Must reset handler after removing it from the list, otherwise m_holder could have been destroyed already (and handlerList would be invalid)
                 handler.m_holder.reset();
@@ -1338,6 +1389,14 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if (Interface* soleHandler = context->m_buses.m_soleHandler)
+                        {
+                            // Only one handler is connected, call it directly instead of walking the handlers
+                            CallstackEntry entry(context, nullptr);
+                            Traits::EventProcessingPolicy::Call(AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                            return;
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1373,6 +1432,14 @@ namespace AZ
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
+                        if (Interface* soleHandler = context->m_buses.m_soleHandler)
+                        {
+                            // Only one handler is connected, call it directly instead of walking the handlers
+                            CallstackEntry entry(context, nullptr);
+                            Traits::EventProcessingPolicy::CallResult(results, AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...);
+                            return;
+                        }
+
                         auto& handlers = context->m_buses.m_handlers;
                         auto handlerIt = handlers.begin();
                         auto handlersEnd = handlers.end();
@@ -1487,15 +1554,19 @@ namespace AZ
             {
                 // Don't need to check for duplicates here, because BusConnect would have caught it already
                 m_handlers.insert(handler);
+                m_soleHandler = FindSoleHandler<Interface>(m_handlers);
             }
 
             void Disconnect(HandlerNode& handler)
             {
                 // Don't need to check that handler is already connected here, because BusDisconnect would have caught it already
                 m_handlers.erase(handler);
+                m_soleHandler = FindSoleHandler<Interface>(m_handlers);
             }
 
             typename HandlerStorage::StorageType m_handlers;
+            // Set while exactly one handler is connected, so broadcasts can skip walking m_handlers
+            Interface* m_soleHandler = nullptr;
         };
 
         // Specialization for single address, single handler
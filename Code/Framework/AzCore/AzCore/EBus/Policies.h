@@ -17,6 +17,9 @@
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/containers/lock_free_intrusive_stamped_stack.h>
+#include <AzCore/std/typetraits/aligned_storage.h>
 
 #include <AzCore/Module/Environment.h>
 #include <AzCore/EBus/Environment.h>
@@ -302,6 +305,199 @@ namespace AZ
             AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             return m_messages.size();
         }
+
+        template <class Callable>
+        void Queue(Callable&& callable)
+        {
+            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
+            m_messages.push(BusMessageCall(AZStd::forward<Callable>(callable), typename Bus::AllocatorType()));
+        }
+    };
+
+    /**
+     * Queue policy used when EBusTraits::EnableLockFreeEventQueue is set. Events are queued without taking a lock, so
+     * threads that queue events don't contend with each other or with the thread that executes them.
+     * Queued calls are constructed in pooled message nodes instead of an AZStd::function each. Calls that don't fit in
+     * the storage of a node are allocated separately. Nodes are reused once their call has executed and are only freed
+     * when the bus context is destroyed, so the memory of the queue stays at the highest number of events that were queued at once.
+     * Events can be queued from any number of threads, but only one thread at a time can execute them.
+     */
+    template <class Bus>
+    struct EBusLockFreeQueuePolicy
+    {
+        static constexpr size_t MessageStorageSize = 64;
+        static constexpr size_t MessageStorageAlignment = 16;
+
+        struct BusMessageCall
+            : public AZStd::lock_free_intrusive_stack_node<BusMessageCall>
+        {
+            using InvokeFunction = void(*)(void* /*callable*/);
+            using DestroyFunction = void(*)(void* /*callable*/);
+
+            BusMessageCall* m_nextMessage = nullptr;    ///< Next message in the list of queued messages.
+            BusMessageCall* m_nextAllocated = nullptr;  ///< Next message in the list of all messages owned by the queue.
+            void* m_callable = nullptr;
+            InvokeFunction m_invoke = nullptr;
+            DestroyFunction m_destroy = nullptr;
+            AZStd::aligned_storage_t<MessageStorageSize, MessageStorageAlignment> m_storage;
+        };
+
+        using FreeMessageStack = AZStd::lock_free_intrusive_stamped_stack<BusMessageCall, AZStd::lock_free_intrusive_stack_base_hook<BusMessageCall>>;
+
+        EBusLockFreeQueuePolicy() = default;
+        EBusLockFreeQueuePolicy(const EBusLockFreeQueuePolicy&) = delete;
+        EBusLockFreeQueuePolicy& operator=(const EBusLockFreeQueuePolicy&) = delete;
+
+        ~EBusLockFreeQueuePolicy()
+        {
+            Clear();
+
+            // Empty the free stack first, it still references the messages that are about to be freed.
+            while (m_freeMessages.pop())
+            {
+            }
+
+            BusMessageCall* message = m_allocatedMessages.load(AZStd::memory_order_acquire);
+            while (message)
+            {
+                BusMessageCall* next = message->m_nextAllocated;
+                message->~BusMessageCall();
+                typename Bus::AllocatorType().deallocate(message, sizeof(BusMessageCall), alignof(BusMessageCall));
+                message = next;
+            }
+        }
+
+        AZStd::atomic_bool                  m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        AZStd::atomic<BusMessageCall*>      m_messages{ nullptr };          ///< Queued messages, newest first.
+        AZStd::atomic<BusMessageCall*>      m_allocatedMessages{ nullptr }; ///< All messages allocated by the queue.
+        AZStd::atomic<size_t>               m_numMessages{ 0 };
+        FreeMessageStack                    m_freeMessages;                 ///< Messages that are available for reuse.
+
+        void Execute()
+        {
+            AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
+            // Take all queued messages at once. Messages that are queued while these execute are picked up by the next iteration.
+            while (BusMessageCall* message = TakeMessagesInOrder())
+            {
+                while (message)
+                {
+                    BusMessageCall* next = message->m_nextMessage;
+                    m_numMessages.fetch_sub(1, AZStd::memory_order_release);
+                    message->m_invoke(message->m_callable);
+                    ReleaseMessage(message);
+                    message = next;
+                }
+            }
+        }
+
+        void Clear()
+        {
+            BusMessageCall* message = TakeMessagesInOrder();
+            while (message)
+            {
+                BusMessageCall* next = message->m_nextMessage;
+                m_numMessages.fetch_sub(1, AZStd::memory_order_release);
+                ReleaseMessage(message);
+                message = next;
+            }
+        }
+
+        void SetActive(bool isActive)
+        {
+            m_isActive = isActive;
+            if (!isActive)
+            {
+                Clear();
+            }
+        }
+
+        bool IsActive()
+        {
+            return m_isActive;
+        }
+
+        size_t Count()
+        {
+            return m_numMessages.load(AZStd::memory_order_acquire);
+        }
+
+        template <class Callable>
+        void Queue(Callable&& callable)
+        {
+            using CallableType = AZStd::decay_t<Callable>;
+
+            BusMessageCall* message = AcquireMessage();
+            if constexpr (sizeof(CallableType) <= MessageStorageSize && alignof(CallableType) <= MessageStorageAlignment)
+            {
+                message->m_callable = new (&message->m_storage) CallableType(AZStd::forward<Callable>(callable));
+                message->m_destroy = [](void* callableObject)
+                {
+                    static_cast<CallableType*>(callableObject)->~CallableType();
+                };
+            }
+            else
+            {
+                void* memory = typename Bus::AllocatorType().allocate(sizeof(CallableType), alignof(CallableType));
+                message->m_callable = new (memory) CallableType(AZStd::forward<Callable>(callable));
+                message->m_destroy = [](void* callableObject)
+                {
+                    static_cast<CallableType*>(callableObject)->~CallableType();
+                    typename Bus::AllocatorType().deallocate(callableObject, sizeof(CallableType), alignof(CallableType));
+                };
+            }
+            message->m_invoke = [](void* callableObject)
+            {
+                (*static_cast<CallableType*>(callableObject))();
+            };
+
+            m_numMessages.fetch_add(1, AZStd::memory_order_release);
+            BusMessageCall* head = m_messages.load(AZStd::memory_order_relaxed);
+            do
+            {
+                message->m_nextMessage = head;
+            } while (!m_messages.compare_exchange_weak(head, message, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+    private:
+        BusMessageCall* AcquireMessage()
+        {
+            BusMessageCall* message = m_freeMessages.pop();
+            if (!message)
+            {
+                void* memory = typename Bus::AllocatorType().allocate(sizeof(BusMessageCall), alignof(BusMessageCall));
+                message = new (memory) BusMessageCall();
+
+                BusMessageCall* head = m_allocatedMessages.load(AZStd::memory_order_relaxed);
+                do
+                {
+                    message->m_nextAllocated = head;
+                } while (!m_allocatedMessages.compare_exchange_weak(head, message, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+            }
+            return message;
+        }
+
+        void ReleaseMessage(BusMessageCall* message)
+        {
+            message->m_destroy(message->m_callable);
+            message->m_callable = nullptr;
+            message->m_nextMessage = nullptr;
+            m_freeMessages.push(*message);
+        }
+
+        //! Removes all queued messages and returns them as a list, ordered from oldest to newest.
+        BusMessageCall* TakeMessagesInOrder()
+        {
+            BusMessageCall* message = m_messages.exchange(nullptr, AZStd::memory_order_acquire);
+            BusMessageCall* ordered = nullptr;
+            while (message)
+            {
+                BusMessageCall* next = message->m_nextMessage;
+                message->m_nextMessage = ordered;
+                ordered = message;
+                message = next;
+            }
+            return ordered;
+        }
     };
 
     /// @endcond
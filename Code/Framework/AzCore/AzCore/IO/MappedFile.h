@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    namespace IO
+    {
+        /**
+         * Maps the content of a file into memory for reading. The pages of the file are read by the OS as they're
+         * accessed, so the file doesn't need to be copied into a buffer first. The file can be modified or deleted
+         * while it's mapped, but the mapped content is undefined if the file is truncated.
+         */
+        class MappedFile
+        {
+        public:
+            MappedFile() = default;
+            ~MappedFile();
+            AZ_DISABLE_COPY_MOVE(MappedFile);
+
+            //! Maps the file at path into memory, closing the file that was previously mapped.
+            //! Returns false if the file can't be opened or mapped. Empty files can be mapped, but have no data.
+            bool Open(const char* path);
+            //! Unmaps the file, any pointer returned by GetData() becomes invalid.
+            void Close();
+
+            bool IsOpen() const
+            {
+                return m_isOpen;
+            }
+
+            //! Returns the mapped content of the file, or nullptr if no file is mapped or the file is empty.
+            const char* GetData() const
+            {
+                return m_data;
+            }
+
+            AZ::u64 GetSize() const
+            {
+                return m_size;
+            }
+
+        private:
+            const char* m_data = nullptr;
+            AZ::u64 m_size = 0;
+            bool m_isOpen = false;
+        };
+    } // namespace IO
+} // namespace AZ
@@ -180,6 +180,88 @@ namespace AZ
             AZ::IO::GenericStream* m_stream;
             AZStd::vector<AZ::u8> m_cache;
         };
+
+        /**
+         * For use with rapidjson::Reader. Reads the stream in blocks so documents can be parsed without
+         * loading the entire stream into memory first.
+         */
+        class RapidJSONStreamReader
+        {
+        public:
+            typedef char Ch;    //!< Character type. Only support char.
+
+            RapidJSONStreamReader(AZ::IO::GenericStream* stream, size_t readCacheSize = 64 * 1024)
+                : m_stream(stream)
+            {
+                m_cache.resize_no_construct(readCacheSize > 0 ? readCacheSize : 1);
+                m_current = m_cache.data();
+                m_end = m_current;
+                FillCache();
+            }
+
+            RapidJSONStreamReader(const RapidJSONStreamReader&) = delete;
+            RapidJSONStreamReader& operator=(const RapidJSONStreamReader&) = delete;
+
+            char Peek() const
+            {
+                return m_current < m_end ? *m_current : '\0';
+            }
+
+            char Take()
+            {
+                if (m_current < m_end)
+                {
+                    char c = *m_current++;
+                    if (m_current == m_end)
+                    {
+                        FillCache();
+                    }
+                    return c;
+                }
+                return '\0';
+            }
+
+            size_t Tell() const
+            {
+                return m_consumed + (m_current - m_cache.data());
+            }
+
+            // Not implemented
+            char* PutBegin()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutBegin not supported.");
+                return 0;
+            }
+            void Put(char)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Put not supported.");
+            }
+            void Flush()
+            {
+                AZ_Assert(false, "RapidJSONStreamReader Flush not supported.");
+            }
+            size_t PutEnd(char*)
+            {
+                AZ_Assert(false, "RapidJSONStreamReader PutEnd not supported.");
+                return 0;
+            }
+
+            AZ::IO::GenericStream* m_stream;
+            AZStd::vector<char> m_cache;
+
+        private:
+            void FillCache()
+            {
+                m_consumed += m_end - m_cache.data();
+                IO::SizeType bytes = m_stream->Read(m_cache.size(), m_cache.data());
+                m_current = m_cache.data();
+                m_end = m_current + bytes;
+            }
+
+            const char* m_current{ nullptr };
+            const char* m_end{ nullptr };
+            size_t m_consumed{ 0 };
+        };
     }   // namespace IO
 }   // namespace AZ
 
@@ -9,6 +9,8 @@
 
 #include <AzCore/Jobs/task_group.h>
 #include <AzCore/std/allocator_stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/sort.h>
 
 #include <AzCore/std/parallel/spin_mutex.h>
 
@@ -51,8 +53,8 @@ namespace AZ
 
             typedef ParallelForChunkJob<Function, Partition> ThisType;
 
-            ParallelForChunkJob(ParallelIndexType start, ParallelIndexType end, ParallelIndexType step, const Function& function,
-                ThisType* assisting, JobContext* jobContext, bool isAutoDelete)
+            ParallelForChunkJob(ParallelIndexType start, ParallelIndexType end, ParallelIndexType step, ParallelIndexType grainSize,
+                const Function& function, ThisType* assisting, JobContext* jobContext, bool isAutoDelete)
                 : Job(isAutoDelete, jobContext)
 #ifdef AZ_JOBS_CHUNK_JOB_RANGE_LOCK
                 , m_rangeLock(true)
@@ -60,6 +62,7 @@ namespace AZ
                 , m_current(start)
                 , m_end(end)
                 , m_step(step)
+                , m_grainSize(grainSize)
                 , m_function(function)
                 , m_assisting(assisting)
             {
@@ -80,8 +83,9 @@ namespace AZ
                                 AZStd::this_thread::pause(1);
                             }
 
+                            // don't steal less than the grain size, it's not worth the synchronization
                             numIterationsLeftToAssist = (m_assisting->m_end - m_assisting->m_current) / (2 * m_step);
-                            if (numIterationsLeftToAssist > 0)
+                            if (numIterationsLeftToAssist >= m_grainSize)
                             {
                                 m_current = m_assisting->m_current + numIterationsLeftToAssist * m_step;
                                 m_end = m_assisting->m_end;
@@ -107,9 +111,9 @@ namespace AZ
                         // As of now 2 is simpler and when tested did not give much of a difference.
 
                         // create another assistant on the stack.
-                        if (numIterationsLeftToAssist > 1)
+                        if (numIterationsLeftToAssist > m_grainSize)
                         {
-                            ThisType* newAssistant = new(AZ_ALLOCA(sizeof(ThisType)))ThisType(m_end, m_end, m_step, m_function, m_assisting, m_context, false);
+                            ThisType* newAssistant = new(AZ_ALLOCA(sizeof(ThisType)))ThisType(m_end, m_end, m_step, m_grainSize, m_function, m_assisting, m_context, false);
                             StartAsChild(newAssistant);
                         }
                     }
@@ -118,8 +122,8 @@ namespace AZ
                         // spawn a helper job (before we execute the first function)
                         // to assist if there are any workers available.
                         // This will make sure we have good load balance.
-                        ThisType assistChunkJob(m_end, m_end, m_step, m_function, this, m_context, false);
-                        if (m_end - m_current > 1)
+                        ThisType assistChunkJob(m_end, m_end, m_step, m_grainSize, m_function, this, m_context, false);
+                        if ((m_end - m_current) / m_step > m_grainSize)
                         {
                             StartAsChild(&assistChunkJob);
                         }
@@ -156,7 +160,7 @@ namespace AZ
                         // spawn a helper job (before we execute the first function)
                         // to assist if there are any workers available.
                         // This will make sure we have good load balance.
-                        ParallelForChunkJob<Function, Partition> assistChunkJob(m_end, m_end, step, m_function, this, m_context, false);
+                        ParallelForChunkJob<Function, Partition> assistChunkJob(m_end, m_end, step, m_grainSize, m_function, this, m_context, false);
                         if (m_end - currentElement > 1)
                         {
                             StartAsChild(&assistChunkJob);
@@ -194,6 +198,7 @@ namespace AZ
 #endif // #ifdef AZ_JOBS_CHUNK_JOB_RANGE_LOCK
             ParallelIndexType                   m_end;
             ParallelIndexType                   m_step;
+            ParallelIndexType                   m_grainSize;    ///< Minimum number of iterations an assisting job takes over.
             const Function&                     m_function;
             ThisType*                           m_assisting;    ///< Pointer to the ChunkJob we are assisting. Valid only for assisting chunk jobs.
         };
@@ -208,8 +213,8 @@ namespace AZ
         {
             ParallelIndexType numToProcess = end - start;
             ParallelIndexType numChunks = partition.GetNumChunks(numToProcess, jobContext);
-            // There is no real benefit creating bigger chunks by default
-            const ParallelIndexType minIterationsPerChunk = 1 /*8*/;
+            // There is no real benefit creating bigger chunks by default, unless the partition asks for a larger grain
+            const ParallelIndexType minIterationsPerChunk = partition.GetWorkGrain();
 
             ParallelIndexType numIterationsLeft = (numToProcess + step - 1) / step;
             ParallelIndexType numIterationsPerChunk = AZStd::GetMax(numIterationsLeft / numChunks, minIterationsPerChunk);
@@ -232,11 +237,11 @@ namespace AZ
                 ChunkJobType* chunkJob;
                 if (allocator)
                 {
-                    chunkJob = new(allocator->allocate(sizeof(ChunkJobType), AZStd::alignment_of<ChunkJobType>::value))ChunkJobType(index, index + (chunkIterations * step), step, function, nullptr, jobContext, false);
+                    chunkJob = new(allocator->allocate(sizeof(ChunkJobType), AZStd::alignment_of<ChunkJobType>::value))ChunkJobType(index, index + (chunkIterations * step), step, minIterationsPerChunk, function, nullptr, jobContext, false);
                 }
                 else
                 {
-                    chunkJob = aznew ChunkJobType(index, index + (chunkIterations * step), step, function, nullptr, jobContext, true);
+                    chunkJob = aznew ChunkJobType(index, index + (chunkIterations * step), step, minIterationsPerChunk, function, nullptr, jobContext, true);
                 }
 
                 chunkJob->SetDependent(dependent);
@@ -472,24 +477,36 @@ namespace AZ
 
     /**
      *   Default partition algorithms. It will create one chunk for each worker thread, it will spawn assisting jobs
-     *   for load balance (if iteration time is NOT the same) and we will process one task at a time
+     *   for load balance (if iteration time is NOT the same) and we will process one task at a time.
+     *   A grain size can be specified for very cheap iterations, no chunk or assisting job will process fewer
+     *   iterations than the grain size (except for the remainder of the range).
      **/
     struct auto_partitioner
     {
         static const bool s_isSpawnAssistJob = true;
 
+        auto_partitioner() = default;
+
+        explicit auto_partitioner(Internal::ParallelIndexType grainSize)
+            : m_grainSize(grainSize)
+        {
+            AZ_Assert(m_grainSize > 0, "Grain size must be > 0");
+        }
+
         // number of iterations we process at a time from a single job/thread.
-        inline Internal::ParallelIndexType GetWorkGrain()
+        inline Internal::ParallelIndexType GetWorkGrain() const
         {
-            return static_cast<Internal::ParallelIndexType>(1);
+            return m_grainSize;
         }
 
         // How many jobs/chucks to spawn for numElementsToProcess elements.
         inline Internal::ParallelIndexType GetNumChunks(Internal::ParallelIndexType numElementsToProcess, JobContext* jobContext) const
         {
-            (void)numElementsToProcess;
-            return static_cast<Internal::ParallelIndexType>(jobContext->GetJobManager().GetNumWorkerThreads());
+            const Internal::ParallelIndexType numWorkerThreads = static_cast<Internal::ParallelIndexType>(jobContext->GetJobManager().GetNumWorkerThreads());
+            return AZStd::GetMax<Internal::ParallelIndexType>(1, AZStd::GetMin(numWorkerThreads, numElementsToProcess / m_grainSize));
         }
+
+        Internal::ParallelIndexType m_grainSize = 1;
     };
 
     /**
@@ -499,6 +516,11 @@ namespace AZ
     {
         static const bool s_isSpawnAssistJob = false;
 
+        inline Internal::ParallelIndexType GetWorkGrain() const
+        {
+            return static_cast<Internal::ParallelIndexType>(1);
+        }
+
         inline Internal::ParallelIndexType GetNumChunks(Internal::ParallelIndexType numElementsToProcess, JobContext* jobContext) const
         {
             (void)numElementsToProcess;
@@ -519,6 +541,11 @@ namespace AZ
             AZ_Assert(m_chunkSize > 1, "Chunk size must be > 0");
         }
 
+        inline Internal::ParallelIndexType GetWorkGrain() const
+        {
+            return static_cast<Internal::ParallelIndexType>(1);
+        }
+
         inline Internal::ParallelIndexType GetNumChunks(Internal::ParallelIndexType numElementsToProcess, JobContext* jobContext) const
         {
             (void)jobContext;
@@ -766,6 +793,322 @@ namespace AZ
         group.run(f7);
         group.run_and_wait(f8);
     }
+
+    namespace Internal
+    {
+        /**
+         * Returns the grain size the parallel algorithms use when none is specified, it splits the range in a few
+         * chunks per worker thread, which is enough for the work stealing to balance the load.
+         */
+        inline ParallelIndexType GetDefaultGrainSize(ParallelIndexType numElements, JobContext* jobContext)
+        {
+            const ParallelIndexType numChunks = static_cast<ParallelIndexType>(jobContext->GetJobManager().GetNumWorkerThreads()) * 4;
+            return AZStd::GetMax<ParallelIndexType>(1, numElements / AZStd::GetMax<ParallelIndexType>(1, numChunks));
+        }
+
+        /**
+         * Runs the function inside a job, so the recursive algorithms below can always fork from the current job.
+         * If we are not in a job already, this thread will assist until the function is complete.
+         */
+        template<class Function>
+        inline void ParallelRunInJob(const Function& function, JobContext* jobContext)
+        {
+            if (jobContext->GetJobManager().GetCurrentJob())
+            {
+                function();
+            }
+            else
+            {
+                JobFunction<Function> rootJob(function, false, jobContext);
+                rootJob.StartAndWaitForCompletion();
+            }
+        }
+
+        /**
+         * Runs both functions as child jobs of the current job, and waits for them. Both are child jobs so a fork
+         * nested in one of them never waits for the jobs of its sibling.
+         */
+        template<class Function1, class Function2>
+        inline void ParallelFork(const Function1& function1, const Function2& function2, JobContext* jobContext)
+        {
+            Job* currentJob = jobContext->GetJobManager().GetCurrentJob();
+            AZ_Assert(currentJob, "ParallelFork must be called from a job, use ParallelRunInJob");
+
+            JobFunction<Function1> job1(function1, false, jobContext);
+            JobFunction<Function2> job2(function2, false, jobContext);
+            currentJob->StartAsChild(&job1);
+            currentJob->StartAsChild(&job2);
+            currentJob->WaitForChildren();
+        }
+
+        template<class T, class RangeFunction, class ReduceFunction>
+        T ParallelReduceRecursive(ParallelIndexType start, ParallelIndexType end, ParallelIndexType grainSize, const T& identity,
+            const RangeFunction& rangeFunction, const ReduceFunction& reduceFunction, JobContext* jobContext)
+        {
+            if (end - start <= grainSize)
+            {
+                return rangeFunction(start, end);
+            }
+
+            const ParallelIndexType mid = start + (end - start) / 2;
+            T left = identity;
+            T right = identity;
+            ParallelFork(
+                [&]() { left = ParallelReduceRecursive(start, mid, grainSize, identity, rangeFunction, reduceFunction, jobContext); },
+                [&]() { right = ParallelReduceRecursive(mid, end, grainSize, identity, rangeFunction, reduceFunction, jobContext); },
+                jobContext);
+            return reduceFunction(left, right);
+        }
+
+        template<class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+        void ParallelScan(RandomIterator first, RandomIterator last, OutputIterator result, const T& identity, const BinaryOperation& op,
+            bool isInclusive, ParallelIndexType grainSize, JobContext* jobContext)
+        {
+            const ParallelIndexType numElements = static_cast<ParallelIndexType>(last - first);
+            if (numElements == 0)
+            {
+                return;
+            }
+
+            const ParallelIndexType numBlocks = (numElements + grainSize - 1) / grainSize;
+
+            // Scans one block starting from the offset, and returns the total of the block
+            auto scanBlock = [&](ParallelIndexType blockIndex, T offset, bool writeResult) -> T
+            {
+                const ParallelIndexType blockEnd = AZStd::GetMin(numElements, (blockIndex + 1) * grainSize);
+                for (ParallelIndexType i = blockIndex * grainSize; i < blockEnd; ++i)
+                {
+                    // read the element before writing the result, so the scan can be done in place
+                    T next = op(offset, first[i]);
+                    if (writeResult)
+                    {
+                        result[i] = isInclusive ? next : offset;
+                    }
+                    offset = AZStd::move(next);
+                }
+                return offset;
+            };
+
+            if (numBlocks == 1)
+            {
+                scanBlock(0, identity, true);
+                return;
+            }
+
+            // First pass calculates the total of each block (except the last one, which isn't needed), the totals
+            // are scanned serially to the offset of each block, then the second pass scans the blocks in parallel.
+            AZStd::vector<T> blockOffsets(numBlocks, identity);
+            parallel_for(static_cast<ParallelIndexType>(0), numBlocks - 1,
+                [&](ParallelIndexType blockIndex) { blockOffsets[blockIndex + 1] = scanBlock(blockIndex, identity, false); }, jobContext);
+            for (ParallelIndexType blockIndex = 1; blockIndex < numBlocks; ++blockIndex)
+            {
+                blockOffsets[blockIndex] = op(blockOffsets[blockIndex - 1], blockOffsets[blockIndex]);
+            }
+            parallel_for(static_cast<ParallelIndexType>(0), numBlocks,
+                [&](ParallelIndexType blockIndex) { scanBlock(blockIndex, blockOffsets[blockIndex], true); }, jobContext);
+        }
+
+        /// Merges two sorted ranges by moving the elements to the output.
+        template<class InputIterator, class OutputIterator, class Compare>
+        void ParallelMergeSerial(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2, OutputIterator result, const Compare& comp)
+        {
+            for (; first1 != last1 && first2 != last2; ++result)
+            {
+                if (comp(*first2, *first1))
+                {
+                    *result = AZStd::move(*first2);
+                    ++first2;
+                }
+                else
+                {
+                    *result = AZStd::move(*first1);
+                    ++first1;
+                }
+            }
+            for (; first1 != last1; ++first1, ++result)
+            {
+                *result = AZStd::move(*first1);
+            }
+            for (; first2 != last2; ++first2, ++result)
+            {
+                *result = AZStd::move(*first2);
+            }
+        }
+
+        /**
+         * Merges two sorted ranges in parallel. The larger range is split in the middle, and the other range at the
+         * matching position, so both halves can be merged independently.
+         */
+        template<class InputIterator, class OutputIterator, class Compare>
+        void ParallelMerge(InputIterator first1, InputIterator last1, InputIterator first2, InputIterator last2, OutputIterator result,
+            const Compare& comp, ParallelIndexType grainSize, JobContext* jobContext)
+        {
+            const auto count1 = last1 - first1;
+            const auto count2 = last2 - first2;
+            if (count1 + count2 <= grainSize)
+            {
+                ParallelMergeSerial(first1, last1, first2, last2, result, comp);
+                return;
+            }
+
+            InputIterator mid1;
+            InputIterator mid2;
+            if (count1 >= count2)
+            {
+                mid1 = first1 + count1 / 2;
+                mid2 = AZStd::lower_bound(first2, last2, *mid1, comp);
+            }
+            else
+            {
+                mid2 = first2 + count2 / 2;
+                mid1 = AZStd::upper_bound(first1, last1, *mid2, comp);
+            }
+            OutputIterator resultMid = result + ((mid1 - first1) + (mid2 - first2));
+
+            ParallelFork(
+                [&]() { ParallelMerge(first1, mid1, first2, mid2, result, comp, grainSize, jobContext); },
+                [&]() { ParallelMerge(mid1, last1, mid2, last2, resultMid, comp, grainSize, jobContext); },
+                jobContext);
+        }
+
+        /**
+         * Merge sort which sorts both halves in parallel and merges them in parallel. The halves are sorted to the
+         * other buffer from the one the merged result is written to, so every level only moves the elements once.
+         */
+        template<class RandomIterator, class BufferIterator, class Compare>
+        void ParallelSortRecursive(RandomIterator first, RandomIterator last, BufferIterator buffer, bool isResultInBuffer,
+            const Compare& comp, ParallelIndexType grainSize, JobContext* jobContext)
+        {
+            const auto count = last - first;
+            if (count <= grainSize)
+            {
+                AZStd::sort(first, last, comp);
+                if (isResultInBuffer)
+                {
+                    for (; first != last; ++first, ++buffer)
+                    {
+                        *buffer = AZStd::move(*first);
+                    }
+                }
+                return;
+            }
+
+            const auto half = count / 2;
+            RandomIterator mid = first + half;
+            ParallelFork(
+                [&]() { ParallelSortRecursive(first, mid, buffer, !isResultInBuffer, comp, grainSize, jobContext); },
+                [&]() { ParallelSortRecursive(mid, last, buffer + half, !isResultInBuffer, comp, grainSize, jobContext); },
+                jobContext);
+
+            if (isResultInBuffer)
+            {
+                ParallelMerge(first, mid, mid, last, buffer, comp, grainSize, jobContext);
+            }
+            else
+            {
+                ParallelMerge(buffer, buffer + half, buffer + half, buffer + count, first, comp, grainSize, jobContext);
+            }
+        }
+    }
+
+    /**
+     * Parallel reduction of a range. The range is split recursively until the sub ranges are smaller than the grain
+     * size, each sub range is processed by rangeFunction, which has the signature T(ParallelIndexType start,
+     * ParallelIndexType end), and the results are combined with reduceFunction, which has the signature
+     * T(const T& left, const T& right). reduceFunction must be associative, the results are always combined in the
+     * same order, so the result doesn't depend on the scheduling of the jobs (even for floating point values).
+     * identity is returned for an empty range. This function will block until the reduction is complete. A grain size
+     * of 0 picks one based on the number of worker threads.
+     */
+    template<class IndexType, class T, class RangeFunction, class ReduceFunction>
+    T parallel_reduce(IndexType start, IndexType end, const T& identity, const RangeFunction& rangeFunction, const ReduceFunction& reduceFunction,
+        IndexType grainSize = 0, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(end - start);
+        if (numElements <= 0)
+        {
+            return identity;
+        }
+
+        const Internal::ParallelIndexType grain = grainSize > 0 ? static_cast<Internal::ParallelIndexType>(grainSize) : Internal::GetDefaultGrainSize(numElements, context);
+        if (numElements <= grain)
+        {
+            return rangeFunction(static_cast<Internal::ParallelIndexType>(start), static_cast<Internal::ParallelIndexType>(end));
+        }
+
+        T result = identity;
+        Internal::ParallelRunInJob([&]()
+        {
+            result = Internal::ParallelReduceRecursive(static_cast<Internal::ParallelIndexType>(start), static_cast<Internal::ParallelIndexType>(end),
+                grain, identity, rangeFunction, reduceFunction, context);
+        }, context);
+        return result;
+    }
+
+    /**
+     * Parallel inclusive prefix scan, result[i] = op(...op(op(identity, first[0]), first[1])..., first[i]). Works with
+     * random access iterators, and the result can be the input range. op must be associative. This function will
+     * block until the scan is complete. A grain size of 0 picks one based on the number of worker threads.
+     */
+    template<class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+    void parallel_inclusive_scan(RandomIterator first, RandomIterator last, OutputIterator result, const T& identity, const BinaryOperation& op,
+        Internal::ParallelIndexType grainSize = 0, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        Internal::ParallelScan(first, last, result, identity, op, true, grainSize > 0 ? grainSize : Internal::GetDefaultGrainSize(numElements, context), context);
+    }
+
+    /**
+     * Parallel exclusive prefix scan, same as \ref parallel_inclusive_scan, except result[i] doesn't include first[i],
+     * so result[0] is identity.
+     */
+    template<class RandomIterator, class OutputIterator, class T, class BinaryOperation>
+    void parallel_exclusive_scan(RandomIterator first, RandomIterator last, OutputIterator result, const T& identity, const BinaryOperation& op,
+        Internal::ParallelIndexType grainSize = 0, JobContext* jobContext = nullptr)
+    {
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        Internal::ParallelScan(first, last, result, identity, op, false, grainSize > 0 ? grainSize : Internal::GetDefaultGrainSize(numElements, context), context);
+    }
+
+    /**
+     * Parallel merge sort of a random access range. Sub ranges smaller than the grain size are sorted with
+     * AZStd::sort, and merged back in parallel. The sort is not stable. It uses a temporary buffer as large as the
+     * range, so the value type must be default constructible and move assignable. This function will block until the
+     * range is sorted. A grain size of 0 picks one based on the number of worker threads.
+     */
+    template<class RandomIterator, class Compare>
+    void parallel_sort(RandomIterator first, RandomIterator last, const Compare& comp, Internal::ParallelIndexType grainSize = 0, JobContext* jobContext = nullptr)
+    {
+        typedef typename AZStd::iterator_traits<RandomIterator>::value_type value_type;
+
+        // Below this size the overhead of the jobs and the extra moves is larger than the gain
+        const Internal::ParallelIndexType minGrainSize = 512;
+
+        JobContext* context = jobContext ? jobContext : JobContext::GetParentContext();
+        const Internal::ParallelIndexType numElements = static_cast<Internal::ParallelIndexType>(last - first);
+        const Internal::ParallelIndexType grain = grainSize > 0 ? AZStd::GetMax<Internal::ParallelIndexType>(grainSize, 2)
+            : AZStd::GetMax(Internal::GetDefaultGrainSize(numElements, context), minGrainSize);
+        if (numElements <= grain)
+        {
+            AZStd::sort(first, last, comp);
+            return;
+        }
+
+        AZStd::vector<value_type> buffer(numElements);
+        Internal::ParallelRunInJob([&]()
+        {
+            Internal::ParallelSortRecursive(first, last, buffer.begin(), false, comp, grain, context);
+        }, context);
+    }
+
+    template<class RandomIterator>
+    void parallel_sort(RandomIterator first, RandomIterator last, JobContext* jobContext = nullptr)
+    {
+        parallel_sort(first, last, AZStd::less<typename AZStd::iterator_traits<RandomIterator>::value_type>(), 0, jobContext);
+    }
 }
 
 #ifdef AZ_COMPILER_MSVC
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Platform implementation of the fibers JobManagerWorkStealing uses to suspend jobs, see JobManagerDesc::m_useFibers.
+         * A fiber is a stack with a saved register context. Switching between fibers is cooperative, and the fibers of a
+         * thread are only ever switched to on that thread.
+         */
+        namespace JobFiber
+        {
+            struct Context; ///< Defined by the platform implementation
+
+            using EntryFunction = void(*)(void* userData);
+
+            /// Returns false if fibers are not implemented on this platform, in which case all other functions fail.
+            bool IsSupported();
+
+            /// Converts the calling thread to a fiber, which is required before switching to other fibers on the thread.
+            Context* ConvertCurrentThread();
+
+            /// Converts the calling thread back from a fiber, the context must have been returned by ConvertCurrentThread on this thread.
+            void RevertCurrentThread(Context* threadContext);
+
+            /**
+             * Creates a fiber with its own stack, which calls entryFunction when it's first switched to. entryFunction must
+             * never return, it has to switch to another fiber instead. Returns nullptr if the fiber can't be created.
+             */
+            Context* Create(size_t stackSize, EntryFunction entryFunction, void* userData);
+
+            /// Destroys a fiber created with Create, the fiber must not be running.
+            void Destroy(Context* context);
+
+            /// Saves the state of the running fiber to 'from', and continues running 'to'.
+            void Switch(Context* from, Context* to);
+        }
+    }
+}
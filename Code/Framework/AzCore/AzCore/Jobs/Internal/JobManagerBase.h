@@ -17,6 +17,25 @@ namespace AZ
         {
         public:
             static const AZ::u32 InvalidWorkerThreadId = ~0u;
+
+            /**
+             * Jobs are queued separately per priority level, and a worker always takes the highest level job it can
+             * find, so long running low priority jobs can't delay frame critical ones which are queued behind them.
+             * Within a level jobs are ordered by their priority value, see Job::Job.
+             */
+            enum PriorityLevel
+            {
+                PriorityLevelHigh,      ///< priority > 0
+                PriorityLevelNormal,    ///< priority == 0, the default
+                PriorityLevelLow,       ///< priority < 0
+                PriorityLevelCount
+            };
+
+            static PriorityLevel GetPriorityLevel(AZ::s8 priority)
+            {
+                return priority > 0 ? PriorityLevelHigh : (priority == 0 ? PriorityLevelNormal : PriorityLevelLow);
+            }
+
         protected:
             void Process(Job* job);
         };
@@ -15,6 +15,7 @@
 #include <AzCore/std/functional.h>
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathIntrinsics.h>
 
 #ifdef JOBMANAGER_ENABLE_STATS
 #   include <stdio.h>
@@ -30,28 +31,51 @@ bool CompareJobPriorities(AZ::s8 value, const Job* job)
 
 void WorkQueue::LocalInsert(Job* job)
 {
+    const unsigned int level = JobManagerBase::GetPriorityLevel(job->GetPriority());
+
     LockGuard lock(m_lock);
-    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(m_queue.begin(),
-                                                                                   m_queue.end(),
+    AZStd::deque<Job*>& queue = m_queues[level];
+    const AZStd::deque<Job*>::const_iterator locationToinsert = AZStd::upper_bound(queue.begin(),
+                                                                                   queue.end(),
                                                                                    job->GetPriority(),
                                                                                    CompareJobPriorities);
-    m_queue.insert(locationToinsert, job);
+    queue.insert(locationToinsert, job);
+    m_pendingLevelMask.fetch_or(1u << level, AZStd::memory_order_release);
 }
 
 Job* WorkQueue::LocalPopFront()
 {
     LockGuard lock(m_lock);
+    return PopFrontNoLock();
+}
+
+Job* WorkQueue::PopFrontNoLock()
+{
+    //the mask is only changed while holding the lock, so it's exact here
+    const unsigned int pendingLevelMask = m_pendingLevelMask.load(AZStd::memory_order_relaxed);
+    if (pendingLevelMask == 0)
+    {
+        return nullptr;
+    }
 
-    Job* result = nullptr;
-    if (!m_queue.empty())
+    const unsigned int level = az_ctz_u32(pendingLevelMask);
+    AZStd::deque<Job*>& queue = m_queues[level];
+    Job* result = queue.front();
+    queue.pop_front();
+    if (queue.empty())
     {
-        result = m_queue.front();
-        m_queue.pop_front();
+        m_pendingLevelMask.fetch_and(~(1u << level), AZStd::memory_order_release);
     }
 
     return result;
 }
 
+unsigned int WorkQueue::GetHighestPendingLevel() const
+{
+    const unsigned int pendingLevelMask = m_pendingLevelMask.load(AZStd::memory_order_acquire);
+    return pendingLevelMask ? az_ctz_u32(pendingLevelMask) : JobManagerBase::PriorityLevelCount;
+}
+
 Job* WorkQueue::TryStealFront()
 {
     AZStd::exponential_backoff backoff;
@@ -60,13 +84,7 @@ Job* WorkQueue::TryStealFront()
         // Do a bounded spin with backoff to acquire the lock
         if (m_lock.try_lock())
         {
-            Job* result = nullptr;
-            if (!m_queue.empty())
-            {
-                result = m_queue.front();
-                m_queue.pop_front();
-            }
-
+            Job* result = PopFrontNoLock();
             m_lock.unlock();
             return result;
         }
@@ -84,6 +102,14 @@ JobManagerWorkStealing::JobManagerWorkStealing(const JobManagerDesc& desc)
     : m_isAsynchronous(!desc.m_workerThreads.empty())
     , m_workerThreads(AZStd::move(CreateWorkerThreads(desc.m_workerThreads)))
 {
+    SetAffinityMasks(desc.m_jobAffinityMasks);
+
+    AZ_Warning("JobManager", !desc.m_useFibers || JobFiber::IsSupported(),
+        "Fibers are not supported on this platform, jobs waiting for their children will process other jobs recursively instead");
+    m_useFibers = desc.m_useFibers && IsAsynchronous() && JobFiber::IsSupported();
+    m_fiberStackSize = desc.m_fiberStackSize;
+    m_maxFibersPerWorker = desc.m_maxFibersPerWorker;
+
     //allow workers to begin processing after they have all been created, needed to wait since they may access each others queues
     m_initSemaphore.release(static_cast<unsigned int>(desc.m_workerThreads.size()));
 }
@@ -122,6 +148,9 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
 #endif
 
     AZ_PROFILE_INTERVAL_START(AZ::Debug::ProfileCategory::JobManagerDetailed, job, "AzCore Job Queued Awaiting Execute");
+#ifdef JOBMANAGER_ENABLE_STATS
+    job->m_pendingTime = AZStd::GetTimeNowTicks();
+#endif
 
     if (job->IsCompletion())
     {
@@ -141,6 +170,19 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
 #endif
         }
     }
+    else if ((job->GetAffinityGroup() != JobManagerDesc::NoAffinityGroup) && IsAsynchronous())
+    {
+        //job with an affinity group, insert into the shared queue of the group, which only the threads in its affinity mask pop from
+        const AZ::u8 affinityGroup = job->GetAffinityGroup();
+        AZ_Assert(affinityGroup < m_numAffinityGroups, "Job affinity group %u has no affinity mask in the JobManagerDesc", affinityGroup);
+        const unsigned int queueIndex = (affinityGroup < m_numAffinityGroups) ? affinityGroup : GlobalQueueIndex;
+
+        AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+        InsertSharedJob(queueIndex, job);
+
+        //checking/changing shared queue empty state or worker availability must be done atomically while holding the global queue lock
+        ActivateWorker((queueIndex != GlobalQueueIndex) ? m_affinityWorkerMasks[queueIndex] : m_allWorkersMask);
+    }
     else if (info && info->m_isWorker && (info->m_owningManager == this))
     {
         //current thread is a worker, insert into the local queue based on the job's priority
@@ -157,11 +199,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         if (IsAsynchronous())
         {
             AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-            const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                       m_globalJobQueue.end(),
-                                                                                       job->GetPriority(),
-                                                                                       CompareJobPriorities);
-            m_globalJobQueue.insert(locationToinsert, job);
+            InsertSharedJob(GlobalQueueIndex, job);
 
             //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
             ActivateWorker();
@@ -170,11 +208,7 @@ void JobManagerWorkStealing::AddPendingJob(Job* job)
         {
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(m_globalJobQueue.begin(),
-                                                                                           m_globalJobQueue.end(),
-                                                                                           job->GetPriority(),
-                                                                                           CompareJobPriorities);
-                m_globalJobQueue.insert(locationToinsert, job);
+                InsertSharedJob(GlobalQueueIndex, job);
             }
 
             //no workers, so must process the jobs right now
@@ -195,7 +229,14 @@ void JobManagerWorkStealing::SuspendJobUntilReady(Job* job)
 
     if (IsAsynchronous())
     {
-        ProcessJobsAssist(info, job, NULL);
+        if (info->m_currentFiber)
+        {
+            ParkJobUntilReady(info, job);
+        }
+        else
+        {
+            ProcessJobsAssist(info, job, NULL);
+        }
     }
     else
     {
@@ -245,6 +286,12 @@ void JobManagerWorkStealing::ClearStats()
         info->m_jobsStolen = 0;
         info->m_jobTime = 0;
         info->m_stealTime = 0;
+        for (unsigned int level = 0; level < PriorityLevelCount; ++level)
+        {
+            info->m_levelJobsDone[level] = 0;
+            info->m_levelLatency[level] = 0;
+            info->m_levelMaxLatency[level] = 0;
+        }
     }
 #endif
 }
@@ -266,6 +313,28 @@ void JobManagerWorkStealing::PrintStats()
             i, info->m_globalJobs, info->m_jobsForked, info->m_jobsDone, info->m_jobsStolen, jobTime, stealTime, jobTime + stealTime);
         printf(str);
     }
+
+    static const char* levelNames[PriorityLevelCount] = { "High", "Normal", "Low" };
+    printf("\n");
+    printf("Priority   Jobs done   Average latency (ms)   Max latency (ms)\n");
+    printf("--------   ----------  --------------------   ----------------\n");
+    for (unsigned int level = 0; level < PriorityLevelCount; ++level)
+    {
+        unsigned int jobsDone = 0;
+        u64 latency = 0;
+        u64 maxLatency = 0;
+        for (const ThreadInfo* info : m_threads)
+        {
+            jobsDone += info->m_levelJobsDone[level];
+            latency += info->m_levelLatency[level];
+            maxLatency = AZStd::max(maxLatency, info->m_levelMaxLatency[level]);
+        }
+        double averageLatencyTime = jobsDone ? 1000.0 * static_cast<double>(latency) / jobsDone / AZStd::GetTimeTicksPerSecond() : 0.0;
+        double maxLatencyTime = 1000.0 * static_cast<double>(maxLatency) / AZStd::GetTimeTicksPerSecond();
+        azsnprintf(str, AZ_ARRAY_SIZE(str), " %-6s       %5d           %3.3f                  %3.3f\n",
+            levelNames[level], jobsDone, averageLatencyTime, maxLatencyTime);
+        printf(str);
+    }
 #endif
 }
 
@@ -305,8 +374,30 @@ void JobManagerWorkStealing::ProcessJobsWorker(ThreadInfo* info)
     //setup thread-local storage
     m_currentThreadInfo = info;
 
+    if (m_useFibers)
+    {
+        //if the thread can't be converted jobs on this worker will process other jobs recursively while waiting
+        info->m_threadFiber = JobFiber::ConvertCurrentThread();
+        info->m_currentFiber = info->m_threadFiber;
+    }
+
     ProcessJobsInternal(info, NULL, NULL);
 
+    if (info->m_threadFiber)
+    {
+        AZ_Assert(info->m_currentFiber == info->m_threadFiber, "Worker must exit on its own fiber");
+        AZ_Assert(info->m_parkedFibers.empty(), "Job manager is destroyed while jobs are waiting for their children");
+        for (JobFiber::Context* fiber : info->m_fibers)
+        {
+            JobFiber::Destroy(fiber);
+        }
+        info->m_fibers.clear();
+        info->m_idleFibers.clear();
+        JobFiber::RevertCurrentThread(info->m_threadFiber);
+        info->m_threadFiber = nullptr;
+        info->m_currentFiber = nullptr;
+    }
+
     m_currentThreadInfo = NULL;
 }
 
@@ -326,6 +417,9 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
 
     //get thread local job queue
     WorkQueue* pendingJobs = info->m_isWorker ? &info->m_pendingJobs : nullptr;
+    //when assisting, this fiber still holds the stack of the waiting job, so it can't switch to a parked job which is
+    //ready. It would be put on the idle list and the waiting job would only continue once another job parks
+    const bool canResumeParkedFibers = !suspendedJob && !notifyFlag;
     unsigned int victim = ((m_workerThreads.size() > 1) && (m_workerThreads[0] == info)) ? 1 : 0;
 
     while (true)
@@ -352,7 +446,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 {
                     //checking/changing global queue empty state or worker availability must be done atomically while holding the global queue lock
                     AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                    if (m_globalJobQueue.empty())
+                    if (!HasSharedJob(info, PriorityLevelCount - 1) && !(canResumeParkedFibers && HasReadyFiber(info)))
                     {
                         shouldSleep = true;
 
@@ -386,22 +480,26 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                 return;
             }
 
+            //a parked job which is ready to resume takes precedence over starting new jobs, when this fiber is resumed itself
+            //it continues looking for jobs
+            if (canResumeParkedFibers && !info->m_parkedFibers.empty())
+            {
+                ResumeReadyFiber(info);
+            }
+
+            //take the highest priority job from the shared queues, unless the local queue has a job of a higher priority level
+            const unsigned int localLevel = pendingJobs ? pendingJobs->GetHighestPendingLevel() : PriorityLevelCount;
+            const unsigned int lowestSharedLevel = AZStd::min<unsigned int>(localLevel, PriorityLevelCount - 1);
+            if (HasSharedJob(info, lowestSharedLevel))
             {
                 AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
-                if (!m_globalJobQueue.empty())
-                {
-                    job = m_globalJobQueue.front();
-                    m_globalJobQueue.pop_front();
-#ifdef JOBMANAGER_ENABLE_STATS
-                    ++info->m_globalJobs;
-#endif
-                }
+                job = PopSharedJob(info, lowestSharedLevel);
             }
         }
 
         if (!job && pendingJobs)
         {
-            //nothing on the global queue, try to pop from the local queue
+            //nothing on the shared queues, try to pop from the local queue
             job = pendingJobs->LocalPopFront();
         }
 
@@ -414,9 +512,7 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
             //run current job and jobs from the local queue until it is empty
             while (job)
             {
-                info->m_currentJob = job;
-                Process(job);
-                info->m_currentJob = nullptr;
+                ProcessJob(info, job);
 
                 //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -429,8 +525,24 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                     return;
                 }
 
-                //pop a new job from the local queue
-                if (pendingJobs)
+                //resume a parked job if its children are done, before starting new jobs
+                if (canResumeParkedFibers && !info->m_parkedFibers.empty())
+                {
+                    ResumeReadyFiber(info);
+                }
+
+                //pop a new job from the shared queues if they have a job of a higher priority level than the local queue,
+                //so frame critical jobs don't wait until all the lower priority jobs forked by this thread are done
+                job = nullptr;
+                const unsigned int localLevel = pendingJobs ? pendingJobs->GetHighestPendingLevel() : PriorityLevelCount;
+                if ((localLevel > 0) && HasSharedJob(info, localLevel - 1))
+                {
+                    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+                    job = PopSharedJob(info, localLevel - 1);
+                }
+
+                //otherwise pop a new job from the local queue
+                if (!job && pendingJobs)
                 {
                     job = pendingJobs->LocalPopFront();
                     if (job)
@@ -439,10 +551,6 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         ActivateWorker();
                     }
                 }
-                else
-                {
-                    job = nullptr;
-                }
             }
 
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -469,7 +577,8 @@ void JobManagerWorkStealing::ProcessJobsInternal(ThreadInfo* info, Job* suspende
                         return;
                     }
 
-                    //select a victim thread, using the same victim as the previous successful steal if possible
+                    //select a victim thread with the highest priority jobs, using the same victim as the previous successful steal if possible
+                    victim = SelectStealVictim(info, victim);
                     WorkQueue* victimQueue = &m_workerThreads[victim]->m_pendingJobs;
 
                     //attempt the steal
@@ -521,14 +630,19 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     ThreadInfo* oldInfo = m_currentThreadInfo;
     m_currentThreadInfo = info;
 
-    while (!m_globalJobQueue.empty())
+    while (true)
     {
-        Job* job = m_globalJobQueue.front();
-        m_globalJobQueue.pop_front();
+        Job* job = nullptr;
+        {
+            AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+            job = PopSharedJob(info, PriorityLevelCount - 1);
+        }
+        if (!job)
+        {
+            break;
+        }
 
-        info->m_currentJob = job;
-        Process(job);
-        info->m_currentJob = NULL;
+        ProcessJob(info, job);
 
         //...after calling Process we cannot use the job pointer again, the job has completed and may not exist anymore
 #ifdef JOBMANAGER_ENABLE_STATS
@@ -545,6 +659,209 @@ void JobManagerWorkStealing::ProcessJobsSynchronous(ThreadInfo* info, Job* suspe
     m_currentThreadInfo = oldInfo; //restore previous ThreadInfo, necessary as must be NULL when returning to user code to support multiple job contexts
 }
 
+void JobManagerWorkStealing::ProcessJob(ThreadInfo* info, Job* job)
+{
+#ifdef JOBMANAGER_ENABLE_STATS
+    const unsigned int level = GetPriorityLevel(job->GetPriority());
+    const u64 latency = static_cast<u64>(AZStd::GetTimeNowTicks()) - job->m_pendingTime;
+    ++info->m_levelJobsDone[level];
+    info->m_levelLatency[level] += latency;
+    info->m_levelMaxLatency[level] = AZStd::max(info->m_levelMaxLatency[level], latency);
+#endif
+
+    info->m_currentJob = job;
+    Process(job);
+    info->m_currentJob = nullptr;
+}
+
+void JobManagerWorkStealing::FiberMain(void* userData)
+{
+    JobManagerWorkStealing* manager = static_cast<JobManagerWorkStealing*>(userData);
+    ThreadInfo* info = m_currentThreadInfo; //fibers never leave the worker thread which created them
+
+    manager->ProcessJobsInternal(info, nullptr, nullptr);
+
+    //quit was requested, continue on the thread's own fiber so the worker can exit, this fiber is never resumed
+    manager->SwitchFiber(info, info->m_threadFiber);
+}
+
+void JobManagerWorkStealing::SwitchFiber(ThreadInfo* info, JobFiber::Context* fiber)
+{
+    JobFiber::Context* currentFiber = info->m_currentFiber;
+    info->m_currentFiber = fiber;
+    JobFiber::Switch(currentFiber, fiber);
+}
+
+void JobManagerWorkStealing::ParkJobUntilReady(ThreadInfo* info, Job* job)
+{
+    if (job->GetDependentCount() == 0)
+    {
+        return; //the children are already done
+    }
+
+    JobFiber::Context* nextFiber = nullptr;
+    if (!info->m_idleFibers.empty())
+    {
+        nextFiber = info->m_idleFibers.back();
+        info->m_idleFibers.pop_back();
+    }
+    else
+    {
+        const bool isFiberLimitReached = (m_maxFibersPerWorker != 0) && (info->m_fibers.size() >= m_maxFibersPerWorker);
+        nextFiber = isFiberLimitReached ? nullptr : JobFiber::Create(m_fiberStackSize, &FiberMain, this);
+        if (!nextFiber)
+        {
+            //out of fibers, fall back to processing other jobs on this stack. Parked jobs are not resumed until it returns
+            ProcessJobsAssist(info, job, nullptr);
+            return;
+        }
+        info->m_fibers.push_back(nextFiber);
+    }
+
+    //the job is parked before checking if its children are done, so the completion of the last child either happens
+    //before the check on the next fiber, or it sees this worker in m_parkedWorkerMask and wakes it
+    info->m_parkedFibers.push_back({ info->m_currentFiber, job });
+    m_parkedWorkerMask.fetch_or(AZ::u64(1) << info->m_workerId, AZStd::memory_order_seq_cst);
+
+    //continue processing jobs on the next fiber, ResumeReadyFiber switches back once the children of the job are done
+    SwitchFiber(info, nextFiber);
+}
+
+bool JobManagerWorkStealing::ResumeReadyFiber(ThreadInfo* info)
+{
+    for (size_t i = 0; i < info->m_parkedFibers.size(); ++i)
+    {
+        if (info->m_parkedFibers[i].m_job->GetDependentCount() == 0)
+        {
+            JobFiber::Context* readyFiber = info->m_parkedFibers[i].m_fiber;
+            info->m_parkedFibers.erase(info->m_parkedFibers.begin() + i);
+            if (info->m_parkedFibers.empty())
+            {
+                m_parkedWorkerMask.fetch_and(~(AZ::u64(1) << info->m_workerId), AZStd::memory_order_seq_cst);
+            }
+
+            //this fiber is between jobs, so it can be reused by the next job which waits for its children
+            info->m_idleFibers.push_back(info->m_currentFiber);
+            SwitchFiber(info, readyFiber);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool JobManagerWorkStealing::HasReadyFiber(const ThreadInfo* info) const
+{
+    for (const ThreadInfo::ParkedFiber& parkedFiber : info->m_parkedFibers)
+    {
+        if (parkedFiber.m_job->GetDependentCount() == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void JobManagerWorkStealing::WakeParkedWorkers()
+{
+    //workers check for ready fibers while holding the global queue lock before becoming available, so holding it here
+    //guarantees a worker which missed the completion of the children is woken
+    AZStd::lock_guard<GlobalQueueMutexType> lock(m_globalJobQueueMutex);
+    const AZ::u64 parkedWorkerMask = m_parkedWorkerMask.load(AZStd::memory_order_acquire);
+    for (size_t i = 0; i < m_workerThreads.size(); ++i)
+    {
+        ThreadInfo* info = m_workerThreads[i];
+        if ((parkedWorkerMask & (AZ::u64(1) << i)) && info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel))
+        {
+            m_numAvailableWorkers.fetch_sub(1, AZStd::memory_order_acq_rel);
+            info->m_waitEvent.release();
+        }
+    }
+}
+
+AZ::u64 JobManagerWorkStealing::GetSharedQueueMask(unsigned int queueIndex)
+{
+    AZ::u64 mask = 0;
+    for (unsigned int level = 0; level < PriorityLevelCount; ++level)
+    {
+        mask |= AZ::u64(1) << (level * SharedQueueCount + queueIndex);
+    }
+    return mask;
+}
+
+AZ::u64 JobManagerWorkStealing::GetSharedLevelsMask(unsigned int lowestLevel)
+{
+    //the bits of all the shared queues for the priority levels up to and including lowestLevel
+    return (AZ::u64(1) << ((lowestLevel + 1) * SharedQueueCount)) - 1;
+}
+
+void JobManagerWorkStealing::InsertSharedJob(unsigned int queueIndex, Job* job)
+{
+    const unsigned int level = GetPriorityLevel(job->GetPriority());
+    GlobalJobQueue& queue = m_sharedJobQueues[queueIndex][level];
+    const GlobalJobQueue::const_iterator locationToinsert = AZStd::upper_bound(queue.begin(),
+                                                                               queue.end(),
+                                                                               job->GetPriority(),
+                                                                               CompareJobPriorities);
+    queue.insert(locationToinsert, job);
+    m_sharedPendingMask.fetch_or(AZ::u64(1) << (level * SharedQueueCount + queueIndex), AZStd::memory_order_release);
+}
+
+Job* JobManagerWorkStealing::PopSharedJob(ThreadInfo* info, unsigned int lowestLevel)
+{
+    //the mask is only changed while holding the global queue lock, so it's exact here
+    const AZ::u64 pendingMask = m_sharedPendingMask.load(AZStd::memory_order_relaxed) & info->m_sharedQueueMask & GetSharedLevelsMask(lowestLevel);
+    if (pendingMask == 0)
+    {
+        return nullptr;
+    }
+
+    //the lowest bit is the highest priority level, and the affinity group queues come before the global queue within a level
+    const unsigned int bit = static_cast<unsigned int>(az_ctz_u64(pendingMask));
+    GlobalJobQueue& queue = m_sharedJobQueues[bit % SharedQueueCount][bit / SharedQueueCount];
+    Job* job = queue.front();
+    queue.pop_front();
+    if (queue.empty())
+    {
+        m_sharedPendingMask.fetch_and(~(AZ::u64(1) << bit), AZStd::memory_order_release);
+    }
+#ifdef JOBMANAGER_ENABLE_STATS
+    ++info->m_globalJobs;
+#endif
+
+    return job;
+}
+
+bool JobManagerWorkStealing::HasSharedJob(const ThreadInfo* info, unsigned int lowestLevel) const
+{
+    return (m_sharedPendingMask.load(AZStd::memory_order_acquire) & info->m_sharedQueueMask & GetSharedLevelsMask(lowestLevel)) != 0;
+}
+
+unsigned int JobManagerWorkStealing::SelectStealVictim(const ThreadInfo* info, unsigned int victim) const
+{
+    //prefer the thread with the highest priority jobs, starting the search at the previous victim so it's kept among equals
+    const unsigned int numWorkerThreads = static_cast<unsigned int>(m_workerThreads.size());
+    unsigned int bestVictim = victim;
+    unsigned int bestLevel = PriorityLevelCount;
+    for (unsigned int i = 0; (i < numWorkerThreads) && (bestLevel != PriorityLevelHigh); ++i)
+    {
+        const unsigned int candidate = (victim + i) % numWorkerThreads;
+        if (m_workerThreads[candidate] == info)
+        {
+            continue;
+        }
+
+        const unsigned int level = m_workerThreads[candidate]->m_pendingJobs.GetHighestPendingLevel();
+        if (level < bestLevel)
+        {
+            bestLevel = level;
+            bestVictim = candidate;
+        }
+    }
+
+    return bestVictim;
+}
+
 JobManagerWorkStealing::ThreadInfo* JobManagerWorkStealing::GetCurrentOrCreateThreadInfo()
 {
     ThreadInfo* info = m_currentThreadInfo;
@@ -659,13 +976,44 @@ JobManagerWorkStealing::ThreadList JobManagerWorkStealing::CreateWorkerThreads(c
     return workerThreads;
 }
 
-inline void JobManagerWorkStealing::ActivateWorker()
+void JobManagerWorkStealing::SetAffinityMasks(const JobManagerDesc::AffinityMaskList& affinityMaskList)
+{
+    m_allWorkersMask = (m_workerThreads.size() < 64) ? (AZ::u64(1) << m_workerThreads.size()) - 1 : ~AZ::u64(0);
+    m_numAffinityGroups = static_cast<unsigned int>(affinityMaskList.size());
+
+    for (unsigned int affinityGroup = 0; affinityGroup < m_numAffinityGroups; ++affinityGroup)
+    {
+        AZ::u64 workerMask = affinityMaskList[affinityGroup] & m_allWorkersMask;
+        if (workerMask == 0 && !m_workerThreads.empty())
+        {
+            AZ_Error("JobManager", false, "Job affinity mask 0x%llx of group %u has no worker threads, jobs of the group will run on any worker thread",
+                static_cast<unsigned long long>(affinityMaskList[affinityGroup]), affinityGroup);
+            workerMask = m_allWorkersMask;
+        }
+        m_affinityWorkerMasks[affinityGroup] = workerMask;
+
+        for (size_t i = 0; i < m_workerThreads.size(); ++i)
+        {
+            if (workerMask & (AZ::u64(1) << i))
+            {
+                m_workerThreads[i]->m_sharedQueueMask |= GetSharedQueueMask(affinityGroup);
+            }
+        }
+    }
+}
+
+inline void JobManagerWorkStealing::ActivateWorker(AZ::u64 workerMask)
 {
     // find an available worker thread (we do it brute force because the number of threads is small)
     while (m_numAvailableWorkers.load(AZStd::memory_order_acquire) > 0)
     {
         for (size_t i = 0; i < m_workerThreads.size(); ++i)
         {
+            if ((workerMask & (AZ::u64(1) << i)) == 0)
+            {
+                continue;
+            }
+
             ThreadInfo* info = m_workerThreads[i];
             if (info->m_isAvailable.exchange(false, AZStd::memory_order_acq_rel) == true)
             {
@@ -678,6 +1026,14 @@ inline void JobManagerWorkStealing::ActivateWorker()
                 return;
             }
         }
+
+        if ((m_allWorkersMask & ~workerMask) != 0)
+        {
+            // only some of the workers can run the job and none of them is available. Jobs with an affinity group are queued
+            // while holding the global queue lock, which the workers also hold while becoming available, so unlike the
+            // unmasked case we don't need to wait for a worker that is about to become available.
+            return;
+        }
     }
 }
 
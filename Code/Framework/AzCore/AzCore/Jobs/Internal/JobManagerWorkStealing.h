@@ -9,6 +9,7 @@
 
 // Included directly from JobManager.h
 
+#include <AzCore/Jobs/Internal/JobFiber.h>
 #include <AzCore/Jobs/Internal/JobManagerBase.h>
 #include <AzCore/Jobs/JobManagerDesc.h>
 #include <AzCore/Memory/PoolAllocator.h>
@@ -26,6 +27,10 @@ namespace AZ
 
     namespace Internal
     {
+        /**
+         * The local queue of a worker thread, with a separate deque per priority level. Jobs are always popped and
+         * stolen from the highest priority level which has any jobs.
+         */
         class WorkQueue final
         {
         public:
@@ -33,6 +38,12 @@ namespace AZ
             Job* LocalPopFront();
             Job* TryStealFront();
 
+            /**
+             * Returns the highest priority level which has any jobs, or PriorityLevelCount if the queue is empty.
+             * This doesn't lock the queue, so it's only a hint when called from another thread.
+             */
+            unsigned int GetHighestPendingLevel() const;
+
         private:
             enum
             {
@@ -41,7 +52,10 @@ namespace AZ
             using LockType = AZStd::shared_mutex;
             using LockGuard = AZStd::lock_guard<LockType>;
 
-            AZStd::deque<Job*> m_queue;
+            Job* PopFrontNoLock();
+
+            AZStd::deque<Job*> m_queues[JobManagerBase::PriorityLevelCount];
+            AZStd::atomic_uint m_pendingLevelMask{0}; //bit N is set if m_queues[N] is not empty
             LockType m_lock;
         };
 
@@ -62,12 +76,27 @@ namespace AZ
 
             AZ_FORCE_INLINE bool IsAsynchronous() const { return m_isAsynchronous; }
 
+            AZ_FORCE_INLINE bool IsUsingFibers() const { return m_useFibers; }
+
             void AddPendingJob(Job* job);
 
             void SuspendJobUntilReady(Job* job);
 
             void StartJobAndAssistUntilComplete(Job* job);
 
+            AZ_FORCE_INLINE void NotifyChildJobsComplete()
+            {
+                if (m_useFibers)
+                {
+                    //orders the completion of the last child before the check for parked fibers, see ParkJobUntilReady
+                    AZStd::atomic_thread_fence(AZStd::memory_order_seq_cst);
+                    if (m_parkedWorkerMask.load(AZStd::memory_order_relaxed) != 0)
+                    {
+                        WakeParkedWorkers();
+                    }
+                }
+            }
+
             void ClearStats();
             void PrintStats();
 
@@ -81,7 +110,25 @@ namespace AZ
 
         private:
 
-            void ActivateWorker();
+            /**
+             * Jobs which are not added by a worker of this job manager go to a shared queue, which all the threads
+             * serving it pop from while holding m_globalJobQueueMutex. There is a shared queue for each affinity group,
+             * served only by the worker threads in its affinity mask, followed by the global queue served by all threads.
+             * Whether a shared queue has jobs of a priority level is tracked in m_sharedPendingMask, at bit
+             * (level * SharedQueueCount + queue index), so a thread can find the highest priority shared job it may
+             * run with a single bit scan of (m_sharedPendingMask & ThreadInfo::m_sharedQueueMask).
+             */
+            enum
+            {
+                SharedQueueCount = JobManagerDesc::MaxAffinityGroups + 1,
+                GlobalQueueIndex = JobManagerDesc::MaxAffinityGroups,
+            };
+            static_assert(SharedQueueCount * PriorityLevelCount <= 64, "Shared queue pending bits must fit in 64 bits");
+
+            static AZ::u64 GetSharedQueueMask(unsigned int queueIndex);
+            static AZ::u64 GetSharedLevelsMask(unsigned int lowestLevel);
+
+            void ActivateWorker(AZ::u64 workerMask = ~AZ::u64(0));
 
             struct ThreadInfo
             {
@@ -98,6 +145,19 @@ namespace AZ
                 AZStd::binary_semaphore m_waitEvent;
                 WorkQueue m_pendingJobs;
                 unsigned int m_workerId = JobManagerBase::InvalidWorkerThreadId;
+                AZ::u64 m_sharedQueueMask = GetSharedQueueMask(GlobalQueueIndex); //shared queues served by this thread, for all priority levels
+
+                // fiber state, only used on workers when fibers are enabled, and only accessed by the worker itself
+                struct ParkedFiber
+                {
+                    JobFiber::Context* m_fiber;
+                    Job* m_job; //job waiting for its children on m_fiber
+                };
+                JobFiber::Context* m_threadFiber = nullptr; //the fiber of the thread itself
+                JobFiber::Context* m_currentFiber = nullptr; //the fiber running on the thread, nullptr if fibers are not used
+                AZStd::vector<ParkedFiber> m_parkedFibers;
+                AZStd::vector<JobFiber::Context*> m_idleFibers; //fibers which are ready to continue the job processing loop
+                AZStd::vector<JobFiber::Context*> m_fibers; //all fibers created for this thread
 
 #ifdef JOBMANAGER_ENABLE_STATS
                 unsigned int m_globalJobs = 0;
@@ -106,6 +166,9 @@ namespace AZ
                 unsigned int m_jobsStolen = 0;
                 u64 m_jobTime = 0;
                 u64 m_stealTime = 0;
+                unsigned int m_levelJobsDone[PriorityLevelCount] = {};
+                u64 m_levelLatency[PriorityLevelCount] = {}; //total time jobs waited from being added until being processed
+                u64 m_levelMaxLatency[PriorityLevelCount] = {};
 #endif
             };
             using ThreadList = AZStd::vector<ThreadInfo*>;
@@ -114,7 +177,25 @@ namespace AZ
             void ProcessJobsAssist(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsSynchronous(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
             void ProcessJobsInternal(ThreadInfo* info, Job* suspendedJob, AZStd::atomic<bool>* notifyFlag);
+            void ProcessJob(ThreadInfo* info, Job* job);
+
+            //fiber functions, see JobManagerDesc::m_useFibers
+            static void FiberMain(void* userData);
+            void SwitchFiber(ThreadInfo* info, JobFiber::Context* fiber);
+            void ParkJobUntilReady(ThreadInfo* info, Job* job);
+            bool ResumeReadyFiber(ThreadInfo* info);
+            bool HasReadyFiber(const ThreadInfo* info) const;
+            void WakeParkedWorkers();
             ThreadList CreateWorkerThreads(const JobManagerDesc::DescList& workerDescList);
+            void SetAffinityMasks(const JobManagerDesc::AffinityMaskList& affinityMaskList);
+
+            //shared queue functions, lowestLevel is the lowest priority level considered. Inserting and popping requires
+            //holding m_globalJobQueueMutex, HasSharedJob can be used without it as a hint to avoid taking the lock.
+            void InsertSharedJob(unsigned int queueIndex, Job* job);
+            Job* PopSharedJob(ThreadInfo* info, unsigned int lowestLevel);
+            bool HasSharedJob(const ThreadInfo* info, unsigned int lowestLevel) const;
+
+            unsigned int SelectStealVictim(const ThreadInfo* info, unsigned int victim) const;
 #ifndef AZ_MONOLITHIC_BUILD
             ThreadInfo* CrossModuleFindAndSetWorkerThreadInfo() const;
 #endif
@@ -133,9 +214,19 @@ namespace AZ
             using GlobalJobQueue = AZStd::deque<Job*>;
             using GlobalQueueMutexType = AZStd::mutex;
 
-            GlobalJobQueue              m_globalJobQueue;
+            GlobalJobQueue              m_sharedJobQueues[SharedQueueCount][PriorityLevelCount];
+            AZStd::atomic<AZ::u64>      m_sharedPendingMask{0};
             GlobalQueueMutexType        m_globalJobQueueMutex;
 
+            bool                        m_useFibers = false;
+            unsigned int                m_fiberStackSize = 0;
+            unsigned int                m_maxFibersPerWorker = 0;
+            AZStd::atomic<AZ::u64>      m_parkedWorkerMask{0}; //bit N is set while worker N has parked fibers
+
+            AZ::u64                     m_allWorkersMask = 0;
+            AZ::u64                     m_affinityWorkerMasks[JobManagerDesc::MaxAffinityGroups] = {};
+            unsigned int                m_numAffinityGroups = 0;
+
             volatile bool               m_quitRequested = false;
             AZStd::atomic_uint          m_numAvailableWorkers{0};
 
@@ -24,6 +24,7 @@ namespace AZ
     namespace Internal
     {
         class JobManagerBase;
+        class JobManagerWorkStealing;
     }
 
     /**
@@ -59,6 +60,10 @@ namespace AZ
          * priority is used to sort jobs such that higher priority jobs are run before lower priority ones.
          *          The valid range is -128 (lowest priority) to 127 (highest priority), the default is 0,
          *          and jobs with equal priority values will be run in the same order as added to the queue.
+         *          Positive, zero and negative priorities are scheduled as the high, normal and low priority levels,
+         *          each level has separate queues and is always preferred to the lower levels, including when stealing
+         *          jobs from other threads. So use a positive priority for short frame critical jobs, and a negative
+         *          priority for long running jobs which should not delay them.
          */
         Job(bool isAutoDelete, JobContext* context, bool isCompletion = false, AZ::s8 priority = 0);
 
@@ -172,6 +177,18 @@ namespace AZ
          */
         AZ::s8 GetPriority() const;
 
+        /**
+         * Restricts the job to the worker threads of an affinity group, which are set in JobManagerDesc::m_jobAffinityMasks.
+         * Use JobManagerDesc::NoAffinityGroup (the default) to let the job run on any thread. Can only be called before
+         * the job is started.
+         */
+        void SetAffinityGroup(AZ::u8 affinityGroup);
+
+        /*
+         * Get the affinity group of this job, see SetAffinityGroup.
+         */
+        AZ::u8 GetAffinityGroup() const;
+
 #ifdef AZ_DEBUG_JOB_STATE
         int GetState() const    { return m_state; }
 #endif // AZ_DEBUG_JOB_STATE
@@ -192,6 +209,7 @@ namespace AZ
         unsigned int GetDependentCountAndFlags() const;
 
         friend class Internal::JobManagerBase;
+        friend class Internal::JobManagerWorkStealing;
 
     private:
         //non-copyable
@@ -232,6 +250,13 @@ namespace AZ
         //state is only really necessary for debugging... we could squeeze it into the dependent count member, but it
         //would require atomic ops to set/read it, so not really worth it.
         int m_state;
+
+        //fits in the padding after m_state
+        AZ::u8 m_affinityGroup;
+
+#ifdef JOBMANAGER_ENABLE_STATS
+        AZ::u64 m_pendingTime = 0; //time at which the job was added to the job manager, used to measure the scheduling latency
+#endif
     };
 
     //============================================================================================================
@@ -261,6 +286,7 @@ namespace AZ
         countAndFlags |= (unsigned int)((priority << FLAG_PRIORITY_START_BIT) & FLAG_PRIORITY_MASK);
         SetDependentCountAndFlags(countAndFlags);
         StoreDependent(NULL);
+        m_affinityGroup = JobManagerDesc::NoAffinityGroup;
 
 #ifdef AZ_DEBUG_JOB_STATE
         SetState(STATE_SETUP);
@@ -473,6 +499,8 @@ namespace AZ
             "Job dependent count should not be decremented after job is already pending");
 #endif
         AZ_Assert(GetDependentCount() > 0, ("Job dependent count is already zero"));
+        //a job waiting for its children can resume and be deleted as soon as the count reaches zero, so get the context first
+        JobContext* context = m_context;
 #ifdef AZCORE_JOBS_IMPL_SYNCHRONOUS
         unsigned int countAndFlags = m_dependentCountAndFlags--;
 #else
@@ -487,7 +515,11 @@ namespace AZ
                 AZ_Assert(m_state == STATE_STARTED, "Job has not been started but the dependent count is zero, must be a dependency error");
                 SetState(STATE_PENDING);
 #endif
-                m_context->GetJobManager().AddPendingJob(this);
+                context->GetJobManager().AddPendingJob(this);
+            }
+            else
+            {
+                context->GetJobManager().NotifyChildJobsComplete();
             }
         }
     }
@@ -497,6 +529,19 @@ namespace AZ
         return (GetDependentCountAndFlags() >> FLAG_PRIORITY_START_BIT) & 0xff;
     }
 
+    inline void Job::SetAffinityGroup(AZ::u8 affinityGroup)
+    {
+#ifdef AZ_DEBUG_JOB_STATE
+        AZ_Assert(m_state == STATE_SETUP, "The affinity group can only be set before the job is started");
+#endif
+        m_affinityGroup = affinityGroup;
+    }
+
+    AZ_FORCE_INLINE AZ::u8 Job::GetAffinityGroup() const
+    {
+        return m_affinityGroup;
+    }
+
 #ifdef AZ_DEBUG_JOB_STATE
     AZ_FORCE_INLINE void Job::SetState(int state)
     {
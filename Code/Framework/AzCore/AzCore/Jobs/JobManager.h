@@ -46,6 +46,9 @@ namespace AZ
         /// Check if we have multiple threads for parallel processing.
         AZ_FORCE_INLINE bool    IsAsynchronous() const { return m_impl.IsAsynchronous(); }
 
+        /// Check if jobs waiting for their children on worker threads are parked in fibers, see JobManagerDesc::m_useFibers.
+        AZ_FORCE_INLINE bool    IsUsingFibers() const { return m_impl.IsUsingFibers(); }
+
         /**
          * Clears all accumulated statistics, should only really be called when system is idle to ensure consistent
          * results.
@@ -92,6 +95,9 @@ namespace AZ
         //called internally by Job class to start a job and then assist in processing until it is complete
         AZ_FORCE_INLINE void StartJobAndAssistUntilComplete(Job* job) { m_impl.StartJobAndAssistUntilComplete(job); }
 
+        //called internally by Job class when the last child of a job has completed
+        AZ_FORCE_INLINE void NotifyChildJobsComplete() { m_impl.NotifyChildJobsComplete(); }
+
         Internal::JobManagerWorkStealing m_impl;
     };
 }
@@ -28,6 +28,7 @@ namespace AZ
         , m_jobGlobalContext(nullptr)
         , m_numberOfWorkerThreads(0)
         , m_firstThreadCPU(-1)
+        , m_useFibers(false)
     {
     }
 
@@ -58,6 +59,7 @@ namespace AZ
         {
             desc.m_workerThreads.push_back(threadDesc);
         }
+        desc.m_useFibers = m_useFibers;
 
         m_jobManager = aznew JobManager(desc);
         m_jobGlobalContext = aznew JobContext(*m_jobManager);
@@ -118,6 +120,7 @@ namespace AZ
                 ->Version(1)
                 ->Field("NumberOfWorkerThreads", &JobManagerComponent::m_numberOfWorkerThreads)
                 ->Field("FirstThreadCPUID", &JobManagerComponent::m_firstThreadCPU)
+                ->Field("UseFibers", &JobManagerComponent::m_useFibers)
                 ;
 
             if (EditContext* editContext = serializeContext->GetEditContext())
@@ -133,6 +136,7 @@ namespace AZ
                     ->DataElement(AZ::Edit::UIHandlers::SpinBox, &JobManagerComponent::m_firstThreadCPU, "CPU ID", "First CPU ID for a worker thread, each consecutive thread will use the next CPU ID. -1 Will not assign CPU Ids")
                         ->Attribute(AZ::Edit::Attributes::Min, -1)
                         ->Attribute(AZ::Edit::Attributes::Max, 16)
+                    ->DataElement(AZ::Edit::UIHandlers::CheckBox, &JobManagerComponent::m_useFibers, "Use fibers", "Jobs waiting for their children are suspended on a fiber instead of processing other jobs recursively")
                     ;
             }
         }
@@ -51,6 +51,7 @@ namespace AZ
         JobContext*  m_jobGlobalContext;
         int          m_numberOfWorkerThreads;   ///< Number of worked threads to spawn for this process. If <= 0 we will use all cores.
         int          m_firstThreadCPU;          ///< ID of the first thread, afterwards we just increment. If == -1, no CPU will be set.(TODO: We can have a full array)
+        bool         m_useFibers;               ///< Suspend jobs waiting for their children on fibers, see JobManagerDesc::m_useFibers.
     };
 }
 
@@ -50,7 +50,38 @@ namespace AZ
     {
         JobManagerDesc() {}
 
+        /// The maximum number of affinity groups, see m_jobAffinityMasks.
+        static const AZ::u8 MaxAffinityGroups = 15;
+
+        /// Affinity group of jobs which can run on any thread, see Job::SetAffinityGroup.
+        static const AZ::u8 NoAffinityGroup = 0xff;
+
         using DescList = AZStd::fixed_vector<JobManagerThreadDesc, 64>;
         DescList m_workerThreads; ///< List of worker threads to create
+
+        /**
+         * Optional thread affinity masks for jobs. A job assigned to affinity group N with Job::SetAffinityGroup will only
+         * run on the worker threads whose bit is set in m_jobAffinityMasks[N], where bit M is the worker created from
+         * m_workerThreads[M]. Jobs without an affinity group run on any thread, including the threads in affinity masks.
+         * e.g. to keep the jobs of affinity group 0 on the first two workers: m_jobAffinityMasks.push_back(0x3);
+         */
+        using AffinityMaskList = AZStd::fixed_vector<AZ::u64, MaxAffinityGroups>;
+        AffinityMaskList m_jobAffinityMasks;
+
+        /**
+         * If true, a job which waits for its children on a worker thread (Job::WaitForChildren) is parked in a fiber, and
+         * the worker continues with other jobs on a fresh fiber until the children are done. Otherwise the worker runs the
+         * other jobs recursively on the stack of the waiting job, so deep job graphs need large worker thread stacks.
+         * A parked job always resumes on the worker thread it was parked on. Jobs waiting on non-worker threads always
+         * run other jobs recursively. Ignored on platforms which don't support fibers.
+         */
+        bool m_useFibers = false;
+
+        /// Stack size of the fibers when m_useFibers is true, each fiber runs one chain of jobs until the next job waits.
+        unsigned int m_fiberStackSize = 256 * 1024;
+
+        /// Maximum number of fibers each worker creates, 0 for no limit. When a worker has no fiber left, a waiting job
+        /// runs other jobs recursively on its stack, as if m_useFibers was false.
+        unsigned int m_maxFibersPerWorker = 0;
     };
 }
@@ -60,6 +60,9 @@ namespace AZ
         bool Load(void* classPtr, IO::GenericStream& stream, unsigned int /*version*/, bool isDataBigEndian = false) override;
 
         bool CompareValueData(const void* lhs, const void* rhs) override;
+
+        //! The binary data is the 16 bytes of the Uuid.
+        size_t GetRawDataSize() const override { return sizeof(Uuid); }
     };
 
     class FloatArrayTextSerializer
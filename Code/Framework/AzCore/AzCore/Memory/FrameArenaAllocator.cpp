@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    struct FrameArenaAllocator::ThreadArena
+    {
+        AZ_CLASS_ALLOCATOR(ThreadArena, SystemAllocator, 0);
+
+        ThreadArena(AZStd::thread_id threadId, const LinearAllocator::Descriptor& desc)
+            : m_threadId(threadId)
+            , m_arena(desc)
+        {
+        }
+
+        AZStd::thread_id m_threadId;
+        LinearAllocator m_arena;
+    };
+
+    namespace
+    {
+        // Arena of the calling thread for the allocator with the matching id. Ids are never reused, so an entry
+        // left behind by a destroyed allocator can't be mistaken for the arena of a new one.
+        struct ThreadArenaCache
+        {
+            AZ::u64 m_allocatorId;
+            LinearAllocator* m_arena;
+        };
+
+        AZ_THREAD_LOCAL ThreadArenaCache s_threadArenaCache = { 0, nullptr };
+        // Set once the arenas of the current thread are released, later arenas of the exiting thread are freed by Destroy
+        AZ_THREAD_LOCAL bool s_threadArenaExited = false;
+
+        // The registry of created allocators, guarded by the registry mutex
+        FrameArenaAllocator* s_firstFrameArenaAllocator = nullptr;
+        AZ::u64 s_nextFrameArenaAllocatorId = 1;
+
+        // The mutex is never destroyed, threads can exit after the static objects of this module are destroyed
+        AZStd::mutex& GetFrameArenaRegistryMutex()
+        {
+            alignas(AZStd::mutex) static char s_mutexStorage[sizeof(AZStd::mutex)];
+            static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+            return *s_mutex;
+        }
+    }
+
+    // Releases the arenas of a thread when the thread exits
+    struct FrameArenaAllocator::ThreadArenaExitGuard
+    {
+        static constexpr size_t MaxArenas = 8;
+
+        ~ThreadArenaExitGuard();
+
+        struct Entry
+        {
+            AZ::u64 m_allocatorId;
+            ThreadArena* m_threadArena;
+        };
+        // A thread using more allocators than this keeps the extra arenas until their allocator is destroyed
+        Entry m_entries[MaxArenas] = {};
+        size_t m_entryCount = 0;
+    };
+
+    FrameArenaAllocator::ThreadArenaExitGuard::~ThreadArenaExitGuard()
+    {
+        s_threadArenaExited = true;
+        s_threadArenaCache = { 0, nullptr };
+        AZStd::lock_guard<AZStd::mutex> lock(GetFrameArenaRegistryMutex());
+        for (size_t i = 0; i < m_entryCount; ++i)
+        {
+            // The arenas of a destroyed allocator were freed by Destroy, its id is no longer registered
+            for (FrameArenaAllocator* allocator = s_firstFrameArenaAllocator; allocator; allocator = allocator->m_nextAllocator)
+            {
+                if (allocator->m_id == m_entries[i].m_allocatorId)
+                {
+                    allocator->ReleaseThreadArena(m_entries[i].m_threadArena);
+                    break;
+                }
+            }
+        }
+        m_entryCount = 0;
+    }
+
+    FrameArenaAllocator::FrameArenaAllocator()
+        : AllocatorBase(this, "FrameArenaAllocator", "Per thread linear arenas for temporary frame data")
+    {
+        // Memory is reclaimed by rewinding the arenas, it would leak if the allocations were redirected elsewhere
+        DisableOverriding();
+    }
+
+    FrameArenaAllocator::~FrameArenaAllocator()
+    {
+    }
+
+    bool FrameArenaAllocator::Create(const Descriptor& desc)
+    {
+        m_desc = desc;
+        if (!m_desc.m_chunkAllocator)
+        {
+            m_desc.m_chunkAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFrameArenaRegistryMutex());
+        m_id = s_nextFrameArenaAllocatorId++;
+        m_nextAllocator = s_firstFrameArenaAllocator;
+        s_firstFrameArenaAllocator = this;
+        return true;
+    }
+
+    void FrameArenaAllocator::Destroy()
+    {
+        {
+            // Threads that exit from now on don't release their arenas to this allocator
+            AZStd::lock_guard<AZStd::mutex> lock(GetFrameArenaRegistryMutex());
+            FrameArenaAllocator** link = &s_firstFrameArenaAllocator;
+            while (*link && *link != this)
+            {
+                link = &(*link)->m_nextAllocator;
+            }
+            if (*link)
+            {
+                *link = m_nextAllocator;
+            }
+            m_nextAllocator = nullptr;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadArenasMutex);
+        for (ThreadArena* threadArena : m_threadArenas)
+        {
+            delete threadArena;
+        }
+        m_threadArenas.clear();
+        m_threadArenas.shrink_to_fit();
+        m_id = 0;
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        return AllocatorDebugConfig().ExcludeFromDebugging();
+    }
+
+    LinearAllocator& FrameArenaAllocator::GetThreadArena()
+    {
+        AZ_Assert(m_id != 0, "FrameArenaAllocator is not created!");
+
+        ThreadArenaCache& cache = s_threadArenaCache;
+        if (cache.m_allocatorId == m_id)
+        {
+            return *cache.m_arena;
+        }
+
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        ThreadArena* threadArena = nullptr;
+        bool isNewArena = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_threadArenasMutex);
+            for (ThreadArena* existingArena : m_threadArenas)
+            {
+                if (existingArena->m_threadId == threadId)
+                {
+                    threadArena = existingArena;
+                    break;
+                }
+            }
+
+            if (!threadArena)
+            {
+                LinearAllocator::Descriptor arenaDesc;
+                arenaDesc.m_chunkSize = m_desc.m_chunkSize;
+                arenaDesc.m_chunkAllocator = m_desc.m_chunkAllocator;
+                threadArena = aznew ThreadArena(threadId, arenaDesc);
+                m_threadArenas.push_back(threadArena);
+                isNewArena = true;
+            }
+        }
+
+        if (isNewArena && !s_threadArenaExited)
+        {
+            // the guard is constructed on the first arena of this thread, its destructor runs when the thread exits
+            thread_local static ThreadArenaExitGuard s_exitGuard;
+            if (s_exitGuard.m_entryCount < ThreadArenaExitGuard::MaxArenas)
+            {
+                s_exitGuard.m_entries[s_exitGuard.m_entryCount++] = { m_id, threadArena };
+            }
+        }
+
+        cache.m_allocatorId = m_id;
+        cache.m_arena = &threadArena->m_arena;
+        return threadArena->m_arena;
+    }
+
+    FrameArenaAllocator::Marker FrameArenaAllocator::GetMarker()
+    {
+        return GetThreadArena().GetMarker();
+    }
+
+    void FrameArenaAllocator::Rewind(const Marker& marker)
+    {
+        GetThreadArena().Rewind(marker);
+    }
+
+    void FrameArenaAllocator::ReleaseThreadArena(ThreadArena* threadArena)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadArenasMutex);
+        auto it = AZStd::find(m_threadArenas.begin(), m_threadArenas.end(), threadArena);
+        if (it != m_threadArenas.end())
+        {
+            *it = m_threadArenas.back();
+            m_threadArenas.pop_back();
+            delete threadArena;
+        }
+    }
+
+    FrameArenaAllocator::pointer_type
+    FrameArenaAllocator::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        pointer_type ptr = GetThreadArena().Allocate(byteSize, alignment, flags, name, fileName, lineNum, suppressStackRecord);
+        if (!ptr)
+        {
+            OnOutOfMemory(byteSize, alignment, flags, name, fileName, lineNum);
+        }
+        return ptr;
+    }
+
+    void FrameArenaAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        // Memory allocated on a different thread is never the most recent allocation of this thread's arena, so this is a no-op for it
+        GetThreadArena().DeAllocate(ptr, byteSize, alignment);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Resize(pointer_type ptr, size_type newSize)
+    {
+        return GetThreadArena().Resize(ptr, newSize);
+    }
+
+    FrameArenaAllocator::pointer_type FrameArenaAllocator::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        return GetThreadArena().ReAllocate(ptr, newSize, newAlignment);
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::AllocationSize(pointer_type ptr)
+    {
+        return GetThreadArena().AllocationSize(ptr);
+    }
+
+    void FrameArenaAllocator::GarbageCollect()
+    {
+        // Other threads could be allocating from their arenas, only the calling thread's arena is safe to trim
+        GetThreadArena().GarbageCollect();
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::NumAllocatedBytes() const
+    {
+        size_type bytesAllocated = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadArenasMutex);
+        for (const ThreadArena* threadArena : m_threadArenas)
+        {
+            bytesAllocated += threadArena->m_arena.NumAllocatedBytes();
+        }
+        return bytesAllocated;
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::Capacity() const
+    {
+        size_type capacity = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_threadArenasMutex);
+        for (const ThreadArena* threadArena : m_threadArenas)
+        {
+            capacity += threadArena->m_arena.Capacity();
+        }
+        return capacity;
+    }
+
+    FrameArenaScope::FrameArenaScope()
+        : m_allocator(static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()))
+        , m_marker(m_allocator.GetMarker())
+    {
+    }
+
+    FrameArenaScope::~FrameArenaScope()
+    {
+        m_allocator.Rewind(m_marker);
+    }
+}
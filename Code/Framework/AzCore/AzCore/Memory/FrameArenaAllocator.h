@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/LinearAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena allocator, for temporary data that doesn't outlive a scope within the frame.
+     * Each thread allocates from its own \ref LinearAllocator, so allocations don't take any locks once a thread
+     * has its arena. Frees are ignored (except for the most recent allocation of the thread), memory is only reclaimed
+     * by a \ref FrameArenaScope, which rewinds the arena of the calling thread in O(1) when it goes out of scope.
+     * Allocate inside a scope, memory allocated outside of any scope is held until the thread exits.
+     * The arena of a thread, with all of its chunks, is released when the thread exits.
+     * Allocations are not tracked by the memory driller, as they are never freed individually. The used and reserved
+     * bytes of all arenas show up in the allocator stats.
+     */
+    class FrameArenaAllocator
+        : public AllocatorBase
+        , public IAllocatorAllocate
+    {
+    public:
+        AZ_TYPE_INFO(FrameArenaAllocator, "{2835C2C1-0A7E-4910-9C6F-E50C49E79A51}")
+
+        using Marker = LinearAllocator::Marker;
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(64 * 1024)
+                , m_chunkAllocator(nullptr)
+            {}
+            size_t              m_chunkSize;        ///< Size in bytes of each chunk of the thread arenas.
+            IAllocatorAllocate* m_chunkAllocator;   ///< Allocator for the chunks, if null the SystemAllocator will be used.
+        };
+
+        FrameArenaAllocator();
+        ~FrameArenaAllocator() override;
+
+        bool Create(const Descriptor& desc);
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocator
+        void Destroy() override;
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        /// Returns the current position in the arena of the calling thread.
+        Marker GetMarker();
+        /// Rewinds the arena of the calling thread to a marker taken on the same thread.
+        void Rewind(const Marker& marker);
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorAllocate
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = nullptr, const char* fileName = nullptr, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Returns chunks that the arena of the calling thread is not using.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override;
+        size_type Capacity() const override;
+        size_type GetMaxAllocationSize() const override { return AZ_CORE_MAX_ALLOCATOR_SIZE; }
+        IAllocatorAllocate* GetSubAllocator() override { return m_desc.m_chunkAllocator; }
+
+    private:
+        FrameArenaAllocator(const FrameArenaAllocator&) = delete;
+        FrameArenaAllocator& operator=(const FrameArenaAllocator&) = delete;
+
+        struct ThreadArena;
+        struct ThreadArenaExitGuard;
+
+        LinearAllocator& GetThreadArena();
+        /// Frees the arena of a thread that is exiting.
+        void ReleaseThreadArena(ThreadArena* threadArena);
+
+        Descriptor m_desc;
+        AZ::u64 m_id = 0;                                   ///< Unique id, used to match the thread local arena cache.
+        FrameArenaAllocator* m_nextAllocator = nullptr;     ///< Next created allocator, threads release their arenas to the created allocators.
+        mutable AZStd::mutex m_threadArenasMutex;
+        AZStd::vector<ThreadArena*> m_threadArenas;         ///< Arenas of the threads that allocated from this allocator and haven't exited.
+    };
+
+    typedef AZStdAlloc<FrameArenaAllocator> FrameArenaStdAllocator;
+
+    /**
+     * Rewinds the frame arena of the calling thread to where it was when the scope was entered.
+     * Declare it before any containers that use the allocator, so they are destroyed before it rewinds.
+     */
+    class FrameArenaScope
+    {
+    public:
+        FrameArenaScope();
+        ~FrameArenaScope();
+
+        FrameArenaScope(const FrameArenaScope&) = delete;
+        FrameArenaScope& operator=(const FrameArenaScope&) = delete;
+
+    private:
+        FrameArenaAllocator& m_allocator;
+        FrameArenaAllocator::Marker m_marker;
+    };
+}
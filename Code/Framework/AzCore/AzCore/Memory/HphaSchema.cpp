@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/OSAllocator.h> // required by certain platforms
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
@@ -55,6 +56,48 @@ namespace AZ {
 // Enabled mutex per bucket
 #define USE_MUTEX_PER_BUCKET
 
+// Enable per thread caches of free small elements in front of the buckets
+#if defined(MULTITHREADED) && !defined(DEBUG_ALLOCATOR)
+#   define USE_THREAD_CACHE
+#endif
+
+#ifdef USE_THREAD_CACHE
+    // Thread caches are found through a thread local table with an entry per allocator that uses them. An allocator claims
+    // a table index when it's created, the allocator id stored in each entry tells if the entry belongs to the current
+    // allocator or to an earlier one that used the same index.
+    static const unsigned THREAD_CACHE_MAX_ALLOCATORS = 8;
+
+    struct ThreadCacheEntry
+    {
+        AZ::u64 mAllocatorId;
+        void*   mCache;
+    };
+
+    class HpAllocator;
+
+    // The registry of allocators that use thread caches, guarded by the registry mutex
+    static AZ::u64 s_threadCacheAllocatorIds[THREAD_CACHE_MAX_ALLOCATORS];
+    static HpAllocator* s_threadCacheAllocators[THREAD_CACHE_MAX_ALLOCATORS];
+    static AZ::u64 s_nextThreadCacheAllocatorId = 1;
+    static AZ_THREAD_LOCAL ThreadCacheEntry s_threadCacheEntries[THREAD_CACHE_MAX_ALLOCATORS];
+    // Set once the caches of the current thread are released, later allocations of the exiting thread skip the cache
+    static AZ_THREAD_LOCAL bool s_threadCacheExited;
+
+    // The mutex is never destroyed, threads can exit after the static objects of this module are destroyed
+    static AZStd::mutex& GetThreadCacheRegistryMutex()
+    {
+        alignas(AZStd::mutex) static char s_mutexStorage[sizeof(AZStd::mutex)];
+        static AZStd::mutex* s_mutex = new (s_mutexStorage) AZStd::mutex();
+        return *s_mutex;
+    }
+
+    // Returns the thread caches of a thread to their allocators when the thread exits
+    struct ThreadCacheExitGuard
+    {
+        ~ThreadCacheExitGuard();
+    };
+#endif
+
     //////////////////////////////////////////////////////////////////////////
     // TODO: Replace with AZStd::intrusive_list
     class intrusive_list_base
@@ -461,6 +504,45 @@ namespace AZ {
         void* bucket_realloc_aligned(void* ptr, size_t size, size_t alignment);
         void bucket_free(void* ptr);
         void bucket_free_direct(void* ptr, unsigned bi);
+#ifdef USE_THREAD_CACHE
+        // per thread cache of free bucket elements, allocations and frees from the owning thread use a magazine of
+        // elements per bucket without taking the bucket lock. Magazines are refilled from and returned to the buckets in batches.
+        struct thread_cache
+        {
+            struct magazine
+            {
+                free_link* mHead = nullptr;
+                unsigned   mCount = 0;
+            };
+
+            AZStd::atomic_bool    mInUse{ false };      ///< Set while a thread uses the cache, other threads only flush caches that are not in use.
+            AZStd::atomic<size_t> mCachedSize{ 0 };     ///< Bytes held by the magazines, these are allocated from the buckets but free.
+            thread_cache*         mNext = nullptr;
+            magazine              mMagazines[NUM_BUCKETS];
+        };
+        // the most elements a magazine holds, we cache at most a few KB per bucket
+        static inline unsigned thread_cache_capacity(unsigned bi)
+        {
+            return (unsigned)AZStd::GetMax<size_t>(4, AZStd::GetMin<size_t>(64, 2048 / bucket_spacing_function_inverse(bi)));
+        }
+        thread_cache* thread_cache_get();
+        void thread_cache_release(thread_cache* cache);
+        void* thread_cache_alloc(unsigned bi);
+        bool thread_cache_free(void* ptr, unsigned bi);
+        void thread_cache_refill(thread_cache* cache, unsigned bi);
+        void thread_cache_return(thread_cache* cache, unsigned bi, unsigned count);
+        void thread_cache_flush(thread_cache* cache);
+        void thread_cache_purge();
+        void thread_cache_destroy();
+        size_t thread_cache_size() const;
+        size_t thread_cache_count() const;
+
+        thread_cache*   mThreadCaches = nullptr;    ///< Caches of the threads that use this allocator
+        thread_cache*   mFreeThreadCaches = nullptr;    ///< Caches of exited threads, flushed and reused by new threads
+        mutable AZStd::mutex mThreadCacheMutex;
+        AZ::u64         mThreadCacheId = 0;
+        unsigned        mThreadCacheIndex = THREAD_CACHE_MAX_ALLOCATORS;
+#endif
         /// return the block size for the pointer.
         size_t bucket_ptr_size(void* ptr) const;
         size_t bucket_get_max_allocation() const;
@@ -1046,6 +1128,10 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+#ifdef USE_THREAD_CACHE
+            // Return cached elements first, so their pages can be released
+            thread_cache_purge();
+#endif
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1062,7 +1148,11 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
+#ifdef USE_THREAD_CACHE
+            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree - thread_cache_size();
+#else
             return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+#endif
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1170,6 +1260,25 @@ namespace AZ {
     #   endif // MULTITHREADED
     #endif // AZ_TRAIT_OS_HAS_CRITICAL_SECTION_SPIN_COUNT
 #endif
+
+#ifdef USE_THREAD_CACHE
+        // Fixed memory block allocators don't use thread caches, they can't request the cache memory from the OS
+        if (!m_fixedBlock && m_isPoolAllocations)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(GetThreadCacheRegistryMutex());
+            mThreadCacheId = s_nextThreadCacheAllocatorId++;
+            for (unsigned i = 0; i < THREAD_CACHE_MAX_ALLOCATORS; ++i)
+            {
+                if (s_threadCacheAllocatorIds[i] == 0)
+                {
+                    s_threadCacheAllocatorIds[i] = mThreadCacheId;
+                    s_threadCacheAllocators[i] = this;
+                    mThreadCacheIndex = i;
+                    break;
+                }
+            }
+        }
+#endif
     }
 
     HpAllocator::~HpAllocator()
@@ -1179,6 +1288,10 @@ namespace AZ {
         report();
         check();
 #endif
+
+#ifdef USE_THREAD_CACHE
+        thread_cache_destroy();
+#endif
         
         purge();
 
@@ -1337,11 +1450,286 @@ namespace AZ {
         return nullptr;
     }
 
+#ifdef USE_THREAD_CACHE
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        if (mThreadCacheIndex >= THREAD_CACHE_MAX_ALLOCATORS)
+        {
+            return nullptr;
+        }
+        ThreadCacheEntry& entry = s_threadCacheEntries[mThreadCacheIndex];
+        if (entry.mAllocatorId == mThreadCacheId)
+        {
+            return static_cast<thread_cache*>(entry.mCache);
+        }
+
+        // first use of this allocator from the current thread
+        if (s_threadCacheExited)
+        {
+            return nullptr;
+        }
+        thread_cache* cache = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+            if (mFreeThreadCaches)
+            {
+                cache = mFreeThreadCaches;
+                mFreeThreadCaches = cache->mNext;
+            }
+        }
+        if (!cache)
+        {
+            void* mem = SystemAlloc(sizeof(thread_cache), OS_VIRTUAL_PAGE_SIZE);
+            if (!mem)
+            {
+                return nullptr;
+            }
+            cache = new (mem) thread_cache();
+        }
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+            cache->mNext = mThreadCaches;
+            mThreadCaches = cache;
+        }
+
+        // the guard is constructed on the first use from this thread, its destructor runs when the thread exits
+        thread_local static ThreadCacheExitGuard s_exitGuard;
+        (void)s_exitGuard;
+
+        entry.mAllocatorId = mThreadCacheId;
+        entry.mCache = cache;
+        return cache;
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache* cache)
+    {
+        // The owning thread is exiting, return the cached elements and keep the cache for the next thread
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        thread_cache** link = &mThreadCaches;
+        while (*link != cache)
+        {
+            HPPA_ASSERT(*link);
+            link = &(*link)->mNext;
+        }
+        *link = cache->mNext;
+        thread_cache_flush(cache);
+        cache->mNext = mFreeThreadCaches;
+        mFreeThreadCaches = cache;
+    }
+
+    void* HpAllocator::thread_cache_alloc(unsigned bi)
+    {
+        thread_cache* cache = thread_cache_get();
+        if (!cache || cache->mInUse.exchange(true, AZStd::memory_order_acquire))
+        {
+            return nullptr;
+        }
+        thread_cache::magazine& mag = cache->mMagazines[bi];
+        if (!mag.mHead)
+        {
+            thread_cache_refill(cache, bi);
+        }
+        free_link* element = mag.mHead;
+        if (element)
+        {
+            mag.mHead = element->mNext;
+            --mag.mCount;
+            // only the thread that holds mInUse writes mCachedSize
+            cache->mCachedSize.store(cache->mCachedSize.load(AZStd::memory_order_relaxed) - bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        }
+        cache->mInUse.store(false, AZStd::memory_order_release);
+        return element;
+    }
+
+    bool HpAllocator::thread_cache_free(void* ptr, unsigned bi)
+    {
+        thread_cache* cache = thread_cache_get();
+        if (!cache || cache->mInUse.exchange(true, AZStd::memory_order_acquire))
+        {
+            return false;
+        }
+        thread_cache::magazine& mag = cache->mMagazines[bi];
+        if (mag.mCount >= thread_cache_capacity(bi))
+        {
+            thread_cache_return(cache, bi, mag.mCount / 2);
+        }
+        free_link* element = (free_link*)ptr;
+        element->mNext = mag.mHead;
+        mag.mHead = element;
+        ++mag.mCount;
+        cache->mCachedSize.store(cache->mCachedSize.load(AZStd::memory_order_relaxed) + bucket_spacing_function_inverse(bi), AZStd::memory_order_relaxed);
+        cache->mInUse.store(false, AZStd::memory_order_release);
+        return true;
+    }
+
+    void HpAllocator::thread_cache_refill(thread_cache* cache, unsigned bi)
+    {
+        thread_cache::magazine& mag = cache->mMagazines[bi];
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        const unsigned count = thread_cache_capacity(bi) / 2;
+        unsigned numAllocated = 0;
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            for (; numAllocated < count; ++numAllocated)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* element = (free_link*)mBuckets[bi].alloc(p);
+                element->mNext = mag.mHead;
+                mag.mHead = element;
+            }
+            mTotalAllocatedSizeBuckets += elemSize * numAllocated;
+        }
+        mag.mCount += numAllocated;
+        cache->mCachedSize.store(cache->mCachedSize.load(AZStd::memory_order_relaxed) + elemSize * numAllocated, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_return(thread_cache* cache, unsigned bi, unsigned count)
+    {
+        thread_cache::magazine& mag = cache->mMagazines[bi];
+        HPPA_ASSERT(count <= mag.mCount);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            for (unsigned i = 0; i < count; ++i)
+            {
+                free_link* element = mag.mHead;
+                mag.mHead = element->mNext;
+                mBuckets[bi].free(ptr_get_page(element), element);
+            }
+            mTotalAllocatedSizeBuckets -= elemSize * count;
+        }
+        mag.mCount -= count;
+        cache->mCachedSize.store(cache->mCachedSize.load(AZStd::memory_order_relaxed) - elemSize * count, AZStd::memory_order_relaxed);
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache* cache)
+    {
+        for (unsigned bi = 0; bi < NUM_BUCKETS; ++bi)
+        {
+            if (cache->mMagazines[bi].mCount)
+            {
+                thread_cache_return(cache, bi, cache->mMagazines[bi].mCount);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_purge()
+    {
+        // Caches of exited threads were returned when their thread exited, a cache that is in use is skipped
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        for (thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            if (!cache->mInUse.exchange(true, AZStd::memory_order_acquire))
+            {
+                thread_cache_flush(cache);
+                cache->mInUse.store(false, AZStd::memory_order_release);
+            }
+        }
+    }
+
+    void HpAllocator::thread_cache_destroy()
+    {
+        if (mThreadCacheIndex < THREAD_CACHE_MAX_ALLOCATORS)
+        {
+            // Entries that threads still hold for this allocator don't match the id of the next allocator with this index,
+            // and threads that exit from now on don't release their caches to this allocator
+            AZStd::lock_guard<AZStd::mutex> lock(GetThreadCacheRegistryMutex());
+            s_threadCacheAllocatorIds[mThreadCacheIndex] = 0;
+            s_threadCacheAllocators[mThreadCacheIndex] = nullptr;
+            mThreadCacheIndex = THREAD_CACHE_MAX_ALLOCATORS;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        thread_cache** cacheLists[] = { &mThreadCaches, &mFreeThreadCaches };
+        for (thread_cache** caches : cacheLists)
+        {
+            while (*caches)
+            {
+                thread_cache* cache = *caches;
+                *caches = cache->mNext;
+                thread_cache_flush(cache);
+                cache->~thread_cache();
+                SystemFree(cache);
+            }
+        }
+    }
+
+    size_t HpAllocator::thread_cache_size() const
+    {
+        size_t cachedSize = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        for (const thread_cache* cache = mThreadCaches; cache; cache = cache->mNext)
+        {
+            cachedSize += cache->mCachedSize.load(AZStd::memory_order_relaxed);
+        }
+        return cachedSize;
+    }
+
+    size_t HpAllocator::thread_cache_count() const
+    {
+        size_t count = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(mThreadCacheMutex);
+        const thread_cache* cacheLists[] = { mThreadCaches, mFreeThreadCaches };
+        for (const thread_cache* caches : cacheLists)
+        {
+            for (const thread_cache* cache = caches; cache; cache = cache->mNext)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    ThreadCacheExitGuard::~ThreadCacheExitGuard()
+    {
+        s_threadCacheExited = true;
+        AZStd::lock_guard<AZStd::mutex> lock(GetThreadCacheRegistryMutex());
+        for (unsigned i = 0; i < THREAD_CACHE_MAX_ALLOCATORS; ++i)
+        {
+            ThreadCacheEntry& entry = s_threadCacheEntries[i];
+            // an entry of a destroyed allocator doesn't match the id registered for its index
+            if (entry.mAllocatorId != 0 && entry.mAllocatorId == s_threadCacheAllocatorIds[i])
+            {
+                s_threadCacheAllocators[i]->thread_cache_release(static_cast<HpAllocator::thread_cache*>(entry.mCache));
+            }
+            entry.mAllocatorId = 0;
+            entry.mCache = nullptr;
+        }
+    }
+#endif // USE_THREAD_CACHE
+
     void* HpAllocator::bucket_alloc(size_t size)
     {
         HPPA_ASSERT(size <= MAX_SMALL_ALLOCATION);
         unsigned bi = bucket_spacing_function(size);
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (void* ptr = thread_cache_alloc(bi))
+        {
+            return ptr;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1370,6 +1758,12 @@ namespace AZ {
     void* HpAllocator::bucket_alloc_direct(unsigned bi)
     {
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (void* ptr = thread_cache_alloc(bi))
+        {
+            return ptr;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1437,6 +1831,12 @@ namespace AZ {
         page* p = ptr_get_page(ptr);
         unsigned bi = p->bucket_index();
         HPPA_ASSERT(bi < NUM_BUCKETS);
+#ifdef USE_THREAD_CACHE
+        if (thread_cache_free(ptr, bi))
+        {
+            return;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -1455,6 +1855,12 @@ namespace AZ {
         // if this asserts, the free size doesn't match the allocated size
         // most likely a class needs a base virtual destructor
         HPPA_ASSERT(bi == p->bucket_index());
+#ifdef USE_THREAD_CACHE
+        if (thread_cache_free(ptr, p->bucket_index()))
+        {
+            return;
+        }
+#endif
 #ifdef MULTITHREADED
     #if defined (USE_MUTEX_PER_BUCKET)
         AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
@@ -2695,6 +3101,19 @@ namespace AZ {
     {
         m_allocator->purge();
     }
+
+    //=========================================================================
+    // GetNumThreadCaches
+    //=========================================================================
+    HphaSchema::size_type
+    HphaSchema::GetNumThreadCaches() const
+    {
+#ifdef USE_THREAD_CACHE
+        return m_allocator->thread_cache_count();
+#else
+        return 0;
+#endif
+    }
         
     size_t
     HphaSchema::Capacity() const
@@ -16,6 +16,9 @@ namespace AZ
 
     /**
     * Heap allocator schema, based on Dimitar Lazarov "High Performance Heap Allocator".
+    * Small allocations and frees go through a per thread cache of free elements, which is refilled from and
+    * returned to the shared buckets in batches. A thread returns its cached elements when it exits and its cache is
+    * reused by the next thread, GarbageCollect also returns cached elements of threads that are not allocating at the time.
     */
     class HphaSchema
         : public IAllocatorAllocate
@@ -71,6 +74,9 @@ namespace AZ
         /// Return unused memory to the OS (if we don't use fixed block). Don't call this unless you really need free memory, it is slow.
         virtual void            GarbageCollect();
 
+        /// Returns the number of per thread caches, including the caches of exited threads kept for reuse.
+        size_type               GetNumThreadCaches() const;
+
     private:
         // [LY-84974][sconel@][2018-08-10] SliceStrike integration up to CL 671758
         // this must be at least the max size of HpAllocator (defined in the cpp) + any platform compiler padding
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/LinearAllocator.h>
+#include <AzCore/std/algorithm.h>
+
+namespace AZ
+{
+    struct LinearAllocator::Chunk
+    {
+        static constexpr size_t s_alignment = 16;
+
+        char* GetData()
+        {
+            return reinterpret_cast<char*>(this) + AZ_SIZE_ALIGN_UP(sizeof(Chunk), s_alignment);
+        }
+
+        Chunk* m_next;
+        size_t m_size; ///< Usable bytes after the header.
+    };
+
+    namespace
+    {
+        // Offset of the first address at or after data + offset that satisfies the alignment.
+        AZ_FORCE_INLINE size_t AlignedOffset(const char* data, size_t offset, size_t alignment)
+        {
+            const size_t address = reinterpret_cast<size_t>(data) + offset;
+            return offset + (AZ_SIZE_ALIGN_UP(address, alignment) - address);
+        }
+    }
+
+    LinearAllocator::LinearAllocator(const Descriptor& desc)
+        : m_chunkAllocator(desc.m_chunkAllocator ? desc.m_chunkAllocator : &AllocatorInstance<SystemAllocator>::Get())
+        , m_chunkSize(desc.m_chunkSize)
+    {
+        AZ_Assert(m_chunkSize > 0, "LinearAllocator chunk size must be greater than 0");
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        FreeChunks(m_firstChunk);
+    }
+
+    LinearAllocator::Marker LinearAllocator::GetMarker()
+    {
+        // Allocations before the marker must stay in place, so the most recent one can no longer be freed or resized
+        m_lastAllocation = nullptr;
+
+        Marker marker;
+        marker.m_chunk = m_currentChunk;
+        marker.m_offset = m_offset;
+        marker.m_allocatedBytes = m_allocatedBytes;
+        return marker;
+    }
+
+    void LinearAllocator::Rewind(const Marker& marker)
+    {
+        AZ_Assert(marker.m_allocatedBytes <= m_allocatedBytes, "Marker was taken after the allocator was rewound past it");
+        m_currentChunk = marker.m_chunk;
+        m_offset = marker.m_offset;
+        m_allocatedBytes = marker.m_allocatedBytes;
+        m_lastAllocation = nullptr;
+    }
+
+    void LinearAllocator::Reset()
+    {
+        Rewind(Marker());
+    }
+
+    LinearAllocator::pointer_type
+    LinearAllocator::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        alignment = alignment ? alignment : 1;
+        AZ_Assert((alignment & (alignment - 1)) == 0, "Alignment %zu must be a power of 2", alignment);
+
+        if (m_currentChunk)
+        {
+            char* data = m_currentChunk->GetData();
+            const size_type start = AlignedOffset(data, m_offset, alignment);
+            if (start + byteSize <= m_currentChunk->m_size)
+            {
+                m_allocatedBytes += start + byteSize - m_offset;
+                m_offset = start + byteSize;
+                m_lastAllocation = data + start;
+                return m_lastAllocation;
+            }
+        }
+
+        return AllocateFromNextChunk(byteSize, alignment);
+    }
+
+    LinearAllocator::pointer_type LinearAllocator::AllocateFromNextChunk(size_type byteSize, size_type alignment)
+    {
+        // Chunk data is only aligned to Chunk::s_alignment, reserve room to align bigger alignments
+        const size_type requiredSize = byteSize + (alignment > Chunk::s_alignment ? alignment - Chunk::s_alignment : 0);
+
+        Chunk* chunk = m_currentChunk ? m_currentChunk->m_next : m_firstChunk;
+        if (!chunk || chunk->m_size < requiredSize)
+        {
+            // Insert a new chunk, a following chunk that was too small stays in the list for later allocations
+            const size_type chunkSize = AZStd::GetMax(m_chunkSize, requiredSize);
+            void* memory = m_chunkAllocator->Allocate(AZ_SIZE_ALIGN_UP(sizeof(Chunk), Chunk::s_alignment) + chunkSize, Chunk::s_alignment, 0, "AZ::LinearAllocator chunk", __FILE__, __LINE__);
+            if (!memory)
+            {
+                return nullptr;
+            }
+
+            Chunk* newChunk = reinterpret_cast<Chunk*>(memory);
+            newChunk->m_next = chunk;
+            newChunk->m_size = chunkSize;
+            if (m_currentChunk)
+            {
+                m_currentChunk->m_next = newChunk;
+            }
+            else
+            {
+                m_firstChunk = newChunk;
+            }
+            m_capacity += chunkSize;
+            chunk = newChunk;
+        }
+
+        char* data = chunk->GetData();
+        const size_type start = AlignedOffset(data, 0, alignment);
+        m_currentChunk = chunk;
+        m_offset = start + byteSize;
+        m_allocatedBytes += m_offset;
+        m_lastAllocation = data + start;
+        return m_lastAllocation;
+    }
+
+    void LinearAllocator::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+
+        if (ptr && ptr == m_lastAllocation)
+        {
+            const size_type start = m_lastAllocation - m_currentChunk->GetData();
+            m_allocatedBytes -= m_offset - start;
+            m_offset = start;
+            m_lastAllocation = nullptr;
+        }
+    }
+
+    LinearAllocator::size_type LinearAllocator::Resize(pointer_type ptr, size_type newSize)
+    {
+        if (ptr && ptr == m_lastAllocation)
+        {
+            const size_type start = m_lastAllocation - m_currentChunk->GetData();
+            if (start + newSize <= m_currentChunk->m_size)
+            {
+                m_allocatedBytes = m_allocatedBytes - m_offset + start + newSize;
+                m_offset = start + newSize;
+                return newSize;
+            }
+        }
+        return 0;
+    }
+
+    LinearAllocator::pointer_type LinearAllocator::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        (void)ptr;
+        (void)newSize;
+        (void)newAlignment;
+        AZ_Assert(false, "Not supported!");
+        return nullptr;
+    }
+
+    LinearAllocator::size_type LinearAllocator::AllocationSize(pointer_type ptr)
+    {
+        // Allocation sizes are not stored, only the most recent allocation is known
+        if (ptr && ptr == m_lastAllocation)
+        {
+            return m_offset - (m_lastAllocation - m_currentChunk->GetData());
+        }
+        return 0;
+    }
+
+    void LinearAllocator::GarbageCollect()
+    {
+        // Chunks after the current one are not in use, markers can only refer to the current chunk or earlier ones
+        if (m_currentChunk)
+        {
+            FreeChunks(m_currentChunk->m_next);
+            m_currentChunk->m_next = nullptr;
+        }
+        else
+        {
+            FreeChunks(m_firstChunk);
+            m_firstChunk = nullptr;
+        }
+    }
+
+    void LinearAllocator::FreeChunks(Chunk* chunk)
+    {
+        while (chunk)
+        {
+            Chunk* next = chunk->m_next;
+            m_capacity -= chunk->m_size;
+            m_chunkAllocator->DeAllocate(chunk, AZ_SIZE_ALIGN_UP(sizeof(Chunk), Chunk::s_alignment) + chunk->m_size, Chunk::s_alignment);
+            chunk = next;
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    /**
+     * Linear (bump pointer) allocator over a list of chunks.
+     * Allocations are carved out of the current chunk, individual frees are ignored except for the most recent
+     * allocation, and memory is reclaimed all at once by rewinding to a \ref Marker or by \ref Reset, both O(1).
+     * Chunks are kept after a rewind and reused, they are only returned to the chunk allocator by GarbageCollect
+     * or on destruction. This makes it a good fit for short lived temporary data, declare one in a scope
+     * and all its memory is released when the scope exits.
+     * LinearAllocator is NOT thread safe, use \ref FrameArenaAllocator for a thread safe frame arena.
+     */
+    class LinearAllocator
+        : public IAllocatorAllocate
+    {
+        struct Chunk;
+
+    public:
+        AZ_CLASS_ALLOCATOR(LinearAllocator, SystemAllocator, 0);
+
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(16 * 1024)
+                , m_chunkAllocator(nullptr)
+            {}
+            size_t              m_chunkSize;        ///< Size in bytes of each chunk. Bigger allocations get a chunk of their own.
+            IAllocatorAllocate* m_chunkAllocator;   ///< Allocator for the chunks, if null the SystemAllocator will be used.
+        };
+
+        /**
+         * Position in the allocator, rewinding to it releases everything allocated after the marker was taken.
+         * A default constructed marker is the start of the allocator.
+         */
+        struct Marker
+        {
+            Chunk*      m_chunk = nullptr;
+            size_type   m_offset = 0;
+            size_type   m_allocatedBytes = 0;
+        };
+
+        LinearAllocator(const Descriptor& desc = Descriptor());
+        ~LinearAllocator() override;
+
+        /// Returns the current position in the allocator. Allocations made before it can no longer be freed or resized.
+        Marker GetMarker();
+        /// Releases all allocations made after the marker was taken. Markers taken after that are no longer valid.
+        void Rewind(const Marker& marker);
+        /// Releases all allocations, chunks are kept for reuse.
+        void Reset();
+
+        //////////////////////////////////////////////////////////////////////////
+        // IAllocatorAllocate
+        pointer_type Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = nullptr, const char* fileName = nullptr, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        /// Only the most recent allocation is released, everything else is released by Rewind or Reset.
+        void DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        /// Only the most recent allocation can be resized, returns 0 for all others.
+        size_type Resize(pointer_type ptr, size_type newSize) override;
+        pointer_type ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        size_type AllocationSize(pointer_type ptr) override;
+        /// Returns chunks that are not in use to the chunk allocator.
+        void GarbageCollect() override;
+
+        size_type NumAllocatedBytes() const override { return m_allocatedBytes; }
+        size_type Capacity() const override { return m_capacity; }
+        size_type GetMaxAllocationSize() const override { return AZ_CORE_MAX_ALLOCATOR_SIZE; }
+        IAllocatorAllocate* GetSubAllocator() override { return m_chunkAllocator; }
+
+    private:
+        LinearAllocator(const LinearAllocator&) = delete;
+        LinearAllocator& operator=(const LinearAllocator&) = delete;
+
+        pointer_type AllocateFromNextChunk(size_type byteSize, size_type alignment);
+        void FreeChunks(Chunk* chunk);
+
+        IAllocatorAllocate* m_chunkAllocator;
+        size_type           m_chunkSize;
+        Chunk*              m_firstChunk = nullptr;
+        Chunk*              m_currentChunk = nullptr;      ///< Chunk we allocate from, null until the first allocation after a reset.
+        size_type           m_offset = 0;                  ///< Offset of the first free byte in the current chunk.
+        char*               m_lastAllocation = nullptr;    ///< Most recent allocation, the only one that can be freed or resized.
+        size_type           m_allocatedBytes = 0;
+        size_type           m_capacity = 0;
+    };
+
+    /**
+     * Rewinds a LinearAllocator to where it was when the scope was entered.
+     * Declare it before any containers that use the allocator, so they are destroyed before it rewinds.
+     */
+    class LinearAllocatorScope
+    {
+    public:
+        explicit LinearAllocatorScope(LinearAllocator& allocator)
+            : m_allocator(allocator)
+            , m_marker(allocator.GetMarker())
+        {
+        }
+
+        ~LinearAllocatorScope()
+        {
+            m_allocator.Rewind(m_marker);
+        }
+
+        LinearAllocatorScope(const LinearAllocatorScope&) = delete;
+        LinearAllocatorScope& operator=(const LinearAllocatorScope&) = delete;
+
+    private:
+        LinearAllocator& m_allocator;
+        LinearAllocator::Marker m_marker;
+    };
+}
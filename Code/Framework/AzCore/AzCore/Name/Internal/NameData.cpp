@@ -33,6 +33,19 @@ namespace AZ
             ++m_useCount;
         }
 
+        bool NameData::TryAddRef()
+        {
+            int useCount = m_useCount.load(AZStd::memory_order_acquire);
+            while (useCount >= 0)
+            {
+                if (m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acq_rel))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void NameData::release()
         {
             AZ_Assert(m_useCount > 0, "m_useCount is already 0!");
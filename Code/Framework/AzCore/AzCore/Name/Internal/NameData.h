@@ -39,6 +39,10 @@ namespace AZ
             void add_ref();
             void release();
 
+            // Adds a reference unless the NameData is being released, which is flagged by a use count of -1.
+            // This is used by NameDictionary lookups that don't take a lock.
+            bool TryAddRef();
+
             template <typename T>
             friend struct AZStd::IntrusivePtrCountPolicy;
 
@@ -48,6 +52,8 @@ namespace AZ
 
             // TODO: We should be able to change this to a normal bool after introducing name dictionary garbage collection
             AZStd::atomic<bool> m_hashCollision = false; // Tracks whether the hash has been involved in a collision
+
+            AZStd::atomic<bool> m_isLiteral = false; // Tracks whether the name is cached by a NameLiteral, which keeps it in the dictionary
         };
     }
 }
@@ -12,6 +12,7 @@
 namespace AZ
 {
     class NameDictionary;
+    class NameLiteral;
     class ScriptDataContext;
     class ReflectContext;
 
@@ -24,10 +25,11 @@ namespace AZ
     //! Equality-comparison of two Name objects is very fast.
     //!
     //! The dictionary must be initialized before Name objects are created.
-    //! A Name instance must not be statically declared.
+    //! A Name instance must not be statically declared, use NameLiteral for names that are known at compile time.
     class Name
     {
         friend NameDictionary;
+        friend NameLiteral;
     public:
         using Hash = Internal::NameData::Hash;
 
@@ -6,21 +6,28 @@
  */
 
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/Name/NameLiteral.h>
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/std/hash.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/Math/MathUtils.h>
 #include <cstring>
 
 namespace AZ
 {
     static const char* NameDictionaryInstanceName = "NameDictionaryInstance";
+    static const char* NameDictionaryGenerationName = "NameDictionaryGeneration";
+
+    // The lock free lookup table is kept at most half full, so probe sequences stay short
+    static constexpr uint32_t InitialLookupTableCapacity = 1024;
 
     namespace NameDictionaryInternal
     {
         static AZ::EnvironmentVariable<NameDictionary*> s_instance = nullptr;
+        static AZ::EnvironmentVariable<uint64_t> s_generation = nullptr;
     }
 
     void NameDictionary::Create()
@@ -76,7 +83,18 @@ namespace AZ
     }
     
     NameDictionary::NameDictionary()
-    {}
+    {
+        using namespace NameDictionaryInternal;
+
+        // The generation is stored in the environment so it keeps increasing when the dictionary is recreated by a different module
+        if (!s_generation)
+        {
+            s_generation = AZ::Environment::CreateVariable<uint64_t>(NameDictionaryGenerationName, uint64_t(0));
+        }
+        m_generation = ++(*s_generation);
+
+        RebuildLookupTable(InitialLookupTableCapacity);
+    }
 
     NameDictionary::~NameDictionary()
     {
@@ -87,11 +105,12 @@ namespace AZ
             Internal::NameData* nameData = keyValue.second;
             const int useCount = keyValue.second->m_useCount;
             const bool hadCollision = keyValue.second->m_hashCollision;
+            const bool isLiteral = keyValue.second->m_isLiteral;
 
             if (useCount == 0)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                // Entries that had resolved hash collisions or are cached by a NameLiteral are allowed to remain in the dictionary until shutdown.
+                AZ_Assert(hadCollision || isLiteral, "Only colliding names and name literals are allowed to remain in the dictionary");
                 delete nameData;
             }
             else
@@ -101,11 +120,26 @@ namespace AZ
             }
         }
 
+        for (Internal::NameData* nameData : m_freeNameData)
+        {
+            delete nameData;
+        }
+
         AZ_Assert(!leaksDetected, "AZ::NameDictionary still has active name references. See debug output for the list of leaked names.");
     }
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
+        if (Internal::NameData* nameData = TryAcquireName(hash))
+        {
+            // Hand the reference acquired by the lookup over to the Name
+            Name name(nameData);
+            --nameData->m_useCount;
+            return name;
+        }
+
+        // The lock free lookup can miss entries that are being moved by a concurrent insertion or removal,
+        // so a miss has to be confirmed with the lock held.
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
         auto iter = m_dictionary.find(hash);
         if (iter != m_dictionary.end())
@@ -115,7 +149,20 @@ namespace AZ
         return Name();
     }
 
+    void NameDictionary::PreInternNames(AZStd::initializer_list<const NameLiteral*> nameLiterals)
+    {
+        for (const NameLiteral* nameLiteral : nameLiterals)
+        {
+            nameLiteral->GetName();
+        }
+    }
+
     Name NameDictionary::MakeName(AZStd::string_view nameString)
+    {
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
     {
         // Null strings should return empty.
         if (nameString.empty())
@@ -123,15 +170,17 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
-
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
+        // This path is faster than the loop below because TryAcquireName() doesn't take any locks whereas the
         // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
-        if (name.GetStringView() == nameString)
+        if (Internal::NameData* nameData = TryAcquireName(hash))
         {
-            return AZStd::move(name);
+            Name name(nameData);
+            --nameData->m_useCount;
+            if (name.GetStringView() == nameString)
+            {
+                return name;
+            }
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
@@ -144,9 +193,10 @@ namespace AZ
             // No existing entry, add a new one and we're done
             if (iter == m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                Internal::NameData* nameData = AllocateNameData(nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
                 m_dictionary.emplace(hash, nameData);
+                InsertLookupEntry(nameData);
                 return Name(nameData);
             }
             // Found the desired entry, return it
@@ -165,6 +215,32 @@ namespace AZ
         }
     }
 
+    Name NameDictionary::ResolveLiteral(const NameLiteral& nameLiteral)
+    {
+        Name name = MakeName(nameLiteral.m_literal, nameLiteral.m_hash);
+        if (!name.IsEmpty())
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+
+            // Names resolved for literals stay in the dictionary until it is destroyed, so the literal can
+            // cache the NameData without holding a reference to it.
+            name.m_data->m_isLiteral = true;
+            nameLiteral.m_data.store(name.m_data.get(), AZStd::memory_order_relaxed);
+            nameLiteral.m_generation.store(m_generation, AZStd::memory_order_release);
+        }
+        return name;
+    }
+
+    Name NameLiteral::GetName() const
+    {
+        NameDictionary& nameDictionary = NameDictionary::Instance();
+        if (m_generation.load(AZStd::memory_order_acquire) == nameDictionary.m_generation)
+        {
+            return Name(m_data.load(AZStd::memory_order_relaxed));
+        }
+        return nameDictionary.ResolveLiteral(*this);
+    }
+
     void NameDictionary::TryReleaseName(Internal::NameData* nameData)
     {
         // Note that we don't remove NameData from the dictionary if it has been involved in a collision.
@@ -178,8 +254,10 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
+        // Names cached by a NameLiteral are kept in the dictionary for the same reason.
+
         // Early exit to avoid locking the mutex unnecessarily.
-        if (nameData->m_hashCollision)
+        if (nameData->m_hashCollision || nameData->m_isLiteral)
         {
             return;
         }
@@ -188,7 +266,7 @@ namespace AZ
 
         // Check m_hashCollision again inside the m_sharedMutex because a new collision could have happened
         // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
+        if (nameData->m_hashCollision || nameData->m_isLiteral)
         {
             return;
         }
@@ -200,8 +278,16 @@ namespace AZ
         int32_t expectedRefCount = 0;
         if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
         {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // The NameData may belong to a previous dictionary if the Name was leaked, in which case it isn't in this one
+            auto iter = m_dictionary.find(nameData->GetHash());
+            if (iter != m_dictionary.end() && iter->second == nameData)
+            {
+                m_dictionary.erase(iter);
+                RemoveLookupEntry(nameData);
+            }
+
+            // Lock free readers may still hold a pointer to the NameData, so it's kept for reuse instead of being deleted
+            m_freeNameData.push_back(nameData);
         }
 
         ReportStats();
@@ -272,11 +358,130 @@ namespace AZ
 #endif // AZ_DEBUG_BUILD
     }
 
-    Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
+    Internal::NameData* NameDictionary::AllocateNameData(AZStd::string_view nameString, Name::Hash hash)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        if (m_freeNameData.empty())
+        {
+            return aznew Internal::NameData(nameString, hash);
+        }
+
+        Internal::NameData* nameData = m_freeNameData.back();
+        m_freeNameData.pop_back();
+        nameData->m_name = nameString;
+        nameData->m_hash = hash;
+        nameData->m_hashCollision = false;
+        nameData->m_isLiteral = false;
+
+        // The use count is reset last, because that allows lock free readers that still hold a pointer to this NameData to reference it again
+        nameData->m_useCount.store(0, AZStd::memory_order_release);
+        return nameData;
+    }
+
+    NameDictionary::LookupTable::LookupTable(uint32_t capacity)
+        : m_mask(capacity - 1)
+        , m_hashes(new AZStd::atomic<Name::Hash>[capacity]())
+        , m_entries(new AZStd::atomic<Internal::NameData*>[capacity]())
+    {
+        AZ_Assert(AZ::IsPowerOfTwo(capacity), "LookupTable capacity must be a power of two");
+    }
+
+    Internal::NameData* NameDictionary::TryAcquireName(Name::Hash hash) const
+    {
+        const LookupTable* table = m_lookupTable.load(AZStd::memory_order_acquire);
+        const uint32_t mask = table->m_mask;
+        for (uint32_t probe = 0, slot = hash & mask; probe <= mask; ++probe, slot = (slot + 1) & mask)
+        {
+            Internal::NameData* nameData = table->m_entries[slot].load(AZStd::memory_order_acquire);
+            if (nameData == nullptr)
+            {
+                return nullptr;
+            }
+
+            if (table->m_hashes[slot].load(AZStd::memory_order_relaxed) == hash && nameData->TryAddRef())
+            {
+                // The NameData may have been released and reused for a different name after it was read from the table,
+                // it can't change anymore now that we hold a reference to it
+                if (nameData->m_hash == hash)
+                {
+                    return nameData;
+                }
+                nameData->release();
+            }
+        }
+        return nullptr;
+    }
+
+    void NameDictionary::InsertLookupEntry(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        if (m_dictionary.size() * 2 > table->m_mask + 1)
+        {
+            // The new table is built from m_dictionary, which already contains the new entry
+            RebuildLookupTable((table->m_mask + 1) * 2);
+            return;
+        }
+
+        uint32_t slot = nameData->m_hash & table->m_mask;
+        while (table->m_entries[slot].load(AZStd::memory_order_relaxed) != nullptr)
+        {
+            slot = (slot + 1) & table->m_mask;
+        }
+        table->m_hashes[slot].store(nameData->m_hash, AZStd::memory_order_relaxed);
+        table->m_entries[slot].store(nameData, AZStd::memory_order_release);
+    }
+
+    void NameDictionary::RemoveLookupEntry(Internal::NameData* nameData)
+    {
+        LookupTable* table = m_lookupTable.load(AZStd::memory_order_relaxed);
+        const uint32_t mask = table->m_mask;
+
+        uint32_t hole = nameData->m_hash & mask;
+        while (table->m_entries[hole].load(AZStd::memory_order_relaxed) != nameData)
+        {
+            if (table->m_entries[hole].load(AZStd::memory_order_relaxed) == nullptr)
+            {
+                return;
+            }
+            hole = (hole + 1) & mask;
+        }
+
+        // Shift the rest of the probe sequence back instead of leaving a tombstone, so lookups never stop early at the removed entry.
+        // An entry can fill the hole if its home slot isn't cyclically between the hole and the entry.
+        for (uint32_t slot = (hole + 1) & mask; ; slot = (slot + 1) & mask)
+        {
+            Internal::NameData* entry = table->m_entries[slot].load(AZStd::memory_order_relaxed);
+            if (entry == nullptr)
+            {
+                break;
+            }
+
+            const Name::Hash entryHash = table->m_hashes[slot].load(AZStd::memory_order_relaxed);
+            if (((slot - (entryHash & mask)) & mask) >= ((slot - hole) & mask))
+            {
+                table->m_hashes[hole].store(entryHash, AZStd::memory_order_relaxed);
+                table->m_entries[hole].store(entry, AZStd::memory_order_release);
+                hole = slot;
+            }
+        }
+        table->m_entries[hole].store(nullptr, AZStd::memory_order_release);
+    }
+
+    void NameDictionary::RebuildLookupTable(uint32_t capacity)
+    {
+        AZStd::unique_ptr<LookupTable> table = AZStd::make_unique<LookupTable>(capacity);
+        for (const auto& keyValue : m_dictionary)
+        {
+            uint32_t slot = keyValue.first & table->m_mask;
+            while (table->m_entries[slot].load(AZStd::memory_order_relaxed) != nullptr)
+            {
+                slot = (slot + 1) & table->m_mask;
+            }
+            table->m_hashes[slot].store(keyValue.first, AZStd::memory_order_relaxed);
+            table->m_entries[slot].store(keyValue.second, AZStd::memory_order_relaxed);
+        }
+
+        // Publishing the table makes all of its entries visible to lock free readers
+        m_lookupTable.store(table.get(), AZStd::memory_order_release);
+        m_lookupTables.push_back(AZStd::move(table));
     }
 }
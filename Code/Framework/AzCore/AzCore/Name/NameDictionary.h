@@ -8,9 +8,12 @@
 #pragma once
 
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/Name/Name.h>
@@ -28,6 +31,7 @@ namespace UnitTest
 namespace AZ
 {
     class Module;
+    class NameLiteral;
 
     namespace Internal
     {
@@ -42,12 +46,18 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't 
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names 
     //! that already exist.
+    //!
+    //! Looking up a name that already exists doesn't take any locks. The dictionary is mirrored in an
+    //! open addressing table that is only modified while the dictionary is locked for writing, and that
+    //! readers probe using atomic loads. A reader that misses, e.g. because an entry is being moved by
+    //! a concurrent insertion or removal, falls back to the locked path.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
 
         friend Module;
         friend Name;
+        friend NameLiteral;
         friend Internal::NameData;
         friend UnitTest::NameDictionaryTester;
         
@@ -71,12 +81,31 @@ namespace AZ
         //! @return A Name instance. If the hash was not found, the Name will be empty.
         Name FindName(Name::Hash hash) const;
 
+        //! Resolves a list of name literals ahead of time, so that not even the first use of each literal
+        //! needs to access the dictionary.
+        void PreInternNames(AZStd::initializer_list<const NameLiteral*> nameLiterals);
+
+        //! Calculates a hash for the provided name string.
+        //! Does not attempt to resolve hash collisions; that is handled elsewhere.
+        static constexpr Name::Hash CalcHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Name::Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
     private:
         NameDictionary();
         ~NameDictionary();
 
         void ReportStats() const;
 
+        // Makes a Name from a raw string and its hash before collision resolution.
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
+        // Makes the Name for a literal and caches it in the literal.
+        Name ResolveLiteral(const NameLiteral& nameLiteral);
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
@@ -86,11 +115,47 @@ namespace AZ
         
         //////////////////////////////////////////////////////////////////////////
 
-        // Calculates a hash for the provided name string.
-        // Does not attempt to resolve hash collisions; that is handled elsewhere.
-        Name::Hash CalcHash(AZStd::string_view name);
-                
+        // Creates a new NameData, reusing a released one if possible.
+        Internal::NameData* AllocateNameData(AZStd::string_view name, Name::Hash hash);
+
+        //////////////////////////////////////////////////////////////////////////
+        // Lock free lookup table
+
+        // Finds the NameData with the provided hash without taking any locks, and adds a reference to it.
+        // Returns nullptr if the name wasn't found, which may happen spuriously while the table is being modified.
+        Internal::NameData* TryAcquireName(Name::Hash hash) const;
+
+        // These must be called with m_sharedMutex locked exclusively, after the NameData has been added to or removed from m_dictionary.
+        void InsertLookupEntry(Internal::NameData* nameData);
+        void RemoveLookupEntry(Internal::NameData* nameData);
+        void RebuildLookupTable(uint32_t capacity);
+
+        struct LookupTable
+        {
+            AZ_CLASS_ALLOCATOR(LookupTable, AZ::OSAllocator, 0);
+
+            explicit LookupTable(uint32_t capacity);
+
+            uint32_t m_mask;
+            AZStd::unique_ptr<AZStd::atomic<Name::Hash>[]> m_hashes;
+            AZStd::unique_ptr<AZStd::atomic<Internal::NameData*>[]> m_entries;
+        };
+
+        //////////////////////////////////////////////////////////////////////////
+
         AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
         mutable AZStd::shared_mutex m_sharedMutex;
+
+        // The table used by lock free lookups. Tables that have been replaced by a larger one are kept alive
+        // until the dictionary is destroyed, because readers may still be probing them.
+        AZStd::atomic<LookupTable*> m_lookupTable = nullptr;
+        AZStd::vector<AZStd::unique_ptr<LookupTable>> m_lookupTables;
+
+        // Released NameData objects are reused instead of being deleted, because lock free readers may still
+        // hold a pointer to them. TryAddRef() fails for these until they are reused.
+        AZStd::vector<Internal::NameData*> m_freeNameData;
+
+        // Increases every time a dictionary is created, so NameLiterals can tell which dictionary they were resolved in.
+        uint64_t m_generation = 0;
     };
 }
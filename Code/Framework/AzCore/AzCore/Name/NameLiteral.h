@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Name/Name.h>
+#include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace AZ
+{
+    //! A Name for a string literal, for hot paths that would otherwise construct the same Name from a string over and over.
+    //! The hash of the literal is calculated at compile time, and the literal is resolved against the NameDictionary the
+    //! first time it's used, or ahead of time with NameDictionary::PreInternNames(). After that GetName() neither hashes
+    //! the string nor accesses the dictionary. A resolved name stays in the dictionary until the dictionary is destroyed.
+    //!
+    //! Unlike Name, a NameLiteral can be statically declared:
+    //!     static AZ::NameLiteral s_baseColorName{ "baseColor" };
+    //!     material->SetPropertyValue(s_baseColorName.GetName(), color);
+    class NameLiteral final
+    {
+        friend NameDictionary;
+    public:
+        constexpr explicit NameLiteral(AZStd::string_view literal)
+            : m_literal(literal)
+            , m_hash(NameDictionary::CalcHash(literal))
+        {}
+
+        AZ_DISABLE_COPY_MOVE(NameLiteral);
+
+        //! Returns the Name for this literal, resolving it against the NameDictionary on first use.
+        Name GetName() const;
+
+        //! Returns the literal string.
+        AZStd::string_view GetStringView() const
+        {
+            return m_literal;
+        }
+
+    private:
+        AZStd::string_view m_literal;
+        Name::Hash m_hash; //< The hash of the literal before any hash collision is resolved
+
+        // The NameData does not hold a reference, the dictionary keeps names resolved for literals until it is destroyed.
+        // m_generation identifies the dictionary m_data was resolved in, it's 0 if the literal hasn't been resolved yet.
+        mutable AZStd::atomic<Internal::NameData*> m_data = nullptr;
+        mutable AZStd::atomic<uint64_t> m_generation = 0;
+    };
+} // namespace AZ
+
+//! Returns the Name for a string literal, which is only resolved against the NameDictionary the first time it's evaluated.
+#define AZ_NAME_LITERAL(str) ([]() -> AZ::Name { static AZ::NameLiteral s_nameLiteral{ str }; return s_nameLiteral.GetName(); }())
@@ -363,6 +363,20 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            /// Returns the address of the first element, the elements are stored contiguously.
+            void* GetContiguousElements(void* instance) override
+            {
+                return reinterpret_cast<T*>(instance)->data();
+            }
+
+            /// Resizes the container and returns the address of the first element.
+            void* ResizeContiguousElements(void* instance, size_t elementCount) override
+            {
+                auto arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(elementCount);
+                return arrayPtr->data();
+            }
         };
         template<class T, bool IsStableIterators, size_t N>
         class AZStdFixedCapacityRandomAccessContainer
@@ -394,6 +408,18 @@ namespace AZ
                 }
                 return nullptr;
             }
+
+            /// Resizes the container if elementCount fits in its capacity.
+            void* ResizeContiguousElements(void* instance, size_t elementCount) override
+            {
+                if (elementCount > N)
+                {
+                    return nullptr;
+                }
+                T* arrayPtr = reinterpret_cast<T*>(instance);
+                arrayPtr->resize(elementCount);
+                return arrayPtr->data();
+            }
         };
 
         class AZStdArrayEvents : public SerializeContext::IEventHandler
@@ -542,6 +568,18 @@ namespace AZ
                 return nullptr;
             }
 
+            /// Returns the address of the first element, the elements are stored contiguously.
+            void*   GetContiguousElements(void* instance) override
+            {
+                return reinterpret_cast<ContainerType*>(instance)->data();
+            }
+
+            /// The array has a fixed size, so only a matching element count can be loaded in place.
+            void*   ResizeContiguousElements(void* instance, size_t elementCount) override
+            {
+                return elementCount == N ? reinterpret_cast<ContainerType*>(instance)->data() : nullptr;
+            }
+
             /// Store element
             void    StoreElement(void* instance, void* element) override
             {
@@ -10,6 +10,7 @@
 #include <AzCore/Serialization/DataPatch.h>
 #include <AzCore/Serialization/DataPatchBus.h>
 #include <AzCore/Serialization/DataPatchUpgradeManager.h>
+#include <AzCore/Serialization/DynamicSerializableField.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Outcome/Outcome.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
@@ -48,11 +49,13 @@ namespace AZ
             m_children.clear();
             m_classData = nullptr;
             m_classElement = nullptr;
+            m_hash = 0;
         }
 
         void*           m_data;
         DataNode*       m_parent;
         ChildDataNodes  m_children;
+        AZ::u64         m_hash;         ///< Structural hash of the type, element names and values of this node and all its children.
 
         const SerializeContext::ClassData*      m_classData;
         const SerializeContext::ClassElement*   m_classElement;
@@ -66,7 +69,8 @@ namespace AZ
             , m_context(context)
         {}
 
-        void Build(const void* classPtr, const Uuid& classId);
+        /// Build the tree for an object. Structural hashes are only calculated if requested, they're only used for comparing trees.
+        void Build(const void* classPtr, const Uuid& classId, bool calculateHashes = false);
 
         bool BeginNode(
             void* ptr,
@@ -74,6 +78,9 @@ namespace AZ
             const SerializeContext::ClassElement* classElement);
         bool EndNode();
 
+        /// Calculate the structural hash of a node from its own value and the hashes of its children.
+        void CalculateStructuralHash(DataNode& node);
+
         /// Compare two nodes and fill the patch structure
         static void CompareElements(
             const DataNode* sourceNode,
@@ -92,7 +99,8 @@ namespace AZ
             SerializeContext* context,
             AddressType& address,
             DataPatch::Flags parentAddressFlags,
-            AZStd::vector<AZ::u8>& tmpSourceBuffer);
+            AZStd::vector<AZ::u8>& tmpSourceBuffer,
+            bool skipEqualSubtrees);
 
         /// Apply patch to elements, return a valid pointer only for the root element
         static void* ApplyToElements(
@@ -128,10 +136,30 @@ namespace AZ
             const AZ::SerializeContext::ClassData* parentClassData,
             const AZ::ObjectStream::FilterDescriptor& filterDesc);
 
+        /// Find the instance and class data an address points to by walking the reflection of an existing object, without
+        /// building a tree for it. Returns false if the address can't be found or passes through data that can't be patched in place.
+        static bool ResolveAddressInPlace(
+            SerializeContext& context,
+            const AddressType& address,
+            const DataPatch::FlagsMap& sourceFlagsMap,
+            const DataPatch::FlagsMap& targetFlagsMap,
+            void*& instance,
+            const SerializeContext::ClassData*& classData,
+            DataPatch::Flags& addressFlags);
+
+        static bool ResolveElementInPlace(
+            SerializeContext& context,
+            const Uuid& classId,
+            const SerializeContext::ClassElement& classElement,
+            void*& instance,
+            const SerializeContext::ClassData*& classData);
+
         DataNode m_root;
         DataNode* m_currentNode;        ///< Used as temp during tree building
         SerializeContext* m_context;
         AZStd::list<SerializeContext::ClassElement> m_dynamicClassElements; ///< Storage for class elements that represent dynamic serializable fields.
+        AZStd::vector<AZ::u8> m_hashBuffer; ///< Used as temp to store leaf values while calculating hashes.
+        bool m_calculateHashes = false;
     };
 
     static bool ConvertLegacyBoolToEnum(AZ::SerializeContext& context, AZStd::any& patchAny, const DataNode& sourceNode);
@@ -140,12 +168,13 @@ namespace AZ
     //=========================================================================
     // DataNodeTree::Build
     //=========================================================================
-    void DataNodeTree::Build(const void* rootClassPtr, const Uuid& rootClassId)
+    void DataNodeTree::Build(const void* rootClassPtr, const Uuid& rootClassId, bool calculateHashes)
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
 
         m_root.Reset();
         m_currentNode = nullptr;
+        m_calculateHashes = calculateHashes;
 
         if (m_context && rootClassPtr)
         {
@@ -228,6 +257,12 @@ namespace AZ
     //=========================================================================
     bool DataNodeTree::EndNode()
     {
+        // All children have been added at this point, so the hash of the node can be completed.
+        if (m_calculateHashes)
+        {
+            CalculateStructuralHash(*m_currentNode);
+        }
+
         if (m_currentNode->m_classData->m_eventHandler)
         {
             m_currentNode->m_classData->m_eventHandler->OnReadEnd(m_currentNode->m_data);
@@ -237,6 +272,31 @@ namespace AZ
         return true;
     }
 
+    //=========================================================================
+    // DataNodeTree::CalculateStructuralHash
+    //=========================================================================
+    void DataNodeTree::CalculateStructuralHash(DataNode& node)
+    {
+        AZStd::size_t hash = 0;
+        AZStd::hash_combine(hash, node.m_classData->m_typeId);
+
+        if (node.m_classData->m_serializer)
+        {
+            // Leaf values are hashed in the same form they would be stored in a patch.
+            m_hashBuffer.clear();
+            IO::ByteContainerStream<AZStd::vector<AZ::u8>> valueStream(&m_hashBuffer);
+            node.m_classData->m_serializer->Save(node.m_data, valueStream);
+            AZStd::hash_combine(hash, AZStd::hash_string(m_hashBuffer.begin(), m_hashBuffer.size()));
+        }
+
+        for (const DataNode& child : node.m_children)
+        {
+            AZStd::hash_combine(hash, child.m_classElement ? child.m_classElement->m_nameCrc : 0, child.m_hash);
+        }
+
+        node.m_hash = hash;
+    }
+
     //=========================================================================
     // DataNodeTree::CompareElements
     //=========================================================================
@@ -251,6 +311,18 @@ namespace AZ
         AddressType tmpAddress;
         AZStd::vector<AZ::u8> tmpSourceBuffer;
 
+        // ForceOverride stores values even if they're identical to the source, so identical subtrees can only be skipped
+        // if it isn't set anywhere.
+        bool skipEqualSubtrees = true;
+        for (const auto& targetFlags : targetFlagsMap)
+        {
+            if (targetFlags.second & (DataPatch::Flag::ForceOverrideSet | DataPatch::Flag::ForceOverrideEffect))
+            {
+                skipEqualSubtrees = false;
+                break;
+            }
+        }
+
         CompareElementsInternal(
             sourceNode,
             targetNode,
@@ -260,7 +332,8 @@ namespace AZ
             context,
             tmpAddress,
             0,
-            tmpSourceBuffer);
+            tmpSourceBuffer,
+            skipEqualSubtrees);
     }
 
     //=========================================================================
@@ -275,7 +348,8 @@ namespace AZ
         SerializeContext* context,
         AddressType& address,
         DataPatch::Flags parentAddressFlags,
-        AZStd::vector<AZ::u8>& tmpSourceBuffer)
+        AZStd::vector<AZ::u8>& tmpSourceBuffer,
+        bool skipEqualSubtrees)
     {
         // calculate the flags affecting this address
         DataPatch::Flags addressFlags = CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, parentAddressFlags, address);
@@ -299,6 +373,12 @@ namespace AZ
             return;
         }
 
+        // Subtrees with the same structural hash hold the same data, so there is nothing to patch below this address.
+        if (skipEqualSubtrees && sourceNode->m_hash == targetNode->m_hash)
+        {
+            return;
+        }
+
         if (targetNode->m_classData->m_container)
         {
             AZStd::unordered_map<const DataNode*, AZStd::pair<u64, bool>> nodesToRemove;
@@ -372,7 +452,8 @@ namespace AZ
                         context,
                         address,
                         addressFlags,
-                        tmpSourceBuffer);
+                        tmpSourceBuffer,
+                        skipEqualSubtrees);
                 }
                 else
                 {
@@ -480,7 +561,8 @@ namespace AZ
                         context,
                         address,
                         addressFlags,
-                        tmpSourceBuffer);
+                        tmpSourceBuffer,
+                        skipEqualSubtrees);
 
                     address.pop_back();
                 }
@@ -1272,6 +1354,146 @@ namespace AZ
         return flags;
     }
 
+    //=========================================================================
+    // DataNodeTree::ResolveElementInPlace
+    //=========================================================================
+    bool DataNodeTree::ResolveElementInPlace(
+        SerializeContext& context,
+        const Uuid& classId,
+        const SerializeContext::ClassElement& classElement,
+        void*& instance,
+        const SerializeContext::ClassData*& classData)
+    {
+        // Follows the same rules SerializeContext::EnumerateInstance uses to find the object and class of an element,
+        // so the result matches the node that would have been built for it.
+        if (classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+        {
+            instance = *reinterpret_cast<void**>(instance);
+            if (!instance)
+            {
+                return false;
+            }
+
+            if (classElement.m_azRtti)
+            {
+                const Uuid& actualClassId = classElement.m_azRtti->GetActualUuid(instance);
+                if (actualClassId != classId)
+                {
+                    classData = context.FindClassData(actualClassId);
+                    if (!classData || !classData->m_azRtti)
+                    {
+                        return false;
+                    }
+                    instance = classElement.m_azRtti->Cast(instance, classData->m_azRtti->GetTypeId());
+                    if (!instance)
+                    {
+                        return false;
+                    }
+                }
+            }
+        }
+
+        if (!classData)
+        {
+            classData = context.FindClassData(classId);
+        }
+        return classData != nullptr;
+    }
+
+    //=========================================================================
+    // DataNodeTree::ResolveAddressInPlace
+    //=========================================================================
+    bool DataNodeTree::ResolveAddressInPlace(
+        SerializeContext& context,
+        const AddressType& address,
+        const DataPatch::FlagsMap& sourceFlagsMap,
+        const DataPatch::FlagsMap& targetFlagsMap,
+        void*& instance,
+        const SerializeContext::ClassData*& classData,
+        DataPatch::Flags& addressFlags)
+    {
+        AddressType elementAddress;
+        elementAddress.reserve(address.size());
+        addressFlags = CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, 0, elementAddress);
+
+        for (const AddressTypeElement& addressElement : address)
+        {
+            // Event handlers expect to be notified of writes and dynamic fields own their data, neither can be patched in place.
+            if (classData->m_eventHandler || classData->m_serializer ||
+                classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid())
+            {
+                return false;
+            }
+
+            void* elementInstance = nullptr;
+            const SerializeContext::ClassData* elementClassData = nullptr;
+            if (classData->m_container)
+            {
+                // Only containers that keep their elements in order are walked, changing values in place in
+                // associative containers could break their ordering.
+                if (!classData->m_container->CanAccessElementsByIndex())
+                {
+                    return false;
+                }
+
+                u64 elementIndex = 0;
+                auto findElement = [&](void* elementPtr, const Uuid& elementClassId, const SerializeContext::ClassData* genericClassData,
+                    const SerializeContext::ClassElement* genericClassElement)
+                {
+                    void* candidate = elementPtr;
+                    const SerializeContext::ClassData* candidateClassData = genericClassData;
+                    if (genericClassElement && ResolveElementInPlace(context, elementClassId, *genericClassElement, candidate, candidateClassData))
+                    {
+                        // Use the same ids as CompareElementsInternal: the persistent id if there is one, otherwise the index.
+                        // Null pointers aren't part of the data tree so they don't count towards the index.
+                        SerializeContext::ClassPersistentId persistentIdFunction = candidateClassData->GetPersistentId(context);
+                        u64 elementId = persistentIdFunction ? persistentIdFunction(candidate) : elementIndex;
+                        if (elementId == addressElement.GetAddressElement())
+                        {
+                            elementInstance = candidate;
+                            elementClassData = candidateClassData;
+                            return false;
+                        }
+                        ++elementIndex;
+                    }
+                    return true;
+                };
+                classData->m_container->EnumElements(instance, findElement);
+            }
+            else
+            {
+                for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+                {
+                    if (classElement.m_nameCrc == addressElement.GetAddressElement())
+                    {
+                        void* candidate = reinterpret_cast<char*>(instance) + classElement.m_offset;
+                        const SerializeContext::ClassData* candidateClassData = classElement.m_genericClassInfo
+                            ? classElement.m_genericClassInfo->GetClassData()
+                            : context.FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+                        if (ResolveElementInPlace(context, classElement.m_typeId, classElement, candidate, candidateClassData))
+                        {
+                            elementInstance = candidate;
+                            elementClassData = candidateClassData;
+                        }
+                        break;
+                    }
+                }
+            }
+
+            if (!elementInstance)
+            {
+                return false;
+            }
+
+            elementAddress.push_back(addressElement);
+            addressFlags = CalculateDataFlagsAtThisAddress(sourceFlagsMap, targetFlagsMap, addressFlags, elementAddress);
+            instance = elementInstance;
+            classData = elementClassData;
+        }
+
+        return classData->m_eventHandler == nullptr;
+    }
+
     inline namespace DataPatchInternal
     {
         //=========================================================================
@@ -1736,10 +1958,47 @@ namespace AZ
         return *this;
     }
 
+    //=========================================================================
+    // SourceCache
+    //=========================================================================
+    DataPatch::SourceCache::SourceCache() = default;
+
+    //=========================================================================
+    // ~SourceCache
+    //=========================================================================
+    DataPatch::SourceCache::~SourceCache() = default;
+
+    //=========================================================================
+    // SourceCache::Reset
+    //=========================================================================
+    void DataPatch::SourceCache::Reset()
+    {
+        m_sourceTree.reset();
+        m_source = nullptr;
+        m_sourceClassId = Uuid::CreateNull();
+    }
+
+    //=========================================================================
+    // Create
+    //=========================================================================
+    bool DataPatch::Create(
+        const void* source,
+        const Uuid& sourceClassId,
+        const void* target,
+        const Uuid& targetClassId,
+        const FlagsMap& sourceFlagsMap,
+        const FlagsMap& targetFlagsMap,
+        SerializeContext* context)
+    {
+        SourceCache sourceCache;
+        return Create(sourceCache, source, sourceClassId, target, targetClassId, sourceFlagsMap, targetFlagsMap, context);
+    }
+
     //=========================================================================
     // Create
     //=========================================================================
     bool DataPatch::Create(
+        SourceCache& sourceCache,
         const void* source,
         const Uuid& sourceClassId,
         const void* target,
@@ -1795,12 +2054,19 @@ namespace AZ
         }
         else
         {
-            // Build the tree for the course and compare it against the target
-            DataNodeTree sourceTree(context);
-            sourceTree.Build(source, sourceClassId);
+            // Build the tree for the source, unless it's already cached, and compare it against the target
+            if (!sourceCache.m_sourceTree || sourceCache.m_source != source || sourceCache.m_sourceClassId != sourceClassId ||
+                sourceCache.m_sourceTree->m_context != context)
+            {
+                sourceCache.m_sourceTree = AZStd::make_unique<DataNodeTree>(context);
+                sourceCache.m_sourceTree->Build(source, sourceClassId, true);
+                sourceCache.m_source = source;
+                sourceCache.m_sourceClassId = sourceClassId;
+            }
+            DataNodeTree& sourceTree = *sourceCache.m_sourceTree;
 
             DataNodeTree targetTree(context);
-            targetTree.Build(target, targetClassId);
+            targetTree.Build(target, targetClassId, true);
 
             {
                 AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::Create:RecursiveCallToCompareElements");
@@ -1941,6 +2207,141 @@ namespace AZ
         return result;
     }
 
+    //=========================================================================
+    // ApplyInPlace
+    //=========================================================================
+    bool DataPatch::ApplyInPlace(
+        void* object,
+        const Uuid& classId,
+        SerializeContext* context,
+        const FlagsMap& sourceFlagsMap,
+        const FlagsMap& targetFlagsMap) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        if (!object)
+        {
+            AZ_Error("Serialization", false, "Can't apply patch to invalid object %p\n", object);
+            return false;
+        }
+
+        if (!context)
+        {
+            EBUS_EVENT_RESULT(context, ComponentApplicationBus, GetSerializeContext);
+            if (!context)
+            {
+                AZ_Error("Serialization", false, "No serialize context provided! Failed to get component application default serialize context! ComponentApp is not started or input serialize context should not be null!");
+                return false;
+            }
+        }
+
+        if (classId != m_targetClassId)
+        {
+            return false;
+        }
+
+        if (m_patch.empty())
+        {
+            return true;
+        }
+
+        const SerializeContext::ClassData* rootClassData = context->FindClassData(classId);
+        if (!rootClassData)
+        {
+            AZ_Error("Serialization", false, "Can't find class data for the type Uuid %s.", classId.ToString<AZStd::string>().c_str());
+            return false;
+        }
+
+        // Copy the patch so we can repair it before application.
+        PatchMap fixedPatch;
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "DataPatch::ApplyInPlace:UpgradeDataPatch");
+            for (PatchMap::value_type patch : m_patch)
+            {
+                DataPatchUpgradeManager::UpgradeDataPatch(context, m_targetClassId, m_targetClassVersion, patch.first, patch.second);
+                fixedPatch.insert(AZStd::move(patch));
+            }
+        }
+
+        // Find all values before changing anything, so the object is left untouched if any part of the patch can't be applied in place.
+        struct ValuePatch
+        {
+            void* m_instance;
+            const SerializeContext::ClassData* m_classData;
+            AZStd::any* m_value;
+        };
+        AZStd::vector<ValuePatch> valuePatches;
+        valuePatches.reserve(fixedPatch.size());
+        for (auto& patch : fixedPatch)
+        {
+            // Replacing the root and removing elements require the object to be rebuilt.
+            if (patch.first.empty() || !patch.first.IsValid() || patch.second.empty() ||
+                patch.second.type() == azrtti_typeid<DataPatch::LegacyStreamWrapper>())
+            {
+                return false;
+            }
+
+            void* instance = object;
+            const SerializeContext::ClassData* classData = rootClassData;
+            Flags addressFlags = 0;
+            if (!DataNodeTree::ResolveAddressInPlace(*context, patch.first, sourceFlagsMap, targetFlagsMap, instance, classData, addressFlags))
+            {
+                return false;
+            }
+
+            if (addressFlags & Flag::PreventOverrideEffect)
+            {
+                continue;
+            }
+
+            // All Asset patches are typed to AZ::Data::Asset<AZ::Data::AssetData>>, see ApplyToElements.
+            AZ::TypeId patchDataTypeId = patch.second.type();
+            if (patchDataTypeId == azrtti_typeid<AZ::Data::Asset<AZ::Data::AssetData>>())
+            {
+                patchDataTypeId = AZ::GetAssetClassId();
+            }
+
+            // Only values stored by a serializer are overwritten, anything else would have to be recreated.
+            if (!classData->m_serializer || classData->m_typeId != patchDataTypeId)
+            {
+                return false;
+            }
+
+            valuePatches.push_back({ instance, classData, &patch.second });
+        }
+
+        // Keep the current values, so the values already written can be restored if a value fails to load.
+        AZStd::vector<AZStd::vector<AZ::u8>> originalValues(valuePatches.size());
+        for (size_t patchIndex = 0; patchIndex < valuePatches.size(); ++patchIndex)
+        {
+            const ValuePatch& valuePatch = valuePatches[patchIndex];
+            IO::ByteContainerStream<AZStd::vector<AZ::u8>> originalStream(&originalValues[patchIndex]);
+            valuePatch.m_classData->m_serializer->Save(valuePatch.m_instance, originalStream);
+        }
+
+        AZStd::vector<AZ::u8> tmpSourceBuffer;
+        for (size_t patchIndex = 0; patchIndex < valuePatches.size(); ++patchIndex)
+        {
+            const ValuePatch& valuePatch = valuePatches[patchIndex];
+            tmpSourceBuffer.clear();
+            IO::ByteContainerStream<AZStd::vector<AZ::u8>> sourceStream(&tmpSourceBuffer);
+            valuePatch.m_classData->m_serializer->Save(AZStd::any_cast<void>(valuePatch.m_value), sourceStream);
+            IO::MemoryStream targetStream(tmpSourceBuffer.data(), tmpSourceBuffer.size());
+            if (!valuePatch.m_classData->m_serializer->Load(valuePatch.m_instance, targetStream, valuePatch.m_classData->m_version))
+            {
+                // Restore the failed value too, a serializer can fail after it has written part of it.
+                for (size_t restoreIndex = patchIndex + 1; restoreIndex-- > 0;)
+                {
+                    const ValuePatch& restorePatch = valuePatches[restoreIndex];
+                    IO::MemoryStream originalStream(originalValues[restoreIndex].data(), originalValues[restoreIndex].size());
+                    restorePatch.m_classData->m_serializer->Load(restorePatch.m_instance, originalStream, restorePatch.m_classData->m_version);
+                }
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
     * Helper method to convert over the legacy bytestream format to using AZStd::any to store patch data
     */
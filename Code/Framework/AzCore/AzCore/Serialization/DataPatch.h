@@ -171,6 +171,8 @@ namespace AZStd
 //! Reopen namespace to define DataPatch class
 namespace AZ
 {
+    class DataNodeTree;
+
     /**
     * Structure that contains patch data for a given class. The primary goal of this
     * object is to help with tools (slices and undo/redo), this structure is not recommended to
@@ -227,6 +229,33 @@ namespace AZ
             AZStd::vector<AZ::u8> m_stream;
         };
 
+        /**
+         * Keeps the data tree of a source object alive between calls to Create, together with the structural hash of each of its
+         * subtrees. Creating several patches against the same source, such as when overrides of an instance are recomputed after
+         * every edit, only requires the target to be walked again.
+         * The tree references the memory of the source object, so Reset has to be called when the source is modified or destroyed.
+         */
+        class SourceCache
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(SourceCache, SystemAllocator, 0);
+
+            SourceCache();
+            ~SourceCache();
+            SourceCache(const SourceCache&) = delete;
+            SourceCache& operator=(const SourceCache&) = delete;
+
+            /// Releases the cached tree. The next call to Create will build it again from the source.
+            void Reset();
+
+        private:
+            friend class DataPatch;
+
+            AZStd::unique_ptr<DataNodeTree> m_sourceTree;
+            const void* m_source = nullptr;
+            Uuid m_sourceClassId = Uuid::CreateNull();
+        };
+
         //! Alias the DataPatchInternal::AddressType inside the DataPatch declaration for backwards compatibility with DataPatch::AddressType
         using AddressTypeElement = DataPatchInternal::AddressTypeElement;
         using AddressType = DataPatchInternal::AddressType;
@@ -292,6 +321,37 @@ namespace AZ
             return Create(sourceClassPtr, sourceClassId, targetClassPtr, targetClassId, sourceFlagsMap, targetFlagsMap, context);
         }
 
+        /**
+         * Create a patch the same way as above, but reuse the source tree stored in \ref sourceCache.
+         * The cache is (re)built from the source if it was built for a different object. Subtrees of the target that have
+         * the same structural hash as the matching source subtree are skipped while comparing.
+         */
+        bool Create(
+            SourceCache& sourceCache,
+            const void* source,
+            const Uuid& sourceClassId,
+            const void* target,
+            const Uuid& targetClassId,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap(),
+            SerializeContext* context = nullptr);
+
+        template<class T, class U>
+        bool Create(
+            SourceCache& sourceCache,
+            const T* source,
+            const U* target,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap(),
+            SerializeContext* context = nullptr)
+        {
+            const void* sourceClassPtr = SerializeTypeInfo<T>::RttiCast(source, SerializeTypeInfo<T>::GetRttiTypeId(source));
+            const Uuid& sourceClassId = SerializeTypeInfo<T>::GetUuid(source);
+            const void* targetClassPtr = SerializeTypeInfo<U>::RttiCast(target, SerializeTypeInfo<U>::GetRttiTypeId(target));
+            const Uuid& targetClassId = SerializeTypeInfo<U>::GetUuid(target);
+            return Create(sourceCache, sourceClassPtr, sourceClassId, targetClassPtr, targetClassId, sourceFlagsMap, targetFlagsMap, context);
+        }
+
         /**
          * Apply the patch to a source instance and generate a patched instance, from a source instance.
          * If patch can't be applied a null pointer is returned. Currently the only reason for that is if
@@ -352,6 +412,38 @@ namespace AZ
             }
         }
 
+        /**
+         * Apply the patch directly to an existing instance instead of generating a new one. The instance is expected to
+         * hold the data of the source the patch was created from.
+         * Only patches that overwrite existing values can be applied in place. If the patch adds, removes or replaces
+         * elements, reaches data owned by a class with an event handler, or a value fails to load, the instance is left
+         * untouched and false is returned, in which case the full Apply has to be used instead.
+         *
+         * \param object pointer to the instance that will be patched.
+         * \param classId id of the class \ref object is pointing to, has to match the target class of the patch.
+         * \param context if null we will grab the default serialize context.
+         * \param sourceFlagsMap flags for source data. These may affect how a patch is applied (ex: prevent patching of specific addresses)
+         * \param targetFlagsMap flags for target data. These may affect how a patch is applied.
+         */
+        bool ApplyInPlace(
+            void* object,
+            const Uuid& classId,
+            SerializeContext* context = nullptr,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap()) const;
+
+        template<class T>
+        bool ApplyInPlace(
+            T* object,
+            SerializeContext* context = nullptr,
+            const FlagsMap& sourceFlagsMap = FlagsMap(),
+            const FlagsMap& targetFlagsMap = FlagsMap()) const
+        {
+            void* classPtr = SerializeTypeInfo<T>::RttiCast(object, SerializeTypeInfo<T>::GetRttiTypeId(object));
+            const Uuid& classId = SerializeTypeInfo<T>::GetUuid(object);
+            return ApplyInPlace(classPtr, classId, context, sourceFlagsMap, targetFlagsMap);
+        }
+
         /// \returns true if this is a valid patch.
         bool IsValid() const
         {
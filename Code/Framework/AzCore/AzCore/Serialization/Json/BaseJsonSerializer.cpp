@@ -65,9 +65,9 @@ namespace AZ
         return m_reporters.top();
     }
 
-    void JsonBaseContext::PushPath(AZStd::string_view child)
+    void JsonBaseContext::PushPath(AZStd::string_view child, StackedString::Storage storage)
     {
-        m_path.Push(child);
+        m_path.Push(child, storage);
     }
 
     void JsonBaseContext::PushPath(size_t index)
@@ -180,10 +180,10 @@ namespace AZ
     // ScopedContextPath
     //
 
-    ScopedContextPath::ScopedContextPath(JsonBaseContext& context, AZStd::string_view child)
+    ScopedContextPath::ScopedContextPath(JsonBaseContext& context, AZStd::string_view child, StackedString::Storage storage)
         : m_context(context)
     {
-        m_context.PushPath(child);
+        m_context.PushPath(child, storage);
     }
 
     ScopedContextPath::ScopedContextPath(JsonBaseContext& context, size_t index)
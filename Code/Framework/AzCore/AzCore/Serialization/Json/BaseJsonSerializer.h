@@ -48,7 +48,9 @@ namespace AZ
         JsonSerializationResult::JsonIssueCallback& GetReporter();
 
         //! Add a child name to the path.
-        void PushPath(AZStd::string_view child);
+        //! @param storage Use StackedString::Storage::Reference if the child name outlives the path entry, such as names from
+        //!     reflection or from the json document. This avoids building the path string until it's needed for a report.
+        void PushPath(AZStd::string_view child, StackedString::Storage storage = StackedString::Storage::Copy);
         //! Add an index to the path.
         void PushPath(size_t index);
         //! Remove a previously added entry to the path.
@@ -141,7 +143,8 @@ namespace AZ
     class ScopedContextPath
     {
     public:
-        ScopedContextPath(JsonBaseContext& context, AZStd::string_view child);
+        ScopedContextPath(JsonBaseContext& context, AZStd::string_view child,
+            StackedString::Storage storage = StackedString::Storage::Copy);
         ScopedContextPath(JsonBaseContext& context, size_t index);
         ~ScopedContextPath();
 
@@ -185,6 +185,9 @@ namespace AZ
 
         AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
 
+        const JsonSerializationPlan& plan =
+            context.GetRegistrationContext()->GetSerializationPlan(*context.GetSerializeContext(), classData);
+
         size_t numLoads = 0;
         ResultCode retVal(Tasks::ReadField);
         for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
@@ -195,13 +198,14 @@ namespace AZ
             {
                 continue;
             }
-            Crc32 nameCrc(name);
-            ElementDataResult foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            const JsonSerializationPlan::NamedField* field = plan.FindField(Crc32(name));
 
-            ScopedContextPath subPath(context, name);
-            if (foundElementData.m_found)
+            // The name is owned by the json document, which outlives the path entry.
+            ScopedContextPath subPath(context, name, StackedString::Storage::Reference);
+            if (field)
             {
-                ResultCode result = LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
+                void* fieldObject = reinterpret_cast<char*>(object) + field->m_offset;
+                ResultCode result = LoadField(fieldObject, val, *field->m_field, context);
                 retVal.Combine(result);
 
                 if (result.GetProcessing() == Processing::Halted)
@@ -220,8 +224,7 @@ namespace AZ
             }
         }
 
-        size_t elementCount = CountElements(*context.GetSerializeContext(), classData);
-        if (elementCount > numLoads)
+        if (plan.m_elementCount > numLoads)
         {
             retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
         }
@@ -229,6 +232,15 @@ namespace AZ
         return retVal;
     }
 
+    JsonSerializationResult::ResultCode JsonDeserializer::LoadField(void* object, const rapidjson::Value& value,
+        const JsonSerializationPlan::Field& field, JsonDeserializerContext& context)
+    {
+        // If the serializer for the field could be determined up front, skip resolving it again for every instance.
+        return field.m_serializer
+            ? DeserializerDefaultCheck(field.m_serializer, object, field.m_element->m_typeId, value, false, context)
+            : LoadWithClassElement(object, value, *field.m_element, context);
+    }
+
     JsonSerializationResult::ResultCode JsonDeserializer::LoadEnum(void* object, const SerializeContext::ClassData& classData,
         const rapidjson::Value& value, JsonDeserializerContext& context)
     {
@@ -860,63 +872,6 @@ namespace AZ
         return result;
     }
 
-    JsonDeserializer::ElementDataResult JsonDeserializer::FindElementByNameCrc(SerializeContext& serializeContext, 
-        void* object, const SerializeContext::ClassData& classData, const Crc32 nameCrc)
-    {
-        // The class data stores base class element information first in the set of m_elements
-        // We use a reverse iterator to ensure that derived class data takes precedence over base classes' data
-        // for the case of naming conflicts in the serialized data between base and derived classes
-        for (auto elementData = classData.m_elements.crbegin(); elementData != classData.m_elements.crend(); ++elementData)
-        {
-            if (elementData->m_nameCrc == nameCrc)
-            {
-                ElementDataResult result;
-                result.m_data = reinterpret_cast<void*>(reinterpret_cast<char*>(object) + elementData->m_offset);
-                result.m_info = &*elementData;
-                result.m_found = true;
-                return result;
-            }
-                
-            if (elementData->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
-            {
-                const SerializeContext::ClassData* baseClassData = serializeContext.FindClassData(elementData->m_typeId);
-                if (baseClassData)
-                {
-                    void* subclassOffset = reinterpret_cast<char*>(object) + elementData->m_offset;
-                    ElementDataResult foundElementData = FindElementByNameCrc(
-                        serializeContext, subclassOffset, *baseClassData, nameCrc);
-                    if (foundElementData.m_found)
-                    {
-                        return foundElementData;
-                    }
-                }
-            }
-        }
-
-        return ElementDataResult{};
-    }
-
-    size_t JsonDeserializer::CountElements(SerializeContext& serializeContext, const SerializeContext::ClassData& classData)
-    {
-        size_t count = 0;
-        for (auto& element : classData.m_elements)
-        {
-            if (element.m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
-            {
-                const SerializeContext::ClassData* baseClassData = serializeContext.FindClassData(element.m_typeId);
-                if (baseClassData)
-                {
-                    count += CountElements(serializeContext, *baseClassData);
-                }
-            }
-            else
-            {
-                count++;
-            }
-        }
-        return count;
-    }
-
     bool JsonDeserializer::IsExplicitDefault(const rapidjson::Value& value)
     {
         return value.IsObject() && value.MemberCount() == 0;
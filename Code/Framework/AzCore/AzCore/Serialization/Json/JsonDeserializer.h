@@ -10,6 +10,7 @@
 #include <AzCore/JSON/document.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/std/utils.h>
 
 namespace AZ
@@ -20,6 +21,7 @@ namespace AZ
     {
         friend class JsonSerialization;
         friend class BaseJsonSerializer;
+        friend class JsonStreamDeserializer;
 
     private:
         enum class ResolvePointerResult : bool
@@ -39,12 +41,6 @@ namespace AZ
             Uuid m_typeId;
             TypeIdDetermination m_determination;
         };
-        struct ElementDataResult
-        {
-            void* m_data{ nullptr };
-            const SerializeContext::ClassElement* m_info{ nullptr };
-            bool m_found{ false };
-        };
 
         JsonDeserializer() = delete;
         ~JsonDeserializer() = delete;
@@ -65,6 +61,9 @@ namespace AZ
         static JsonSerializationResult::ResultCode LoadClass(void* object, const SerializeContext::ClassData& classData, const rapidjson::Value& value,
             JsonDeserializerContext& context);
 
+        static JsonSerializationResult::ResultCode LoadField(void* object, const rapidjson::Value& value,
+            const JsonSerializationPlan::Field& field, JsonDeserializerContext& context);
+
         static JsonSerializationResult::ResultCode LoadEnum(void* object, const SerializeContext::ClassData& classData, const rapidjson::Value& value,
             JsonDeserializerContext& context);
 
@@ -97,15 +96,6 @@ namespace AZ
         static JsonSerializationResult::ResultCode LoadTypeId(Uuid& typeId, const rapidjson::Value& input, JsonDeserializerContext& context,
             const Uuid* baseTypeId = nullptr, bool* isExplicit = nullptr);
 
-        //! Searches the class data matching typeId at object for a child element that matches nameCrc
-        //! Sets the outSubclassTypeId to the found element data's typeId, and returns the offset pointer within storageClass to the found element.
-        //! If nullptr is returned, outSubclassTypeId is invalid.
-        static ElementDataResult FindElementByNameCrc(SerializeContext& serializeContext, void* object, 
-            const SerializeContext::ClassData& classData, const Crc32 nameCrc);
-
-        //! Counts the total number of elements that would be at the root of a json object.
-        static size_t CountElements(SerializeContext& serializeContext, const SerializeContext::ClassData& classData);
-
         //! Checks if a value is an explicit default. This means the value is an object with no members.
         static bool IsExplicitDefault(const rapidjson::Value& value);
 
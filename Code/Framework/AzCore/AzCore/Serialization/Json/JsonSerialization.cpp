@@ -12,6 +12,8 @@
 #include <AzCore/Serialization/Json/JsonMerger.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/JsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonStreamDeserializer.h>
+#include <AzCore/Serialization/Json/JsonStreamSerializer.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/sort.h>
@@ -249,6 +251,38 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::Load(
+        void* object, const Uuid& objectType, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonDeserializerSettings settingsCopy{settings};
+        return Load(object, objectType, stream, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::Load(
+        void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            JsonDeserializerContext context(settings);
+            result = JsonStreamDeserializer::Load(object, objectType, stream, context);
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::LoadTypeId(
         Uuid& typeId, const rapidjson::Value& input, const Uuid* baseClassTypeId, AZStd::string_view jsonPath,
         const JsonDeserializerSettings& settings)
@@ -326,6 +360,50 @@ namespace AZ
         return result;
     }
 
+    JsonSerializationResult::ResultCode JsonSerialization::Store(
+        IO::GenericStream& stream, const void* object, const void* defaultObject, const Uuid& objectType,
+        const JsonSerializerSettings& settings)
+    {
+        // Explicitly make a copy to call the correct overloaded version and avoid infinite recursion on this function.
+        JsonSerializerSettings settingsCopy{settings};
+        return Store(stream, object, defaultObject, objectType, settingsCopy);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerialization::Store(
+        IO::GenericStream& stream, const void* object, const void* defaultObject, const Uuid& objectType,
+        JsonSerializerSettings& settings)
+    {
+        using namespace JsonSerializationResult;
+
+        AZStd::string scratchBuffer;
+        auto issueReportingCallback = [&scratchBuffer](AZStd::string_view message, ResultCode result, AZStd::string_view target) -> ResultCode
+        {
+            return JsonSerialization::DefaultIssueReporter(scratchBuffer, message, result, target);
+        };
+        if (!settings.m_reporting)
+        {
+            settings.m_reporting = issueReportingCallback;
+        }
+
+        ResultCode result = JsonSerializationInternal::GetContexts(settings, settings.m_serializeContext, settings.m_registrationContext);
+        if (result.GetOutcome() == Outcomes::Success)
+        {
+            if (defaultObject)
+            {
+                // If a default object is provided by the user, then the intention is to strip defaults, so make sure
+                // the settings match this.
+                settings.m_keepDefaults = false;
+            }
+
+            // Only values that are handled by a serializer are temporarily stored as json values, so use a dedicated
+            // allocator that can be cleared between fields.
+            rapidjson::Document::AllocatorType scratchAllocator;
+            JsonSerializerContext context(settings, scratchAllocator);
+            result = JsonStreamSerializer::Store(stream, object, defaultObject, objectType, context);
+        }
+        return result;
+    }
+
     JsonSerializationResult::ResultCode JsonSerialization::StoreTypeId(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const Uuid& typeId, AZStd::string_view elementPath,
         const JsonSerializerSettings& settings)
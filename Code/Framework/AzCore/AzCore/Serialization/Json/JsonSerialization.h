@@ -17,6 +17,11 @@
 namespace AZ
 {
     class BaseJsonSerializer;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
     
     enum class JsonMergeApproach
     {
@@ -152,6 +157,43 @@ namespace AZ
         static JsonSerializationResult::ResultCode Load(
             void* object, const Uuid& objectType, const rapidjson::Value& root, JsonDeserializerSettings& settings);
 
+        //! Loads the data from the json document in the provided stream into the supplied object. The object is expected to be created
+        //! before calling load. The document is read directly from the stream instead of being parsed in full first. Reflected classes
+        //! are loaded one field at a time while the document is read and only values that are handled by a serializer, such as
+        //! containers, are temporarily kept as json values. This keeps memory usage low for large documents such as prefabs.
+        //! Note: Unlike loading from a json value, the object may have been partially loaded if the stream turns out to contain
+        //!     malformed json.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream containing the json document the deserializer will read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Load(
+            T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the json document in the provided stream into the supplied object. The object is expected to be created
+        //! before calling load. See the version with the optional settings for details on how the stream is loaded.
+        //! @param object Object where the data will be loaded into.
+        //! @param stream The stream containing the json document the deserializer will read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Load(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+        //! Loads the data from the json document in the provided stream into the supplied object. The object is expected to be created
+        //! before calling load. See the templated version for details on how the stream is loaded.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json document the deserializer will read from.
+        //! @param settings Optional additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& objectType, IO::GenericStream& stream,
+            const JsonDeserializerSettings& settings = JsonDeserializerSettings{});
+        //! Loads the data from the json document in the provided stream into the supplied object. The object is expected to be created
+        //! before calling load. See the templated version for details on how the stream is loaded.
+        //! @param object Pointer to the object where the data will be loaded into.
+        //! @param objectType Type id of the object passed in.
+        //! @param stream The stream containing the json document the deserializer will read from.
+        //! @param settings Additional settings to control the way document is deserialized.
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& objectType, IO::GenericStream& stream, JsonDeserializerSettings& settings);
+
         //! Loads the type id from the provided input.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -250,6 +292,48 @@ namespace AZ
             rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const void* object, const void* defaultObject,
             const Uuid& objectType, JsonSerializerSettings& settings);
 
+        //! Stores the data in the provided object as a json document written directly to the provided stream. Reflected classes are
+        //! written one field at a time, so the full document is never held in memory. Only fields that are handled by a serializer,
+        //! such as containers, are temporarily kept as json values. The written json is the same as storing to a json value and
+        //! writing that to the stream.
+        //! @param stream The stream the json document will be written to.
+        //! @param object The object that will be read from for values to convert.
+        //! @param settings Optional additional settings to control the way document is serialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Store(
+            IO::GenericStream& stream, const T& object, const JsonSerializerSettings& settings = JsonSerializerSettings{});
+        //! Stores the data in the provided object as a json document written directly to the provided stream.
+        //! See the version with the optional settings for details on how the document is written.
+        //! @param stream The stream the json document will be written to.
+        //! @param object The object that will be read from for values to convert.
+        //! @param settings Additional settings to control the way document is serialized.
+        template<typename T>
+        static JsonSerializationResult::ResultCode Store(IO::GenericStream& stream, const T& object, JsonSerializerSettings& settings);
+        //! Stores the data in the provided object as a json document written directly to the provided stream.
+        //! See the templated version for details on how the document is written.
+        //! @param stream The stream the json document will be written to.
+        //! @param object Pointer to the object that will be read from for values to convert.
+        //! @param defaultObject Pointer to a default object used to compare the object to in order to determine if values are
+        //!     defaulted or not. This argument can be null, in which case a temporary default may be created if required by
+        //!     the settings. If this is argument is provided m_keepDefaults in the settings will automatically  be set to true.
+        //! @param objectType The type id of the object and default object.
+        //! @param settings Optional additional settings to control the way document is serialized.
+        static JsonSerializationResult::ResultCode Store(
+            IO::GenericStream& stream, const void* object, const void* defaultObject, const Uuid& objectType,
+            const JsonSerializerSettings& settings = JsonSerializerSettings{});
+        //! Stores the data in the provided object as a json document written directly to the provided stream.
+        //! See the templated version for details on how the document is written.
+        //! @param stream The stream the json document will be written to.
+        //! @param object Pointer to the object that will be read from for values to convert.
+        //! @param defaultObject Pointer to a default object used to compare the object to in order to determine if values are
+        //!     defaulted or not. This argument can be null, in which case a temporary default may be created if required by
+        //!     the settings. If this is argument is provided m_keepDefaults in the settings will automatically  be set to true.
+        //! @param objectType The type id of the object and default object.
+        //! @param settings Additional settings to control the way document is serialized.
+        static JsonSerializationResult::ResultCode Store(
+            IO::GenericStream& stream, const void* object, const void* defaultObject, const Uuid& objectType,
+            JsonSerializerSettings& settings);
+
         //! Stores a name for the type id in the provided output. The name can be safely used to reference a type such as a class during loading.
         //! Note: it's not recommended to use this function (frequently) as it requires users of the json file to have knowledge of the internal
         //!     type structure and is therefore harder to use.
@@ -311,6 +395,19 @@ namespace AZ
         return Load(&object, azrtti_typeid(object), root, settings);
     }
 
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Load(
+        T& object, IO::GenericStream& stream, const JsonDeserializerSettings& settings)
+    {
+        return Load(&object, azrtti_typeid(object), stream, settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Load(T& object, IO::GenericStream& stream, JsonDeserializerSettings& settings)
+    {
+        return Load(&object, azrtti_typeid(object), stream, settings);
+    }
+
     template<typename T>
     JsonSerializationResult::ResultCode JsonSerialization::Store(
         rapidjson::Value& output, rapidjson::Document::AllocatorType& allocator, const T& object, const JsonSerializerSettings& settings)
@@ -339,4 +436,17 @@ namespace AZ
     {
         return Store(output, allocator, &object, &defaultObject, azrtti_typeid(object), settings);
     }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Store(
+        IO::GenericStream& stream, const T& object, const JsonSerializerSettings& settings)
+    {
+        return Store(stream, &object, nullptr, azrtti_typeid(object), settings);
+    }
+
+    template<typename T>
+    JsonSerializationResult::ResultCode JsonSerialization::Store(IO::GenericStream& stream, const T& object, JsonSerializerSettings& settings)
+    {
+        return Store(stream, &object, nullptr, azrtti_typeid(object), settings);
+    }
 } // namespace AZ
@@ -147,7 +147,9 @@ namespace AZ
                     StoreTypeName(classData, context), context.GetJsonAllocator());
                 result = ResultCode(Tasks::WriteValue, Outcomes::Success);
             }
-            return result.Combine(StoreClass(node, object, defaultObject, classData, context));
+            const JsonSerializationPlan& plan =
+                context.GetRegistrationContext()->GetSerializationPlan(*context.GetSerializeContext(), classData);
+            return result.Combine(StoreClass(node, object, defaultObject, plan, context));
         }
     }
 
@@ -180,14 +182,15 @@ namespace AZ
     }
 
     JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassElement(rapidjson::Value& parentNode, const void* object,
-        const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context)
+        const void* defaultObject, const JsonSerializationPlan::Field& field, JsonSerializerContext& context)
     {
         using namespace JsonSerializationResult;
 
-        ScopedContextPath elementPath(context, classElement.m_name);
+        const SerializeContext::ClassElement& classElement = *field.m_element;
+        // Element names are owned by the reflection, which outlives the path entry.
+        ScopedContextPath elementPath(context, classElement.m_name, StackedString::Storage::Reference);
 
-        const SerializeContext::ClassData* elementClassData =
-            context.GetSerializeContext()->FindClassData(classElement.m_typeId);
+        const SerializeContext::ClassData* elementClassData = field.m_classData;
         if (!elementClassData)
         {
             return context.Report(Tasks::RetrieveInfo, Outcomes::Unknown,
@@ -214,14 +217,28 @@ namespace AZ
         {
             // Base class information can be reconstructed so doesn't need to be written to the final json. StoreClass
             // will simply pick up where this left off and write to the same element.
-            return StoreClass(parentNode, object, defaultObject, *elementClassData, context);
+            AZ_Assert(field.m_basePlan, "Serialization plan for base class '%s' is missing.", elementClassData->m_name);
+            return StoreClass(parentNode, object, defaultObject, *field.m_basePlan, context);
         }
         else
         {
             rapidjson::Value value;
-            ResultCode result = classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER ?
-                StoreWithClassDataFromPointer(value, object, defaultObject, *elementClassData, context):
-                StoreWithClassData(value, object, defaultObject, *elementClassData, StoreTypeId::No, context);
+            ResultCode result(Tasks::WriteValue);
+            if (classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+            {
+                result = StoreWithClassDataFromPointer(value, object, defaultObject, *elementClassData, context);
+            }
+            else if (field.m_serializer)
+            {
+                // The serializer for the field was determined up front, so skip resolving it again for every instance.
+                value.SetObject();
+                result = field.m_serializer->Store(value, object, defaultObject, elementClassData->m_typeId, context);
+            }
+            else
+            {
+                result = StoreWithClassData(value, object, defaultObject, *elementClassData, StoreTypeId::No, context);
+            }
+
             if (result.GetProcessing() != Processing::Halted)
             {
                 if (parentNode.IsObject())
@@ -242,21 +259,21 @@ namespace AZ
     }
 
     JsonSerializationResult::ResultCode JsonSerializer::StoreClass(rapidjson::Value& output, const void* object, const void* defaultObject,
-        const SerializeContext::ClassData& classData, JsonSerializerContext& context)
+        const JsonSerializationPlan& plan, JsonSerializerContext& context)
     {
         using namespace JsonSerializationResult;
 
         AZ_Assert(output.IsObject(), "Unable to write class to the json node as it's not an object.");
-        if (!classData.m_elements.empty())
+        if (!plan.m_fields.empty())
         {
             ResultCode result(Tasks::WriteValue);
-            for (const SerializeContext::ClassElement& element : classData.m_elements)
+            for (const JsonSerializationPlan::Field& field : plan.m_fields)
             {
-                const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + element.m_offset;
+                const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + field.m_element->m_offset;
                 const void* elementDefaultPtr = defaultObject ?
-                    (reinterpret_cast<const uint8_t*>(defaultObject) + element.m_offset) : nullptr;
+                    (reinterpret_cast<const uint8_t*>(defaultObject) + field.m_element->m_offset) : nullptr;
 
-                result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, element, context));
+                result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, field, context));
             }
             return result;
         }
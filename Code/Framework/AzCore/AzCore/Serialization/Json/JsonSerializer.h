@@ -10,6 +10,7 @@
 #include <AzCore/JSON/document.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
 
 namespace AZ
 {
@@ -19,6 +20,7 @@ namespace AZ
     {
         friend class JsonSerialization;
         friend class BaseJsonSerializer;
+        friend class JsonStreamSerializer;
     private:
         enum class StoreTypeId : bool
         {
@@ -52,10 +54,10 @@ namespace AZ
             const void* defaultObject, const SerializeContext::ClassData& classData, JsonSerializerContext& context);
 
         static JsonSerializationResult::ResultCode StoreWithClassElement(rapidjson::Value& parentNode, const void* object,
-            const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context);
+            const void* defaultObject, const JsonSerializationPlan::Field& field, JsonSerializerContext& context);
 
         static JsonSerializationResult::ResultCode StoreClass(rapidjson::Value& output, const void* object, const void* defaultObject,
-            const SerializeContext::ClassData& classData, JsonSerializerContext& context);
+            const JsonSerializationPlan& plan, JsonSerializerContext& context);
 
         static JsonSerializationResult::ResultCode StoreEnum(rapidjson::Value& output, const void* object, const void* defaultObject,
             const SerializeContext::ClassData& classData, JsonSerializerContext& context);
@@ -0,0 +1,396 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/GenericStreams.h>
+#include <AzCore/IO/TextStreamWriters.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/JSON/error/en.h>
+#include <AzCore/JSON/reader.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonDeserializer.h>
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonStreamDeserializer.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/Serialization/Json/StackedString.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ
+{
+    namespace JsonStreamDeserializerInternal
+    {
+        //! Memory used for temporary json values is released once it grows beyond this size.
+        static constexpr size_t MaxScratchMemorySize = 1024 * 1024;
+    } // namespace JsonStreamDeserializerInternal
+
+    //! Receives the events from the SAX reader. Reflected classes that are being loaded are tracked on a stack, while values that
+    //! need to go through the regular deserializer are rebuilt in a scratch document until they're complete.
+    class JsonStreamDeserializer::Handler final
+    {
+    public:
+        Handler(void* object, const Uuid& typeId, JsonDeserializerContext& context)
+            : m_context(context)
+            , m_typeId(typeId)
+            , m_object(object)
+        {
+        }
+
+        bool Null() { return ScalarValue([](rapidjson::Document& document) { return document.Null(); }); }
+        bool Bool(bool value) { return ScalarValue([value](rapidjson::Document& document) { return document.Bool(value); }); }
+        bool Int(int value) { return ScalarValue([value](rapidjson::Document& document) { return document.Int(value); }); }
+        bool Uint(unsigned value) { return ScalarValue([value](rapidjson::Document& document) { return document.Uint(value); }); }
+        bool Int64(int64_t value) { return ScalarValue([value](rapidjson::Document& document) { return document.Int64(value); }); }
+        bool Uint64(uint64_t value) { return ScalarValue([value](rapidjson::Document& document) { return document.Uint64(value); }); }
+        bool Double(double value) { return ScalarValue([value](rapidjson::Document& document) { return document.Double(value); }); }
+        bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return ScalarValue([=](rapidjson::Document& document) { return document.RawNumber(str, length, copy); });
+        }
+        bool String(const char* str, rapidjson::SizeType length, bool copy)
+        {
+            return ScalarValue([=](rapidjson::Document& document) { return document.String(str, length, copy); });
+        }
+
+        bool StartObject();
+        bool Key(const char* str, rapidjson::SizeType length, bool copy);
+        bool EndObject(rapidjson::SizeType memberCount);
+        bool StartArray();
+        bool EndArray(rapidjson::SizeType elementCount);
+
+        JsonSerializationResult::ResultCode GetResult() const { return m_result; }
+        bool IsHalted() const { return m_isHalted; }
+
+    private:
+        enum class ValueAction
+        {
+            Skip, // The value has no matching field and is ignored.
+            Stream, // The value is a reflected class that's loaded one field at a time.
+            Materialize // The value is collected in the scratch document and loaded once complete.
+        };
+
+        struct ClassFrame
+        {
+            ClassFrame(void* object, const JsonSerializationPlan& plan)
+                : m_object(object)
+                , m_plan(&plan)
+            {
+            }
+
+            void* m_object;
+            const JsonSerializationPlan* m_plan;
+            //! The field the next value will be loaded into or null if the next value should be skipped.
+            const JsonSerializationPlan::NamedField* m_pendingField{ nullptr };
+            JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+            size_t m_numLoads{ 0 };
+            size_t m_numMembers{ 0 };
+        };
+
+        template<typename Event>
+        bool ScalarValue(Event&& event);
+
+        ValueAction BeginValue(bool isObject);
+        bool FinishSkippedValue();
+        bool FinishMaterializedValue();
+        bool FinishClass();
+        bool FinishField(JsonSerializationResult::ResultCode result);
+        bool Halt(JsonSerializationResult::ResultCode result);
+
+        rapidjson::Document m_scratchDocument;
+        AZStd::vector<ClassFrame> m_frames;
+        JsonDeserializerContext& m_context;
+        Uuid m_typeId;
+        void* m_object;
+        JsonSerializationResult::ResultCode m_result{ JsonSerializationResult::Tasks::ReadField };
+        size_t m_materializeDepth{ 0 };
+        size_t m_skipDepth{ 0 };
+        bool m_isHalted{ false };
+    };
+
+    template<typename Event>
+    bool JsonStreamDeserializer::Handler::ScalarValue(Event&& event)
+    {
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (m_materializeDepth > 0)
+        {
+            return event(m_scratchDocument);
+        }
+        if (BeginValue(false) == ValueAction::Skip)
+        {
+            return FinishSkippedValue();
+        }
+        return event(m_scratchDocument) && FinishMaterializedValue();
+    }
+
+    bool JsonStreamDeserializer::Handler::StartObject()
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return true;
+        }
+        if (m_materializeDepth > 0)
+        {
+            ++m_materializeDepth;
+            return m_scratchDocument.StartObject();
+        }
+
+        ValueAction action = BeginValue(true);
+        if (action == ValueAction::Skip)
+        {
+            m_skipDepth = 1;
+            return true;
+        }
+        else if (action == ValueAction::Materialize)
+        {
+            m_materializeDepth = 1;
+            return m_scratchDocument.StartObject();
+        }
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Handler::Key(const char* str, rapidjson::SizeType length, bool copy)
+    {
+        using namespace JsonSerializationResult;
+
+        if (m_skipDepth > 0)
+        {
+            return true;
+        }
+        if (m_materializeDepth > 0)
+        {
+            return m_scratchDocument.Key(str, length, copy);
+        }
+
+        AZ_Assert(!m_frames.empty(), "Json stream deserializer received a key outside of an object.");
+        ClassFrame& frame = m_frames.back();
+        frame.m_numMembers++;
+
+        // The reader reuses the memory for the key, so the path needs its own copy.
+        AZStd::string_view name(str, length);
+        m_context.PushPath(name);
+        if (name == JsonSerialization::TypeIdFieldIdentifier)
+        {
+            frame.m_pendingField = nullptr;
+        }
+        else
+        {
+            frame.m_pendingField = frame.m_plan->FindField(Crc32(name));
+            if (!frame.m_pendingField)
+            {
+                frame.m_result.Combine(m_context.Report(Tasks::ReadField, Outcomes::Skipped,
+                    "Skipping field as there's no matching variable in the target."));
+            }
+        }
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Handler::EndObject(rapidjson::SizeType memberCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            return --m_skipDepth > 0 || FinishSkippedValue();
+        }
+        if (m_materializeDepth > 0)
+        {
+            return m_scratchDocument.EndObject(memberCount) && (--m_materializeDepth > 0 || FinishMaterializedValue());
+        }
+        return FinishClass();
+    }
+
+    bool JsonStreamDeserializer::Handler::StartArray()
+    {
+        if (m_skipDepth > 0)
+        {
+            ++m_skipDepth;
+            return true;
+        }
+        if (m_materializeDepth > 0)
+        {
+            ++m_materializeDepth;
+            return m_scratchDocument.StartArray();
+        }
+
+        if (BeginValue(false) == ValueAction::Skip)
+        {
+            m_skipDepth = 1;
+            return true;
+        }
+        m_materializeDepth = 1;
+        return m_scratchDocument.StartArray();
+    }
+
+    bool JsonStreamDeserializer::Handler::EndArray(rapidjson::SizeType elementCount)
+    {
+        if (m_skipDepth > 0)
+        {
+            return --m_skipDepth > 0 || FinishSkippedValue();
+        }
+        AZ_Assert(m_materializeDepth > 0, "Json stream deserializer received the end of an array that wasn't started.");
+        return m_scratchDocument.EndArray(elementCount) && (--m_materializeDepth > 0 || FinishMaterializedValue());
+    }
+
+    auto JsonStreamDeserializer::Handler::BeginValue(bool isObject) -> ValueAction
+    {
+        const JsonRegistrationContext& registrationContext = *m_context.GetRegistrationContext();
+        const SerializeContext& serializeContext = *m_context.GetSerializeContext();
+
+        if (m_frames.empty())
+        {
+            const SerializeContext::ClassData* classData =
+                isObject ? registrationContext.FindPlainClassData(serializeContext, m_typeId) : nullptr;
+            if (classData)
+            {
+                m_frames.emplace_back(m_object, registrationContext.GetSerializationPlan(serializeContext, *classData));
+                return ValueAction::Stream;
+            }
+            return ValueAction::Materialize;
+        }
+
+        const ClassFrame& frame = m_frames.back();
+        if (!frame.m_pendingField)
+        {
+            return ValueAction::Skip;
+        }
+
+        const JsonSerializationPlan::Field& field = *frame.m_pendingField->m_field;
+        if (isObject && !field.m_serializer && !(field.m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER))
+        {
+            if (const SerializeContext::ClassData* classData =
+                    registrationContext.FindPlainClassData(serializeContext, field.m_element->m_typeId))
+            {
+                void* fieldObject = reinterpret_cast<char*>(frame.m_object) + frame.m_pendingField->m_offset;
+                m_frames.emplace_back(fieldObject, registrationContext.GetSerializationPlan(serializeContext, *classData));
+                return ValueAction::Stream;
+            }
+        }
+        return ValueAction::Materialize;
+    }
+
+    bool JsonStreamDeserializer::Handler::FinishSkippedValue()
+    {
+        m_context.PopPath();
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Handler::FinishMaterializedValue()
+    {
+        // Moves the completed value from the document's parsing stack into the document itself.
+        auto takeValue = [](rapidjson::Document&)
+        {
+            return true;
+        };
+        m_scratchDocument.Populate(takeValue);
+
+        bool continueParsing = true;
+        if (m_frames.empty())
+        {
+            m_result = JsonDeserializer::Load(m_object, m_typeId, m_scratchDocument, false, m_context);
+        }
+        else
+        {
+            const ClassFrame& frame = m_frames.back();
+            void* fieldObject = reinterpret_cast<char*>(frame.m_object) + frame.m_pendingField->m_offset;
+            continueParsing = FinishField(
+                JsonDeserializer::LoadField(fieldObject, m_scratchDocument, *frame.m_pendingField->m_field, m_context));
+        }
+
+        m_scratchDocument.SetNull();
+        if (m_scratchDocument.GetAllocator().Size() > JsonStreamDeserializerInternal::MaxScratchMemorySize)
+        {
+            m_scratchDocument.GetAllocator().Clear();
+        }
+        return continueParsing;
+    }
+
+    bool JsonStreamDeserializer::Handler::FinishClass()
+    {
+        using namespace JsonSerializationResult;
+
+        AZ_Assert(!m_frames.empty(), "Json stream deserializer received the end of an object that wasn't started.");
+        const ClassFrame& frame = m_frames.back();
+        ResultCode result = frame.m_result;
+        if (frame.m_numMembers == 0)
+        {
+            result = m_context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
+        }
+        else if (frame.m_plan->m_elementCount > frame.m_numLoads)
+        {
+            result.Combine(ResultCode(Tasks::ReadField, frame.m_numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
+        }
+        m_frames.pop_back();
+
+        if (m_frames.empty())
+        {
+            m_result = result;
+            return true;
+        }
+        return FinishField(result);
+    }
+
+    bool JsonStreamDeserializer::Handler::FinishField(JsonSerializationResult::ResultCode result)
+    {
+        using namespace JsonSerializationResult;
+
+        ClassFrame& frame = m_frames.back();
+        frame.m_result.Combine(result);
+        if (result.GetProcessing() == Processing::Halted)
+        {
+            return Halt(result);
+        }
+        else if (result.GetProcessing() != Processing::Altered)
+        {
+            frame.m_numLoads++;
+        }
+        m_context.PopPath();
+        return true;
+    }
+
+    bool JsonStreamDeserializer::Handler::Halt(JsonSerializationResult::ResultCode result)
+    {
+        // Unwind the same way the nested calls in the regular deserializer do, reporting the failure for every enclosing field.
+        while (!m_frames.empty())
+        {
+            result = m_context.Report(result, "Loading of element has failed.");
+            m_context.PopPath();
+            m_frames.pop_back();
+        }
+        m_result = result;
+        m_isHalted = true;
+        return false;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamDeserializer::Load(
+        void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during loading.");
+        }
+
+        IO::RapidJSONStreamReader streamReader(&stream);
+        Handler handler(object, typeId, context);
+        rapidjson::Reader reader;
+        rapidjson::ParseResult parseResult = reader.Parse(streamReader, handler);
+        if (handler.IsHalted())
+        {
+            return handler.GetResult();
+        }
+        if (parseResult.IsError())
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                AZStd::string::format("Failed to parse json stream: %s (offset %zu).",
+                    rapidjson::GetParseError_En(parseResult.Code()), parseResult.Offset()));
+        }
+        return handler.GetResult();
+    }
+} // namespace AZ
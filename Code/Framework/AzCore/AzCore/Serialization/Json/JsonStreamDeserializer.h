@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+
+namespace AZ
+{
+    struct Uuid;
+    class JsonDeserializerContext;
+
+    namespace IO
+    {
+        class GenericStream;
+    }
+
+    //! Loads json documents directly from a stream by driving the Json Serialization from a SAX reader.
+    //! Reflected classes without a custom serializer are loaded one field at a time while the document is being read, so the
+    //! document is never fully held in memory. Values that do require a serializer, such as containers, pointers or
+    //! primitives, are collected into a temporary json value which is passed on to the regular deserializer and released again
+    //! after it has been loaded.
+    class JsonStreamDeserializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        class Handler;
+
+        JsonStreamDeserializer() = delete;
+        ~JsonStreamDeserializer() = delete;
+        JsonStreamDeserializer& operator=(const JsonStreamDeserializer& rhs) = delete;
+        JsonStreamDeserializer& operator=(JsonStreamDeserializer&& rhs) = delete;
+        JsonStreamDeserializer(const JsonStreamDeserializer& rhs) = delete;
+        JsonStreamDeserializer(JsonStreamDeserializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Load(
+            void* object, const Uuid& typeId, IO::GenericStream& stream, JsonDeserializerContext& context);
+    };
+} // namespace AZ
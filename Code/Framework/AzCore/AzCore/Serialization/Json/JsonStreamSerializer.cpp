@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/JSON/document.h>
+#include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonStreamSerializer.h>
+#include <AzCore/Serialization/Json/StackedString.h>
+#include <AzCore/std/any.h>
+
+namespace AZ
+{
+    namespace JsonStreamSerializerInternal
+    {
+        //! Memory used for temporary json values is released once it grows beyond this size.
+        static constexpr size_t MaxScratchMemorySize = 1024 * 1024;
+    } // namespace JsonStreamSerializerInternal
+
+    void JsonStreamSerializer::ObjectScope::Open()
+    {
+        if (!m_isOpen)
+        {
+            if (m_parent)
+            {
+                m_parent->Open();
+                m_writer.Key(m_name);
+            }
+            m_writer.StartObject();
+            m_isOpen = true;
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamSerializer::Store(IO::GenericStream& stream, const void* object,
+        const void* defaultObject, const Uuid& typeId, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!object)
+        {
+            return context.Report(Tasks::ReadField, Outcomes::Catastrophic,
+                "Target object for Json Serialization is pointing to nothing during storing.");
+        }
+
+        IO::RapidJSONStreamWriter streamWriter(&stream);
+        StreamWriter writer(streamWriter);
+
+        const SerializeContext::ClassData* classData =
+            context.GetRegistrationContext()->FindPlainClassData(*context.GetSerializeContext(), typeId);
+        if (!classData)
+        {
+            // Anything other than a plain class is stored by the regular serializer and written out afterwards.
+            rapidjson::Value value;
+            ResultCode result = JsonSerializer::Store(value, object, defaultObject, typeId, context);
+            value.Accept(writer);
+            return result;
+        }
+
+        ResultCode result(Tasks::WriteValue);
+        AZStd::any defaultObjectInstance;
+        if (!defaultObject && !context.ShouldKeepDefaults())
+        {
+            defaultObjectInstance = context.GetSerializeContext()->CreateAny(typeId);
+            if (defaultObjectInstance.empty())
+            {
+                result = context.Report(Tasks::CreateDefault, Outcomes::Unsupported,
+                    "No factory available to create a default object for comparison.");
+            }
+            defaultObject = AZStd::any_cast<void>(&defaultObjectInstance);
+        }
+
+        const JsonSerializationPlan& plan =
+            context.GetRegistrationContext()->GetSerializationPlan(*context.GetSerializeContext(), *classData);
+        ObjectScope root{ writer, nullptr, nullptr };
+        result.Combine(StoreClass(root, object, defaultObject, plan, context));
+
+        // The root is always written, even if it only contains defaults.
+        root.Open();
+        writer.EndObject();
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamSerializer::StoreClass(ObjectScope& scope, const void* object,
+        const void* defaultObject, const JsonSerializationPlan& plan, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        if (!plan.m_fields.empty())
+        {
+            ResultCode result(Tasks::WriteValue);
+            for (const JsonSerializationPlan::Field& field : plan.m_fields)
+            {
+                const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + field.m_element->m_offset;
+                const void* elementDefaultPtr = defaultObject ?
+                    (reinterpret_cast<const uint8_t*>(defaultObject) + field.m_element->m_offset) : nullptr;
+
+                result.Combine(StoreField(scope, elementPtr, elementDefaultPtr, field, context));
+            }
+            return result;
+        }
+        else
+        {
+            return context.Report(Tasks::WriteValue, context.ShouldKeepDefaults() ? Outcomes::Success : Outcomes::DefaultsUsed,
+                "Class didn't contain any elements to store.");
+        }
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamSerializer::StoreField(ObjectScope& scope, const void* object,
+        const void* defaultObject, const JsonSerializationPlan::Field& field, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        const SerializeContext::ClassElement& classElement = *field.m_element;
+        const SerializeContext::ClassData* elementClassData = field.m_classData;
+        const bool isBaseClass = (classElement.m_flags & SerializeContext::ClassElement::FLG_BASE_CLASS) != 0;
+        const bool canStream = elementClassData && elementClassData->m_azRtti &&
+            (isBaseClass
+                ? field.m_basePlan != nullptr
+                : !(classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER) && !field.m_serializer &&
+                    context.GetRegistrationContext()->FindPlainClassData(*context.GetSerializeContext(), elementClassData->m_typeId));
+        if (!canStream)
+        {
+            return StoreFieldAsValue(scope, object, defaultObject, field, context);
+        }
+
+        // Element names are owned by the reflection, which outlives the path entry.
+        ScopedContextPath elementPath(context, classElement.m_name, StackedString::Storage::Reference);
+        if (classElement.m_flags & SerializeContext::ClassElement::FLG_NO_DEFAULT_VALUE)
+        {
+            defaultObject = nullptr;
+        }
+
+        if (isBaseClass)
+        {
+            // Base classes write their fields to the same object as the class that inherits from them.
+            return StoreClass(scope, object, defaultObject, *field.m_basePlan, context);
+        }
+
+        const JsonSerializationPlan& plan =
+            context.GetRegistrationContext()->GetSerializationPlan(*context.GetSerializeContext(), *elementClassData);
+        ObjectScope fieldScope{ scope.m_writer, &scope, classElement.m_name };
+        ResultCode result = StoreClass(fieldScope, object, defaultObject, plan, context);
+        if (result.GetProcessing() != Processing::Halted &&
+            (context.ShouldKeepDefaults() || result.GetOutcome() != Outcomes::DefaultsUsed))
+        {
+            fieldScope.Open();
+        }
+        // If the field's object was already started it has to be closed to keep the json valid, even if the field turned out
+        // to only contain defaults or failed to store.
+        if (fieldScope.m_isOpen)
+        {
+            scope.m_writer.EndObject();
+        }
+        return result;
+    }
+
+    JsonSerializationResult::ResultCode JsonStreamSerializer::StoreFieldAsValue(ObjectScope& scope, const void* object,
+        const void* defaultObject, const JsonSerializationPlan::Field& field, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
+        ResultCode result(Tasks::WriteValue);
+        {
+            // Let the regular serializer decide what to store for the field and write out whatever it added.
+            rapidjson::Value fields(rapidjson::kObjectType);
+            result = JsonSerializer::StoreWithClassElement(fields, object, defaultObject, field, context);
+            for (auto member = fields.MemberBegin(); member != fields.MemberEnd(); ++member)
+            {
+                scope.Open();
+                scope.m_writer.Key(member->name.GetString(), member->name.GetStringLength());
+                member->value.Accept(scope.m_writer);
+            }
+        }
+
+        // Nothing that has been written is referenced anymore, so the memory can be reused.
+        rapidjson::Document::AllocatorType& allocator = context.GetJsonAllocator();
+        if (allocator.Size() > JsonStreamSerializerInternal::MaxScratchMemorySize)
+        {
+            allocator.Clear();
+        }
+        return result;
+    }
+} // namespace AZ
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/TextStreamWriters.h>
+#include <AzCore/JSON/writer.h>
+#include <AzCore/Serialization/Json/JsonSerializationResult.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+
+namespace AZ
+{
+    struct Uuid;
+    class JsonSerializerContext;
+
+    //! Stores objects as json directly to a stream. Reflected classes without a custom serializer are written one field at a
+    //! time, so the full document is never held in memory. Fields that do require a serializer, such as containers, pointers or
+    //! primitives, are stored through the regular serializer into a temporary json value which is written out and released again.
+    class JsonStreamSerializer final
+    {
+        friend class JsonSerialization;
+
+    private:
+        using StreamWriter = rapidjson::Writer<IO::RapidJSONStreamWriter>;
+
+        //! Json object for a class that's being written. The object is only started once the first value is written to it, so
+        //! classes that only contain defaults can still be left out.
+        struct ObjectScope
+        {
+            void Open();
+
+            StreamWriter& m_writer;
+            ObjectScope* m_parent;
+            const char* m_name;
+            bool m_isOpen{ false };
+        };
+
+        JsonStreamSerializer() = delete;
+        ~JsonStreamSerializer() = delete;
+        JsonStreamSerializer& operator=(const JsonStreamSerializer& rhs) = delete;
+        JsonStreamSerializer& operator=(JsonStreamSerializer&& rhs) = delete;
+        JsonStreamSerializer(const JsonStreamSerializer& rhs) = delete;
+        JsonStreamSerializer(JsonStreamSerializer&& rhs) = delete;
+
+        static JsonSerializationResult::ResultCode Store(IO::GenericStream& stream, const void* object, const void* defaultObject,
+            const Uuid& typeId, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreClass(ObjectScope& scope, const void* object, const void* defaultObject,
+            const JsonSerializationPlan& plan, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreField(ObjectScope& scope, const void* object, const void* defaultObject,
+            const JsonSerializationPlan::Field& field, JsonSerializerContext& context);
+
+        static JsonSerializationResult::ResultCode StoreFieldAsValue(ObjectScope& scope, const void* object,
+            const void* defaultObject, const JsonSerializationPlan::Field& field, JsonSerializerContext& context);
+    };
+} // namespace AZ
@@ -8,6 +8,7 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/string/osstring.h>
 
 namespace AZ
@@ -18,6 +19,18 @@ namespace AZ
         AZ_Assert(m_handledTypesMap.empty(), "JsonRegistrationContext is being destroyed without unreflecting all serializers. Check your reflection functions.");
     }
 
+    const JsonSerializationPlan::NamedField* JsonSerializationPlan::FindField(Crc32 nameCrc) const
+    {
+        for (const NamedField& field : m_namedFields)
+        {
+            if (field.m_nameCrc == nameCrc)
+            {
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+
     JsonRegistrationContext::SerializerBuilder* JsonRegistrationContext::SerializerBuilder::operator->()
     {
         return this;
@@ -31,6 +44,7 @@ namespace AZ
     JsonRegistrationContext::SerializerBuilder* JsonRegistrationContext::SerializerBuilder::HandlesTypeId(
         const Uuid& uuid, bool overwriteExisting)
     {
+        m_context->ClearSerializationPlans();
         if (!m_context->IsRemovingReflection())
         {
             auto serializer = m_serializerIter->second.get();
@@ -83,4 +97,146 @@ namespace AZ
         auto serializerIter = m_jsonSerializers.find(typeId);
         return serializerIter != m_jsonSerializers.end() ? serializerIter->second.get() : nullptr;
     }
+
+    const JsonSerializationPlan& JsonRegistrationContext::GetSerializationPlan(
+        const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const
+    {
+        const u64 reflectionGeneration = serializeContext.GetReflectionGeneration();
+        {
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_serializationPlansMutex);
+            auto plansIt = m_serializationPlans.find(&serializeContext);
+            if (plansIt != m_serializationPlans.end() && plansIt->second.m_reflectionGeneration == reflectionGeneration)
+            {
+                auto planIt = plansIt->second.m_plans.find(&classData);
+                if (planIt != plansIt->second.m_plans.end())
+                {
+                    return *planIt->second;
+                }
+            }
+        }
+
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_serializationPlansMutex);
+        SerializationPlans& plans = m_serializationPlans[&serializeContext];
+        if (plans.m_reflectionGeneration != reflectionGeneration)
+        {
+            // The reflected classes have changed since the plans were built, so any of the stored class data could be stale.
+            plans.m_plans.clear();
+            plans.m_reflectionGeneration = reflectionGeneration;
+        }
+        return BuildSerializationPlan(plans, serializeContext, classData);
+    }
+
+    const SerializeContext::ClassData* JsonRegistrationContext::FindPlainClassData(
+        const SerializeContext& serializeContext, const Uuid& typeId) const
+    {
+        // This mirrors the order in which the (de)serializer picks how to process a type.
+        if (GetSerializerForType(typeId))
+        {
+            return nullptr;
+        }
+        const SerializeContext::ClassData* classData = serializeContext.FindClassData(typeId);
+        if (!classData || classData->m_container)
+        {
+            return nullptr;
+        }
+        if (classData->m_azRtti)
+        {
+            // Generic types may be picked up by a serializer for the generic type and integer types may be treated as enums.
+            if ((classData->m_azRtti->GetTypeTraits() & TypeTraits::is_enum) == TypeTraits::is_enum ||
+                classData->m_azRtti->GetGenericTypeId() != typeId)
+            {
+                return nullptr;
+            }
+        }
+        return classData;
+    }
+
+    const JsonSerializationPlan& JsonRegistrationContext::BuildSerializationPlan(SerializationPlans& plans,
+        const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const
+    {
+        auto [planIt, inserted] = plans.m_plans.try_emplace(&classData);
+        if (!inserted)
+        {
+            return *planIt->second;
+        }
+        planIt->second = AZStd::make_unique<JsonSerializationPlan>();
+        // Building the plans for base classes can add to the map, so hold on to the plan instead of the iterator.
+        JsonSerializationPlan& plan = *planIt->second;
+        plan.m_classData = &classData;
+
+        plan.m_fields.reserve(classData.m_elements.size());
+        for (const SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            JsonSerializationPlan::Field& field = plan.m_fields.emplace_back();
+            field.m_element = &element;
+            field.m_classData = serializeContext.FindClassData(element.m_typeId);
+            if (field.m_classData)
+            {
+                if (element.m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+                {
+                    field.m_basePlan = &BuildSerializationPlan(plans, serializeContext, *field.m_classData);
+                }
+                else if ((element.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER) == 0)
+                {
+                    field.m_serializer = FindSerializerForField(element, *field.m_classData);
+                }
+            }
+        }
+
+        // The class data stores base class information first in the set of elements. The fields are added in reverse to ensure
+        // that derived class fields take precedence over base class fields for the case of naming conflicts.
+        for (auto field = plan.m_fields.crbegin(); field != plan.m_fields.crend(); ++field)
+        {
+            plan.m_namedFields.push_back(JsonSerializationPlan::NamedField{ field->m_element->m_nameCrc, field->m_element->m_offset, &*field });
+            if (field->m_element->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+            {
+                if (field->m_basePlan)
+                {
+                    for (const JsonSerializationPlan::NamedField& baseField : field->m_basePlan->m_namedFields)
+                    {
+                        plan.m_namedFields.push_back(JsonSerializationPlan::NamedField{
+                            baseField.m_nameCrc, field->m_element->m_offset + baseField.m_offset, baseField.m_field });
+                    }
+                    plan.m_elementCount += field->m_basePlan->m_elementCount;
+                }
+            }
+            else
+            {
+                plan.m_elementCount++;
+            }
+        }
+
+        return plan;
+    }
+
+    BaseJsonSerializer* JsonRegistrationContext::FindSerializerForField(
+        const SerializeContext::ClassElement& element, const SerializeContext::ClassData& elementClassData) const
+    {
+        // Fields are loaded using the type of the class element and stored using the type of the class data. If those
+        // differ, such as for assets, the serializer has to be determined by the (de)serializer.
+        if (elementClassData.m_typeId != element.m_typeId)
+        {
+            return nullptr;
+        }
+
+        if (BaseJsonSerializer* serializer = GetSerializerForType(element.m_typeId))
+        {
+            return serializer;
+        }
+
+        // Enums and integers aren't resolved up front as the (de)serializer decides per instance if they're treated as an enum.
+        const TypeTraits excludedTraits = TypeTraits::is_enum | TypeTraits::is_signed | TypeTraits::is_unsigned;
+        if (elementClassData.m_azRtti && elementClassData.m_azRtti->GetGenericTypeId() != element.m_typeId &&
+            (elementClassData.m_azRtti->GetTypeTraits() & excludedTraits) == TypeTraits{ 0 })
+        {
+            return GetSerializerForType(elementClassData.m_azRtti->GetGenericTypeId());
+        }
+        return nullptr;
+    }
+
+    void JsonRegistrationContext::ClearSerializationPlans()
+    {
+        AZStd::unique_lock<AZStd::shared_mutex> lock(m_serializationPlansMutex);
+        m_serializationPlans.clear();
+    }
 } // namespace AZ
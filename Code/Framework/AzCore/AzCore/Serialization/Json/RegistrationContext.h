@@ -12,10 +12,49 @@
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ
 {
+    //! Information about a reflected class that's resolved once and then reused by the Json Serialization for every instance of
+    //! that class it loads or stores.
+    struct JsonSerializationPlan
+    {
+        struct Field
+        {
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            //! Class data for the type of the field or null if the type isn't reflected.
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            //! The serializer that handles the type of the field or null if the field is a pointer, the type is handled
+            //! by the serialize context or the serializer has to be determined per instance.
+            BaseJsonSerializer* m_serializer{ nullptr };
+            //! The plan of the base class if the field is a base class, otherwise null.
+            const JsonSerializationPlan* m_basePlan{ nullptr };
+        };
+
+        struct NamedField
+        {
+            Crc32 m_nameCrc;
+            //! Offset of the field from the start of the class, including the offsets of any base classes.
+            size_t m_offset{ 0 };
+            const Field* m_field{ nullptr };
+        };
+
+        //! Finds the field that matches the name, including fields in base classes. Fields in derived classes take precedence over
+        //! fields with the same name in base classes.
+        const NamedField* FindField(Crc32 nameCrc) const;
+
+        const SerializeContext::ClassData* m_classData{ nullptr };
+        //! The fields of the class, in the same order as the elements in the class data.
+        AZStd::vector<Field> m_fields;
+        //! All fields that can be looked up by name, including the fields of base classes, in the order they should be searched.
+        AZStd::vector<NamedField> m_namedFields;
+        //! The total number of fields that would be stored at the root of a json object.
+        size_t m_elementCount{ 0 };
+    };
+
     class JsonRegistrationContext
         : public ReflectContext
     {
@@ -31,6 +70,14 @@ namespace AZ
         const HandledTypesMap& GetRegisteredSerializers() const;
         BaseJsonSerializer* GetSerializerForType(const Uuid& typeId) const;
         BaseJsonSerializer* GetSerializerForSerializerType(const Uuid& typeId) const;
+
+        //! Returns the serialization plan for a class, building it the first time the class is requested. Plans stay valid until
+        //! the reflection in either the serialize context or this registration context changes.
+        const JsonSerializationPlan& GetSerializationPlan(
+            const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const;
+        //! Returns the class data if the type is (de)serialized as a plain reflected class, one field at a time using its
+        //! serialization plan. Returns null for types that are handled by a serializer, enums and containers.
+        const SerializeContext::ClassData* FindPlainClassData(const SerializeContext& serializeContext, const Uuid& typeId) const;
         
         template <typename T>
         SerializerBuilder Serializer()
@@ -39,6 +86,7 @@ namespace AZ
             if (!IsRemovingReflection())
             {
                 AZ_Assert(m_jsonSerializers.find(typeId) == m_jsonSerializers.end(), "Duplicate Serializer registered with typeid %s", typeId.ToString<AZStd::string>().c_str());
+                ClearSerializationPlans();
                 auto insertIter = m_jsonSerializers.emplace(typeId, aznew T);
                 return SerializerBuilder(this, insertIter.first);
             }
@@ -46,6 +94,7 @@ namespace AZ
             {
                 SerializerMap::const_iterator serializerIter = m_jsonSerializers.find(typeId);
                 AZ_Assert(serializerIter != m_jsonSerializers.end(), "Attempting to unregister a serializer that has not been registered yet with typeid %s", typeId.ToString<AZStd::string>().c_str());
+                ClearSerializationPlans();
                 m_jsonSerializers.erase(serializerIter);
                 return SerializerBuilder(this, m_jsonSerializers.end());
             }
@@ -108,7 +157,26 @@ namespace AZ
         };
 
     protected:
+        struct SerializationPlans
+        {
+            using PlanMap = AZStd::unordered_map<const SerializeContext::ClassData*, AZStd::unique_ptr<JsonSerializationPlan>>;
+
+            PlanMap m_plans;
+            u64 m_reflectionGeneration{ 0 };
+        };
+        using SerializationPlansMap = AZStd::unordered_map<const SerializeContext*, SerializationPlans>;
+
+        const JsonSerializationPlan& BuildSerializationPlan(SerializationPlans& plans,
+            const SerializeContext& serializeContext, const SerializeContext::ClassData& classData) const;
+        BaseJsonSerializer* FindSerializerForField(
+            const SerializeContext::ClassElement& element, const SerializeContext::ClassData& elementClassData) const;
+        void ClearSerializationPlans();
+
         SerializerMap m_jsonSerializers;
         HandledTypesMap m_handledTypesMap;
+
+        //! Cache of serialization plans per serialize context. The plans are built on demand by the threads that (de)serialize.
+        mutable SerializationPlansMap m_serializationPlans;
+        mutable AZStd::shared_mutex m_serializationPlansMutex;
     };
 } // namespace AZ
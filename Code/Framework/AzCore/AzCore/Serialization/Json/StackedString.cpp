@@ -14,10 +14,41 @@ namespace AZ
     {
     }
 
-    void StackedString::Push(AZStd::string_view value)
+    void StackedString::Push(AZStd::string_view value, Storage storage)
     {
-        m_offsetStack.push(m_string.length());
+        if (storage == Storage::Reference)
+        {
+            m_deferredParts.push_back(DeferredPart{ value, 0, false });
+        }
+        else
+        {
+            Resolve();
+            m_offsetStack.push(m_string.length());
+            Append(value);
+        }
+    }
+    
+    void StackedString::Push(size_t value)
+    {
+        m_deferredParts.push_back(DeferredPart{ AZStd::string_view{}, value, true });
+    }
 
+    void StackedString::Pop()
+    {
+        if (!m_deferredParts.empty())
+        {
+            m_deferredParts.pop_back();
+        }
+        else if (!m_offsetStack.empty())
+        {
+            size_t value = m_offsetStack.top();
+            m_string.erase(m_string.begin() + value, m_string.end());
+            m_offsetStack.pop();
+        }
+    }
+
+    void StackedString::Append(AZStd::string_view value) const
+    {
         if (!value.empty())
         {
             switch (m_format)
@@ -42,33 +73,37 @@ namespace AZ
             m_string.append(value.data(), value.length());
         }
     }
-    
-    void StackedString::Push(size_t value)
-    {
-        char buffer[16];
-        azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%zu", value);
-        Push(buffer);
-    }
 
-    void StackedString::Pop()
+    void StackedString::Resolve() const
     {
-        if (!m_offsetStack.empty())
+        for (const DeferredPart& part : m_deferredParts)
         {
-            size_t value = m_offsetStack.top();
-            m_string.erase(m_string.begin() + value, m_string.end());
-            m_offsetStack.pop();
+            m_offsetStack.push(m_string.length());
+            if (part.m_isIndex)
+            {
+                char buffer[32];
+                azsnprintf(buffer, AZ_ARRAY_SIZE(buffer), "%zu", part.m_index);
+                Append(buffer);
+            }
+            else
+            {
+                Append(part.m_value);
+            }
         }
+        m_deferredParts.clear();
     }
 
     void StackedString::Reset()
     {
         m_offsetStack = {};
+        m_deferredParts = {};
         m_string = OSString{};
     }
 
 
     AZStd::string_view StackedString::Get() const
     {
+        Resolve();
         if (m_string.empty())
         {
             switch (m_format)
@@ -94,10 +129,10 @@ namespace AZ
     }
 
 
-    ScopedStackedString::ScopedStackedString(StackedString& string, AZStd::string_view value)
+    ScopedStackedString::ScopedStackedString(StackedString& string, AZStd::string_view value, StackedString::Storage storage)
         : m_string(string)
     {
-        string.Push(value);
+        string.Push(value, storage);
     }
 
     ScopedStackedString::ScopedStackedString(StackedString& string, size_t value)
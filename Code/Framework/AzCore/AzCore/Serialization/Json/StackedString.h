@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/osstring.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -22,11 +23,18 @@ namespace AZ
             JsonPointer     //!< String is formatted as a JSON Pointer such as "/class/array/0/element".
         };
 
+        enum class Storage
+        {
+            Copy,       //!< The string part is copied into the stack immediately.
+            Reference   //!< The string part is only copied when the full string is requested. The caller guarantees that
+                        //!< the string part remains valid until it's popped.
+        };
+
         explicit StackedString(Format format);
 
         //! Push a new string part onto the stack.
-        void Push(AZStd::string_view value);
-        //! Push an integer value to the stack. The value will be converted to a string.
+        void Push(AZStd::string_view value, Storage storage = Storage::Copy);
+        //! Push an integer value to the stack. The value will be converted to a string when the full string is requested.
         void Push(size_t value);
         void Pop();
 
@@ -37,8 +45,20 @@ namespace AZ
         operator AZStd::string_view() const;
 
     private:
-        AZStd::stack<size_t> m_offsetStack;
-        OSString m_string;
+        struct DeferredPart
+        {
+            AZStd::string_view m_value;
+            size_t m_index;
+            bool m_isIndex;
+        };
+
+        void Append(AZStd::string_view value) const;
+        //! Moves all deferred parts into the string.
+        void Resolve() const;
+
+        mutable AZStd::stack<size_t> m_offsetStack;
+        mutable AZStd::vector<DeferredPart> m_deferredParts;
+        mutable OSString m_string;
         Format m_format;
     };
 
@@ -49,7 +69,9 @@ namespace AZ
         //! Pushes a new entry on the stack.
         //! @param string The string stack to push to.
         //! @param value The new entry to push.
-        ScopedStackedString(StackedString& string, AZStd::string_view value);
+        //! @param storage Whether the entry is copied immediately or only referenced until the full string is requested.
+        ScopedStackedString(StackedString& string, AZStd::string_view value,
+            StackedString::Storage storage = StackedString::Storage::Copy);
         //! Pushes a new entry on the stack. This overload can be used to push an index to for instance an array.
         //! @param string The string stack to push to.
         //! @param value The new entry to push. The integer will be converted to string.
@@ -48,6 +48,8 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/string/osstring.h>
 
 namespace AZ
@@ -58,6 +60,10 @@ namespace AZ
         static const u8 s_binaryStreamTag = 0;
         static const u8 s_xmlStreamTag = '<';
         static const u8 s_jsonStreamTag = '{';
+        static const u8 s_compiledBinaryStreamTag = 1;
+        static const u32 s_compiledStreamVersion = 1;
+        static const u32 s_invalidCompiledLayoutIndex = static_cast<u32>(-1);
+        static const size_t s_maxCompiledContainerSlots = 255;
 
         class ObjectStreamImpl;
 
@@ -102,6 +108,7 @@ namespace AZ
                 , m_pending(0)
                 , m_inStream(&m_buffer1)
                 , m_outStream(&m_buffer2)
+                , m_compiledStream(&m_compiledData)
             {
                 // Assign default asset filter if none was provided by the user.
                 m_filterDesc = filterDesc;
@@ -174,6 +181,98 @@ namespace AZ
             /// finalizes the stream after the user is done submitting his writes
             bool Finalize() override;
 
+            //////////////////////////////////////////////////////////////////////////
+            // ST_BINARY_COMPILED
+            // The stream starts with a table of the class layouts it uses, followed by the root objects. Each object is stored
+            // as a flat sequence of its elements in reflection order, all data is in native endianness.
+            struct CompiledElement
+            {
+                enum class Op : u8
+                {
+                    Raw,        ///< Trivially copyable value, stored as m_size bytes of memory.
+                    Object,     ///< Value stored with the layout at m_layoutIndex.
+                    Pointer,    ///< Index of the layout of the actual type + 1 (0 for null), followed by the object.
+                    Max
+                };
+
+                u32 m_nameCrc = 0;
+                Uuid m_typeId = Uuid::CreateNull();
+                Op m_op = Op::Raw;
+                u32 m_size = 0;
+                u32 m_rawLayoutCrc = 0; ///< Identifies the memory layout of Raw elements, so reflection changes of nested classes are detected.
+                u32 m_layoutIndex = s_invalidCompiledLayoutIndex;
+                // Runtime information, only available once the layout is compiled from (or bound to) the serialize context.
+                size_t m_offset = 0;
+                const SerializeContext::ClassElement* m_classElement = nullptr;
+                const SerializeContext::ClassData* m_classData = nullptr;
+            };
+
+            /// Load plan step of an Elements layout, adjacent raw elements are merged into a single copy.
+            struct CompiledOp
+            {
+                CompiledElement::Op m_op = CompiledElement::Op::Raw;
+                size_t m_offset = 0;
+                size_t m_size = 0;
+                u32 m_elementIndex = 0;
+            };
+
+            struct CompiledLayout
+            {
+                enum class Kind : u8
+                {
+                    Elements,   ///< Class elements, m_elements matches ClassData::m_elements.
+                    Value,      ///< u32 size followed by the output of the class serializer.
+                    Asset,      ///< Same as Value, loaded with the asset filter.
+                    Container,  ///< u32 count followed by the elements, m_elements are the slots returned by IDataContainer::EnumTypes.
+                    Embedded,   ///< u32 size followed by a ST_BINARY stream, for classes that need the generic write/load path.
+                    Max
+                };
+
+                const SerializeContext::ClassData* m_classData = nullptr; ///< Null until the layout is bound when loading.
+                Uuid m_typeId = Uuid::CreateNull();
+                u32 m_version = 0;
+                Kind m_kind = Kind::Elements;
+                AZStd::vector<CompiledElement> m_elements;
+                AZStd::vector<CompiledOp> m_ops;
+            };
+
+            bool WriteCompiledClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData);
+            /// Returns the index of the layout of the class, compiling it and the layouts of its elements if needed.
+            u32 CompileLayout(const SerializeContext::ClassData* classData);
+            /// Builds the layout of a class from its reflection. The layout indices of the elements are left unassigned.
+            void BuildCompiledLayout(CompiledLayout& layout, const SerializeContext::ClassData* classData);
+            struct CompiledRawData
+            {
+                size_t m_size = 0;
+                u32 m_layoutCrc = 0;
+            };
+            /// Returns the size of the class if its reflected elements cover its memory and can be copied as is (otherwise 0),
+            /// and a crc of the reflection of its memory layout.
+            CompiledRawData GetCompiledRawData(const SerializeContext::ClassData* classData);
+            void WriteCompiledLayouts(IO::GenericStream& stream);
+            void WriteCompiledObject(const void* objectPtr, u32 layoutIndex);
+            void WriteCompiledElement(const void* elementPtr, const CompiledElement& element);
+            void WriteCompiledPointer(const void* pointerAddress, const CompiledElement& element);
+            void WriteCompiledContainer(const void* containerPtr, const CompiledLayout& layout);
+            void WriteCompiledEmbedded(const void* objectPtr, const CompiledLayout& layout);
+            size_t BeginCompiledSize();
+            void EndCompiledSize(size_t sizePosition);
+
+            bool LoadCompiled();
+            bool ReadCompiledLayouts();
+            /// Binds a layout read from the stream to the class data, failing if the reflection of the class doesn't match.
+            bool BindCompiledLayout(u32 layoutIndex, const SerializeContext::ClassData* classData);
+            bool LoadCompiledObject(void* objectPtr, u32 layoutIndex);
+            bool LoadCompiledElement(void* elementPtr, const CompiledElement& element, bool isContainerElement);
+            bool LoadCompiledPointer(void* pointerAddress, const CompiledElement& element, bool isContainerElement);
+            bool LoadCompiledContainer(void* containerPtr, const CompiledLayout& layout);
+            bool LoadCompiledValue(void* objectPtr, const CompiledLayout& layout);
+            /// Returns a view of the next bytes of the stream, or null if the stream is too short.
+            const char* ConsumeCompiled(size_t bytes);
+            template<class T>
+            bool ReadCompiled(T& value);
+            bool ReportCompiledError(const char* error);
+
             /// Returns true if we will keep the element class, otherwise false
             bool ConvertOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
             void PreparseOldVersion(SerializeContext& sc, SerializeContext::DataElementNode& elementNode, IO::GenericStream& stream, const SerializeContext::ClassData* elementClass);
@@ -224,8 +323,34 @@ namespace AZ
             // completed successfully to make sure the equivalent amount
             // of CloseElements are called
             AZStd::vector<bool>                           m_writeElementResultStack;
+
+            // used for compiled binary streams
+            AZStd::deque<CompiledLayout>                  m_compiledLayouts;
+            AZStd::unordered_map<const SerializeContext::ClassData*, u32> m_compiledLayoutIndices;
+            AZStd::unordered_map<const SerializeContext::ClassData*, CompiledRawData> m_compiledRawData;
+            AZStd::vector<char>                           m_compiledData;
+            IO::ByteContainerStream<AZStd::vector<char> > m_compiledStream;
+            size_t                                        m_compiledReadPosition = 0;
+            bool                                          m_compiledLoadResult = true;
         };
 
+        static bool IsEmbeddedInCompiledStream(const SerializeContext::ClassData* classData)
+        {
+            // These classes rely on the generic write and load paths (custom writers, conditional saving, dynamic types),
+            // so they are stored as nested ST_BINARY streams.
+            return classData->m_typeId == SerializeTypeInfo<DynamicSerializableField>::GetUuid()
+                || classData->m_doSave
+                || classData->IsDeprecated()
+                || classData->FindAttribute(SerializeContextAttributes::ObjectStreamWriteElementOverride)
+                || (classData->m_serializer && (classData->m_container || !classData->m_elements.empty()));
+        }
+
+        template<class T>
+        static void WriteCompiledValue(IO::GenericStream& stream, const T& value)
+        {
+            stream.Write(sizeof(T), &value);
+        }
+
         //=========================================================================
         // PreparseOldVersion
         // [4/25/2012]
@@ -1503,6 +1628,11 @@ namespace AZ
         //=========================================================================
         bool ObjectStreamImpl::WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData)
         {
+            if (GetType() == ST_BINARY_COMPILED)
+            {
+                return WriteCompiledClass(classPtr, classId, classData);
+            }
+
             m_errorLogger.Reset();
             // The Write Element Stack reserve size is based on examining a ScriptCanvas object stream that had a depth of up 18 types
             // 32 should be enough slack to serialize an hierarchy of types without needing to realloc
@@ -1954,6 +2084,12 @@ namespace AZ
                     m_jsonWriteValues.push_back();
                     m_jsonWriteValues.back().SetArray();
                 }
+                else if (m_type == ST_BINARY_COMPILED)
+                {
+                    // The layout table and the objects are written on Finalize, once all layouts are known.
+                    WriteCompiledValue(*m_stream, s_compiledBinaryStreamTag);
+                    WriteCompiledValue(*m_stream, s_compiledStreamVersion);
+                }
                 else
                 {
                     u8 binaryTag = s_binaryStreamTag;
@@ -1998,6 +2134,28 @@ namespace AZ
                             result = false;
                         }
                     }
+                    else if (streamTag == s_compiledBinaryStreamTag)
+                    {
+                        SetType(ST_BINARY_COMPILED);
+
+                        u32 version = 0;
+                        m_stream->Read(sizeof(version), &version);
+                        m_version = version;
+
+                        if (m_version <= s_compiledStreamVersion)
+                        {
+                            result = LoadCompiled() && result;
+                        }
+                        else
+                        {
+                            AZStd::string newVersionError = AZStd::string::format("ObjectStream compiled binary load error: Stream is a newer version than object stream supports. ObjectStream version: %u, load stream version: %u",
+                                s_compiledStreamVersion, m_version);
+                            m_errorLogger.ReportError(newVersionError.c_str());
+
+                            // this is considered a "fatal" error since the entire stream is unreadable.
+                            result = false;
+                        }
+                    }
                     else if (streamTag == s_xmlStreamTag)
                     {
                         SetType(ST_XML);
@@ -2098,7 +2256,7 @@ namespace AZ
                     }
                     else
                     {
-                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '<' xml or '{' json!");
+                        m_errorLogger.ReportError("Unknown stream tag (first byte): '\\0' binary, '\\1' compiled binary, '<' xml or '{' json!");
                         // this is considered a "fatal" error since the entire stream is unreadable.
                         result = false;
                     }
@@ -2149,6 +2307,16 @@ namespace AZ
                     azdestroy(m_jsonDoc, SystemAllocator, rapidjson::Document);
                     m_jsonDoc = nullptr;
                 }
+                else if (GetType() == ST_BINARY_COMPILED)
+                {
+                    AZStd::vector<char> layoutTable;
+                    IO::ByteContainerStream<AZStd::vector<char> > layoutStream(&layoutTable);
+                    WriteCompiledLayouts(layoutStream);
+                    // the objects are terminated by an invalid layout index
+                    WriteCompiledValue(m_compiledStream, s_invalidCompiledLayoutIndex);
+                    success = m_stream->Write(layoutTable.size(), layoutTable.data()) == layoutTable.size();
+                    success = m_stream->Write(m_compiledData.size(), m_compiledData.data()) == m_compiledData.size() && success;
+                }
                 else
                 {   /* ST_BINARY */
                     u8 endTag = ST_BINARYFLAG_ELEMENT_END;
@@ -2159,6 +2327,1032 @@ namespace AZ
             return success;
         }
 
+        //=========================================================================
+        // WriteCompiledClass
+        //=========================================================================
+        bool ObjectStreamImpl::WriteCompiledClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData)
+        {
+            m_errorLogger.Reset();
+
+            if (!classData)
+            {
+                classData = m_sc->FindClassData(classId);
+                if (!classData)
+                {
+                    AZStd::string error = AZStd::string::format("Class with ID '%s' is not registered with the serializer!", classId.ToString<AZStd::string>().c_str());
+                    m_errorLogger.ReportError(error.c_str());
+                    return false;
+                }
+            }
+
+            if (classData->m_doSave && !classData->m_doSave(classPtr))
+            {
+                // the user chose to skip saving, same as for the other formats
+                return true;
+            }
+
+            const u32 layoutIndex = CompileLayout(classData);
+            WriteCompiledValue(m_compiledStream, layoutIndex);
+            WriteCompiledObject(classPtr, layoutIndex);
+
+            return m_errorLogger.GetErrorCount() == 0;
+        }
+
+        //=========================================================================
+        // CompileLayout
+        //=========================================================================
+        u32 ObjectStreamImpl::CompileLayout(const SerializeContext::ClassData* classData)
+        {
+            auto layoutIt = m_compiledLayoutIndices.find(classData);
+            if (layoutIt != m_compiledLayoutIndices.end())
+            {
+                return layoutIt->second;
+            }
+
+            // Register the layout before compiling the elements, so recursive types refer to it.
+            const u32 layoutIndex = static_cast<u32>(m_compiledLayouts.size());
+            m_compiledLayoutIndices.emplace(classData, layoutIndex);
+            m_compiledLayouts.emplace_back();
+            BuildCompiledLayout(m_compiledLayouts.back(), classData);
+
+            for (size_t i = 0; i < m_compiledLayouts[layoutIndex].m_elements.size(); ++i)
+            {
+                const CompiledElement& element = m_compiledLayouts[layoutIndex].m_elements[i];
+                if (element.m_op == CompiledElement::Op::Object)
+                {
+                    const u32 elementLayoutIndex = CompileLayout(element.m_classData);
+                    m_compiledLayouts[layoutIndex].m_elements[i].m_layoutIndex = elementLayoutIndex;
+                }
+            }
+            return layoutIndex;
+        }
+
+        //=========================================================================
+        // BuildCompiledLayout
+        //=========================================================================
+        void ObjectStreamImpl::BuildCompiledLayout(CompiledLayout& layout, const SerializeContext::ClassData* classData)
+        {
+            layout.m_classData = classData;
+            layout.m_typeId = classData->m_typeId;
+            layout.m_version = classData->m_version;
+            layout.m_elements.clear();
+            layout.m_ops.clear();
+
+            if (IsEmbeddedInCompiledStream(classData))
+            {
+                layout.m_kind = CompiledLayout::Kind::Embedded;
+                return;
+            }
+            if (classData->m_typeId == GetAssetClassId())
+            {
+                layout.m_kind = CompiledLayout::Kind::Asset;
+                return;
+            }
+            if (classData->m_serializer)
+            {
+                layout.m_kind = CompiledLayout::Kind::Value;
+                return;
+            }
+
+            bool isResolved = true;
+            auto addElement = [this, &layout, &isResolved, classData](const SerializeContext::ClassElement& classElement)
+            {
+                CompiledElement& element = layout.m_elements.emplace_back();
+                element.m_nameCrc = classElement.m_nameCrc;
+                element.m_typeId = classElement.m_typeId;
+                element.m_size = static_cast<u32>(classElement.m_dataSize);
+                element.m_offset = classElement.m_offset;
+                element.m_classElement = &classElement;
+                element.m_classData = classElement.m_genericClassInfo ? classElement.m_genericClassInfo->GetClassData()
+                    : m_sc->FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+
+                if (classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER)
+                {
+                    // the actual type is only known per instance
+                    element.m_op = CompiledElement::Op::Pointer;
+                }
+                else if (!element.m_classData)
+                {
+                    isResolved = false;
+                }
+                else
+                {
+                    const CompiledRawData rawData = GetCompiledRawData(element.m_classData);
+                    if (rawData.m_size != 0 && rawData.m_size == classElement.m_dataSize)
+                    {
+                        element.m_op = CompiledElement::Op::Raw;
+                        element.m_rawLayoutCrc = rawData.m_layoutCrc;
+                    }
+                    else
+                    {
+                        element.m_op = CompiledElement::Op::Object;
+                    }
+                }
+            };
+
+            if (classData->m_container)
+            {
+                layout.m_kind = CompiledLayout::Kind::Container;
+                classData->m_container->EnumTypes([&addElement](const Uuid&, const SerializeContext::ClassElement* classElement)
+                {
+                    addElement(*classElement);
+                    return true;
+                });
+                // Containers without type restrictions (e.g. AZStd::any) can't be described by slots.
+                isResolved = isResolved && !layout.m_elements.empty() && layout.m_elements.size() <= s_maxCompiledContainerSlots;
+            }
+            else
+            {
+                layout.m_kind = CompiledLayout::Kind::Elements;
+                for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+                {
+                    addElement(classElement);
+                }
+
+                for (u32 elementIndex = 0; elementIndex < layout.m_elements.size(); ++elementIndex)
+                {
+                    const CompiledElement& element = layout.m_elements[elementIndex];
+                    if (element.m_op == CompiledElement::Op::Raw && !layout.m_ops.empty() && layout.m_ops.back().m_op == CompiledElement::Op::Raw
+                        && layout.m_ops.back().m_offset + layout.m_ops.back().m_size == element.m_offset)
+                    {
+                        layout.m_ops.back().m_size += element.m_size;
+                    }
+                    else
+                    {
+                        layout.m_ops.push_back({ element.m_op, element.m_offset, element.m_size, elementIndex });
+                    }
+                }
+            }
+
+            if (!isResolved)
+            {
+                layout.m_kind = CompiledLayout::Kind::Embedded;
+                layout.m_elements.clear();
+                layout.m_ops.clear();
+            }
+        }
+
+        //=========================================================================
+        // GetCompiledRawData
+        //=========================================================================
+        ObjectStreamImpl::CompiledRawData ObjectStreamImpl::GetCompiledRawData(const SerializeContext::ClassData* classData)
+        {
+            auto rawDataIt = m_compiledRawData.find(classData);
+            if (rawDataIt != m_compiledRawData.end())
+            {
+                return rawDataIt->second;
+            }
+
+            CompiledRawData rawData;
+            Crc32 layoutCrc(&classData->m_typeId, sizeof(classData->m_typeId));
+            layoutCrc.Add(&classData->m_version, sizeof(classData->m_version));
+            if (!classData->m_eventHandler && !classData->m_container && classData->m_typeId != GetAssetClassId() && !IsEmbeddedInCompiledStream(classData))
+            {
+                if (classData->m_serializer)
+                {
+                    rawData.m_size = classData->m_serializer->GetRawDataSize();
+                }
+                else
+                {
+                    // The elements must be trivially copyable and cover the class memory from the start without gaps.
+                    for (const SerializeContext::ClassElement& classElement : classData->m_elements)
+                    {
+                        if ((classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER) || classElement.m_offset != rawData.m_size)
+                        {
+                            rawData.m_size = 0;
+                            break;
+                        }
+
+                        const SerializeContext::ClassData* elementClassData = classElement.m_genericClassInfo ? classElement.m_genericClassInfo->GetClassData()
+                            : m_sc->FindClassData(classElement.m_typeId, classData, classElement.m_nameCrc);
+                        const CompiledRawData elementRawData = elementClassData ? GetCompiledRawData(elementClassData) : CompiledRawData();
+                        if (elementRawData.m_size == 0 || elementRawData.m_size != classElement.m_dataSize)
+                        {
+                            rawData.m_size = 0;
+                            break;
+                        }
+                        rawData.m_size += elementRawData.m_size;
+                        layoutCrc.Add(&classElement.m_nameCrc, sizeof(classElement.m_nameCrc));
+                        layoutCrc.Add(&elementRawData.m_layoutCrc, sizeof(elementRawData.m_layoutCrc));
+                    }
+                }
+            }
+            rawData.m_layoutCrc = static_cast<u32>(layoutCrc);
+
+            m_compiledRawData.emplace(classData, rawData);
+            return rawData;
+        }
+
+        //=========================================================================
+        // WriteCompiledLayouts
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledLayouts(IO::GenericStream& stream)
+        {
+            WriteCompiledValue(stream, static_cast<u32>(m_compiledLayouts.size()));
+            for (const CompiledLayout& layout : m_compiledLayouts)
+            {
+                WriteCompiledValue(stream, layout.m_typeId);
+                WriteCompiledValue(stream, layout.m_version);
+                WriteCompiledValue(stream, static_cast<u8>(layout.m_kind));
+                WriteCompiledValue(stream, static_cast<u32>(layout.m_elements.size()));
+                for (const CompiledElement& element : layout.m_elements)
+                {
+                    WriteCompiledValue(stream, element.m_nameCrc);
+                    WriteCompiledValue(stream, element.m_typeId);
+                    WriteCompiledValue(stream, static_cast<u8>(element.m_op));
+                    WriteCompiledValue(stream, element.m_size);
+                    WriteCompiledValue(stream, element.m_rawLayoutCrc);
+                    WriteCompiledValue(stream, element.m_layoutIndex);
+                }
+            }
+        }
+
+        //=========================================================================
+        // WriteCompiledObject
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledObject(const void* objectPtr, u32 layoutIndex)
+        {
+            const CompiledLayout& layout = m_compiledLayouts[layoutIndex];
+            const SerializeContext::ClassData* classData = layout.m_classData;
+
+            if (layout.m_kind == CompiledLayout::Kind::Embedded)
+            {
+                // the nested stream sends the events
+                WriteCompiledEmbedded(objectPtr, layout);
+                return;
+            }
+
+            if (classData->m_eventHandler)
+            {
+                classData->m_eventHandler->OnReadBegin(const_cast<void*>(objectPtr));
+            }
+
+            switch (layout.m_kind)
+            {
+            case CompiledLayout::Kind::Elements:
+                for (const CompiledOp& op : layout.m_ops)
+                {
+                    const char* elementPtr = reinterpret_cast<const char*>(objectPtr) + op.m_offset;
+                    if (op.m_op == CompiledElement::Op::Raw)
+                    {
+                        m_compiledStream.Write(op.m_size, elementPtr);
+                    }
+                    else
+                    {
+                        WriteCompiledElement(elementPtr, layout.m_elements[op.m_elementIndex]);
+                    }
+                }
+                break;
+            case CompiledLayout::Kind::Value:
+            case CompiledLayout::Kind::Asset:
+            {
+                const size_t sizePosition = BeginCompiledSize();
+                classData->m_serializer->Save(objectPtr, m_compiledStream, false);
+                EndCompiledSize(sizePosition);
+                break;
+            }
+            case CompiledLayout::Kind::Container:
+                WriteCompiledContainer(objectPtr, layout);
+                break;
+            default:
+                break;
+            }
+
+            if (classData->m_eventHandler)
+            {
+                classData->m_eventHandler->OnReadEnd(const_cast<void*>(objectPtr));
+            }
+        }
+
+        //=========================================================================
+        // WriteCompiledElement
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledElement(const void* elementPtr, const CompiledElement& element)
+        {
+            switch (element.m_op)
+            {
+            case CompiledElement::Op::Raw:
+                m_compiledStream.Write(element.m_size, elementPtr);
+                break;
+            case CompiledElement::Op::Object:
+                WriteCompiledObject(elementPtr, element.m_layoutIndex);
+                break;
+            case CompiledElement::Op::Pointer:
+                WriteCompiledPointer(elementPtr, element);
+                break;
+            default:
+                break;
+            }
+        }
+
+        //=========================================================================
+        // WriteCompiledPointer
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledPointer(const void* pointerAddress, const CompiledElement& element)
+        {
+            void* objectPtr = *reinterpret_cast<void* const*>(pointerAddress);
+            u32 pointerTag = 0;
+            if (!objectPtr)
+            {
+                WriteCompiledValue(m_compiledStream, pointerTag);
+                return;
+            }
+
+            // we may be pointing to a derived type
+            const SerializeContext::ClassElement* classElement = element.m_classElement;
+            const SerializeContext::ClassData* classData = element.m_classData;
+            if (classElement->m_azRtti)
+            {
+                const Uuid& actualClassId = classElement->m_azRtti->GetActualUuid(objectPtr);
+                if (actualClassId != classElement->m_typeId)
+                {
+                    classData = m_sc->FindClassData(actualClassId);
+                    if (classData && classData->m_azRtti)
+                    {
+                        objectPtr = classElement->m_azRtti->Cast(objectPtr, classData->m_azRtti->GetTypeId());
+                    }
+                }
+            }
+
+            if (!classData || !objectPtr)
+            {
+                AZStd::string error = AZStd::string::format("Element '%s' points to a class that is not registered with the serializer and will not be saved.",
+                    classElement->m_name ? classElement->m_name : "NULL");
+                m_errorLogger.ReportError(error.c_str());
+                WriteCompiledValue(m_compiledStream, pointerTag);
+                return;
+            }
+
+            const u32 layoutIndex = CompileLayout(classData);
+            pointerTag = layoutIndex + 1;
+            WriteCompiledValue(m_compiledStream, pointerTag);
+            WriteCompiledObject(objectPtr, layoutIndex);
+        }
+
+        //=========================================================================
+        // WriteCompiledContainer
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledContainer(const void* containerPtr, const CompiledLayout& layout)
+        {
+            SerializeContext::IDataContainer* container = layout.m_classData->m_container;
+            void* instance = const_cast<void*>(containerPtr);
+
+            const size_t countPosition = BeginCompiledSize();
+            u32 elementCount = 0;
+
+            if (layout.m_elements.size() == 1 && layout.m_elements[0].m_op == CompiledElement::Op::Raw)
+            {
+                // trivially copyable elements are stored back to back
+                const size_t elementSize = layout.m_elements[0].m_size;
+                const size_t containerSize = container->Size(instance);
+                const void* elements = containerSize > 0 ? container->GetContiguousElements(instance) : nullptr;
+                if (elements)
+                {
+                    m_compiledStream.Write(containerSize * elementSize, elements);
+                    elementCount = static_cast<u32>(containerSize);
+                }
+                else
+                {
+                    container->EnumElements(instance, [this, elementSize, &elementCount](void* elementPtr, const Uuid&, const SerializeContext::ClassData*, const SerializeContext::ClassElement*)
+                    {
+                        m_compiledStream.Write(elementSize, elementPtr);
+                        ++elementCount;
+                        return true;
+                    });
+                }
+            }
+            else
+            {
+                container->EnumElements(instance, [this, &layout, &elementCount](void* elementPtr, const Uuid& elementClassId, const SerializeContext::ClassData*, const SerializeContext::ClassElement* classElement)
+                {
+                    size_t slotIndex = 0;
+                    for (; slotIndex < layout.m_elements.size(); ++slotIndex)
+                    {
+                        if (layout.m_elements[slotIndex].m_classElement == classElement)
+                        {
+                            break;
+                        }
+                    }
+                    if (slotIndex == layout.m_elements.size())
+                    {
+                        for (slotIndex = 0; slotIndex < layout.m_elements.size(); ++slotIndex)
+                        {
+                            const CompiledElement& slot = layout.m_elements[slotIndex];
+                            if (classElement && slot.m_nameCrc == classElement->m_nameCrc && slot.m_typeId == classElement->m_typeId)
+                            {
+                                break;
+                            }
+                        }
+                    }
+                    if (slotIndex == layout.m_elements.size())
+                    {
+                        AZStd::string error = AZStd::string::format("Element of type '%s' doesn't match any type reported by container '%s' and will not be saved.",
+                            elementClassId.ToString<AZStd::string>().c_str(), layout.m_classData->m_name);
+                        m_errorLogger.ReportError(error.c_str());
+                        return true;
+                    }
+
+                    const CompiledElement& element = layout.m_elements[slotIndex];
+                    if (element.m_op == CompiledElement::Op::Pointer && *reinterpret_cast<void**>(elementPtr) == nullptr)
+                    {
+                        // null elements are skipped, as they are by the other formats
+                        return true;
+                    }
+
+                    if (layout.m_elements.size() > 1)
+                    {
+                        WriteCompiledValue(m_compiledStream, static_cast<u8>(slotIndex));
+                    }
+                    WriteCompiledElement(elementPtr, element);
+                    ++elementCount;
+                    return true;
+                });
+            }
+
+            memcpy(m_compiledData.data() + countPosition, &elementCount, sizeof(elementCount));
+        }
+
+        //=========================================================================
+        // WriteCompiledEmbedded
+        //=========================================================================
+        void ObjectStreamImpl::WriteCompiledEmbedded(const void* objectPtr, const CompiledLayout& layout)
+        {
+            const size_t sizePosition = BeginCompiledSize();
+
+            bool isWritten = false;
+            if (ObjectStream* embeddedStream = ObjectStream::Create(&m_compiledStream, *m_sc, ST_BINARY))
+            {
+                isWritten = embeddedStream->WriteClass(objectPtr, layout.m_typeId, layout.m_classData);
+                isWritten = embeddedStream->Finalize() && isWritten;
+            }
+
+            EndCompiledSize(sizePosition);
+
+            if (!isWritten)
+            {
+                AZStd::string error = AZStd::string::format("Failed to write class '%s' to the compiled stream.", layout.m_classData->m_name);
+                m_errorLogger.ReportError(error.c_str());
+            }
+        }
+
+        size_t ObjectStreamImpl::BeginCompiledSize()
+        {
+            const size_t sizePosition = m_compiledData.size();
+            WriteCompiledValue(m_compiledStream, u32(0));
+            return sizePosition;
+        }
+
+        void ObjectStreamImpl::EndCompiledSize(size_t sizePosition)
+        {
+            const u32 size = static_cast<u32>(m_compiledData.size() - sizePosition - sizeof(u32));
+            memcpy(m_compiledData.data() + sizePosition, &size, sizeof(size));
+        }
+
+        const char* ObjectStreamImpl::ConsumeCompiled(size_t bytes)
+        {
+            if (bytes > m_compiledData.size() - m_compiledReadPosition)
+            {
+                ReportCompiledError("Compiled stream is truncated. Load aborted!");
+                return nullptr;
+            }
+            const char* data = m_compiledData.data() + m_compiledReadPosition;
+            m_compiledReadPosition += bytes;
+            return data;
+        }
+
+        template<class T>
+        bool ObjectStreamImpl::ReadCompiled(T& value)
+        {
+            const char* data = ConsumeCompiled(sizeof(T));
+            if (!data)
+            {
+                return false;
+            }
+            memcpy(&value, data, sizeof(T));
+            return true;
+        }
+
+        //=========================================================================
+        // LoadCompiled
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiled()
+        {
+            // Read the rest of the stream at once, values are loaded from views into this buffer.
+            const IO::SizeType dataSize = m_stream->GetLength() - m_stream->GetCurPos();
+            m_compiledData.resize_no_construct(static_cast<size_t>(dataSize));
+            if (m_stream->Read(dataSize, m_compiledData.data()) != dataSize)
+            {
+                return ReportCompiledError("Failed to read the compiled stream. Load aborted!");
+            }
+            m_compiledReadPosition = 0;
+            m_compiledLoadResult = true;
+
+            if (!ReadCompiledLayouts())
+            {
+                return false;
+            }
+
+            while (true)
+            {
+                u32 layoutIndex = 0;
+                if (!ReadCompiled(layoutIndex))
+                {
+                    return false;
+                }
+                if (layoutIndex == s_invalidCompiledLayoutIndex)
+                {
+                    break;
+                }
+                if (layoutIndex >= m_compiledLayouts.size())
+                {
+                    return ReportCompiledError("Compiled stream has an invalid root element. Load aborted!");
+                }
+
+                const CompiledLayout& layout = m_compiledLayouts[layoutIndex];
+                Uuid classId = layout.m_typeId;
+                const SerializeContext::ClassData* classData = layout.m_classData ? layout.m_classData : m_sc->FindClassData(classId);
+                if (classData)
+                {
+                    // Lookup the SpecializedTypeId from the class if it has GenericClassInfo registered with it
+                    if (GenericClassInfo* genericClassInfo = m_sc->FindGenericClassInfo(classData->m_typeId))
+                    {
+                        classId = genericClassInfo->GetSpecializedTypeId();
+                    }
+                }
+                else if (m_inplaceLoadInfoCB)
+                {
+                    // Root elements may require classInfo to be provided by the in-place load callback.
+                    m_inplaceLoadInfoCB(nullptr, &classData, classId, m_sc);
+                }
+
+                if (!classData)
+                {
+                    AZStd::string error = AZStd::string::format("Root element with class ID '%s' is not registered with the serializer! Load aborted.  File %s",
+                        classId.ToString<AZStd::string>().c_str(), GetStreamFilename());
+                    return ReportCompiledError(error.c_str());
+                }
+                if (!layout.m_classData && !BindCompiledLayout(layoutIndex, classData))
+                {
+                    return false;
+                }
+
+                void* rootAddress = nullptr;
+                if (m_inplaceLoadInfoCB) // user can provide function for inplace loading.
+                {
+                    m_inplaceLoadInfoCB(&rootAddress, nullptr, classId, m_sc);
+                }
+
+                bool isCreated = false;
+                if (!rootAddress)
+                {
+                    if (!m_readyCB)
+                    {
+                        AZStd::string error = AZStd::string::format("Root element address is nullptr and a ClassReadyCB was not provided to the LoadBlocking call."
+                            " Loading of the root element of type %s will halt.", classId.ToString<AZStd::string>().c_str());
+                        return ReportCompiledError(error.c_str());
+                    }
+
+                    AZ_Assert(classData->m_factory != nullptr, "We are attempting to create '%s', but no constructor is provided!", classData->m_name);
+                    rootAddress = classData->m_factory->Create(classData->m_name);
+                    isCreated = true;
+                }
+
+                if (!LoadCompiledObject(rootAddress, layoutIndex))
+                {
+                    if (isCreated)
+                    {
+                        classData->m_factory->Destroy(rootAddress);
+                    }
+                    return false;
+                }
+
+                if (m_readyCB)
+                {
+                    m_readyCB(rootAddress, classId, m_sc);
+                }
+            }
+
+            // Leave the stream at the end of the object stream, like the other formats do.
+            if (m_compiledReadPosition < m_compiledData.size() && m_stream->CanSeek())
+            {
+                m_stream->Seek(-static_cast<IO::OffsetType>(m_compiledData.size() - m_compiledReadPosition), IO::GenericStream::ST_SEEK_CUR);
+            }
+
+            return m_compiledLoadResult;
+        }
+
+        //=========================================================================
+        // ReadCompiledLayouts
+        //=========================================================================
+        bool ObjectStreamImpl::ReadCompiledLayouts()
+        {
+            constexpr size_t layoutHeaderSize = sizeof(Uuid) + sizeof(u32) + sizeof(u8) + sizeof(u32);
+            constexpr size_t elementSize = sizeof(u32) + sizeof(Uuid) + sizeof(u8) + sizeof(u32) + sizeof(u32) + sizeof(u32);
+
+            m_compiledLayouts.clear();
+
+            u32 layoutCount = 0;
+            if (!ReadCompiled(layoutCount) || layoutCount > (m_compiledData.size() - m_compiledReadPosition) / layoutHeaderSize)
+            {
+                return ReportCompiledError("Compiled stream has an invalid layout table. Load aborted!");
+            }
+
+            for (u32 layoutIndex = 0; layoutIndex < layoutCount; ++layoutIndex)
+            {
+                m_compiledLayouts.emplace_back();
+                CompiledLayout& layout = m_compiledLayouts.back();
+
+                u8 kind = 0;
+                u32 elementCount = 0;
+                if (!ReadCompiled(layout.m_typeId) || !ReadCompiled(layout.m_version) || !ReadCompiled(kind) || !ReadCompiled(elementCount)
+                    || kind >= static_cast<u8>(CompiledLayout::Kind::Max) || elementCount > (m_compiledData.size() - m_compiledReadPosition) / elementSize)
+                {
+                    return ReportCompiledError("Compiled stream has an invalid layout table. Load aborted!");
+                }
+                layout.m_kind = static_cast<CompiledLayout::Kind>(kind);
+
+                layout.m_elements.resize(elementCount);
+                for (CompiledElement& element : layout.m_elements)
+                {
+                    u8 op = 0;
+                    if (!ReadCompiled(element.m_nameCrc) || !ReadCompiled(element.m_typeId) || !ReadCompiled(op) || !ReadCompiled(element.m_size) || !ReadCompiled(element.m_rawLayoutCrc)
+                        || !ReadCompiled(element.m_layoutIndex)
+                        || op >= static_cast<u8>(CompiledElement::Op::Max))
+                    {
+                        return ReportCompiledError("Compiled stream has an invalid layout table. Load aborted!");
+                    }
+                    element.m_op = static_cast<CompiledElement::Op>(op);
+                }
+            }
+
+            for (const CompiledLayout& layout : m_compiledLayouts)
+            {
+                for (const CompiledElement& element : layout.m_elements)
+                {
+                    if (element.m_op == CompiledElement::Op::Object && element.m_layoutIndex >= layoutCount)
+                    {
+                        return ReportCompiledError("Compiled stream has an invalid layout table. Load aborted!");
+                    }
+                }
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // BindCompiledLayout
+        //=========================================================================
+        bool ObjectStreamImpl::BindCompiledLayout(u32 layoutIndex, const SerializeContext::ClassData* classData)
+        {
+            CompiledLayout& streamLayout = m_compiledLayouts[layoutIndex];
+            if (streamLayout.m_classData)
+            {
+                return true;
+            }
+
+            CompiledLayout layout;
+            BuildCompiledLayout(layout, classData);
+
+            bool isMatching = layout.m_typeId == streamLayout.m_typeId && layout.m_version == streamLayout.m_version
+                && layout.m_kind == streamLayout.m_kind && layout.m_elements.size() == streamLayout.m_elements.size();
+            for (size_t i = 0; isMatching && i < layout.m_elements.size(); ++i)
+            {
+                CompiledElement& element = layout.m_elements[i];
+                const CompiledElement& streamElement = streamLayout.m_elements[i];
+                isMatching = element.m_nameCrc == streamElement.m_nameCrc && element.m_typeId == streamElement.m_typeId
+                    && element.m_op == streamElement.m_op && element.m_size == streamElement.m_size && element.m_rawLayoutCrc == streamElement.m_rawLayoutCrc;
+                element.m_layoutIndex = streamElement.m_layoutIndex;
+            }
+
+            if (!isMatching)
+            {
+                // The compiled format has no version conversion, the data must be saved with the current reflection.
+                AZStd::string error = AZStd::string::format("The reflection of class '%s'(%s) doesn't match the compiled stream, the stream needs to be saved again. Load aborted!  File %s",
+                    classData->m_name, classData->m_typeId.ToString<AZStd::string>().c_str(), GetStreamFilename());
+                return ReportCompiledError(error.c_str());
+            }
+
+            // Assign the layout before binding the elements, so recursive types find it bound.
+            streamLayout = AZStd::move(layout);
+
+            for (const CompiledElement& element : m_compiledLayouts[layoutIndex].m_elements)
+            {
+                if (element.m_op == CompiledElement::Op::Object && !BindCompiledLayout(element.m_layoutIndex, element.m_classData))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // LoadCompiledObject
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiledObject(void* objectPtr, u32 layoutIndex)
+        {
+            const CompiledLayout& layout = m_compiledLayouts[layoutIndex];
+            const SerializeContext::ClassData* classData = layout.m_classData;
+
+            if (layout.m_kind == CompiledLayout::Kind::Embedded)
+            {
+                // the nested stream sends the events
+                return LoadCompiledValue(objectPtr, layout);
+            }
+
+            if (classData->m_eventHandler)
+            {
+                classData->m_eventHandler->OnWriteBegin(objectPtr);
+            }
+
+            bool isReadable = true;
+            switch (layout.m_kind)
+            {
+            case CompiledLayout::Kind::Elements:
+                for (const CompiledOp& op : layout.m_ops)
+                {
+                    char* elementPtr = reinterpret_cast<char*>(objectPtr) + op.m_offset;
+                    if (op.m_op == CompiledElement::Op::Raw)
+                    {
+                        const char* data = ConsumeCompiled(op.m_size);
+                        if (!data)
+                        {
+                            isReadable = false;
+                            break;
+                        }
+                        memcpy(elementPtr, data, op.m_size);
+                    }
+                    else if (!LoadCompiledElement(elementPtr, layout.m_elements[op.m_elementIndex], false))
+                    {
+                        isReadable = false;
+                        break;
+                    }
+                }
+                break;
+            case CompiledLayout::Kind::Value:
+            case CompiledLayout::Kind::Asset:
+                isReadable = LoadCompiledValue(objectPtr, layout);
+                break;
+            case CompiledLayout::Kind::Container:
+                isReadable = LoadCompiledContainer(objectPtr, layout);
+                break;
+            default:
+                break;
+            }
+
+            if (classData->m_eventHandler)
+            {
+                classData->m_eventHandler->OnWriteEnd(objectPtr);
+                classData->m_eventHandler->OnLoadedFromObjectStream(objectPtr);
+            }
+
+            return isReadable;
+        }
+
+        //=========================================================================
+        // LoadCompiledElement
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiledElement(void* elementPtr, const CompiledElement& element, bool isContainerElement)
+        {
+            switch (element.m_op)
+            {
+            case CompiledElement::Op::Raw:
+                if (const char* data = ConsumeCompiled(element.m_size))
+                {
+                    memcpy(elementPtr, data, element.m_size);
+                    return true;
+                }
+                return false;
+            case CompiledElement::Op::Object:
+                return LoadCompiledObject(elementPtr, element.m_layoutIndex);
+            case CompiledElement::Op::Pointer:
+                return LoadCompiledPointer(elementPtr, element, isContainerElement);
+            default:
+                return false;
+            }
+        }
+
+        //=========================================================================
+        // LoadCompiledPointer
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiledPointer(void* pointerAddress, const CompiledElement& element, bool isContainerElement)
+        {
+            u32 pointerTag = 0;
+            if (!ReadCompiled(pointerTag))
+            {
+                return false;
+            }
+            if (pointerTag == 0)
+            {
+                // null pointers are not stored, keep the default value
+                return true;
+            }
+
+            const u32 layoutIndex = pointerTag - 1;
+            if (layoutIndex >= m_compiledLayouts.size())
+            {
+                return ReportCompiledError("Compiled stream has an invalid pointer element. Load aborted!");
+            }
+
+            const CompiledLayout& layout = m_compiledLayouts[layoutIndex];
+            if (!layout.m_classData)
+            {
+                const SerializeContext::ClassData* classData = layout.m_typeId == element.m_typeId && element.m_classData ? element.m_classData : m_sc->FindClassData(layout.m_typeId);
+                if (!classData)
+                {
+                    AZStd::string error = AZStd::string::format("Element '%s' with class ID '%s' is not registered with the serializer! Load aborted.  File %s",
+                        element.m_classElement->m_name ? element.m_classElement->m_name : "NULL", layout.m_typeId.ToString<AZStd::string>().c_str(), GetStreamFilename());
+                    return ReportCompiledError(error.c_str());
+                }
+                if (!BindCompiledLayout(layoutIndex, classData))
+                {
+                    return false;
+                }
+            }
+
+            const SerializeContext::ClassData* classData = layout.m_classData;
+            const SerializeContext::ClassElement* classElement = element.m_classElement;
+            if (classData->m_typeId != classElement->m_typeId && !m_sc->CanDowncast(classData->m_typeId, classElement->m_typeId, classData->m_azRtti, classElement->m_azRtti))
+            {
+                AZStd::string error = AZStd::string::format("Class '%s' can't be cast to the type of element '%s'. Load aborted!  File %s",
+                    classData->m_name, classElement->m_name ? classElement->m_name : "NULL", GetStreamFilename());
+                return ReportCompiledError(error.c_str());
+            }
+
+            AZ_Assert(classData->m_factory != nullptr, "We are attempting to create '%s', but no factory is provided! Either provide factory or change data member '%s' to value not pointer!",
+                classData->m_name, classElement->m_name);
+
+            // If there is a value stored at the data address already, destroy it. This prevents leaks where the default
+            // constructor of object A allocates an object B and stores B in a field in A that is also serialized.
+            void*& pointer = *reinterpret_cast<void**>(pointerAddress);
+            if (!isContainerElement && pointer)
+            {
+                // Tip: If you crash here, it might be a pointer that isn't initialized to null
+                classData->m_factory->Destroy(pointer);
+            }
+
+            void* objectPtr = classData->m_factory->Create(classData->m_name);
+            // we need to account for additional offsets if we have a pointer to a base class.
+            pointer = m_sc->DownCast(objectPtr, classData->m_typeId, classElement->m_typeId, classData->m_azRtti, classElement->m_azRtti);
+            return LoadCompiledObject(objectPtr, layoutIndex);
+        }
+
+        //=========================================================================
+        // LoadCompiledContainer
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiledContainer(void* containerPtr, const CompiledLayout& layout)
+        {
+            SerializeContext::IDataContainer* container = layout.m_classData->m_container;
+
+            u32 elementCount = 0;
+            if (!ReadCompiled(elementCount))
+            {
+                return false;
+            }
+
+            // Clear the container before loading the elements, otherwise we end up with more elements than we should have.
+            container->ClearElements(containerPtr, m_sc);
+
+            auto getElementAddress = [this, container, containerPtr, &layout](const CompiledElement& element, u32 elementIndex)
+            {
+                void* elementPtr = nullptr;
+                if (container->CanAccessElementsByIndex() && container->Size(containerPtr) > elementIndex)
+                {
+                    elementPtr = container->GetElementByIndex(containerPtr, element.m_classElement, elementIndex);
+                }
+                else
+                {
+                    elementPtr = container->ReserveElement(containerPtr, element.m_classElement);
+                }
+
+                if (!elementPtr)
+                {
+                    AZStd::string error = AZStd::string::format("Failed to reserve element in container '%s'. The container may be full. Element %u will not be added to container.",
+                        layout.m_classData->m_name, elementIndex);
+                    m_errorLogger.ReportError(error.c_str());
+                    m_compiledLoadResult = m_compiledLoadResult && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+                }
+                return elementPtr;
+            };
+
+            if (layout.m_elements.size() == 1 && layout.m_elements[0].m_op == CompiledElement::Op::Raw)
+            {
+                // trivially copyable elements are stored back to back, load them with a single copy when possible
+                const CompiledElement& element = layout.m_elements[0];
+                const char* data = ConsumeCompiled(static_cast<size_t>(elementCount) * element.m_size);
+                if (!data)
+                {
+                    return false;
+                }
+                if (elementCount == 0)
+                {
+                    return true;
+                }
+
+                if (void* elements = container->ResizeContiguousElements(containerPtr, elementCount))
+                {
+                    memcpy(elements, data, static_cast<size_t>(elementCount) * element.m_size);
+                    return true;
+                }
+
+                for (u32 elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+                {
+                    void* elementPtr = getElementAddress(element, elementIndex);
+                    if (!elementPtr)
+                    {
+                        break;
+                    }
+                    memcpy(elementPtr, data + static_cast<size_t>(elementIndex) * element.m_size, element.m_size);
+                    container->StoreElement(containerPtr, elementPtr);
+                }
+                return true;
+            }
+
+            for (u32 elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+            {
+                u8 slotIndex = 0;
+                if (layout.m_elements.size() > 1)
+                {
+                    if (!ReadCompiled(slotIndex))
+                    {
+                        return false;
+                    }
+                    if (slotIndex >= layout.m_elements.size())
+                    {
+                        return ReportCompiledError("Compiled stream has an invalid container element. Load aborted!");
+                    }
+                }
+
+                const CompiledElement& element = layout.m_elements[slotIndex];
+                void* elementPtr = getElementAddress(element, elementIndex);
+                if (!elementPtr)
+                {
+                    // the size of the element data is unknown, so the rest of the stream can't be read
+                    return false;
+                }
+                if (!LoadCompiledElement(elementPtr, element, true))
+                {
+                    return false;
+                }
+                container->StoreElement(containerPtr, elementPtr);
+            }
+            return true;
+        }
+
+        //=========================================================================
+        // LoadCompiledValue
+        //=========================================================================
+        bool ObjectStreamImpl::LoadCompiledValue(void* objectPtr, const CompiledLayout& layout)
+        {
+            u32 dataSize = 0;
+            const char* data = ReadCompiled(dataSize) ? ConsumeCompiled(dataSize) : nullptr;
+            if (!data)
+            {
+                return false;
+            }
+
+            const SerializeContext::ClassData* classData = layout.m_classData;
+            IO::MemoryStream valueStream(data, dataSize);
+            bool isLoaded = false;
+            if (layout.m_kind == CompiledLayout::Kind::Embedded)
+            {
+                auto inplaceLoadInfoCB = [objectPtr, classData](void** rootAddress, const SerializeContext::ClassData** rootClassData, const Uuid&, SerializeContext*)
+                {
+                    if (rootAddress)
+                    {
+                        *rootAddress = objectPtr;
+                    }
+                    if (rootClassData)
+                    {
+                        *rootClassData = classData;
+                    }
+                };
+                isLoaded = ObjectStream::LoadBlocking(&valueStream, *m_sc, ClassReadyCB(), m_filterDesc, inplaceLoadInfoCB);
+            }
+            else if (layout.m_kind == CompiledLayout::Kind::Asset)
+            {
+                // Intercept asset references so we can forward asset load filter information.
+                isLoaded = static_cast<AssetSerializer*>(classData->m_serializer.get())->LoadWithFilter(objectPtr, valueStream, layout.m_version, m_filterDesc.m_assetCB, false);
+            }
+            else
+            {
+                isLoaded = classData->m_serializer->Load(objectPtr, valueStream, layout.m_version, false);
+            }
+
+            if (!isLoaded)
+            {
+                AZStd::string error = AZStd::string::format("Failed to load %s from the compiled stream.  File %s", classData->m_name, GetStreamFilename());
+                m_errorLogger.ReportError(error.c_str());
+                m_compiledLoadResult = m_compiledLoadResult && ((m_filterDesc.m_flags & FILTERFLAG_STRICT) == 0);  // in strict mode, this is a complete failure.
+            }
+            return true;
+        }
+
+        bool ObjectStreamImpl::ReportCompiledError(const char* error)
+        {
+            m_errorLogger.ReportError(error);
+            // this is considered a "fatal" error since the rest of the stream can't be read.
+            return false;
+        }
+
         const char* ObjectStreamImpl::GetStreamFilename() const
         {
             return m_stream ? m_stream->GetFilename() : "None";
@@ -72,6 +72,10 @@ namespace AZ
             ST_XML,
             ST_JSON,
             ST_BINARY,
+            /// Binary format for data that is saved and loaded with the same reflection (e.g. cooked runtime data).
+            /// The layout of each class is compiled once per stream into a flat plan, which allows trivially copyable
+            /// members and containers to be copied in bulk. Loading fails if the reflection of a class has changed.
+            ST_BINARY_COMPILED,
             ST_MAX // insert new types before this.
         };
 
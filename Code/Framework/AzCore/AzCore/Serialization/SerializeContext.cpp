@@ -65,6 +65,11 @@ namespace AZ
             AZ_SERIALIZE_SWAP_ENDIAN(value, isDataBigEndian);
             return static_cast<size_t>(stream.Write(sizeof(T), reinterpret_cast<const void*>(&value)));
         }
+
+        size_t GetRawDataSize() const override
+        {
+            return sizeof(T);
+        }
     };
 
 
@@ -405,6 +410,8 @@ namespace AZ
     SerializeContext::SerializeContext(bool registerIntegralTypes, bool createEditContext)
         : m_editContext(nullptr)
     {
+        OnReflectionChanged();
+
         if (registerIntegralTypes)
         {
             Class<char>()->
@@ -563,6 +570,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        OnReflectionChanged();
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -730,6 +738,7 @@ namespace AZ
 
             if (scGenericInfoFoundIt == scGenericClassInfoRange.second)
             {
+                OnReflectionChanged();
                 m_uuidGenericMap.emplace(classId, genericClassInfo);
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
@@ -1632,6 +1641,8 @@ namespace AZ
     //=========================================================================
     SerializeContext::ClassBuilder::~ClassBuilder()
     {
+        m_context->OnReflectionChanged();
+
 #if defined(AZ_ENABLE_TRACING)
         if (!m_context->IsRemovingReflection())
         {
@@ -2789,11 +2800,31 @@ namespace AZ
         }
     }
 
+    //=========================================================================
+    // GetReflectionGeneration
+    //=========================================================================
+    AZ::u64 SerializeContext::GetReflectionGeneration() const
+    {
+        return m_reflectionGeneration;
+    }
+
+    //=========================================================================
+    // OnReflectionChanged
+    //=========================================================================
+    void SerializeContext::OnReflectionChanged()
+    {
+        // Generations are drawn from a shared counter so a new context that's allocated at the address of a destroyed one
+        // doesn't report a generation that was cached for the destroyed context.
+        static AZStd::atomic<AZ::u64> s_reflectionGenerationCounter{ 0 };
+        m_reflectionGeneration = ++s_reflectionGenerationCounter;
+    }
+
     //=========================================================================
     // RemoveClassData
     //=========================================================================
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        OnReflectionChanged();
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
@@ -693,6 +693,10 @@ namespace AZ
 
             /// Optional post processing of the cloned data to deal with members that are not serialize-reflected.
             virtual void PostClone(void* /*classPtr*/) {}
+
+            /// Returns the size of the value if Save writes the memory of the instance as is (when the data is not big endian) and Load
+            /// reads it back the same way, otherwise 0. Such values can be copied directly by ObjectStream::ST_BINARY_COMPILED.
+            virtual size_t GetRawDataSize() const { return 0; }
         };
 
         /**
@@ -815,6 +819,11 @@ namespace AZ
             virtual void    ClearElements(void* instance, SerializeContext* deletePointerDataContext) = 0;
             /// Called when elements inside the container have been modified.
             virtual void    ElementsUpdated(void* instance);
+            /// Returns the address of the first element if the elements are stored contiguously in memory, otherwise null.
+            virtual void*   GetContiguousElements([[maybe_unused]] void* instance) { return nullptr; }
+            /// Resizes the container to elementCount elements and returns the address of the first one if the elements are stored contiguously in memory,
+            /// otherwise returns null and leaves the container unchanged. Used to load trivially copyable elements with a single copy.
+            virtual void*   ResizeContiguousElements([[maybe_unused]] void* instance, [[maybe_unused]] size_t elementCount) { return nullptr; }
 
         protected:
             /// Free element data (when the class elements are pointers).
@@ -1052,6 +1061,10 @@ namespace AZ
         /// Find a class data (stored information) based on a class name
         AZStd::vector<AZ::Uuid> FindClassId(const AZ::Crc32& classNameCrc) const;
 
+        /// Returns a value that changes every time classes are added to, updated in or removed from this context. Systems that
+        /// cache information derived from the class data can compare it to detect that their cache has become stale.
+        AZ::u64 GetReflectionGeneration() const;
+
         /// Find GenericClassData data based on the supplied class ID
         GenericClassInfo* FindGenericClassInfo(const Uuid& classId) const; 
 
@@ -1098,6 +1111,9 @@ namespace AZ
         /// Enumerate function called to enumerate an azrtti hierarchy
         static void EnumerateBaseRTTIEnumCallback(const Uuid& id, void* userData);
 
+        /// Marks the reflected class data as changed, see GetReflectionGeneration.
+        void OnReflectionChanged();
+
         /// Remove class data
         void RemoveClassData(ClassData* classData);
         /// Removes the GenericClassInfo from the GenericClassInfoMap
@@ -1270,7 +1286,7 @@ namespace AZ
             friend class SerializeContext;
             EnumBuilder(SerializeContext* context, const UuidToClassMap::iterator& classMapIter);
         public:
-            ~EnumBuilder() = default;
+            ~EnumBuilder();
             auto operator->() -> EnumBuilder*;
 
             //! Declare enum field with a specific value
@@ -1329,6 +1345,7 @@ namespace AZ
     private:
         EditContext* m_editContext;  ///< Pointer to optional edit context.
         UuidToClassMap  m_uuidMap;      ///< Map for all class in this serialize context
+        AZ::u64 m_reflectionGeneration = 0; ///< Changes every time the reflected class data changes.
         AZStd::unordered_multimap<AZ::Crc32, AZ::Uuid> m_classNameToUuid;  /// Map all class names to their uuid
         AZStd::unordered_multimap<Uuid, GenericClassInfo*>  m_uuidGenericMap;      ///< Uuid to ClassData map of reflected classes with GenericTypeInfo
         AZStd::unordered_multimap<Uuid, Uuid> m_legacySpecializeTypeIdToTypeIdMap; ///< Keep a map of old legacy specialized typeids of template classes to new specialized typeids
@@ -22,6 +22,11 @@ namespace AZ
         }
     }
 
+    SerializeContext::EnumBuilder::~EnumBuilder()
+    {
+        m_context->OnReflectionChanged();
+    }
+
     auto SerializeContext::EnumBuilder::operator->() -> EnumBuilder*
     {
         return this;
@@ -121,6 +121,11 @@ namespace AZ
             {
                 return SerializeContext::EqualityCompareHelper<EnumType>::CompareValues(lhs, rhs);
             }
+
+            size_t GetRawDataSize() const override
+            {
+                return sizeof(EnumType);
+            }
         };
     }
 
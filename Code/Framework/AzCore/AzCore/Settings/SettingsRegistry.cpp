@@ -5,11 +5,109 @@
  *
  */
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/string/conversions.h>
 
 namespace AZ
 {
+    SettingsRegistryInterface::KeyHandle::KeyHandle(AZStd::string_view path)
+    {
+        m_isValid = Parse(path);
+        if (!m_isValid)
+        {
+            m_names.clear();
+            m_tokens.clear();
+        }
+    }
+
+    bool SettingsRegistryInterface::KeyHandle::Parse(AZStd::string_view path)
+    {
+        if (path.size() > m_path.max_size())
+        {
+            return false;
+        }
+        m_path = path;
+
+        // Follows the JSON Pointer syntax from RFC 6901, an empty path refers to the root.
+        size_t position = 0;
+        while (position < path.size())
+        {
+            if (path[position] != '/' || m_tokens.size() == m_tokens.max_size())
+            {
+                return false;
+            }
+            ++position;
+
+            Token token;
+            token.m_nameOffset = aznumeric_cast<AZ::u32>(m_names.size());
+            for (; position < path.size() && path[position] != '/'; ++position)
+            {
+                char character = path[position];
+                if (character == '~')
+                {
+                    ++position;
+                    if (position == path.size() || (path[position] != '0' && path[position] != '1'))
+                    {
+                        return false;
+                    }
+                    character = path[position] == '0' ? '~' : '/';
+                }
+                m_names.push_back(character);
+            }
+            token.m_nameLength = aznumeric_cast<AZ::u32>(m_names.size() - token.m_nameOffset);
+
+            // Only a non-empty token of digits without leading zeros can be an array index.
+            AZStd::string_view name(m_names.data() + token.m_nameOffset, token.m_nameLength);
+            token.m_index = (name.empty() || (name.size() > 1 && name[0] == '0')) ? NotAnIndex : 0;
+            for (char digit : name)
+            {
+                if (token.m_index == NotAnIndex)
+                {
+                    break;
+                }
+                const size_t digitValue = static_cast<size_t>(digit - '0');
+                if (digit < '0' || digit > '9' || token.m_index > (NotAnIndex - 1 - digitValue) / 10)
+                {
+                    token.m_index = NotAnIndex;
+                }
+                else
+                {
+                    token.m_index = token.m_index * 10 + digitValue;
+                }
+            }
+            m_tokens.push_back(token);
+        }
+        return true;
+    }
+
+    bool SettingsRegistryInterface::KeyHandle::IsValid() const
+    {
+        return m_isValid;
+    }
+
+    AZStd::string_view SettingsRegistryInterface::KeyHandle::GetPath() const
+    {
+        return m_path;
+    }
+
+    size_t SettingsRegistryInterface::KeyHandle::GetTokenCount() const
+    {
+        return m_tokens.size();
+    }
+
+    AZStd::string_view SettingsRegistryInterface::KeyHandle::GetTokenName(size_t index) const
+    {
+        AZ_Assert(index < m_tokens.size(), "Token index %zu is out of range for a key with %zu tokens.", index, m_tokens.size());
+        return AZStd::string_view(m_names.data() + m_tokens[index].m_nameOffset, m_tokens[index].m_nameLength);
+    }
+
+    size_t SettingsRegistryInterface::KeyHandle::GetTokenIndex(size_t index) const
+    {
+        AZ_Assert(index < m_tokens.size(), "Token index %zu is out of range for a key with %zu tokens.", index, m_tokens.size());
+        return m_tokens[index].m_index;
+    }
+
     SettingsRegistryInterface::Specializations::Specializations(AZStd::initializer_list<AZStd::string_view> specializations)
     {
         for (AZStd::string_view specialization : specializations)
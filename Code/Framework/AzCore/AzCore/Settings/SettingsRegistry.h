@@ -82,6 +82,50 @@ namespace AZ
             AZStd::fixed_vector<size_t, MaxCount> m_hashes;
         };
 
+        //! A path into the Settings Registry that's parsed once, for settings that are queried repeatedly, such as
+        //! from per-frame code. Queries with a KeyHandle don't parse the path again, and the Settings Registry can
+        //! resolve them against its latest snapshot without locking.
+        //! A KeyHandle doesn't allocate, so it can be statically declared:
+        //!     static const AZ::SettingsRegistryInterface::KeyHandle s_enabledKey{ "/O3DE/MyGem/Enabled" };
+        //!     registry->Get(enabled, s_enabledKey);
+        class KeyHandle
+        {
+        public:
+            static constexpr size_t MaxTokenCount = 32;
+            static constexpr size_t NotAnIndex = static_cast<size_t>(-1);
+
+            KeyHandle() = default;
+            //! Parses a JSON pointer path, the key is invalid if the path isn't a valid JSON pointer, or has more
+            //! than MaxTokenCount tokens.
+            explicit KeyHandle(AZStd::string_view path);
+
+            //! Whether or not the path could be parsed.
+            bool IsValid() const;
+            //! The path the key was created with.
+            AZStd::string_view GetPath() const;
+            //! The number of reference tokens in the path, 0 for the root.
+            size_t GetTokenCount() const;
+            //! The name of the token at the provided index, with the "~0" and "~1" escape sequences replaced.
+            AZStd::string_view GetTokenName(size_t index) const;
+            //! The array index of the token at the provided index, or NotAnIndex if the token isn't a valid array index.
+            size_t GetTokenIndex(size_t index) const;
+
+        private:
+            bool Parse(AZStd::string_view path);
+
+            struct Token
+            {
+                AZ::u32 m_nameOffset;
+                AZ::u32 m_nameLength;
+                size_t m_index;
+            };
+
+            FixedValueString m_path;
+            FixedValueString m_names; //!< The unescaped names of all the tokens.
+            AZStd::fixed_vector<Token, MaxTokenCount> m_tokens;
+            bool m_isValid{ false };
+        };
+
         //! Type of the store value, or None if there's no value stored.
         enum class Type
         {
@@ -168,6 +212,19 @@ namespace AZ
         //! @callback The function to call when an entry gets a new/updated value.
         [[nodiscard]] virtual NotifyEventHandler RegisterNotifier(NotifyCallback&& callback) = 0;
 
+        //! Returns the type of an entry in the Settings Registry or Type::None if there's no value or the key is invalid.
+        virtual Type GetType(const KeyHandle& key) const { return key.IsValid() ? GetType(key.GetPath()) : Type::NoType; }
+        //! Gets the value for a pre-parsed key, see KeyHandle. These behave the same as the Get functions that take a path.
+        //! @param result The target to write the result to.
+        //! @param key The pre-parsed path to the value.
+        //! @return Whether or not the value was retrieved. An invalid key or type-mismatch will return false;
+        virtual bool Get(bool& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+        virtual bool Get(s64& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+        virtual bool Get(u64& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+        virtual bool Get(double& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+        virtual bool Get(AZStd::string& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+        virtual bool Get(FixedValueString& result, const KeyHandle& key) const { return key.IsValid() && Get(result, key.GetPath()); }
+
         //! Gets the boolean value at the provided path.
         //! @param result The target to write the result to.
         //! @param path The path to the value.
@@ -294,8 +351,8 @@ namespace AZ
         //! @param path The path to the registry file.
         //! @param format The format of the text data in the file at the provided path.
         //! @param rootKey The key where the root of the settings file will be stored under.
-        //! @param scratchBuffer An optional buffer that's used to load the file into. Use this when loading multiple patches to
-        //!     reduce the number of intermediate memory allocations.
+        //! @param scratchBuffer An optional buffer that's used to load the file into if it can't be memory mapped. Use this when
+        //!     loading multiple patches to reduce the number of intermediate memory allocations.
         //! @return True if the registry file was successfully merged, otherwise false.
         virtual bool MergeSettingsFile(AZStd::string_view path, Format format, AZStd::string_view rootKey = "",
             AZStd::vector<char>* scratchBuffer = nullptr) = 0;
@@ -312,11 +369,26 @@ namespace AZ
         //! @param platform An optional name of a platform. Platform overloads are located at <path>/Platform/<platform>/
         //!     Files in a platform are applied in the same order as for the main folder but always after the same file
         //!     in the main folder.
-        //! @param scratchBuffer An optional buffer that's used to load the file into. Use this when loading multiple patches to
-        //!     reduce the number of intermediate memory allocations.
+        //! @param scratchBuffer An optional buffer that's used to load the file into if it can't be memory mapped. Use this when
+        //!     loading multiple patches to reduce the number of intermediate memory allocations.
         //! @return True if the registry folder was successfully merged, otherwise false.
         virtual bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform = {}, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) = 0;
+        //! Loads all settings files in several folders and merges them into the registry. The files are merged in the same
+        //! order as calling MergeSettingsFolder for each folder in turn, but implementations can load and parse the files of
+        //! all folders in parallel first.
+        //! @param paths The paths to the registry folders, in the order they're merged.
+        //! @return True if all registry folders were successfully merged, otherwise false.
+        virtual bool MergeSettingsFolders(const AZStd::vector<AZStd::string_view>& paths, const Specializations& specializations,
+            AZStd::string_view platform = {}, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr)
+        {
+            bool result = true;
+            for (AZStd::string_view path : paths)
+            {
+                result = MergeSettingsFolder(path, specializations, platform, rootKey, scratchBuffer) && result;
+            }
+            return result;
+        }
 
         //! Stores the settings structure which is used when merging settings to the Settings Registry
         //! using JSON Merge Patch or JSON Merge Patch.
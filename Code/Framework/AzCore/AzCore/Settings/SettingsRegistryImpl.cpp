@@ -8,6 +8,9 @@
 #include <cctype>
 #include <cerrno>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/JSON/error/en.h>
 #include <AzCore/NativeUI//NativeUIRequests.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
@@ -15,6 +18,8 @@
 #include <AzCore/Settings/SettingsRegistryImpl.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ
 {
@@ -55,26 +60,18 @@ namespace AZ
                 static_assert(!AZStd::is_same_v<T, T>, "SettingsRegistryImpl::SetValueInternal called with unsupported type.");
             }
 
+            MarkSnapshotOutdated();
             m_notifiers.Signal(path, type);
             return true;
         }
         return false;
     }
 
-    template<typename T>
-    bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
+    namespace SettingsRegistryImplInternal
     {
-        if (path.empty())
+        template<typename T>
+        bool GetValue(T& result, const rapidjson::Value* value)
         {
-            // rapidjson::Pointer assets that the supplied string
-            // is not nullptr even if the supplied size is 0
-            // Setting to empty string to prevent assert
-            path = "";
-        }
-        rapidjson::Pointer pointer(path.data(), path.length());
-        if (pointer.IsValid())
-        {
-            const rapidjson::Value* value = pointer.Get(m_settings);
             if constexpr (AZStd::is_same_v<T, bool>)
             {
                 if (value && value->IsBool())
@@ -119,10 +116,137 @@ namespace AZ
             {
                 static_assert(!AZStd::is_same_v<T,T>, "SettingsRegistryImpl::GetValueInternal called with unsupported type.");
             }
+            return false;
+        }
+
+        SettingsRegistryInterface::Type GetType(const rapidjson::Value* value)
+        {
+            if (value)
+            {
+                switch (value->GetType())
+                {
+                case rapidjson::Type::kNullType:
+                    return SettingsRegistryInterface::Type::Null;
+                case rapidjson::Type::kFalseType:
+                    return SettingsRegistryInterface::Type::Boolean;
+                case rapidjson::Type::kTrueType:
+                    return SettingsRegistryInterface::Type::Boolean;
+                case rapidjson::Type::kObjectType:
+                    return SettingsRegistryInterface::Type::Object;
+                case rapidjson::Type::kArrayType:
+                    return SettingsRegistryInterface::Type::Array;
+                case rapidjson::Type::kStringType:
+                    return SettingsRegistryInterface::Type::String;
+                case rapidjson::Type::kNumberType:
+                    return
+                        value->IsDouble() ? SettingsRegistryInterface::Type::FloatingPoint :
+                        SettingsRegistryInterface::Type::Integer;
+                }
+            }
+            return SettingsRegistryInterface::Type::NoType;
+        }
+
+        // Same as rapidjson::Pointer::Get, but with the tokens of the path already parsed.
+        const rapidjson::Value* FindValue(const rapidjson::Value& root, const SettingsRegistryInterface::KeyHandle& key)
+        {
+            if (!key.IsValid())
+            {
+                return nullptr;
+            }
+
+            const rapidjson::Value* value = &root;
+            const size_t tokenCount = key.GetTokenCount();
+            for (size_t i = 0; i < tokenCount; ++i)
+            {
+                if (value->IsObject())
+                {
+                    AZStd::string_view name = key.GetTokenName(i);
+                    const rapidjson::Value nameValue(rapidjson::StringRef(name.data(), name.size()));
+                    auto member = value->FindMember(nameValue);
+                    if (member == value->MemberEnd())
+                    {
+                        return nullptr;
+                    }
+                    value = &member->value;
+                }
+                else if (value->IsArray())
+                {
+                    const size_t index = key.GetTokenIndex(i);
+                    if (index == SettingsRegistryInterface::KeyHandle::NotAnIndex || index >= value->Size())
+                    {
+                        return nullptr;
+                    }
+                    value = &(*value)[static_cast<rapidjson::SizeType>(index)];
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
+            return value;
+        }
+    }
+
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, AZStd::string_view path) const
+    {
+        if (path.empty())
+        {
+            // rapidjson::Pointer assets that the supplied string
+            // is not nullptr even if the supplied size is 0
+            // Setting to empty string to prevent assert
+            path = "";
+        }
+        rapidjson::Pointer pointer(path.data(), path.length());
+        if (pointer.IsValid())
+        {
+            return SettingsRegistryImplInternal::GetValue(result, pointer.Get(m_settings));
         }
         return false;
     }
 
+    template<typename T>
+    bool SettingsRegistryImpl::GetValueInternal(T& result, const KeyHandle& key) const
+    {
+        if (!key.IsValid())
+        {
+            return false;
+        }
+
+        // Read from the latest snapshot without locking, unless the settings have changed since it was taken. In that
+        // case the live settings are read instead, as taking a new snapshot for every read in between changes would
+        // be far more expensive than the lock.
+        if (!m_isSnapshotOutdated.load(AZStd::memory_order_acquire))
+        {
+            SnapshotPtr snapshot = AcquireSnapshot();
+            return SettingsRegistryImplInternal::GetValue(result, snapshot->Find(key));
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        return SettingsRegistryImplInternal::GetValue(result, SettingsRegistryImplInternal::FindValue(m_settings, key));
+    }
+
+    SettingsRegistryImpl::Snapshot::Snapshot(const rapidjson::Value& settings, u64 version)
+        : m_version(version)
+    {
+        m_settings.CopyFrom(settings, m_settings.GetAllocator());
+    }
+
+    u64 SettingsRegistryImpl::Snapshot::GetVersion() const
+    {
+        return m_version;
+    }
+
+    const rapidjson::Value& SettingsRegistryImpl::Snapshot::GetSettings() const
+    {
+        return m_settings;
+    }
+
+    const rapidjson::Value* SettingsRegistryImpl::Snapshot::Find(const KeyHandle& key) const
+    {
+        return SettingsRegistryImplInternal::FindValue(m_settings, key);
+    }
+
     SettingsRegistryImpl::SettingsRegistryImpl()
     {
         m_serializationSettings.m_keepDefaults = true;
@@ -228,6 +352,66 @@ namespace AZ
         m_notifiers.DisconnectAllHandlers();
     }
 
+    auto SettingsRegistryImpl::GetSnapshot() const -> SnapshotPtr
+    {
+        PublishSnapshot();
+        return AcquireSnapshot();
+    }
+
+    void SettingsRegistryImpl::PublishSnapshot() const
+    {
+        if (m_isSnapshotOutdated.load(AZStd::memory_order_acquire))
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            // Another thread may have updated the snapshot while waiting for the lock.
+            if (m_isSnapshotOutdated.load(AZStd::memory_order_acquire))
+            {
+                UpdateSnapshot();
+            }
+        }
+    }
+
+    auto SettingsRegistryImpl::AcquireSnapshot() const -> SnapshotPtr
+    {
+        while (true)
+        {
+            // Register as a reader of the current epoch, and confirm the epoch didn't change before registering. If
+            // it did, UpdateSnapshot may not be waiting for this reader, so try again in the new epoch.
+            const u32 epoch = m_snapshotEpoch.load(AZStd::memory_order_seq_cst);
+            m_snapshotReaders[epoch].fetch_add(1, AZStd::memory_order_seq_cst);
+            if (m_snapshotEpoch.load(AZStd::memory_order_seq_cst) == epoch)
+            {
+                SnapshotPtr snapshot = m_latestSnapshot.load(AZStd::memory_order_seq_cst);
+                m_snapshotReaders[epoch].fetch_sub(1, AZStd::memory_order_release);
+                return snapshot;
+            }
+            m_snapshotReaders[epoch].fetch_sub(1, AZStd::memory_order_release);
+        }
+    }
+
+    void SettingsRegistryImpl::UpdateSnapshot() const
+    {
+        SnapshotPtr snapshot = aznew Snapshot(m_settings, ++m_snapshotVersion);
+        m_latestSnapshot.store(snapshot.get(), AZStd::memory_order_seq_cst);
+
+        // Readers that start after the epoch changed will see the new snapshot, so once the readers of the previous
+        // epoch are done nobody can still take a reference to the previous snapshot, and it can be released.
+        const u32 previousEpoch = m_snapshotEpoch.load(AZStd::memory_order_relaxed);
+        m_snapshotEpoch.store(previousEpoch ^ 1, AZStd::memory_order_seq_cst);
+        while (m_snapshotReaders[previousEpoch].load(AZStd::memory_order_acquire) != 0)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        m_snapshot = AZStd::move(snapshot);
+        m_isSnapshotOutdated.store(false, AZStd::memory_order_release);
+    }
+
+    void SettingsRegistryImpl::MarkSnapshotOutdated()
+    {
+        m_isSnapshotOutdated.store(true, AZStd::memory_order_release);
+    }
+
     SettingsRegistryInterface::Type SettingsRegistryImpl::GetType(AZStd::string_view path) const
     {
         if (path.empty())
@@ -243,33 +427,28 @@ namespace AZ
         rapidjson::Pointer pointer(path.data(), path.length());
         if (pointer.IsValid())
         {
-            const rapidjson::Value* value = pointer.Get(m_settings);
-            if (value)
-            {
-                switch (value->GetType())
-                {
-                case rapidjson::Type::kNullType:
-                    return Type::Null;
-                case rapidjson::Type::kFalseType:
-                    return Type::Boolean;
-                case rapidjson::Type::kTrueType:
-                    return Type::Boolean;
-                case rapidjson::Type::kObjectType:
-                    return Type::Object;
-                case rapidjson::Type::kArrayType:
-                    return Type::Array;
-                case rapidjson::Type::kStringType:
-                    return Type::String;
-                case rapidjson::Type::kNumberType:
-                    return 
-                        value->IsDouble() ? Type::FloatingPoint :
-                        Type::Integer;
-                }
-            }
+            return SettingsRegistryImplInternal::GetType(pointer.Get(m_settings));
         }
         return Type::NoType;
     }
 
+    SettingsRegistryInterface::Type SettingsRegistryImpl::GetType(const KeyHandle& key) const
+    {
+        if (!key.IsValid())
+        {
+            return Type::NoType;
+        }
+
+        if (!m_isSnapshotOutdated.load(AZStd::memory_order_acquire))
+        {
+            SnapshotPtr snapshot = AcquireSnapshot();
+            return SettingsRegistryImplInternal::GetType(snapshot->Find(key));
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        return SettingsRegistryImplInternal::GetType(SettingsRegistryImplInternal::FindValue(m_settings, key));
+    }
+
     bool SettingsRegistryImpl::Get(bool& result, AZStd::string_view path) const
     {
         AZStd::scoped_lock lock(m_settingMutex);
@@ -306,6 +485,36 @@ namespace AZ
         return GetValueInternal(result, path);
     }
 
+    bool SettingsRegistryImpl::Get(bool& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(s64& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(u64& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(double& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(AZStd::string& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
+    bool SettingsRegistryImpl::Get(FixedValueString& result, const KeyHandle& key) const
+    {
+        return GetValueInternal(result, key);
+    }
+
     bool SettingsRegistryImpl::GetObject(void* result, Uuid resultTypeID, AZStd::string_view path) const
     {
         if (path.empty())
@@ -387,6 +596,7 @@ namespace AZ
             {
                 rapidjson::Value& setting = pointer.Create(m_settings, m_settings.GetAllocator());
                 setting = AZStd::move(store);
+                MarkSnapshotOutdated();
                 m_notifiers.Signal(path, Type::Object);
                 return true;
             }
@@ -410,6 +620,7 @@ namespace AZ
             return false;
         }
 
+        MarkSnapshotOutdated();
         return pointerPath.Erase(m_settings);
     }
 
@@ -530,6 +741,7 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
+        MarkSnapshotOutdated();
 
         JsonSerializationResult::ResultCode mergeResult =
             JsonSerialization::ApplyPatch(m_settings, m_settings.GetAllocator(), jsonPatch, mergeApproach);
@@ -540,6 +752,7 @@ namespace AZ
         }
 
         m_notifiers.Signal("", Type::Object);
+        PublishSnapshot();
 
         return true;
     }
@@ -562,36 +775,73 @@ namespace AZ
         }
 
         AZStd::scoped_lock lock(m_settingMutex);
+        MarkSnapshotOutdated();
 
-        bool result = false;
-        if (path[path.length()] == 0)
+        if (AZ::IO::MaxPathLength < path.length() + 1)
         {
-            result = MergeSettingsFileInternal(path.data(), format, rootKey, *scratchBuffer);
-        }
-        else
-        {
-            if (AZ::IO::MaxPathLength < path.length() + 1)
-            {
-                AZ_Error("Settings Registry", false,
-                    R"(Path "%.*s" is too long. Either make sure that the provided path is terminated or use a shorter path.)",
-                    static_cast<int>(path.length()), path.data());
-                Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
-                Value pathValue(path.data(), aznumeric_caster(path.length()), m_settings.GetAllocator());
-                pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
-                    .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
-                    .AddMember(StringRef("Path"), AZStd::move(pathValue), m_settings.GetAllocator());
-                return false;
-            }
-            AZ::IO::FixedMaxPathString filePath(path);
-            result = MergeSettingsFileInternal(filePath.c_str(), format, rootKey, *scratchBuffer);
+            AZ_Error("Settings Registry", false,
+                R"(Path "%.*s" is too long.)",
+                static_cast<int>(path.length()), path.data());
+            Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+            Value pathValue(path.data(), aznumeric_caster(path.length()), m_settings.GetAllocator());
+            pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+                .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
+                .AddMember(StringRef("Path"), AZStd::move(pathValue), m_settings.GetAllocator());
+            return false;
         }
 
+        PendingRegistryFile file;
+        file.m_path = path;
+        file.m_format = format;
+        LoadSettingsFile(file, *scratchBuffer);
+        bool result = MergeLoadedSettingsFile(file, rootKey);
+
         scratchBuffer->clear();
+        PublishSnapshot();
         return result;
     }
 
     bool SettingsRegistryImpl::MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
         AZStd::string_view platform, AZStd::string_view rootKey, AZStd::vector<char>* scratchBuffer)
+    {
+        return MergeSettingsFolders({ path }, specializations, platform, rootKey, scratchBuffer);
+    }
+
+    bool SettingsRegistryImpl::MergeSettingsFolders(const AZStd::vector<AZStd::string_view>& paths,
+        const Specializations& specializations, AZStd::string_view platform, AZStd::string_view rootKey,
+        AZStd::vector<char>* scratchBuffer)
+    {
+        AZStd::vector<char> buffer;
+        if (!scratchBuffer)
+        {
+            scratchBuffer = &buffer;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        MarkSnapshotOutdated();
+
+        // Find the files in all folders first, so they can be loaded and parsed in parallel. Afterwards they're merged
+        // in the same order as merging the folders one by one.
+        bool result = true;
+        PendingRegistryFileList files;
+        for (AZStd::string_view path : paths)
+        {
+            result = CollectSettingsFolder(files, path, specializations, platform) && result;
+        }
+
+        LoadSettingsFiles(files, *scratchBuffer);
+        for (PendingRegistryFile& file : files)
+        {
+            MergeLoadedSettingsFile(file, rootKey);
+        }
+
+        scratchBuffer->clear();
+        PublishSnapshot();
+        return result;
+    }
+
+    bool SettingsRegistryImpl::CollectSettingsFolder(PendingRegistryFileList& files, AZStd::string_view path,
+        const Specializations& specializations, AZStd::string_view platform)
     {
         using namespace AZ::IO;
         using namespace rapidjson;
@@ -602,13 +852,6 @@ namespace AZ
             return false;
         }
 
-
-        AZStd::vector<char> buffer;
-        if (!scratchBuffer)
-        {
-            scratchBuffer = &buffer;
-        }
-
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
         size_t additionalSpaceRequired = 3; // 3 is for the '/', '*' and 0
@@ -628,7 +871,6 @@ namespace AZ
         }
 
         RegistryFileList fileList;
-        scratchBuffer->clear();
 
         AZ::IO::FixedMaxPathString folderPath{ path };
         constexpr AZStd::string_view pathSeparators{ AZ_CORRECT_AND_WRONG_DATABASE_SEPARATOR };
@@ -647,9 +889,14 @@ namespace AZ
             AZStd::string_view name = specializations.GetSpecialization(i);
             specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
         }
-        pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+        Value& folderHistory = pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.size()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
+        if (!platform.empty())
+        {
+            folderHistory.AddMember(StringRef("Platform"), Value(platform.data(), aznumeric_caster(platform.length()), m_settings.GetAllocator()),
+                m_settings.GetAllocator());
+        }
 
         auto callback = [this, &fileList, &specializations, &pointer, &folderPath](const char* filename, bool isFile) -> bool
         {
@@ -676,8 +923,6 @@ namespace AZ
         };
         SystemFile::FindFiles(folderPath.c_str(), callback);
 
-
-        AZStd::scoped_lock lock(m_settingMutex);
         if (!platform.empty())
         {
             // Move the folderPath prefix back to the supplied path before the wildcard
@@ -734,7 +979,7 @@ namespace AZ
                 return false;
             }
 
-            // Load the registry files in the sorted order.
+            // Queue the registry files in the sorted order.
             for (RegistryFile& registryFile : fileList)
             {
                 folderPath.erase(platformKeyOffset); // Erase all characters after the platformKeyOffset
@@ -748,15 +993,9 @@ namespace AZ
 
                 folderPath += registryFile.m_relativePath;
 
-                if (!registryFile.m_isPatch)
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonMergePatch, rootKey, *scratchBuffer);
-                }
-                else
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonPatch, rootKey, *scratchBuffer);
-                }
-                scratchBuffer->clear();
+                PendingRegistryFile& file = files.emplace_back();
+                file.m_path = folderPath;
+                file.m_format = registryFile.m_isPatch ? Format::JsonPatch : Format::JsonMergePatch;
             }
         }
         return true;
@@ -1012,49 +1251,142 @@ namespace AZ
         }
     }
 
-    bool SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey,
-        AZStd::vector<char>& scratchBuffer)
+    void SettingsRegistryImpl::LoadSettingsFiles(PendingRegistryFileList& files, AZStd::vector<char>& scratchBuffer)
+    {
+        // Loading a handful of files doesn't make up for starting jobs. The files are loaded on the calling thread until
+        // the job manager is created, e.g. for the registries merged during application startup.
+        constexpr size_t FilesPerLoadJob = 4;
+        const size_t jobCount = (files.size() + FilesPerLoadJob - 1) / FilesPerLoadJob;
+        JobContext* jobContext = JobContext::GetGlobalContext();
+        if (jobCount <= 1 || !jobContext)
+        {
+            for (PendingRegistryFile& file : files)
+            {
+                LoadSettingsFile(file, scratchBuffer);
+            }
+            return;
+        }
+
+        // The calling thread holds the settings lock, so it must not wait on the job system: it could run a job on this thread
+        // that accesses the registry and deadlock. Instead, the calling thread and the jobs claim files through an atomic index,
+        // and the calling thread only waits for files that a running job has already claimed. Jobs that start after every file
+        // was claimed exit without touching the file list.
+        struct LoadState
+        {
+            PendingRegistryFile* m_files = nullptr;
+            size_t m_count = 0;
+            AZStd::atomic<size_t> m_nextIndex{ 0 };
+            AZStd::atomic<size_t> m_completedCount{ 0 };
+        };
+        auto state = AZStd::make_shared<LoadState>();
+        state->m_files = files.data();
+        state->m_count = files.size();
+
+        auto loadFiles = [state](AZStd::vector<char>& buffer)
+        {
+            for (size_t index = state->m_nextIndex++; index < state->m_count; index = state->m_nextIndex++)
+            {
+                LoadSettingsFile(state->m_files[index], buffer);
+                ++state->m_completedCount;
+            }
+        };
+
+        // The calling thread loads files as well, so one job less is enough
+        for (size_t job = 1; job < jobCount; ++job)
+        {
+            AZ::CreateJobFunction([loadFiles]()
+                {
+                    AZStd::vector<char> buffer;
+                    loadFiles(buffer);
+                }, true, jobContext)->Start();
+        }
+        loadFiles(scratchBuffer);
+
+        while (state->m_completedCount < state->m_count)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+
+    void SettingsRegistryImpl::LoadSettingsFile(PendingRegistryFile& file, AZStd::vector<char>& scratchBuffer)
     {
         using namespace AZ::IO;
+
+        // The document copies all strings, so it doesn't reference the file content after parsing.
+        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+
+        MappedFile mappedFile;
+        if (mappedFile.Open(file.m_path.c_str()))
+        {
+            if (mappedFile.GetSize() == 0)
+            {
+                file.m_loadResult = LoadResult::EmptyFile;
+                return;
+            }
+            file.m_document.Parse<flags>(mappedFile.GetData(), aznumeric_cast<size_t>(mappedFile.GetSize()));
+            file.m_loadResult = LoadResult::Loaded;
+            return;
+        }
+
+        // Fall back to reading the file, in case it's on a file system that can't be memory mapped.
+        SystemFile systemFile;
+        if (!systemFile.Open(file.m_path.c_str(), SystemFile::OpenMode::SF_OPEN_READ_ONLY))
+        {
+            file.m_loadResult = LoadResult::OpenFailed;
+            return;
+        }
+
+        u64 fileSize = systemFile.Length();
+        if (fileSize == 0)
+        {
+            file.m_loadResult = LoadResult::EmptyFile;
+            return;
+        }
+        scratchBuffer.clear();
+        scratchBuffer.resize_no_construct(fileSize);
+        if (systemFile.Read(fileSize, scratchBuffer.data()) != fileSize)
+        {
+            file.m_loadResult = LoadResult::ReadFailed;
+            return;
+        }
+        file.m_document.Parse<flags>(scratchBuffer.data(), aznumeric_cast<size_t>(fileSize));
+        file.m_loadResult = LoadResult::Loaded;
+    }
+
+    bool SettingsRegistryImpl::MergeLoadedSettingsFile(PendingRegistryFile& file, AZStd::string_view rootKey)
+    {
         using namespace rapidjson;
 
+        const char* path = file.m_path.c_str();
+        Format format = file.m_format;
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
-        SystemFile file;
-        if (!file.Open(path, SystemFile::OpenMode::SF_OPEN_READ_ONLY))
+        switch (file.m_loadResult)
         {
+        case LoadResult::OpenFailed:
             AZ_Error("Settings Registry", false, R"(Unable to open registry file "%s".)", path);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
-        }
-
-        u64 fileSize = file.Length();
-        if (fileSize == 0)
-        {
+        case LoadResult::EmptyFile:
             AZ_Warning("Settings Registry", false, R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", path);
             pointer.Create(m_settings, m_settings.GetAllocator())
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
-        }
-        scratchBuffer.clear();
-        scratchBuffer.resize_no_construct(fileSize + 1);
-        if (file.Read(fileSize, scratchBuffer.data()) != fileSize)
-        {
+        case LoadResult::ReadFailed:
             AZ_Error("Settings Registry", false, R"(Unable to read registry file "%s".)", path);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
+        default:
+            break;
         }
-        scratchBuffer[fileSize] = 0;
 
-        rapidjson::Document jsonPatch;
-        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
-        jsonPatch.ParseInsitu<flags>(scratchBuffer.data());
+        rapidjson::Document& jsonPatch = file.m_document;
         if (jsonPatch.HasParseError())
         {
             auto nativeUI = AZ::Interface<NativeUI::NativeUIRequests>::Get();
@@ -1153,6 +1485,467 @@ namespace AZ
         return true;
     }
 
+    namespace SettingsRegistryImplInternal
+    {
+        // The merge cache is only read by the machine that wrote it, so values are stored in native byte order.
+        //     u32 signature, u32 version
+        //     string cacheKey
+        //     u32 dependencyCount, dependencyCount x { u8 isFolder, string path, string platform, u64 stamp, u64 size, u64 contentHash }
+        //     value settings
+        // A string is stored as a u32 length followed by the characters. A value is a u8 MergeCacheValueType followed by
+        // the number, the string, or a u32 count followed by the elements or the name and value of the members.
+        constexpr u32 MergeCacheSignature = 0x43525341; // "ASRC"
+        constexpr u32 MergeCacheVersion = 2;
+        constexpr size_t MergeCacheMaxDepth = 512;
+
+        enum class MergeCacheValueType : u8
+        {
+            Null,
+            False,
+            True,
+            Int64,
+            Uint64,
+            Double,
+            String,
+            Array,
+            Object
+        };
+
+        //! A file or folder the merged settings were loaded from. For folders the stamp is a hash of the names of the files
+        //! in the folder, so adding or removing a file is detected as well. For files the content is hashed too, because
+        //! an edit that keeps the size can land within the resolution of the modification time.
+        struct MergeCacheDependency
+        {
+            AZ::IO::FixedMaxPathString m_path;
+            AZ::IO::FixedMaxPathString m_platform;
+            u64 m_stamp{};
+            u64 m_size{};
+            u64 m_contentHash{};
+            bool m_isFolder{};
+        };
+
+        void UpdateMergeCacheStamp(MergeCacheDependency& dependency)
+        {
+            if (!dependency.m_isFolder)
+            {
+                dependency.m_stamp = AZ::IO::SystemFile::ModificationTime(dependency.m_path.c_str());
+                dependency.m_size = AZ::IO::SystemFile::Length(dependency.m_path.c_str());
+                AZ::IO::MappedFile file;
+                if (file.Open(dependency.m_path.c_str()))
+                {
+                    dependency.m_contentHash = AZStd::hash<AZStd::string_view>{}(
+                        AZStd::string_view(file.GetData(), aznumeric_cast<size_t>(file.GetSize())));
+                }
+                return;
+            }
+
+            size_t hash = 0;
+            size_t fileCount = 0;
+            auto hashFiles = [&hash, &fileCount](const char* filename, bool isFile) -> bool
+            {
+                if (isFile)
+                {
+                    // Summed so the order the files are listed in doesn't matter
+                    hash += AZStd::hash<AZStd::string_view>{}(AZStd::string_view(filename));
+                    ++fileCount;
+                }
+                return true;
+            };
+            // The folder path recorded in the file history already ends with the wildcard.
+            AZ::IO::SystemFile::FindFiles(dependency.m_path.c_str(), hashFiles);
+            if (!dependency.m_platform.empty() && !dependency.m_path.empty())
+            {
+                AZ::IO::FixedMaxPathString platformFolder(dependency.m_path.c_str(), dependency.m_path.size() - 1);
+                platformFolder += SettingsRegistryInterface::PlatformFolder;
+                platformFolder.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                platformFolder += dependency.m_platform;
+                platformFolder.push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+                platformFolder.push_back('*');
+                AZ::IO::SystemFile::FindFiles(platformFolder.c_str(), hashFiles);
+            }
+            dependency.m_stamp = hash;
+            dependency.m_size = fileCount;
+        }
+
+        //! Collects the files and folders recorded in the file history, including files that failed to load.
+        void CollectMergeCacheDependencies(AZStd::vector<MergeCacheDependency>& dependencies, const rapidjson::Value& settings)
+        {
+            const rapidjson::Value* history = rapidjson::Pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY).Get(settings);
+            if (!history || !history->IsArray())
+            {
+                return;
+            }
+
+            for (const rapidjson::Value& entry : history->GetArray())
+            {
+                MergeCacheDependency dependency;
+                if (entry.IsString())
+                {
+                    dependency.m_path.assign(entry.GetString(), entry.GetStringLength());
+                }
+                else if (entry.IsObject())
+                {
+                    auto folder = entry.FindMember("Folder");
+                    auto path = entry.FindMember("Path");
+                    if (folder != entry.MemberEnd() && folder->value.IsString())
+                    {
+                        dependency.m_path.assign(folder->value.GetString(), folder->value.GetStringLength());
+                        dependency.m_isFolder = true;
+                        auto platform = entry.FindMember("Platform");
+                        if (platform != entry.MemberEnd() && platform->value.IsString())
+                        {
+                            dependency.m_platform.assign(platform->value.GetString(), platform->value.GetStringLength());
+                        }
+                    }
+                    else if (path != entry.MemberEnd() && path->value.IsString())
+                    {
+                        dependency.m_path.assign(path->value.GetString(), path->value.GetStringLength());
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    continue;
+                }
+                UpdateMergeCacheStamp(dependency);
+                dependencies.push_back(AZStd::move(dependency));
+            }
+        }
+
+        template<typename T>
+        void WriteMergeCacheData(AZStd::vector<char>& buffer, const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void WriteMergeCacheString(AZStd::vector<char>& buffer, AZStd::string_view value)
+        {
+            WriteMergeCacheData(buffer, aznumeric_cast<u32>(value.size()));
+            buffer.insert(buffer.end(), value.begin(), value.end());
+        }
+
+        void WriteMergeCacheValue(AZStd::vector<char>& buffer, const rapidjson::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::Null);
+                break;
+            case rapidjson::kFalseType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::False);
+                break;
+            case rapidjson::kTrueType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::True);
+                break;
+            case rapidjson::kNumberType:
+                if (value.IsInt64())
+                {
+                    WriteMergeCacheData(buffer, MergeCacheValueType::Int64);
+                    WriteMergeCacheData(buffer, value.GetInt64());
+                }
+                else if (value.IsUint64())
+                {
+                    WriteMergeCacheData(buffer, MergeCacheValueType::Uint64);
+                    WriteMergeCacheData(buffer, value.GetUint64());
+                }
+                else
+                {
+                    WriteMergeCacheData(buffer, MergeCacheValueType::Double);
+                    WriteMergeCacheData(buffer, value.GetDouble());
+                }
+                break;
+            case rapidjson::kStringType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::String);
+                WriteMergeCacheString(buffer, AZStd::string_view(value.GetString(), value.GetStringLength()));
+                break;
+            case rapidjson::kArrayType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::Array);
+                WriteMergeCacheData(buffer, aznumeric_cast<u32>(value.Size()));
+                for (const rapidjson::Value& element : value.GetArray())
+                {
+                    WriteMergeCacheValue(buffer, element);
+                }
+                break;
+            case rapidjson::kObjectType:
+                WriteMergeCacheData(buffer, MergeCacheValueType::Object);
+                WriteMergeCacheData(buffer, aznumeric_cast<u32>(value.MemberCount()));
+                for (auto& member : value.GetObject())
+                {
+                    WriteMergeCacheString(buffer, AZStd::string_view(member.name.GetString(), member.name.GetStringLength()));
+                    WriteMergeCacheValue(buffer, member.value);
+                }
+                break;
+            }
+        }
+
+        //! Reads from the mapped cache file, failing instead of reading past the end if the file is truncated or corrupt.
+        class MergeCacheReader
+        {
+        public:
+            MergeCacheReader(const char* data, size_t size)
+                : m_data(data)
+                , m_size(size)
+            {
+            }
+
+            template<typename T>
+            bool Read(T& value)
+            {
+                if (m_size - m_offset < sizeof(T))
+                {
+                    return false;
+                }
+                memcpy(&value, m_data + m_offset, sizeof(T));
+                m_offset += sizeof(T);
+                return true;
+            }
+
+            bool ReadString(AZStd::string_view& value)
+            {
+                u32 length;
+                if (!Read(length) || m_size - m_offset < length)
+                {
+                    return false;
+                }
+                value = AZStd::string_view(m_data + m_offset, length);
+                m_offset += length;
+                return true;
+            }
+
+            bool ReadValue(rapidjson::Value& value, rapidjson::Document::AllocatorType& allocator, size_t depth = 0)
+            {
+                MergeCacheValueType type;
+                if (depth > MergeCacheMaxDepth || !Read(type))
+                {
+                    return false;
+                }
+
+                switch (type)
+                {
+                case MergeCacheValueType::Null:
+                    value.SetNull();
+                    return true;
+                case MergeCacheValueType::False:
+                    value.SetBool(false);
+                    return true;
+                case MergeCacheValueType::True:
+                    value.SetBool(true);
+                    return true;
+                case MergeCacheValueType::Int64:
+                {
+                    int64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetInt64(number);
+                    return true;
+                }
+                case MergeCacheValueType::Uint64:
+                {
+                    uint64_t number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetUint64(number);
+                    return true;
+                }
+                case MergeCacheValueType::Double:
+                {
+                    double number;
+                    if (!Read(number))
+                    {
+                        return false;
+                    }
+                    value.SetDouble(number);
+                    return true;
+                }
+                case MergeCacheValueType::String:
+                {
+                    AZStd::string_view string;
+                    if (!ReadString(string))
+                    {
+                        return false;
+                    }
+                    value.SetString(string.data(), aznumeric_cast<rapidjson::SizeType>(string.size()), allocator);
+                    return true;
+                }
+                case MergeCacheValueType::Array:
+                {
+                    u32 count;
+                    if (!Read(count))
+                    {
+                        return false;
+                    }
+                    value.SetArray();
+                    value.Reserve(AZStd::min<u32>(count, aznumeric_cast<u32>(m_size - m_offset)), allocator);
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        rapidjson::Value element;
+                        if (!ReadValue(element, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.PushBack(AZStd::move(element), allocator);
+                    }
+                    return true;
+                }
+                case MergeCacheValueType::Object:
+                {
+                    u32 count;
+                    if (!Read(count))
+                    {
+                        return false;
+                    }
+                    value.SetObject();
+                    for (u32 i = 0; i < count; ++i)
+                    {
+                        AZStd::string_view name;
+                        rapidjson::Value member;
+                        if (!ReadString(name) || !ReadValue(member, allocator, depth + 1))
+                        {
+                            return false;
+                        }
+                        value.AddMember(rapidjson::Value(name.data(), aznumeric_cast<rapidjson::SizeType>(name.size()), allocator),
+                            AZStd::move(member), allocator);
+                    }
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_offset == m_size;
+            }
+
+        private:
+            const char* m_data;
+            size_t m_size;
+            size_t m_offset{ 0 };
+        };
+    } // namespace SettingsRegistryImplInternal
+
+    bool SettingsRegistryImpl::WriteMergeCache(const char* cachePath, AZStd::string_view cacheKey) const
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        AZStd::vector<char> buffer;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+
+            AZStd::vector<MergeCacheDependency> dependencies;
+            CollectMergeCacheDependencies(dependencies, m_settings);
+
+            WriteMergeCacheData(buffer, MergeCacheSignature);
+            WriteMergeCacheData(buffer, MergeCacheVersion);
+            WriteMergeCacheString(buffer, cacheKey);
+            WriteMergeCacheData(buffer, aznumeric_cast<u32>(dependencies.size()));
+            for (const MergeCacheDependency& dependency : dependencies)
+            {
+                WriteMergeCacheData(buffer, static_cast<u8>(dependency.m_isFolder ? 1 : 0));
+                WriteMergeCacheString(buffer, dependency.m_path);
+                WriteMergeCacheString(buffer, dependency.m_platform);
+                WriteMergeCacheData(buffer, dependency.m_stamp);
+                WriteMergeCacheData(buffer, dependency.m_size);
+                WriteMergeCacheData(buffer, dependency.m_contentHash);
+            }
+            WriteMergeCacheValue(buffer, m_settings);
+        }
+
+        // Write to a temporary file first, so another process reading the cache never sees a partially written file.
+        AZ::IO::FixedMaxPathString tempPath(cachePath);
+        tempPath += ".tmp";
+        AZ::IO::SystemFile file;
+        constexpr int openMode = AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH |
+            AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY;
+        if (!file.Open(tempPath.c_str(), openMode))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to create settings registry merge cache "%s".)", tempPath.c_str());
+            return false;
+        }
+        const bool isWritten = file.Write(buffer.data(), buffer.size()) == buffer.size();
+        file.Close();
+        if (!isWritten || !AZ::IO::SystemFile::Rename(tempPath.c_str(), cachePath, true))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write settings registry merge cache "%s".)", cachePath);
+            AZ::IO::SystemFile::Delete(tempPath.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    bool SettingsRegistryImpl::ReadMergeCache(const char* cachePath, AZStd::string_view cacheKey)
+    {
+        using namespace SettingsRegistryImplInternal;
+
+        AZ::IO::MappedFile file;
+        if (!file.Open(cachePath))
+        {
+            return false;
+        }
+        MergeCacheReader reader(file.GetData(), aznumeric_cast<size_t>(file.GetSize()));
+
+        u32 signature;
+        u32 version;
+        AZStd::string_view storedKey;
+        u32 dependencyCount;
+        if (!reader.Read(signature) || signature != MergeCacheSignature ||
+            !reader.Read(version) || version != MergeCacheVersion ||
+            !reader.ReadString(storedKey) || storedKey != cacheKey ||
+            !reader.Read(dependencyCount))
+        {
+            return false;
+        }
+
+        // Any change to the files and folders the settings were merged from invalidates the cache.
+        for (u32 i = 0; i < dependencyCount; ++i)
+        {
+            MergeCacheDependency dependency;
+            u8 isFolder;
+            AZStd::string_view path;
+            AZStd::string_view platform;
+            u64 stamp;
+            u64 size;
+            u64 contentHash;
+            if (!reader.Read(isFolder) || !reader.ReadString(path) || !reader.ReadString(platform) ||
+                !reader.Read(stamp) || !reader.Read(size) || !reader.Read(contentHash) ||
+                path.size() > AZ::IO::MaxPathLength || platform.size() > AZ::IO::MaxPathLength)
+            {
+                return false;
+            }
+            dependency.m_isFolder = isFolder != 0;
+            dependency.m_path = path;
+            dependency.m_platform = platform;
+            UpdateMergeCacheStamp(dependency);
+            if (dependency.m_stamp != stamp || dependency.m_size != size || dependency.m_contentHash != contentHash)
+            {
+                return false;
+            }
+        }
+
+        rapidjson::Document settings;
+        if (!reader.ReadValue(settings, settings.GetAllocator()) || !reader.IsAtEnd() || !settings.IsObject())
+        {
+            AZ_Warning("Settings Registry", false, R"(Settings registry merge cache "%s" is corrupt.)", cachePath);
+            return false;
+        }
+
+        AZStd::scoped_lock lock(m_settingMutex);
+        MarkSnapshotOutdated();
+        m_settings.Swap(settings);
+        m_notifiers.Signal("", Type::Object);
+        PublishSnapshot();
+        return true;
+    }
+
     void SettingsRegistryImpl::SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings)
     {
         m_applyPatchSettings = applyPatchSettings;
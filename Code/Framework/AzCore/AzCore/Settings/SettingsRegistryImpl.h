@@ -15,7 +15,10 @@
 #include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
+#include <AzCore/std/smart_ptr/intrusive_ptr.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -32,11 +35,46 @@ namespace AZ
         AZ_RTTI(AZ::SettingsRegistryImpl, "{E9C34190-F888-48CA-83C9-9F24B4E21D72}", AZ::SettingsRegistryInterface);
 
         static constexpr size_t MaxRegistryFolderEntries = 128;
+
+        //! An immutable copy of the settings. Snapshots are shared between readers, and a snapshot stays valid for
+        //! as long as a reference to it is held, even if the settings are changed in the meantime.
+        class Snapshot final
+            : public AZStd::intrusive_base
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Snapshot, AZ::OSAllocator, 0);
+
+            Snapshot(const rapidjson::Value& settings, u64 version);
+
+            //! The version of the settings this snapshot was taken from, a later snapshot has a higher version.
+            u64 GetVersion() const;
+            const rapidjson::Value& GetSettings() const;
+            //! Returns the value for the key, or nullptr if there's no value or the key is invalid.
+            const rapidjson::Value* Find(const KeyHandle& key) const;
+
+        private:
+            rapidjson::Document m_settings;
+            u64 m_version;
+        };
+        using SnapshotPtr = AZStd::intrusive_ptr<const Snapshot>;
         
         SettingsRegistryImpl();
         AZ_DISABLE_COPY_MOVE(SettingsRegistryImpl);
         ~SettingsRegistryImpl() override = default;
 
+        //! Returns a snapshot of the current settings. If the settings changed since the last snapshot was taken a new
+        //! one is made, otherwise the latest snapshot is returned without locking.
+        SnapshotPtr GetSnapshot() const;
+
+        //! Stores the settings in a binary cache file, together with the modification times of the files and the content of
+        //! the folders that were merged, as recorded in the file history. The cacheKey identifies what the settings were
+        //! merged from, besides the files, such as the specializations and the settings before merging.
+        bool WriteMergeCache(const char* cachePath, AZStd::string_view cacheKey) const;
+        //! Replaces the settings with the settings from a cache file written by WriteMergeCache, which skips loading and
+        //! parsing the registry files. Fails without changing the settings if the cache was written with a different key,
+        //! or if any of the merged files or folders changed since.
+        bool ReadMergeCache(const char* cachePath, AZStd::string_view cacheKey);
+
         void SetContext(SerializeContext* context);
         void SetContext(JsonRegistrationContext* context);
         
@@ -47,6 +85,14 @@ namespace AZ
         [[nodiscard]] NotifyEventHandler RegisterNotifier(NotifyCallback&& callback) override;
         void ClearNotifiers();
 
+        Type GetType(const KeyHandle& key) const override;
+        bool Get(bool& result, const KeyHandle& key) const override;
+        bool Get(s64& result, const KeyHandle& key) const override;
+        bool Get(u64& result, const KeyHandle& key) const override;
+        bool Get(double& result, const KeyHandle& key) const override;
+        bool Get(AZStd::string& result, const KeyHandle& key) const override;
+        bool Get(SettingsRegistryInterface::FixedValueString& result, const KeyHandle& key) const override;
+
         bool Get(bool& result, AZStd::string_view path) const override;
         bool Get(s64& result, AZStd::string_view path) const override;
         bool Get(u64& result, AZStd::string_view path) const override;
@@ -72,6 +118,8 @@ namespace AZ
             AZStd::vector<char>* scratchBuffer = nullptr) override;
         bool MergeSettingsFolder(AZStd::string_view path, const Specializations& specializations,
             AZStd::string_view platform, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
+        bool MergeSettingsFolders(const AZStd::vector<AZStd::string_view>& paths, const Specializations& specializations,
+            AZStd::string_view platform = {}, AZStd::string_view rootKey = "", AZStd::vector<char>* scratchBuffer = nullptr) override;
 
         void SetApplyPatchSettings(const AZ::JsonApplyPatchSettings& applyPatchSettings) override;
         void GetApplyPatchSettings(AZ::JsonApplyPatchSettings& applyPatchSettings) override;
@@ -87,10 +135,30 @@ namespace AZ
         };
         using RegistryFileList = AZStd::fixed_vector<RegistryFile, MaxRegistryFolderEntries>;
 
+        enum class LoadResult
+        {
+            Loaded,
+            OpenFailed,
+            EmptyFile,
+            ReadFailed
+        };
+        //! A registry file that's queued for merging. The file is loaded and parsed before any of the queued files are
+        //! merged, so loading can be done on multiple threads.
+        struct PendingRegistryFile
+        {
+            AZ::IO::FixedMaxPathString m_path;
+            Format m_format{ Format::JsonMergePatch };
+            LoadResult m_loadResult{ LoadResult::OpenFailed };
+            rapidjson::Document m_document; //!< Holds the parse error if the file isn't valid json
+        };
+        using PendingRegistryFileList = AZStd::vector<PendingRegistryFile>;
+
         template<typename T>
         bool SetValueInternal(AZStd::string_view path, T value, SettingsRegistryInterface::Type type);
         template<typename T>
         bool GetValueInternal(T& result, AZStd::string_view path) const;
+        template<typename T>
+        bool GetValueInternal(T& result, const KeyHandle& key) const;
         VisitResponse Visit(Visitor& visitor, StackedString& path, AZStd::string_view valueName,
             const rapidjson::Value& value) const;
 
@@ -98,13 +166,38 @@ namespace AZ
         bool IsLessThan(bool& collisionFound, const RegistryFile& lhs, const RegistryFile& rhs, const Specializations& specializations,
             const rapidjson::Pointer& historyPointer, AZStd::string_view folderPath);
         bool ExtractFileDescription(RegistryFile& output, const char* filename, const Specializations& specializations);
-        bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
-        
+        //! Adds the files in the folder to the list of files to merge in the order they need to be merged.
+        bool CollectSettingsFolder(PendingRegistryFileList& files, AZStd::string_view path, const Specializations& specializations,
+            AZStd::string_view platform);
+        //! Loads and parses the files, using multiple threads if there are enough files. This doesn't access the settings.
+        static void LoadSettingsFiles(PendingRegistryFileList& files, AZStd::vector<char>& scratchBuffer);
+        static void LoadSettingsFile(PendingRegistryFile& file, AZStd::vector<char>& scratchBuffer);
+        //! Merges a loaded file into the settings, or records why it couldn't be merged in the file history.
+        bool MergeLoadedSettingsFile(PendingRegistryFile& file, AZStd::string_view rootKey);
+
+        //! Takes a reference to the latest snapshot without locking.
+        SnapshotPtr AcquireSnapshot() const;
+        //! Replaces the latest snapshot with a copy of the current settings. m_settingMutex must be locked.
+        void UpdateSnapshot() const;
+        //! Updates the snapshot if the settings changed since it was taken.
+        void PublishSnapshot() const;
+        void MarkSnapshotOutdated();
+
         mutable AZStd::recursive_mutex m_settingMutex;
         NotifyEvent m_notifiers;
         rapidjson::Document m_settings;
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
+
+        // The registry's reference to the latest snapshot, only accessed while m_settingMutex is locked. Readers load
+        // m_latestSnapshot instead, and announce themselves in m_snapshotReaders for the epoch they started in, so
+        // UpdateSnapshot can wait until no reader can still be taking a reference to the previous snapshot.
+        mutable SnapshotPtr m_snapshot;
+        mutable AZStd::atomic<const Snapshot*> m_latestSnapshot{ nullptr };
+        mutable AZStd::atomic<u32> m_snapshotEpoch{ 0 };
+        mutable AZStd::atomic<u32> m_snapshotReaders[2] = { {0}, {0} };
+        mutable AZStd::atomic_bool m_isSnapshotOutdated{ true };
+        mutable u64 m_snapshotVersion{ 0 };
     };
 } // namespace AZ
@@ -5,6 +5,7 @@
  *
  */
 
+#include <AzCore/IO/ByteContainerStream.h>
 #include <AzCore/IO/GenericStreams.h>
 #include <AzCore/IO/Path/Path.h>
 #include <AzCore/IO/TextStreamWriters.h>
@@ -391,6 +392,36 @@ namespace AZ::SettingsRegistryMergeUtils
         registry.Visit(visitor, SpecializationsRootKey);
     }
 
+    bool GetMergeCacheSettings(AZ::IO::FixedMaxPath& cachePath, AZStd::string& cacheKey, SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform)
+    {
+        bool isEnabled = false;
+        if (!registry.Get(isEnabled, MergeCacheEnabledKey) || !isEnabled || !registry.Get(cachePath.Native(), FilePathKey_ProjectUserPath))
+        {
+            return false;
+        }
+
+        cacheKey = platform;
+        cacheKey.push_back('\n');
+        const size_t specializationCount = specializations.GetCount();
+        for (size_t i = 0; i < specializationCount; ++i)
+        {
+            cacheKey += specializations.GetSpecialization(i);
+            cacheKey.push_back('\n');
+        }
+        // Applications with different specializations get their own cache, so they don't invalidate each other's cache
+        const size_t cacheNameHash = AZStd::hash<AZStd::string>{}(cacheKey);
+
+        AZStd::string settings;
+        AZ::IO::ByteContainerStream<AZStd::string> settingsStream(&settings);
+        DumpSettingsRegistryToStream(registry, "", settingsStream, DumperSettings{});
+        cacheKey += settings;
+
+        cachePath /= "SettingsRegistryCache";
+        cachePath /= AZ::IO::FixedMaxPathString::format("%zx.setregcache", cacheNameHash);
+        return true;
+    }
+
     void MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(SettingsRegistryInterface& registry, AZStd::string_view targetName)
     {
         registry.Set(BuildTargetNameKey, targetName);
@@ -721,23 +752,16 @@ namespace AZ::SettingsRegistryMergeUtils
         if (registry.GetType(gemListPath) == SettingsRegistryInterface::Type::Object &&
             registry.Get(engineRootPath, FilePathKey_EngineRootFolder))
         {
+            // Collect the registry folders of all gems first, so the files of all gems can be loaded in parallel
             struct Visitor
                 : public SettingsRegistryInterface::Visitor
             {
                 AZ::IO::FixedMaxPath m_gemPath;
-                SettingsRegistryInterface& m_registry;
-                const AZStd::string_view m_platform;
-                const SettingsRegistryInterface::Specializations& m_specializations;
-                AZStd::vector<char>* m_scratchBuffer{};
+                AZStd::vector<AZ::IO::FixedMaxPath> m_registryFolders;
                 bool processingSourcePathKey{};
 
-                Visitor(AZ::SettingsRegistryInterface::FixedValueString rootFolder, SettingsRegistryInterface& registry, const AZStd::string_view platform,
-                    const SettingsRegistryInterface::Specializations& specializations, AZStd::vector<char>* scratchBuffer)
+                explicit Visitor(AZ::SettingsRegistryInterface::FixedValueString rootFolder)
                     : m_gemPath(AZStd::move(rootFolder))
-                    , m_registry(registry)
-                    , m_platform(platform)
-                    , m_specializations(specializations)
-                    , m_scratchBuffer(scratchBuffer)
                 {
                 }
 
@@ -748,7 +772,7 @@ namespace AZ::SettingsRegistryMergeUtils
                     {
                         if (action == SettingsRegistryInterface::VisitAction::Begin)
                         {
-                            // Allows merging of the registry folders within the gem source path array
+                            // Allows collecting the registry folders within the gem source path array
                             // via the Visit function
                             processingSourcePathKey = true;
                         }
@@ -766,14 +790,21 @@ namespace AZ::SettingsRegistryMergeUtils
                 {
                     if (processingSourcePathKey)
                     {
-                        m_registry.MergeSettingsFolder((m_gemPath / value / SettingsRegistryInterface::RegistryFolder).Native(),
-                            m_specializations, m_platform, "", m_scratchBuffer);
+                        m_registryFolders.push_back(m_gemPath / value / SettingsRegistryInterface::RegistryFolder);
                     }
                 }
             };
 
-            Visitor visitor(AZStd::move(engineRootPath), registry, platform, specializations, scratchBuffer);
+            Visitor visitor(AZStd::move(engineRootPath));
             registry.Visit(visitor, gemListPath);
+
+            AZStd::vector<AZStd::string_view> registryFolders;
+            registryFolders.reserve(visitor.m_registryFolders.size());
+            for (const AZ::IO::FixedMaxPath& registryFolder : visitor.m_registryFolders)
+            {
+                registryFolders.push_back(registryFolder.Native());
+            }
+            registry.MergeSettingsFolders(registryFolders, specializations, platform, "", scratchBuffer);
         }
     }
 
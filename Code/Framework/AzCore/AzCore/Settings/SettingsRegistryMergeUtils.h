@@ -22,6 +22,9 @@ namespace AZ::SettingsRegistryMergeUtils
     inline static constexpr char OrganizationRootKey[] = "/Amazon";
     inline static constexpr char BuildTargetNameKey[] = "/Amazon/AzCore/Settings/BuildTargetName";
     inline static constexpr char SpecializationsRootKey[] = "/Amazon/AzCore/Settings/Specializations";
+    //! When true, the settings merged at application startup are stored in a binary cache in the project's user folder,
+    //! and the next launch reuses them instead of loading the registry files again if none of the files changed.
+    inline static constexpr char MergeCacheEnabledKey[] = "/Amazon/AzCore/Settings/MergeCache/Enabled";
     inline static constexpr char BootstrapSettingsRootKey[] = "/Amazon/AzCore/Bootstrap";
     inline static constexpr char GemListRootKey[] = "/Amazon/AzCore/Gems";
     inline static constexpr char FilePathsRootKey[] = "/Amazon/AzCore/Runtime/FilePaths";
@@ -99,6 +102,13 @@ namespace AZ::SettingsRegistryMergeUtils
     //! The SpecializationsRootKey is visited to retrieve any specializations stored within that section of that registry
     void QuerySpecializationsFromRegistry(SettingsRegistryInterface& registry, SettingsRegistryInterface::Specializations& specializations);
 
+    //! Determines where the startup merge cache is stored and the key that identifies what the cached settings were merged from.
+    //! The key consists of the platform, the specializations and the current content of the registry, so it has to be
+    //! queried before the registry files are merged.
+    //! Returns false if the cache isn't enabled with MergeCacheEnabledKey or there's no project user folder to store it in.
+    bool GetMergeCacheSettings(AZ::IO::FixedMaxPath& cachePath, AZStd::string& cacheKey, SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, AZStd::string_view platform);
+
     //! Adds name of current build system target to the Settings Registry specialization section
     //! A build system target is the name used by the build system to build a particular executable or library
     void MergeSettingsToRegistry_AddBuildSystemTargetSpecialization(SettingsRegistryInterface& registry, AZStd::string_view targetName);
@@ -1369,10 +1369,11 @@ namespace AZ
 
         SerializeContext* serializeContext = m_asset.Get()->GetComponent()->GetSerializeContext();
 
-        // Compute the delta/changes for each instance
+        // Compute the delta/changes for each instance, all instances are compared against the same source tree
+        DataPatch::SourceCache sourceCache;
         for (SliceInstance& instance : m_instances)
         {
-            ComputeDataPatchForInstanceKnownToReference(instance, serializeContext, source);
+            ComputeDataPatchForInstanceKnownToReference(instance, serializeContext, source, sourceCache);
         }
     }
 
@@ -1386,10 +1387,12 @@ namespace AZ
         InstantiatedContainer source(m_asset.Get()->GetComponent(), false);
 
         SerializeContext* serializeContext = m_asset.Get()->GetComponent()->GetSerializeContext();
-        ComputeDataPatchForInstanceKnownToReference(*instance, serializeContext, source);
+        DataPatch::SourceCache sourceCache;
+        ComputeDataPatchForInstanceKnownToReference(*instance, serializeContext, source, sourceCache);
     }
 
-    void SliceComponent::SliceReference::ComputeDataPatchForInstanceKnownToReference(SliceInstance& instance, SerializeContext* serializeContext, InstantiatedContainer& sourceContainer)
+    void SliceComponent::SliceReference::ComputeDataPatchForInstanceKnownToReference(SliceInstance& instance, SerializeContext* serializeContext, InstantiatedContainer& sourceContainer,
+        DataPatch::SourceCache& sourceCache)
     {            
         // remap entity ids to the "original"
         const EntityIdToEntityIdMap& reverseLookUp = instance.GetEntityIdToBaseMap();
@@ -1411,7 +1414,7 @@ namespace AZ
         DataPatch::FlagsMap targetDataFlags = instance.GetDataFlags().GetDataFlagsForPatching(&instance.GetEntityIdToBaseMap());
 
         // compute the delta (what we changed from the base slice)
-        instance.m_dataPatch.Create(&sourceContainer, instance.m_instantiated, sourceDataFlags, targetDataFlags, serializeContext);
+        instance.m_dataPatch.Create(sourceCache, &sourceContainer, instance.m_instantiated, sourceDataFlags, targetDataFlags, serializeContext);
 
         // remap entity ids back to the "instance onces"
         IdUtils::Remapper<EntityId>::ReplaceIdsAndIdRefs(instance.m_instantiated, [&instance](const EntityId& sourceId, bool /*isEntityId*/, const AZStd::function<EntityId()>& /*idGenerator*/) -> EntityId
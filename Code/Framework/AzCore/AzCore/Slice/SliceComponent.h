@@ -508,7 +508,9 @@ namespace AZ
 
             /// Internal only function that computes the data patch for the given instance.
             /// This assumes that the instance has already been verified to be related to this slice.
-            void ComputeDataPatchForInstanceKnownToReference(SliceInstance& instance, SerializeContext* serializeContext, InstantiatedContainer& sourceContainer);
+            /// The data tree of the source container is kept in sourceCache, so it's only built once for all instances.
+            void ComputeDataPatchForInstanceKnownToReference(SliceInstance& instance, SerializeContext* serializeContext, InstantiatedContainer& sourceContainer,
+                DataPatch::SourceCache& sourceCache);
 
             /// Creates a new Id'd instance slot internally, but does not instantiate it.
             SliceInstance* CreateEmptyInstance(const SliceInstanceId& instanceId = SliceInstanceId::CreateRandom());
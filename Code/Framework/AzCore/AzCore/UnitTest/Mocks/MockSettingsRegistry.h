@@ -19,6 +19,10 @@ namespace AZ
         : public AZ::SettingsRegistryInterface
     {
     public:
+        // The KeyHandle overloads aren't mocked, they forward to the mocked path overloads
+        using SettingsRegistryInterface::Get;
+        using SettingsRegistryInterface::GetType;
+
         MOCK_CONST_METHOD1(GetType, Type(AZStd::string_view));
         MOCK_CONST_METHOD2(Visit, bool(Visitor&, AZStd::string_view));
         MOCK_CONST_METHOD2(Visit, bool(const VisitorCallback&, AZStd::string_view));
@@ -174,6 +174,7 @@ set(FILES
     IO/IStreamerTypes.cpp
     IO/GenericStreams.cpp
     IO/GenericStreams.h
+    IO/MappedFile.h
     IO/Path/Path.cpp
     IO/Path/Path.h
     IO/Path/Path.inl
@@ -215,6 +216,7 @@ set(FILES
     IPC/SharedMemory.cpp
     IPC/SharedMemory.h
     Jobs/Algorithms.h
+    Jobs/Internal/JobFiber.h
     Jobs/Internal/JobManagerBase.cpp
     Jobs/Internal/JobManagerBase.h
     Jobs/Internal/JobManagerWorkStealing.cpp
@@ -372,11 +374,15 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
     Memory/IAllocator.cpp
     Memory/IAllocator.h
+    Memory/LinearAllocator.cpp
+    Memory/LinearAllocator.h
     Memory/MallocSchema.cpp
     Memory/MallocSchema.h
     Memory/Memory.cpp
@@ -417,6 +423,7 @@ set(FILES
     Name/Name.cpp
     Name/NameDictionary.h
     Name/NameDictionary.cpp
+    Name/NameLiteral.h
     Name/NameJsonSerializer.h
     Name/NameJsonSerializer.cpp
     Name/NameSerializer.h
@@ -523,6 +530,10 @@ set(FILES
     Serialization/Json/JsonSerializationSettings.h
     Serialization/Json/JsonSerializer.h
     Serialization/Json/JsonSerializer.cpp
+    Serialization/Json/JsonStreamDeserializer.h
+    Serialization/Json/JsonStreamDeserializer.cpp
+    Serialization/Json/JsonStreamSerializer.h
+    Serialization/Json/JsonStreamSerializer.cpp
     Serialization/Json/JsonStringConversionUtils.h
     Serialization/Json/JsonSystemComponent.h
     Serialization/Json/JsonSystemComponent.cpp
@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace JobFiber
+        {
+            bool IsSupported()
+            {
+                return false;
+            }
+
+            Context* ConvertCurrentThread()
+            {
+                return nullptr;
+            }
+
+            void RevertCurrentThread(Context*)
+            {
+            }
+
+            Context* Create(size_t, EntryFunction, void*)
+            {
+                return nullptr;
+            }
+
+            void Destroy(Context*)
+            {
+            }
+
+            void Switch(Context*, Context*)
+            {
+                AZ_Assert(false, "Job fibers are not supported on this platform");
+            }
+        }
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* path)
+    {
+        Close();
+
+        int fileDescriptor = open(path, O_RDONLY);
+        if (fileDescriptor == -1)
+        {
+            return false;
+        }
+
+        struct stat statResult;
+        if (fstat(fileDescriptor, &statResult) != 0 || !S_ISREG(statResult.st_mode))
+        {
+            close(fileDescriptor);
+            return false;
+        }
+
+        if (statResult.st_size > 0)
+        {
+            // The mapping holds its own reference to the file, so the descriptor can be closed right away
+            void* data = mmap(nullptr, static_cast<size_t>(statResult.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+            close(fileDescriptor);
+            if (data == MAP_FAILED)
+            {
+                return false;
+            }
+            m_data = static_cast<const char*>(data);
+            m_size = static_cast<AZ::u64>(statResult.st_size);
+        }
+        else
+        {
+            close(fileDescriptor);
+        }
+
+        m_isOpen = true;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            munmap(const_cast<char*>(m_data), static_cast<size_t>(m_size));
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_isOpen = false;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/OSAllocator.h>
+
+#include <sys/mman.h>
+#include <ucontext.h>
+#include <unistd.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace JobFiber
+        {
+            struct Context
+            {
+                ucontext_t m_context;
+                void* m_stack = nullptr; ///< Includes the guard page, nullptr for a converted thread
+                size_t m_stackSize = 0;
+                EntryFunction m_entryFunction = nullptr;
+                void* m_userData = nullptr;
+            };
+
+            // makecontext only passes int arguments, so the context pointer is split in two
+            static void FiberMain(unsigned int contextHigh, unsigned int contextLow)
+            {
+                Context* context = reinterpret_cast<Context*>((static_cast<uintptr_t>(contextHigh) << 32) | static_cast<uintptr_t>(contextLow));
+                context->m_entryFunction(context->m_userData);
+                AZ_Assert(false, "Job fiber entry functions must not return");
+            }
+
+            bool IsSupported()
+            {
+                return true;
+            }
+
+            Context* ConvertCurrentThread()
+            {
+                // The thread's context is saved on the first switch away from it, so there is nothing else to do
+                return azcreate(Context, (), AZ::OSAllocator, "JobFiber");
+            }
+
+            void RevertCurrentThread(Context* threadContext)
+            {
+                AZ_Assert(threadContext && !threadContext->m_stack, "Context was not returned by ConvertCurrentThread");
+                azdestroy(threadContext, AZ::OSAllocator);
+            }
+
+            Context* Create(size_t stackSize, EntryFunction entryFunction, void* userData)
+            {
+                // Round the stack up to whole pages, and add a guard page so a stack overflow faults instead of corrupting memory
+                const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+                const size_t mappedSize = ((stackSize + pageSize - 1) / pageSize + 1) * pageSize;
+                void* stack = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (stack == MAP_FAILED)
+                {
+                    AZ_Error("JobFiber", false, "Failed to allocate a %zu byte job fiber stack", mappedSize);
+                    return nullptr;
+                }
+                mprotect(stack, pageSize, PROT_NONE);
+
+                Context* context = azcreate(Context, (), AZ::OSAllocator, "JobFiber");
+                context->m_stack = stack;
+                context->m_stackSize = mappedSize;
+                context->m_entryFunction = entryFunction;
+                context->m_userData = userData;
+
+                getcontext(&context->m_context);
+                context->m_context.uc_stack.ss_sp = static_cast<char*>(stack) + pageSize;
+                context->m_context.uc_stack.ss_size = mappedSize - pageSize;
+                context->m_context.uc_link = nullptr;
+                const uintptr_t contextAddress = reinterpret_cast<uintptr_t>(context);
+                makecontext(&context->m_context, reinterpret_cast<void(*)()>(&FiberMain), 2,
+                    static_cast<unsigned int>(contextAddress >> 32), static_cast<unsigned int>(contextAddress & 0xffffffff));
+
+                return context;
+            }
+
+            void Destroy(Context* context)
+            {
+                AZ_Assert(context && context->m_stack, "Context was not returned by Create");
+                munmap(context->m_stack, context->m_stackSize);
+                azdestroy(context, AZ::OSAllocator);
+            }
+
+            void Switch(Context* from, Context* to)
+            {
+                swapcontext(&from->m_context, &to->m_context);
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/MappedFile.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ::IO
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    bool MappedFile::Open(const char* path)
+    {
+        Close();
+
+        wchar_t pathW[AZ_MAX_PATH_LEN];
+        size_t numCharsConverted;
+        if (mbstowcs_s(&numCharsConverted, pathW, path, AZ_ARRAY_SIZE(pathW) - 1) != 0)
+        {
+            return false;
+        }
+        HANDLE file = CreateFileW(pathW, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize))
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        if (fileSize.QuadPart > 0)
+        {
+            // The view holds its own references to the mapping and the file, so both handles can be closed right away
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if (!mapping)
+            {
+                return false;
+            }
+            const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (!data)
+            {
+                return false;
+            }
+            m_data = static_cast<const char*>(data);
+            m_size = static_cast<AZ::u64>(fileSize.QuadPart);
+        }
+        else
+        {
+            CloseHandle(file);
+        }
+
+        m_isOpen = true;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data)
+        {
+            UnmapViewOfFile(m_data);
+        }
+        m_data = nullptr;
+        m_size = 0;
+        m_isOpen = false;
+    }
+} // namespace AZ::IO
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Jobs/Internal/JobFiber.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/PlatformIncl.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        namespace JobFiber
+        {
+            struct Context
+            {
+                LPVOID m_fiber = nullptr;
+                EntryFunction m_entryFunction = nullptr;
+                void* m_userData = nullptr;
+                bool m_isConvertedThread = false; ///< True if ConvertThreadToFiber was called, and must be reverted
+            };
+
+            static VOID CALLBACK FiberMain(LPVOID parameter)
+            {
+                Context* context = static_cast<Context*>(parameter);
+                context->m_entryFunction(context->m_userData);
+                AZ_Assert(false, "Job fiber entry functions must not return");
+            }
+
+            bool IsSupported()
+            {
+                return true;
+            }
+
+            Context* ConvertCurrentThread()
+            {
+                Context* context = azcreate(Context, (), AZ::OSAllocator, "JobFiber");
+                if (IsThreadAFiber())
+                {
+                    context->m_fiber = GetCurrentFiber();
+                }
+                else
+                {
+                    context->m_fiber = ConvertThreadToFiberEx(nullptr, FIBER_FLAG_FLOAT_SWITCH);
+                    context->m_isConvertedThread = true;
+                }
+
+                if (!context->m_fiber)
+                {
+                    AZ_Error("JobFiber", false, "Failed to convert the thread to a fiber, error %u", GetLastError());
+                    azdestroy(context, AZ::OSAllocator);
+                    return nullptr;
+                }
+                return context;
+            }
+
+            void RevertCurrentThread(Context* threadContext)
+            {
+                if (threadContext->m_isConvertedThread)
+                {
+                    ConvertFiberToThread();
+                }
+                azdestroy(threadContext, AZ::OSAllocator);
+            }
+
+            Context* Create(size_t stackSize, EntryFunction entryFunction, void* userData)
+            {
+                Context* context = azcreate(Context, (), AZ::OSAllocator, "JobFiber");
+                context->m_entryFunction = entryFunction;
+                context->m_userData = userData;
+                // Commit a small part of the stack up front, the rest is committed as it's used
+                context->m_fiber = CreateFiberEx(0, stackSize, FIBER_FLAG_FLOAT_SWITCH, &FiberMain, context);
+                if (!context->m_fiber)
+                {
+                    AZ_Error("JobFiber", false, "Failed to create a job fiber with a %zu byte stack, error %u", stackSize, GetLastError());
+                    azdestroy(context, AZ::OSAllocator);
+                    return nullptr;
+                }
+                return context;
+            }
+
+            void Destroy(Context* context)
+            {
+                AZ_Assert(context && !context->m_isConvertedThread, "Context was not returned by Create");
+                DeleteFiber(context->m_fiber);
+                azdestroy(context, AZ::OSAllocator);
+            }
+
+            void Switch(Context* /*from*/, Context* to)
+            {
+                // Windows saves the state of the running fiber itself
+                SwitchToFiber(to->m_fiber);
+            }
+        }
+    }
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxStorageDriveConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        StorageDriveLinux::ConstructionOptions options;
+        options.m_enableUnbufferedReads = m_enableUnbufferedReads;
+        options.m_hasSeekPenalty = m_hasSeekPenalty;
+        options.m_minimalReporting = m_minimalReporting;
+
+        // Use the same alignment as the other stack entries, such as the ReadSplitter, so aligned requests from those
+        // entries can be read directly into the provided buffers.
+        auto stackEntry = AZStd::make_shared<StorageDriveLinux>(m_maxFileHandles, hardware.m_maxPhysicalSectorSize,
+            hardware.m_maxLogicalSectorSize, m_ioChannelCount, m_ioThreadCount, m_overcommit, options);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxStorageDriveConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxStorageDriveConfig, IStreamerStackConfig>()
+                ->Version(1)
+                ->Field("MaxFileHandles", &LinuxStorageDriveConfig::m_maxFileHandles)
+                ->Field("IoChannelCount", &LinuxStorageDriveConfig::m_ioChannelCount)
+                ->Field("IoThreadCount", &LinuxStorageDriveConfig::m_ioThreadCount)
+                ->Field("Overcommit", &LinuxStorageDriveConfig::m_overcommit)
+                ->Field("EnableUnbufferedReads", &LinuxStorageDriveConfig::m_enableUnbufferedReads)
+                ->Field("HasSeekPenalty", &LinuxStorageDriveConfig::m_hasSeekPenalty)
+                ->Field("MinimalReporting", &LinuxStorageDriveConfig::m_minimalReporting);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,975 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/typetraits/decay.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // IoThreadPool
+    //
+
+    class StorageDriveLinux::IoThreadPool
+    {
+    public:
+        IoThreadPool(StreamerContext& context, ReadSlot* readSlots, u32 threadCount)
+            : m_context(context)
+            , m_readSlots(readSlots)
+        {
+            m_threadDesc.m_name = "IO Storage Drive";
+            m_threads.reserve(threadCount);
+            for (u32 i = 0; i < threadCount; ++i)
+            {
+                m_threads.emplace_back([this]()
+                {
+                    ThreadMain();
+                }, &m_threadDesc);
+            }
+        }
+
+        ~IoThreadPool()
+        {
+            {
+                AZStd::scoped_lock lock(m_submitGuard);
+                m_isRunning = false;
+            }
+            m_submitCondition.notify_all();
+            for (AZStd::thread& thread : m_threads)
+            {
+                thread.join();
+            }
+        }
+
+        void Submit(size_t readSlot)
+        {
+            {
+                AZStd::scoped_lock lock(m_submitGuard);
+                m_submitted.push_back(readSlot);
+            }
+            m_submitCondition.notify_one();
+        }
+
+        //! Moves the indices of all read slots that have finished reading into the provided list.
+        void CollectCompleted(AZStd::vector<size_t>& completed)
+        {
+            AZStd::scoped_lock lock(m_completedGuard);
+            completed.swap(m_completed);
+        }
+
+    private:
+        void ThreadMain()
+        {
+            while (true)
+            {
+                size_t readSlot = InvalidReadSlotIndex;
+                {
+                    AZStd::unique_lock lock(m_submitGuard);
+                    m_submitCondition.wait(lock, [this]() { return !m_isRunning || !m_submitted.empty(); });
+                    if (m_submitted.empty())
+                    {
+                        // Only exit once all submitted reads have been serviced so no slot is left in flight.
+                        return;
+                    }
+                    readSlot = m_submitted.front();
+                    m_submitted.pop_front();
+                }
+
+                ExecuteRead(m_readSlots[readSlot]);
+
+                {
+                    AZStd::scoped_lock lock(m_completedGuard);
+                    m_completed.push_back(readSlot);
+                }
+                m_context.WakeUpSchedulingThread();
+            }
+        }
+
+        static void ExecuteRead(ReadSlot& slot)
+        {
+            AZ_PROFILE_SCOPE(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ExecuteRead pread");
+
+            u8* output = reinterpret_cast<u8*>(slot.m_output);
+            u64 bytesRead = 0;
+            while (bytesRead < slot.m_readSize)
+            {
+                size_t readSize = aznumeric_cast<size_t>(slot.m_readSize - bytesRead);
+                ssize_t result = ::pread(slot.m_fileDescriptor, output + bytesRead, readSize,
+                    aznumeric_cast<off_t>(slot.m_readOffset + bytesRead));
+                if (result >= 0)
+                {
+                    bytesRead += aznumeric_cast<u64>(result);
+                    if (aznumeric_cast<size_t>(result) < readSize)
+                    {
+                        // Regular files only return short reads at the end of the file. Direct reads are allowed to extend
+                        // past the end of the file to meet the alignment requirements, so this isn't an error. Reading
+                        // again isn't possible either as the end of file is usually not at an aligned offset.
+                        break;
+                    }
+                }
+                else if (errno != EINTR)
+                {
+                    slot.m_error = errno;
+                    break;
+                }
+            }
+            slot.m_bytesRead = bytesRead;
+        }
+
+        AZStd::thread_desc m_threadDesc;
+        AZStd::vector<AZStd::thread> m_threads;
+
+        AZStd::mutex m_submitGuard;
+        AZStd::condition_variable m_submitCondition;
+        AZStd::deque<size_t> m_submitted;
+
+        AZStd::mutex m_completedGuard;
+        AZStd::vector<size_t> m_completed;
+
+        StreamerContext& m_context;
+        ReadSlot* m_readSlots;
+        bool m_isRunning{ true };
+    };
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // ReadSlot
+    //
+
+    void StorageDriveLinux::ReadSlot::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::ReadSlot::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = ReadSlot{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+
+    StorageDriveLinux::StorageDriveLinux(u32 maxFileHandles, size_t physicalSectorSize, size_t logicalSectorSize,
+        u32 ioChannelCount, u32 ioThreadCount, s32 overCommit, ConstructionOptions options)
+        : StreamStackEntry("Storage drive (Linux)")
+        , m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_ioChannelCount(ioChannelCount)
+        , m_ioThreadCount(ioThreadCount)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created.\n", m_name.c_str());
+        }
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_ioChannelCount == 0)
+        {
+            m_ioChannelCount = 1;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received io channel count of 0 for %s. Picking a count of %u instead.\n", m_name.c_str(), m_ioChannelCount);
+        }
+        if (m_ioThreadCount == 0)
+        {
+            m_ioThreadCount = 1;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received io thread count of 0 for %s. Picking a count of %u instead.\n", m_name.c_str(), m_ioThreadCount);
+        }
+        // There's no benefit to having more threads than reads that can be in flight.
+        m_ioThreadCount = AZStd::min(m_ioThreadCount, m_ioChannelCount);
+
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_ioChannelCount) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the number of IO channels (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_ioChannelCount);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_ioChannelCount);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        // Stop the IO threads first as they may still be reading from the cached file handles.
+        m_ioThreads.reset();
+        for (ReadSlot& slot : m_readSlots)
+        {
+            slot.Clear();
+        }
+        for (int file : m_fileCache_handles)
+        {
+            if (file != InvalidFileDescriptor)
+            {
+                ::close(file);
+            }
+        }
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+
+            FileRequest* read = m_context->GetNewInternalRequest();
+            read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                readRequest.m_offset, readRequest.m_size);
+            m_context->PushPreparedRequest(read);
+            return;
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                m_pendingReadRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                m_pendingRequests.push_back(request);
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                CancelRequest(request, args.m_target);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+                {
+                    Report(args);
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Submit as many reads as there are free slots so the IO threads always have work queued.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (!ReadRequest(request))
+            {
+                break;
+            }
+            m_pendingReadRequests.pop_front();
+            hasWorked = true;
+        }
+
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand()) || hasWorked;
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+        status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() && (m_activeReads_Count == 0);
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                const ReadSlot& read = m_readSlots[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime +
+                    AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequest(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                if (m_getFileExistsTimeAverage.GetNumRecorded() > 0)
+                {
+                    startTime += m_getFileExistsTimeAverage.CalculateAverage();
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                if (m_getFileMetaDataTimeAverage.GetNumRecorded() > 0)
+                {
+                    startTime += m_getFileMetaDataTimeAverage.CalculateAverage();
+                }
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex && m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            // Reads are serviced in parallel, so the time to read the data is spread over the available channels.
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / (totalBytesRead * m_ioThreadCount)));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_ioChannelCount)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    void StorageDriveLinux::EnsureIoThreadsStarted()
+    {
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, InvalidFileDescriptor);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_isDirect.resize(m_maxFileHandles, false);
+
+            // The read slots can't be resized after this point as the IO threads refer to them directly.
+            m_readSlots.resize(m_ioChannelCount);
+            m_readSlots_active.resize(m_ioChannelCount);
+
+            m_ioThreads = AZStd::make_unique<IoThreadPool>(*m_context, m_readSlots.data(), m_ioThreadCount);
+
+            m_cachesInitialized = true;
+        }
+    }
+
+    auto StorageDriveLinux::OpenFile(size_t& cacheSlot, const FileRequest::ReadData& data) -> OpenFileResult
+    {
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex == InvalidFileCacheIndex)
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            int file = InvalidFileDescriptor;
+            bool isDirect = false;
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    isDirect = file != InvalidFileDescriptor;
+                }
+                if (file == InvalidFileDescriptor)
+                {
+                    // Either direct reads were not requested or the file system doesn't support them (e.g. tmpfs).
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+                if (file == InvalidFileDescriptor)
+                {
+                    return OpenFileResult::OpenFailed;
+                }
+
+                CloseFileHandle(cacheIndex);
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_isDirect[cacheIndex] = isDirect;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        EnsureIoThreadsStarted();
+
+        if (m_activeReads_Count >= m_ioChannelCount)
+        {
+            return false;
+        }
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(fileCacheSlot, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::OpenFailed:
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+        ReadSlot& slot = m_readSlots[readSlot];
+        slot.m_request = request;
+        slot.m_fileHandleIndex = fileCacheSlot;
+        slot.m_fileDescriptor = m_fileCache_handles[fileCacheSlot];
+        slot.m_readOffset = data->m_offset;
+        slot.m_readSize = data->m_size;
+        slot.m_output = data->m_output;
+
+        if (m_fileCache_isDirect[fileCacheSlot])
+        {
+            // Direct reads require the offset and size to be aligned to the logical sector size and the output to the
+            // physical sector size. If any of these are not met, read the surrounding sectors into an aligned buffer and
+            // copy the requested part back once the read completes. See StorageDriveWin::ReadRequest for a diagram.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedOffs)
+            {
+                slot.m_readOffset = AZ_SIZE_ALIGN_DOWN(data->m_offset, aznumeric_cast<u64>(m_logicalSectorSize));
+                slot.m_copyBackOffset = aznumeric_cast<size_t>(data->m_offset - slot.m_readOffset);
+                slot.m_readSize = data->m_size + slot.m_copyBackOffset;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(slot.m_readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(slot.m_readSize, aznumeric_cast<u64>(m_logicalSectorSize));
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    slot.m_readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                slot.m_readSize = AZ_SIZE_ALIGN_UP(slot.m_readSize, aznumeric_cast<u64>(m_logicalSectorSize));
+                slot.AllocateAlignedBuffer(aznumeric_cast<size_t>(slot.m_readSize), m_physicalSectorSize);
+                slot.m_output = slot.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        m_queueDepthAverage.PushEntry(m_activeReads_Count);
+        m_peakQueueDepth = AZStd::max(m_peakQueueDepth, aznumeric_cast<u64>(m_activeReads_Count));
+        slot.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = slot.m_readOffset + slot.m_readSize;
+
+        m_ioThreads->Submit(readSlot);
+        return true;
+    }
+
+    void StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Reads that have already been handed to the IO threads can't be interrupted, but they will be reported
+        // as canceled once they return.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots[readSlot].m_request->WorksOn(target))
+            {
+                m_readSlots[readSlot].m_isCanceled = true;
+            }
+        }
+
+        cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(cancelRequest);
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        if (FindInFileHandleCache(fileExists.m_path) != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+        }
+        else
+        {
+            struct stat fileStatus;
+            fileExists.m_found = ::stat(fileExists.m_path.GetAbsolutePath(), &fileStatus) == 0 && S_ISREG(fileStatus.st_mode);
+        }
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE_DYNAMIC(AZ::Debug::ProfileCategory::AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataTimeAverage);
+
+        struct stat fileStatus;
+        bool found = false;
+        // If the file is already open, use the file handle which usually is cheaper than asking for the file by name.
+        size_t cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileDescriptor,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            found = ::fstat(m_fileCache_handles[cacheIndex], &fileStatus) == 0;
+        }
+        else
+        {
+            found = ::stat(command.m_path.GetAbsolutePath(), &fileStatus) == 0 && S_ISREG(fileStatus.st_mode);
+        }
+
+        if (found)
+        {
+            command.m_fileSize = aznumeric_cast<u64>(fileStatus.st_size);
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        }
+        else
+        {
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+        }
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] != InvalidFileDescriptor)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = InvalidFileDescriptor;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                CloseFileHandle(cacheIndex);
+                m_fileCache_activeReads[cacheIndex] = 0;
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzCore);
+
+        if (!m_ioThreads)
+        {
+            return false;
+        }
+
+        AZStd::vector<size_t> completed;
+        m_ioThreads->CollectCompleted(completed);
+        for (size_t readSlot : completed)
+        {
+            FinalizeSingleRequest(readSlot);
+        }
+        return !completed.empty();
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot)
+    {
+        ReadSlot& slot = m_readSlots[readSlot];
+
+        m_activeReads_ByteCount += slot.m_bytesRead;
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that all reads in the batch are done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&slot.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored in the read slot did not contain a read request.");
+        AZ_Error("StorageDriveLinux", slot.m_error == 0, "Reading '%s' failed with error %i.\n",
+            readCommand->m_path.GetRelativePath(), slot.m_error);
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        bool isSuccess = slot.m_error == 0 && (readCommand->m_size + slot.m_copyBackOffset <= slot.m_bytesRead);
+        if (isSuccess && slot.m_sectorAlignedOutput && !slot.m_isCanceled)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(slot.m_sectorAlignedOutput) + slot.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        slot.m_request->SetStatus(
+            slot.m_isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(slot.m_request);
+
+        m_fileCache_activeReads[slot.m_fileHandleIndex]--;
+        m_readSlots_active[readSlot] = false;
+        slot.Clear();
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot() const
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            if (m_fileOpenCloseTimeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            }
+            if (m_getFileExistsTimeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            }
+            if (m_getFileMetaDataTimeAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataTimeAverage.CalculateAverage().count()));
+            }
+            if (m_queueDepthAverage.GetNumRecorded() > 0)
+            {
+                statistics.push_back(Statistic::CreateFloat(m_name, "Queue depth (avg.)", m_queueDepthAverage.CalculateAverage()));
+            }
+            statistics.push_back(Statistic::CreateInteger(m_name, "Queue depth (peak)", aznumeric_cast<s64>(m_peakQueueDepth)));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Active reads", m_activeReads_Count));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != InvalidFileDescriptor)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+namespace AZ::IO
+{
+    //! Storage drive optimized for Linux. Unlike the generic StorageDrive, which services one blocking read at a time, this
+    //! drive keeps up to "ioChannelCount" reads in flight by handing them to a small pool of IO threads that issue positional
+    //! reads (pread) concurrently. This allows the kernel and the device to reorder and overlap requests.
+    //! Optionally files are opened with O_DIRECT to bypass the page cache. Direct reads have alignment restrictions which
+    //! this drive will resolve with an internal sector aligned buffer if needed. For the most optimal performance add a
+    //! ReadSplitter configured with "AdjustOffset" above this entry so requests arrive already aligned.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use direct (O_DIRECT) reads to bypass the Linux page cache. This results in a faster read the first time
+            //! a file is read, but subsequent reads will possibly be slower as those could have been serviced from the page cache.
+            //! If the file system doesn't support direct reads the file will be opened for buffered reads instead.
+            u8 m_enableUnbufferedReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param physicalSectorSize The alignment of the memory buffers when direct reads are used.
+        //! @param logicalSectorSize The alignment of the read offset and read size when direct reads are used.
+        //! @param ioChannelCount The maximum number of reads that are in flight at the same time.
+        //! @param ioThreadCount The number of threads that issue reads. Each thread has at most one read in flight, so
+        //!     the effective queue depth is the smallest of ioChannelCount and ioThreadCount.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(u32 maxFileHandles, size_t physicalSectorSize, size_t logicalSectorSize,
+            u32 ioChannelCount, u32 ioThreadCount, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr int InvalidFileDescriptor = -1;
+
+        //! Information for a single read that's in flight. The streamer thread owns the slot until it's submitted
+        //! to the IO threads and reclaims ownership once the IO threads have returned it as completed.
+        struct ReadSlot
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_output{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            u64 m_readOffset{ 0 };
+            u64 m_readSize{ 0 };
+            u64 m_bytesRead{ 0 };
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            int m_fileDescriptor{ InvalidFileDescriptor };
+            int m_error{ 0 };
+            bool m_isCanceled{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        //! Pool of threads that execute the reads. Stored separately so the threads don't depend on the address of the drive.
+        class IoThreadPool;
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            OpenFailed,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(size_t& cacheSlot, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot() const;
+        void EnsureIoThreadsStarted();
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+        void CloseFileHandle(size_t cacheIndex);
+
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+        //! The number of reads in flight at the moment a new read is submitted.
+        AverageWindow<u64, float, s_statisticsWindowSize> m_queueDepthAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+
+        AZStd::vector<ReadSlot> m_readSlots;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isDirect;
+
+        AZStd::unique_ptr<IoThreadPool> m_ioThreads;
+
+        size_t m_activeReads_ByteCount{ 0 };
+        u64 m_peakQueueDepth{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_ioChannelCount{ 1 };
+        u32 m_ioThreadCount{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+    };
+} // namespace AZ::IO
@@ -34,6 +34,7 @@ set(FILES
     ../Common/Default/AzCore/IO/Streamer/StreamerConfiguration_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.cpp
     ../Common/Default/AzCore/IO/Streamer/StreamerContext_Default.h
+    ../Common/UnixLike/AzCore/IO/MappedFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/SystemFile_UnixLike.cpp
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.h
     ../Common/UnixLike/AzCore/IO/Internal/SystemFileUtils_UnixLike.cpp
@@ -43,6 +44,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     AzCore/IPC/SharedMemory_Mac.h
     AzCore/IPC/SharedMemory_Mac.cpp
+    ../Common/Unimplemented/AzCore/Jobs/Internal/JobFiber_Unimplemented.cpp
     ../Common/Apple/AzCore/Memory/OSAllocator_Apple.h
     ../Common/Unimplemented/AzCore/Memory/OverrunDetectionAllocator_Unimplemented.h
     AzCore/Memory/HeapSchema_Mac.cpp
@@ -33,6 +33,7 @@ set(FILES
     ../Common/WinAPI/AzCore/Debug/Trace_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/Streamer/StreamerContext_WinAPI.h
+    ../Common/WinAPI/AzCore/IO/MappedFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.cpp
     ../Common/WinAPI/AzCore/IO/SystemFile_WinAPI.h
     AzCore/IO/SystemFile_Platform.h
@@ -46,6 +47,7 @@ set(FILES
     AzCore/IPC/SharedMemory_Platform.h
     AzCore/IPC/SharedMemory_Windows.h
     AzCore/IPC/SharedMemory_Windows.cpp
+    ../Common/WinAPI/AzCore/Jobs/Internal/JobFiber_WinAPI.cpp
     ../Common/WinAPI/AzCore/Memory/OSAllocator_WinAPI.h
     ../Common/WinAPI/AzCore/Memory/OverrunDetectionAllocator_WinAPI.h
     AzCore/Memory/HeapSchema_Windows.cpp
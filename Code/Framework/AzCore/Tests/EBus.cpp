@@ -44,7 +44,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool lockFreeEventQueue = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -55,6 +55,7 @@ namespace BusImplementation
 
         // Allow queuing
         static const bool EnableEventQueue = true;
+        static const bool EnableLockFreeEventQueue = lockFreeEventQueue;
 
         // Force locking
         using MutexType = AZStd::recursive_mutex;
@@ -192,8 +193,8 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool lockFreeEventQueue = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, lockFreeEventQueue>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
@@ -761,6 +762,40 @@ namespace UnitTest
         this->ClearHandlers();
     }
 
+    // Test sending events on an address while the number of handlers on it goes between one and many
+    TYPED_TEST(EBusTestIdMultiHandlers, Event_HandlerCountChanges_AllConnectedHandlersCalled)
+    {
+        using Bus = TypeParam;
+        using Handler = typename EBusTestAll<Bus>::Handler;
+
+        constexpr bool connectOnConstruct{ true };
+        typename Bus::BusPtr busPtr;
+        Bus::Bind(busPtr, 0);
+
+        Handler first(0, connectOnConstruct);
+        Bus::Event(0, &Bus::Events::OnEvent);
+        Bus::Event(busPtr, &Bus::Events::OnEvent);
+        EXPECT_EQ(2, first.m_eventCalls);
+
+        Handler second(0, connectOnConstruct);
+        Bus::Event(0, &Bus::Events::OnEvent);
+        Bus::Event(busPtr, &Bus::Events::OnEvent);
+        EXPECT_EQ(4, first.m_eventCalls);
+        EXPECT_EQ(2, second.m_eventCalls);
+
+        first.BusDisconnect();
+        int result = 0;
+        Bus::EventResult(result, 0, &Bus::Events::OnEvent);
+        Bus::EventResult(result, busPtr, &Bus::Events::OnEvent);
+        EXPECT_EQ(4, first.m_eventCalls);
+        EXPECT_EQ(4, second.m_eventCalls);
+
+        second.BusDisconnect();
+        Bus::Event(0, &Bus::Events::OnEvent);
+        Bus::Event(busPtr, &Bus::Events::OnEvent);
+        EXPECT_EQ(4, second.m_eventCalls);
+    }
+
     // Test sending events on an address
     TYPED_TEST(EBusTestId, EventReverse)
     {
@@ -1821,6 +1856,111 @@ namespace UnitTest
         AllocatorInstance<PoolAllocator>::Destroy();
     }
 
+    namespace LockFreeQueueMessageTest
+    {
+        static const int NumThreads = 4;
+        static const int NumCalls = 5000;
+
+        class LockFreeQueueTestEvents
+            : public EBusTraits
+        {
+        public:
+            //////////////////////////////////////////////////////////////////////////
+            // EBusTraits overrides
+            typedef AZStd::mutex MutexType;
+            static const bool EnableEventQueue = true;
+            static const bool EnableLockFreeEventQueue = true;
+            //////////////////////////////////////////////////////////////////////////
+            virtual ~LockFreeQueueTestEvents() = default;
+            virtual void OnMessage(int threadIndex, int messageIndex) = 0;
+        };
+        using LockFreeQueueTestBus = AZ::EBus<LockFreeQueueTestEvents>;
+
+        class LockFreeQueueTestHandler
+            : public LockFreeQueueTestBus::Handler
+        {
+        public:
+            void OnMessage(int threadIndex, int messageIndex) override
+            {
+                // Messages queued from the same thread must execute in the order they were queued
+                EXPECT_EQ(m_nextMessage[threadIndex], messageIndex);
+                m_nextMessage[threadIndex] = messageIndex + 1;
+                ++m_callCount;
+            }
+
+            int m_nextMessage[NumThreads] = {};
+            int m_callCount = 0;
+        };
+    }
+
+    TEST_F(EBus, QueueMessage_LockFreeQueue_MessagesFromAllThreadsExecuteInOrder)
+    {
+        using namespace LockFreeQueueMessageTest;
+
+        LockFreeQueueTestHandler handler;
+        handler.BusConnect();
+
+        AZStd::thread threads[NumThreads];
+        for (int threadIndex = 0; threadIndex < NumThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex]()
+            {
+                for (int messageIndex = 0; messageIndex < NumCalls; ++messageIndex)
+                {
+                    LockFreeQueueTestBus::QueueBroadcast(&LockFreeQueueTestBus::Events::OnMessage, threadIndex, messageIndex);
+                }
+            });
+        }
+
+        while (handler.m_callCount < NumThreads * NumCalls)
+        {
+            LockFreeQueueTestBus::ExecuteQueuedEvents();
+            AZStd::this_thread::yield();
+        }
+
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(NumThreads * NumCalls, handler.m_callCount);
+        EXPECT_EQ(0u, LockFreeQueueTestBus::QueuedEventCount());
+
+        handler.BusDisconnect();
+    }
+
+    TEST_F(EBus, QueueFunction_LockFreeQueue_LargeAndSmallCallablesExecuteAndClear)
+    {
+        using namespace LockFreeQueueMessageTest;
+
+        LockFreeQueueTestHandler handler;
+        handler.BusConnect();
+
+        // Captures larger than the pooled message storage are allocated separately
+        int largeCapture[64] = {};
+        largeCapture[63] = 42;
+        int result = 0;
+        LockFreeQueueTestBus::QueueFunction([largeCapture, &result]() { result = largeCapture[63]; });
+        LockFreeQueueTestBus::QueueFunction([&result]() { result += 1; });
+        EXPECT_EQ(2u, LockFreeQueueTestBus::QueuedEventCount());
+
+        LockFreeQueueTestBus::ExecuteQueuedEvents();
+        EXPECT_EQ(43, result);
+        EXPECT_EQ(0u, LockFreeQueueTestBus::QueuedEventCount());
+
+        // Cleared messages are destroyed without being executed
+        LockFreeQueueTestBus::QueueFunction([largeCapture, &result]() { result = 0; });
+        LockFreeQueueTestBus::QueueBroadcast(&LockFreeQueueTestBus::Events::OnMessage, 0, 0);
+        EXPECT_EQ(2u, LockFreeQueueTestBus::QueuedEventCount());
+        LockFreeQueueTestBus::ClearQueuedEvents();
+        EXPECT_EQ(0u, LockFreeQueueTestBus::QueuedEventCount());
+        LockFreeQueueTestBus::ExecuteQueuedEvents();
+        EXPECT_EQ(43, result);
+        EXPECT_EQ(0, handler.m_callCount);
+
+        handler.BusDisconnect();
+    }
+
     class QueueEbusTest
         : public ScopedAllocatorSetupFixture
     {
@@ -4335,6 +4475,53 @@ namespace Benchmark
     }
     BUS_BENCHMARK_REGISTER_ID(BM_EBus_EventCachedResult);
 
+    //////////////////////////////////////////////////////////////////////////
+    // Sole Handler Events/Broadcasts
+    //////////////////////////////////////////////////////////////////////////
+
+    // Dispatch to an address with state.range(0) handlers, addresses with a sole handler skip walking the handlers
+    template <typename Bus>
+    static void BM_EBus_EventSoleHandler(::benchmark::State& state)
+    {
+        constexpr bool connectOnConstruct{ true };
+        AZStd::vector<AZStd::unique_ptr<Handler<Bus>>> handlers;
+        for (int64_t handlerIndex = 0; handlerIndex < state.range(0); ++handlerIndex)
+        {
+            handlers.emplace_back(AZStd::make_unique<Handler<Bus>>(0, connectOnConstruct));
+        }
+
+        while (state.KeepRunning())
+        {
+            int result = 0;
+            Bus::EventResult(result, 0, &Bus::Events::OnEvent);
+            ::benchmark::DoNotOptimize(result);
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_EventSoleHandler, ManyToOne)->Arg(1);
+    BENCHMARK_TEMPLATE(BM_EBus_EventSoleHandler, ManyToMany)->Arg(1)->Arg(2);
+    BENCHMARK_TEMPLATE(BM_EBus_EventSoleHandler, ManyToManyOrdered)->Arg(1)->Arg(2);
+
+    template <typename Bus>
+    static void BM_EBus_BroadcastSoleHandler(::benchmark::State& state)
+    {
+        constexpr bool connectOnConstruct{ true };
+        AZStd::vector<AZStd::unique_ptr<Handler<Bus>>> handlers;
+        for (int64_t handlerIndex = 0; handlerIndex < state.range(0); ++handlerIndex)
+        {
+            handlers.emplace_back(AZStd::make_unique<Handler<Bus>>(0, connectOnConstruct));
+        }
+
+        while (state.KeepRunning())
+        {
+            int result = 0;
+            Bus::BroadcastResult(result, &Bus::Events::OnEvent);
+            ::benchmark::DoNotOptimize(result);
+        }
+    }
+    BENCHMARK_TEMPLATE(BM_EBus_BroadcastSoleHandler, OneToOne)->Arg(1);
+    BENCHMARK_TEMPLATE(BM_EBus_BroadcastSoleHandler, OneToMany)->Arg(1)->Arg(2);
+    BENCHMARK_TEMPLATE(BM_EBus_BroadcastSoleHandler, OneToManyOrdered)->Arg(1)->Arg(2);
+
     //////////////////////////////////////////////////////////////////////////
     // Broadcast/Event Queuing
     //////////////////////////////////////////////////////////////////////////
@@ -4500,6 +4687,51 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    //////////////////////////////////////////////////////////////////////////
+    // Multithreaded Queued Broadcasts
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Bus>
+    static void BM_EBus_Multithreaded_QueueBroadcast(::benchmark::State& state)
+    {
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        // Every thread produces events, the first thread also drains the queue
+        while (state.KeepRunning())
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnEvent);
+            if (state.thread_index == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        };
+
+        if (state.thread_index == 0)
+        {
+            Bus::ClearQueuedEvents();
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+
+    static void BM_EBus_Multithreaded_QueueBroadcast_Locks(::benchmark::State& state)
+    {
+        BM_EBus_Multithreaded_QueueBroadcast<TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, false>>(state);
+    }
+    BENCHMARK(BM_EBus_Multithreaded_QueueBroadcast_Locks)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_QueueBroadcast_LockFree(::benchmark::State& state)
+    {
+        BM_EBus_Multithreaded_QueueBroadcast<TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false, true>>(state);
+    }
+    BENCHMARK(BM_EBus_Multithreaded_QueueBroadcast_LockFree)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
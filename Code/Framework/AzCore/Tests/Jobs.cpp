@@ -68,6 +68,9 @@ namespace UnitTest
         JobManager* m_jobManager = nullptr;
         JobContext* m_jobContext = nullptr;
         unsigned int m_numWorkerThreads;
+        JobManagerDesc::AffinityMaskList m_jobAffinityMasks;
+        bool m_useFibers = false;
+        unsigned int m_maxFibersPerWorker = 0;
     public:
         DefaultJobManagerSetupFixture(unsigned int numWorkerThreads = 0)
             : m_numWorkerThreads(numWorkerThreads)
@@ -100,6 +103,10 @@ namespace UnitTest
 #endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
             }
 
+            desc.m_jobAffinityMasks = m_jobAffinityMasks;
+            desc.m_useFibers = m_useFibers;
+            desc.m_maxFibersPerWorker = m_maxFibersPerWorker;
+
             m_jobManager = aznew JobManager(desc);
             m_jobContext = aznew JobContext(*m_jobManager);
 
@@ -1135,6 +1142,123 @@ namespace UnitTest
         run();
     }
 
+    class JobParallelAlgorithmsTest
+        : public DefaultJobManagerSetupFixture
+    {
+    };
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_SumOfRange_MatchesSerialSum)
+    {
+        const int numElements = 100000;
+        const AZ::s64 expectedSum = static_cast<AZ::s64>(numElements) * (numElements - 1) / 2;
+        auto sumRange = [](int start, int end)
+        {
+            AZ::s64 sum = 0;
+            for (int i = start; i < end; ++i)
+            {
+                sum += i;
+            }
+            return sum;
+        };
+        auto add = [](AZ::s64 left, AZ::s64 right) { return left + right; };
+
+        EXPECT_EQ(expectedSum, parallel_reduce(0, numElements, AZ::s64(0), sumRange, add));
+        EXPECT_EQ(expectedSum, parallel_reduce(0, numElements, AZ::s64(0), sumRange, add, 1));
+        EXPECT_EQ(0, parallel_reduce(0, 0, AZ::s64(0), sumRange, add));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelReduce_NonCommutativeReduction_KeepsRangeOrder)
+    {
+        const int numElements = 4096;
+        // Each range is reduced to [start, end), combining them only works if the left range is always the first argument
+        using Range = AZStd::pair<int, int>;
+        Range result = parallel_reduce(0, numElements, Range(0, 0),
+            [](int start, int end) { return Range(start, end); },
+            [](const Range& left, const Range& right)
+            {
+                EXPECT_EQ(left.second, right.first);
+                return Range(left.first, right.second);
+            }, 16);
+        EXPECT_EQ(0, result.first);
+        EXPECT_EQ(numElements, result.second);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelScan_InclusiveAndExclusive_MatchSerialScan)
+    {
+        const int numElements = 10000;
+        AZStd::vector<int> values(numElements);
+        for (int i = 0; i < numElements; ++i)
+        {
+            values[i] = (i % 7) + 1;
+        }
+
+        AZStd::vector<int> inclusive(numElements);
+        AZStd::vector<int> exclusive(numElements);
+        parallel_inclusive_scan(values.begin(), values.end(), inclusive.begin(), 0, AZStd::plus<int>());
+        parallel_exclusive_scan(values.begin(), values.end(), exclusive.begin(), 0, AZStd::plus<int>(), 64);
+
+        int sum = 0;
+        for (int i = 0; i < numElements; ++i)
+        {
+            EXPECT_EQ(sum, exclusive[i]);
+            sum += values[i];
+            EXPECT_EQ(sum, inclusive[i]);
+        }
+
+        // in place
+        parallel_inclusive_scan(values.begin(), values.end(), values.begin(), 0, AZStd::plus<int>(), 100);
+        EXPECT_EQ(inclusive, values);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_RandomValues_AreSorted)
+    {
+        const int numElements = 100000;
+        AZStd::vector<AZ::u32> values(numElements);
+        SimpleLcgRandom random(1234);
+        for (AZ::u32& value : values)
+        {
+            value = static_cast<AZ::u32>(random.GetRandom() % 1000);
+        }
+        AZStd::vector<AZ::u32> expected = values;
+        AZStd::sort(expected.begin(), expected.end());
+
+        AZStd::vector<AZ::u32> sorted = values;
+        parallel_sort(sorted.begin(), sorted.end());
+        EXPECT_EQ(expected, sorted);
+
+        // small grain size to force deep recursion and parallel merges
+        sorted = values;
+        parallel_sort(sorted.begin(), sorted.end(), AZStd::greater<AZ::u32>(), 32);
+        AZStd::reverse(expected.begin(), expected.end());
+        EXPECT_EQ(expected, sorted);
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelSort_CalledFromJob_IsSorted)
+    {
+        AZStd::vector<int> values(20000);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i] = static_cast<int>(values.size() - i);
+        }
+
+        Job* job = CreateJobFunction([&values]() { parallel_sort(values.begin(), values.end(), AZStd::less<int>(), 256); }, false, m_jobContext);
+        job->StartAndWaitForCompletion();
+        delete job;
+
+        EXPECT_TRUE(AZStd::is_sorted(values.begin(), values.end()));
+    }
+
+    TEST_F(JobParallelAlgorithmsTest, ParallelFor_WithGrainSize_VisitsEveryIndexOnce)
+    {
+        const int numElements = 10000;
+        AZStd::vector<int> visits(numElements, 0);
+        parallel_for(0, numElements, [&visits](int i) { ++visits[i]; }, auto_partitioner(64));
+        for (int i = 0; i < numElements; ++i)
+        {
+            EXPECT_EQ(1, visits[i]);
+        }
+    }
+
     class PERF_JobParallelForOverheadTest
         : public DefaultJobManagerSetupFixture
     {
@@ -1651,6 +1775,230 @@ namespace UnitTest
     {
         RunTest();
     }
+
+    class TestJobForkingLowPriorityJobs : public Job
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(TestJobForkingLowPriorityJobs, ThreadPoolAllocator, 0)
+
+        TestJobForkingLowPriorityJobs(JobContext* context, AZStd::binary_semaphore& binarySemaphore, AZStd::vector<AZStd::string>& namesOfProcessedJobs, AZStd::atomic_bool& hasForked)
+            : Job(true, context)
+            , m_binarySemaphore(binarySemaphore)
+            , m_namesOfProcessedJobs(namesOfProcessedJobs)
+            , m_hasForked(hasForked)
+        {
+        }
+
+        void Process() override
+        {
+            // Jobs started on a worker thread go to its local queue, and the lone worker can't run them until this job is done
+            (aznew TestJobWithPriority(-1, "LowPriority1", GetContext(), m_binarySemaphore, m_namesOfProcessedJobs))->Start();
+            (aznew TestJobWithPriority(-1, "LowPriority2", GetContext(), m_binarySemaphore, m_namesOfProcessedJobs))->Start();
+            m_hasForked = true;
+
+            m_binarySemaphore.acquire();
+            m_namesOfProcessedJobs.push_back("ForkingJob");
+            m_binarySemaphore.release();
+        }
+
+    private:
+        AZStd::binary_semaphore& m_binarySemaphore;
+        AZStd::vector<AZStd::string>& m_namesOfProcessedJobs;
+        AZStd::atomic_bool& m_hasForked;
+    };
+
+    class JobPriorityLevelTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobPriorityLevelTestFixture() : DefaultJobManagerSetupFixture(1) // Only 1 worker to serialize job execution
+        {
+        }
+
+        void RunTest()
+        {
+            AZStd::vector<AZStd::string> namesOfProcessedJobs;
+            AZStd::binary_semaphore binarySemaphore;
+            AZStd::atomic_bool hasForked{ false };
+
+            // The forking job queues low priority jobs on the worker, then blocks until a high priority job has been queued from this thread.
+            (aznew TestJobForkingLowPriorityJobs(m_jobContext, binarySemaphore, namesOfProcessedJobs, hasForked))->Start();
+            while (!hasForked) {}
+            (aznew TestJobWithPriority(1, "HighPriority", m_jobContext, binarySemaphore, namesOfProcessedJobs))->Start();
+            binarySemaphore.release();
+
+            while (TestJobWithPriority::s_numIncompleteJobs > 0) {}
+
+            // The high priority job must not wait for the lower priority jobs which were already queued on the worker.
+            ASSERT_EQ(namesOfProcessedJobs.size(), 4u);
+            EXPECT_EQ(namesOfProcessedJobs[0], "ForkingJob");
+            EXPECT_EQ(namesOfProcessedJobs[1], "HighPriority");
+            EXPECT_EQ(namesOfProcessedJobs[2], "LowPriority1");
+            EXPECT_EQ(namesOfProcessedJobs[3], "LowPriority2");
+        }
+    };
+
+    TEST_F(JobPriorityLevelTestFixture, HighPriorityJob_RunsBeforeLowerPriorityLocalJobs)
+    {
+        RunTest();
+    }
+
+    class JobAffinityTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        static const AZ::u32 AffinityWorkerId = 1;
+
+        JobAffinityTestFixture() : DefaultJobManagerSetupFixture(4)
+        {
+            // Affinity group 0 only runs on the second worker
+            m_jobAffinityMasks.push_back(AZ::u64(1) << AffinityWorkerId);
+        }
+
+        void RunTest()
+        {
+            const int numUserThreadJobs = 256;
+            const int numWorkerThreadJobs = 32;
+            AZStd::atomic_int numJobsDone{ 0 };
+            AZStd::atomic_int numJobsOnOtherThreads{ 0 };
+            auto affinityJobFunction = [this, &numJobsDone, &numJobsOnOtherThreads]()
+            {
+                if (m_jobManager->GetWorkerThreadId() != AffinityWorkerId)
+                {
+                    ++numJobsOnOtherThreads;
+                }
+                ++numJobsDone;
+            };
+
+            JobCompletion completion(m_jobContext);
+
+            // Jobs started on this thread
+            for (int i = 0; i < numUserThreadJobs; ++i)
+            {
+                Job* job = CreateJobFunction(affinityJobFunction, true, m_jobContext);
+                job->SetAffinityGroup(0);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+
+            // Jobs started on any of the worker threads
+            for (int i = 0; i < numWorkerThreadJobs; ++i)
+            {
+                Job* parentJob = CreateJobFunction([affinityJobFunction](Job& thisJob)
+                {
+                    Job* job = CreateJobFunction(affinityJobFunction, true, thisJob.GetContext());
+                    job->SetAffinityGroup(0);
+                    thisJob.StartAsChild(job);
+                    thisJob.WaitForChildren();
+                }, true, m_jobContext);
+                parentJob->SetDependent(&completion);
+                parentJob->Start();
+            }
+
+            completion.StartAndWaitForCompletion();
+
+            EXPECT_EQ(numUserThreadJobs + numWorkerThreadJobs, numJobsDone);
+            EXPECT_EQ(0, numJobsOnOtherThreads);
+        }
+    };
+
+    TEST_F(JobAffinityTestFixture, AffinityGroupJobs_OnlyRunOnWorkersInAffinityMask)
+    {
+        RunTest();
+    }
+
+    class JobFiberTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        JobFiberTestFixture() : DefaultJobManagerSetupFixture(2)
+        {
+            m_useFibers = true;
+        }
+
+        // Each job forks a child and a leaf job and waits for both, which nests depth jobs waiting for their children.
+        // With fibers the waiting jobs are parked, instead of the worker stacks growing with every level.
+        static void ForkChain(Job& thisJob, int depth, AZStd::atomic_int& numLeafJobs)
+        {
+            Job* leafJob = CreateJobFunction([&numLeafJobs]() { ++numLeafJobs; }, true, thisJob.GetContext());
+            thisJob.StartAsChild(leafJob);
+            if (depth > 1)
+            {
+                Job* childJob = CreateJobFunction([depth, &numLeafJobs](Job& job) { ForkChain(job, depth - 1, numLeafJobs); }, true, thisJob.GetContext());
+                thisJob.StartAsChild(childJob);
+            }
+            thisJob.WaitForChildren();
+        }
+
+        void RunTest()
+        {
+            EXPECT_EQ(AZ::Internal::JobFiber::IsSupported(), m_jobManager->IsUsingFibers());
+
+            const int numChains = 4;
+            const int chainDepth = 256;
+            AZStd::atomic_int numLeafJobs{ 0 };
+
+            JobCompletion completion(m_jobContext);
+            for (int i = 0; i < numChains; ++i)
+            {
+                Job* job = CreateJobFunction([&numLeafJobs](Job& thisJob) { ForkChain(thisJob, chainDepth, numLeafJobs); }, true, m_jobContext);
+                job->SetDependent(&completion);
+                job->Start();
+            }
+            completion.StartAndWaitForCompletion();
+
+            EXPECT_EQ(numChains * chainDepth, numLeafJobs);
+        }
+    };
+
+    TEST_F(JobFiberTestFixture, DeeplyNestedWaitForChildren_AllJobsComplete)
+    {
+        RunTest();
+    }
+
+    class JobFiberLimitTestFixture : public DefaultJobManagerSetupFixture
+    {
+    public:
+        // A single worker with one fiber besides its own, so the second job which waits on it has no fiber to park on
+        JobFiberLimitTestFixture() : DefaultJobManagerSetupFixture(1)
+        {
+            m_useFibers = true;
+            m_maxFibersPerWorker = 1;
+        }
+    };
+
+    TEST_F(JobFiberLimitTestFixture, WaitWithoutFreeFiber_WhileAnotherJobIsParked_BothJobsComplete)
+    {
+        // The parked job's child completes while the worker processes jobs on the stack of the waiting job. The parked
+        // job must not be resumed from there, the waiting job would only continue once another job parked.
+        const int numJobs = 4;
+        AZStd::atomic_int numJobsDone{ 0 };
+        AZStd::binary_semaphore allJobsDone;
+        auto jobDone = [&numJobsDone, &allJobsDone]()
+        {
+            if (++numJobsDone == numJobs)
+            {
+                allJobsDone.release();
+            }
+        };
+
+        Job* parkedJob = CreateJobFunction([this, &jobDone](Job& thisJob)
+        {
+            Job* waitingJob = CreateJobFunction([this, &jobDone](Job& waitingThisJob)
+            {
+                waitingThisJob.StartAsChild(CreateJobFunction(jobDone, true, m_jobContext));
+                waitingThisJob.WaitForChildren();
+                jobDone();
+            }, true, m_jobContext);
+
+            // queued before the child, so the worker runs it first once this job is parked
+            waitingJob->Start();
+            thisJob.StartAsChild(CreateJobFunction(jobDone, true, m_jobContext));
+            thisJob.WaitForChildren();
+            jobDone();
+        }, true, m_jobContext);
+        parkedJob->Start();
+
+        EXPECT_TRUE(allJobsDone.try_acquire_for(AZStd::chrono::seconds(10)));
+        EXPECT_EQ(numJobs, numJobsDone);
+    }
 } // UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -1820,6 +2168,54 @@ namespace Benchmark
         AZStd::vector<AZ::s8> m_randomPriorities;
     };
 
+    BENCHMARK_F(JobBenchmarkFixture, SortLargeArray_Serial)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::u32> values(LARGE_NUMBER_OF_JOBS * 64);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            SimpleLcgRandom random(1);
+            AZStd::generate(values.begin(), values.end(), [&random]() { return static_cast<AZ::u32>(random.GetRandom()); });
+            state.ResumeTiming();
+
+            AZStd::sort(values.begin(), values.end());
+        }
+    }
+
+    BENCHMARK_F(JobBenchmarkFixture, SortLargeArray_ParallelSort)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::u32> values(LARGE_NUMBER_OF_JOBS * 64);
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            SimpleLcgRandom random(1);
+            AZStd::generate(values.begin(), values.end(), [&random]() { return static_cast<AZ::u32>(random.GetRandom()); });
+            state.ResumeTiming();
+
+            parallel_sort(values.begin(), values.end(), m_jobContext);
+        }
+    }
+
+    BENCHMARK_F(JobBenchmarkFixture, SumLargeArray_ParallelReduce)(benchmark::State& state)
+    {
+        AZStd::vector<AZ::u32> values(LARGE_NUMBER_OF_JOBS * 64, 1);
+        for (auto _ : state)
+        {
+            AZ::u64 sum = parallel_reduce(0, static_cast<int>(values.size()), AZ::u64(0),
+                [&values](int start, int end)
+                {
+                    AZ::u64 rangeSum = 0;
+                    for (int i = start; i < end; ++i)
+                    {
+                        rangeSum += values[i];
+                    }
+                    return rangeSum;
+                },
+                [](AZ::u64 left, AZ::u64 right) { return left + right; }, 0, m_jobContext);
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+
     BENCHMARK_F(JobBenchmarkFixture, RunSmallNumberOfLightWeightJobsWithDefaultPriority)(benchmark::State& state)
     {
         for (auto _ : state)
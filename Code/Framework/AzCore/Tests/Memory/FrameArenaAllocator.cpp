@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/Memory/LinearAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+using namespace AZ;
+
+namespace UnitTest
+{
+    class LinearAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            LinearAllocator::Descriptor desc;
+            desc.m_chunkSize = 1024;
+            m_allocator = aznew LinearAllocator(desc);
+        }
+
+        void TearDown() override
+        {
+            delete m_allocator;
+            m_allocator = nullptr;
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        LinearAllocator* m_allocator = nullptr;
+    };
+
+    TEST_F(LinearAllocatorTest, Allocate_VariousAlignments_AddressesAreAligned)
+    {
+        for (size_t alignment = 1; alignment <= 256; alignment *= 2)
+        {
+            void* ptr = m_allocator->Allocate(3, alignment);
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(ptr) % alignment);
+        }
+    }
+
+    TEST_F(LinearAllocatorTest, Allocate_LargerThanChunk_GetsOwnChunk)
+    {
+        void* small = m_allocator->Allocate(16, 16);
+        void* large = m_allocator->Allocate(4096, 16);
+        ASSERT_NE(nullptr, small);
+        ASSERT_NE(nullptr, large);
+        memset(large, 0xcd, 4096);
+        EXPECT_GE(m_allocator->Capacity(), 1024 + 4096);
+    }
+
+    TEST_F(LinearAllocatorTest, Rewind_ToMarker_ReleasesLaterAllocationsAndReusesChunks)
+    {
+        m_allocator->Allocate(100, 4);
+        const size_t allocatedAtMarker = m_allocator->NumAllocatedBytes();
+        LinearAllocator::Marker marker = m_allocator->GetMarker();
+
+        void* first = m_allocator->Allocate(64, 16);
+        for (int i = 0; i < 100; ++i)
+        {
+            m_allocator->Allocate(64, 16);
+        }
+        const size_t capacity = m_allocator->Capacity();
+        EXPECT_GT(m_allocator->NumAllocatedBytes(), allocatedAtMarker);
+
+        m_allocator->Rewind(marker);
+        EXPECT_EQ(allocatedAtMarker, m_allocator->NumAllocatedBytes());
+
+        // Same allocations again land at the same addresses, without taking new chunks
+        EXPECT_EQ(first, m_allocator->Allocate(64, 16));
+        for (int i = 0; i < 100; ++i)
+        {
+            m_allocator->Allocate(64, 16);
+        }
+        EXPECT_EQ(capacity, m_allocator->Capacity());
+
+        m_allocator->Reset();
+        EXPECT_EQ(0, m_allocator->NumAllocatedBytes());
+        m_allocator->GarbageCollect();
+        EXPECT_EQ(0, m_allocator->Capacity());
+    }
+
+    TEST_F(LinearAllocatorTest, DeAllocateAndResize_MostRecentAllocation_AdjustedInPlace)
+    {
+        void* first = m_allocator->Allocate(32, 8);
+        void* second = m_allocator->Allocate(32, 8);
+        const size_t allocated = m_allocator->NumAllocatedBytes();
+
+        EXPECT_EQ(0, m_allocator->Resize(first, 64));
+        EXPECT_EQ(64, m_allocator->Resize(second, 64));
+        EXPECT_EQ(allocated + 32, m_allocator->NumAllocatedBytes());
+
+        m_allocator->DeAllocate(first, 32, 8);
+        EXPECT_EQ(allocated + 32, m_allocator->NumAllocatedBytes());
+        m_allocator->DeAllocate(second, 64, 8);
+        EXPECT_EQ(allocated - 32, m_allocator->NumAllocatedBytes());
+    }
+
+    TEST_F(LinearAllocatorTest, Scope_ContainersAllocatedInScope_ReleasedOnExit)
+    {
+        {
+            LinearAllocatorScope scope(*m_allocator);
+            AZStdIAllocator allocator(m_allocator);
+            AZStd::vector<int, AZStdIAllocator> values(allocator);
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+            }
+            EXPECT_GE(m_allocator->NumAllocatedBytes(), 1000 * sizeof(int));
+        }
+        EXPECT_EQ(0, m_allocator->NumAllocatedBytes());
+    }
+
+    class FrameArenaAllocatorTest
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+            AllocatorInstance<FrameArenaAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            AllocatorsTestFixture::TearDown();
+        }
+
+        FrameArenaAllocator& GetFrameArena()
+        {
+            return static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator());
+        }
+    };
+
+    TEST_F(FrameArenaAllocatorTest, FrameArenaScope_ContainersAllocatedInScope_ReleasedOnExit)
+    {
+        const size_t allocated = GetFrameArena().NumAllocatedBytes();
+        {
+            FrameArenaScope scope;
+            AZStd::vector<int, FrameArenaStdAllocator> values;
+            AZStd::list<int, FrameArenaStdAllocator> nodes;
+            for (int i = 0; i < 1000; ++i)
+            {
+                values.push_back(i);
+                nodes.push_back(i);
+            }
+            EXPECT_GT(GetFrameArena().NumAllocatedBytes(), allocated);
+        }
+        EXPECT_EQ(allocated, GetFrameArena().NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTest, Allocate_FromSeveralThreads_EachThreadUsesItsOwnArenaAndReleasesItOnExit)
+    {
+        constexpr int numThreads = 4;
+        constexpr int numAllocations = 1000;
+        constexpr size_t allocationSize = 32;
+
+        const size_t allocated = GetFrameArena().NumAllocatedBytes();
+        const size_t capacity = GetFrameArena().Capacity();
+
+        AZStd::atomic<int> allocatedThreads{ 0 };
+        AZStd::atomic<bool> exitThreads{ false };
+        AZStd::thread threads[numThreads];
+        for (int threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([threadIndex, &allocatedThreads, &exitThreads]()
+            {
+                IAllocatorAllocate& allocator = AllocatorInstance<FrameArenaAllocator>::Get();
+                for (int i = 0; i < numAllocations; ++i)
+                {
+                    char* ptr = reinterpret_cast<char*>(allocator.Allocate(allocationSize, 16));
+                    memset(ptr, threadIndex, allocationSize);
+                }
+                ++allocatedThreads;
+                while (!exitThreads)
+                {
+                    AZStd::this_thread::yield();
+                }
+            });
+        }
+        while (allocatedThreads < numThreads)
+        {
+            AZStd::this_thread::yield();
+        }
+
+        EXPECT_EQ(allocated + numThreads * numAllocations * allocationSize, GetFrameArena().NumAllocatedBytes());
+
+        exitThreads = true;
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // The arenas of the exited threads are released with their chunks
+        EXPECT_EQ(allocated, GetFrameArena().NumAllocatedBytes());
+        EXPECT_EQ(capacity, GetFrameArena().Capacity());
+    }
+}
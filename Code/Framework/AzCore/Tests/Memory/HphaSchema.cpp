@@ -8,6 +8,7 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -87,6 +88,97 @@ namespace UnitTest
         }
     }
 
+    class HphaSchemaMultithreadedTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(HphaSchemaMultithreadedTestFixture, AllocateAndFreeOnDifferentThreads_AllMemoryReturnedAfterGarbageCollect)
+    {
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocationsPerThread = 1000;
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations[numThreads];
+
+        AZStd::thread threads[numThreads];
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads[threadIndex] = AZStd::thread([&allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocationsPerThread; ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    void* allocation = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(allocationSize, 0);
+                    EXPECT_NE(nullptr, allocation);
+                    allocations[threadIndex].emplace_back(allocation);
+
+                    // Free every other allocation right away, so the thread reuses its own freed elements
+                    if (i % 2)
+                    {
+                        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[threadIndex].back(), allocationSize);
+                        allocations[threadIndex].pop_back();
+                    }
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Free the remaining allocations from another thread than the one that allocated them
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (void* allocation : allocations[threadIndex])
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocation);
+            }
+        }
+
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GarbageCollect();
+        EXPECT_EQ(0, AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaMultithreadedTestFixture, ManyShortLivedThreads_CachesReturnedAndReusedOnThreadExit)
+    {
+        auto allocateAndFree = []()
+        {
+            void* allocations[s_smallAllocationSizes.size()];
+            for (size_t i = 0; i < s_smallAllocationSizes.size(); ++i)
+            {
+                allocations[i] = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(s_smallAllocationSizes[i], 0);
+                EXPECT_NE(nullptr, allocations[i]);
+            }
+            for (size_t i = 0; i < s_smallAllocationSizes.size(); ++i)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[i], s_smallAllocationSizes[i]);
+            }
+        };
+        auto* schema = static_cast<AZ::HphaSchema*>(AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().GetSchema());
+
+        AZStd::thread(allocateAndFree).join();
+        const size_t numThreadCaches = schema->GetNumThreadCaches();
+        EXPECT_EQ(0, schema->NumAllocatedBytes());
+
+        // Without a GarbageCollect, exited threads return their cached elements and the next thread reuses their cache
+        constexpr size_t numThreads = 100;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            AZStd::thread(allocateAndFree).join();
+            EXPECT_EQ(0, schema->NumAllocatedBytes());
+            EXPECT_EQ(numThreadCaches, schema->GetNumThreadCaches());
+        }
+    }
+
     static const AZStd::array<HphaSchemaTestParameters, 2> s_smallInstancesParameters = {
          HphaSchemaTestParameters(s_smallAllocationSizes, 2),
          HphaSchemaTestParameters(s_smallAllocationSizes, 100)
@@ -122,14 +214,19 @@ namespace Benchmark
     public:
         void SetUp(const ::benchmark::State& state)
         {
-            AZ_UNUSED(state);
-            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+            // Multithreaded benchmarks share the allocator that the first thread creates
+            if (state.thread_index == 0)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+            }
         }
 
         void TearDown(const ::benchmark::State& state)
         {
-            AZ_UNUSED(state);
-            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            if (state.thread_index == 0)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            }
         }
 
         static void BM_Allocations(benchmark::State& state, const AllocationSizeArray& allocationArray)
@@ -177,6 +274,25 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Small allocations from several threads at once, each iteration allocates a batch and frees it again
+    BENCHMARK_DEFINE_F(HphaSchemaBenchmarkFixture, MultithreadedSmallAllocations)(benchmark::State& state)
+    {
+        AZStd::array<void*, 64> allocations;
+        while (state.KeepRunning())
+        {
+            for (size_t allocationIndex = 0; allocationIndex < allocations.size(); ++allocationIndex)
+            {
+                allocations[allocationIndex] = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().Allocate(s_smallAllocationSizes[allocationIndex % s_smallAllocationSizes.size()], 0);
+            }
+            for (size_t allocationIndex = 0; allocationIndex < allocations.size(); ++allocationIndex)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get().DeAllocate(allocations[allocationIndex], s_smallAllocationSizes[allocationIndex % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * allocations.size());
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaBenchmarkFixture, MultithreadedSmallAllocations)->ThreadRange(1, 8);
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
@@ -17,6 +17,7 @@
 #include <AzCore/Script/ScriptContext.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Name/Name.h>
+#include <AzCore/Name/NameLiteral.h>
 #include <AzCore/Name/Internal/NameData.h>
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Memory/MemoryComponent.h>
@@ -621,6 +622,104 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, LookupTable_ManyNamesCreatedAndReleased_AllNamesFoundByHash)
+    {
+        // Enough names to grow the lock free lookup table several times, and to shift entries back when names are released
+        constexpr int NameCount = 5000;
+
+        AZStd::vector<AZ::Name> names;
+        for (int i = 0; i < NameCount; ++i)
+        {
+            names.emplace_back(AZStd::string::format("name%d", i));
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), NameCount);
+
+        AZStd::vector<AZ::Name::Hash> releasedHashes;
+        for (int i = 0; i < NameCount; i += 2)
+        {
+            releasedHashes.push_back(names[i].GetHash());
+            names[i] = AZ::Name();
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), NameCount / 2);
+
+        for (int i = 1; i < NameCount; i += 2)
+        {
+            AZ::Name foundName = AZ::NameDictionary::Instance().FindName(names[i].GetHash());
+            EXPECT_EQ(foundName, names[i]);
+            EXPECT_EQ(foundName.GetStringView(), names[i].GetStringView());
+        }
+
+        for (AZ::Name::Hash hash : releasedHashes)
+        {
+            EXPECT_TRUE(AZ::NameDictionary::Instance().FindName(hash).IsEmpty());
+        }
+
+        // Released NameData is reused for new names
+        for (int i = 0; i < NameCount; i += 2)
+        {
+            names[i] = AZ::Name(AZStd::string::format("renamed%d", i));
+            EXPECT_EQ(AZ::NameDictionary::Instance().FindName(names[i].GetHash()).GetStringView(), names[i].GetStringView());
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), NameCount);
+    }
+
+    TEST_F(NameTest, NameLiteral_MatchesNameFromString)
+    {
+        AZ::NameLiteral nameLiteral{ "literal" };
+        EXPECT_EQ(nameLiteral.GetStringView(), "literal");
+
+        AZ::Name name{ "literal" };
+        EXPECT_EQ(nameLiteral.GetName(), name);
+        EXPECT_EQ(nameLiteral.GetName().GetStringView(), name.GetStringView());
+        EXPECT_EQ(AZ_NAME_LITERAL("literal"), name);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
+    TEST_F(NameTest, NameLiteral_EmptyLiteral_ReturnsEmptyName)
+    {
+        AZ::NameLiteral nameLiteral{ "" };
+        EXPECT_TRUE(nameLiteral.GetName().IsEmpty());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+    }
+
+    TEST_F(NameTest, NameLiteral_NameIsReleased_StaysInDictionary)
+    {
+        AZ::NameLiteral nameLiteral{ "literal" };
+        AZ::Name::Hash hash = nameLiteral.GetName().GetHash();
+
+        // The literal holds no reference, but its name is kept in the dictionary
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        EXPECT_EQ(AZ::NameDictionary::Instance().FindName(hash).GetStringView(), "literal");
+        EXPECT_EQ(nameLiteral.GetName().GetHash(), hash);
+    }
+
+    TEST_F(NameTest, NameLiteral_PreInternNames_AddsNamesToDictionary)
+    {
+        AZ::NameLiteral nameLiteralA{ "literalA" };
+        AZ::NameLiteral nameLiteralB{ "literalB" };
+        AZ::NameDictionary::Instance().PreInternNames({ &nameLiteralA, &nameLiteralB });
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+
+        EXPECT_EQ(nameLiteralA.GetName(), AZ::Name("literalA"));
+        EXPECT_EQ(nameLiteralB.GetName(), AZ::Name("literalB"));
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+    }
+
+    TEST_F(NameTest, NameLiteral_DictionaryIsRecreated_LiteralIsResolvedAgain)
+    {
+        AZ::NameLiteral nameLiteral{ "literal" };
+        nameLiteral.GetName();
+
+        AZ::NameDictionary::Destroy();
+        AZ::NameDictionary::Create();
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        AZ::Name name = nameLiteral.GetName();
+        EXPECT_EQ(name.GetStringView(), "literal");
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        EXPECT_EQ(AZ::NameDictionary::Instance().FindName(name.GetHash()), name);
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = AZ_TRAIT_UNIT_TEST_NAME_COUNT;
@@ -832,3 +931,114 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+//-------------------------------------------------------------------------
+// PERF TESTS
+//-------------------------------------------------------------------------
+
+#include <benchmark/benchmark.h>
+
+namespace Benchmark
+{
+    // Measures how Name creation scales with the number of threads using the dictionary.
+    // Thread 0 sets up the allocators and the dictionary, the other threads wait for it at the start of the benchmark loop.
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr size_t NameCount = 1024;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+
+                m_nameStrings = AZStd::make_unique<AZStd::vector<AZStd::string>>();
+                m_names = AZStd::make_unique<AZStd::vector<AZ::Name>>();
+                for (size_t i = 0; i < NameCount; ++i)
+                {
+                    m_nameStrings->push_back(AZStd::string::format("BenchmarkName%zu", i));
+                    m_names->emplace_back(m_nameStrings->back());
+                }
+            }
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            if (state.thread_index == 0)
+            {
+                m_names.reset();
+                m_nameStrings.reset();
+
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<AZStd::vector<AZStd::string>> m_nameStrings;
+        AZStd::unique_ptr<AZStd::vector<AZ::Name>> m_names; //< Keeps the names in the dictionary
+    };
+
+    // Every thread creates Names from strings that are already in the dictionary
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingName)(::benchmark::State& state)
+    {
+        size_t nameIndex = state.thread_index;
+        for (auto _ : state)
+        {
+            AZ::Name name((*m_nameStrings)[nameIndex % NameCount]);
+            ::benchmark::DoNotOptimize(name);
+            ++nameIndex;
+        }
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingName)->ThreadRange(1, 8)->ThreadPerCpu();
+
+    // Every thread looks up existing names by hash
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_FindName)(::benchmark::State& state)
+    {
+        size_t nameIndex = state.thread_index;
+        for (auto _ : state)
+        {
+            AZ::Name name = AZ::NameDictionary::Instance().FindName((*m_names)[nameIndex % NameCount].GetHash());
+            ::benchmark::DoNotOptimize(name);
+            ++nameIndex;
+        }
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_FindName)->ThreadRange(1, 8)->ThreadPerCpu();
+
+    // Thread 0 keeps adding and releasing new names, while the other threads create Names from strings that are already in the dictionary
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingNameWhileInserting)(::benchmark::State& state)
+    {
+        size_t nameIndex = state.thread_index;
+        for (auto _ : state)
+        {
+            if (state.thread_index == 0)
+            {
+                AZ::Name name(AZStd::string::format("NewBenchmarkName%zu", nameIndex));
+                ::benchmark::DoNotOptimize(name);
+            }
+            else
+            {
+                AZ::Name name((*m_nameStrings)[nameIndex % NameCount]);
+                ::benchmark::DoNotOptimize(name);
+            }
+            ++nameIndex;
+        }
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_MakeExistingNameWhileInserting)->ThreadRange(2, 8);
+
+    // Every thread gets the Name of the same literal, which only accesses the dictionary the first time
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameLiteral)(::benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::Name name = AZ_NAME_LITERAL("BenchmarkName0");
+            ::benchmark::DoNotOptimize(name);
+        }
+    }
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, BM_NameDictionary_NameLiteral)->ThreadRange(1, 8)->ThreadPerCpu();
+}
+
+#endif // HAVE_BENCHMARK
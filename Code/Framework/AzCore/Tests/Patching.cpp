@@ -455,6 +455,72 @@ namespace UnitTest
 
             AZStd::vector<ObjectBaseClass*> m_vectorOfBaseClasses;
         };
+
+        //! A value with a custom serializer that fails to load negative values, after it has written them.
+        struct ValueWithFailingLoad
+        {
+            AZ_TYPE_INFO(ValueWithFailingLoad, "{4C3F9C61-2A57-4E0B-9D43-6F0B6A1E27D4}");
+
+            int m_value = 0;
+        };
+
+        class ValueWithFailingLoadSerializer
+            : public SerializeContext::IDataSerializer
+        {
+        public:
+            size_t Save(const void* classPtr, IO::GenericStream& stream, bool /*isDataBigEndian*/) override
+            {
+                int value = reinterpret_cast<const ValueWithFailingLoad*>(classPtr)->m_value;
+                return static_cast<size_t>(stream.Write(sizeof(value), &value));
+            }
+
+            size_t DataToText(IO::GenericStream&, IO::GenericStream&, bool) override
+            {
+                return 0;
+            }
+
+            size_t TextToData(const char*, unsigned int, IO::GenericStream&, bool) override
+            {
+                return 0;
+            }
+
+            bool Load(void* classPtr, IO::GenericStream& stream, unsigned int /*version*/, bool /*isDataBigEndian*/) override
+            {
+                int value = 0;
+                if (stream.Read(sizeof(value), &value) != sizeof(value))
+                {
+                    return false;
+                }
+                reinterpret_cast<ValueWithFailingLoad*>(classPtr)->m_value = value;
+                return value >= 0;
+            }
+
+            bool CompareValueData(const void* lhs, const void* rhs) override
+            {
+                return reinterpret_cast<const ValueWithFailingLoad*>(lhs)->m_value == reinterpret_cast<const ValueWithFailingLoad*>(rhs)->m_value;
+            }
+        };
+
+        class ObjectWithFailingLoadValues
+        {
+        public:
+            AZ_TYPE_INFO(ObjectWithFailingLoadValues, "{B2E6A0D7-8F31-4A5C-93E2-1D7C5B84F6A9}");
+            AZ_CLASS_ALLOCATOR(ObjectWithFailingLoadValues, SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& sc)
+            {
+                sc.Class<ValueWithFailingLoad>()
+                    ->Serializer<ValueWithFailingLoadSerializer>();
+                sc.Class<ObjectWithFailingLoadValues>()
+                    ->Field("m_intValue", &ObjectWithFailingLoadValues::m_intValue)
+                    ->Field("m_firstValue", &ObjectWithFailingLoadValues::m_firstValue)
+                    ->Field("m_secondValue", &ObjectWithFailingLoadValues::m_secondValue);
+            }
+
+            int m_intValue = 0;
+            ValueWithFailingLoad m_firstValue;
+            ValueWithFailingLoad m_secondValue;
+        };
     }
 
     class PatchingTest
@@ -1252,6 +1318,184 @@ namespace UnitTest
             EXPECT_FALSE(patch.IsData());
         }
 
+        TEST_F(PatchingTest, CreateWithSourceCache_SameSourceDifferentTargets_DataPatchesApplyCorrectly)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_objectArray.resize(100);
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<int>(i + 10);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+            }
+
+            ObjectToPatch targetObj;
+            targetObj.m_objectArray.resize(sourceObj.m_objectArray.size());
+            for (size_t i = 0; i < targetObj.m_objectArray.size(); ++i)
+            {
+                targetObj.m_objectArray[i].m_persistentId = sourceObj.m_objectArray[i].m_persistentId;
+                targetObj.m_objectArray[i].m_data = sourceObj.m_objectArray[i].m_data;
+            }
+
+            DataPatch::SourceCache sourceCache;
+
+            // Only a single element differs from the source
+            targetObj.m_objectArray[42].m_data = 1;
+            DataPatch patch;
+            EXPECT_TRUE(patch.Create(sourceCache, &sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+
+            DataPatch uncachedPatch;
+            uncachedPatch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+            AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+            AZStd::unique_ptr<ObjectToPatch> uncachedGeneratedObj(uncachedPatch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+            ASSERT_TRUE(uncachedGeneratedObj);
+            ASSERT_EQ(targetObj.m_objectArray.size(), generatedObj->m_objectArray.size());
+            for (size_t i = 0; i < generatedObj->m_objectArray.size(); ++i)
+            {
+                EXPECT_EQ(targetObj.m_objectArray[i].m_data, generatedObj->m_objectArray[i].m_data);
+                EXPECT_EQ(uncachedGeneratedObj->m_objectArray[i].m_data, generatedObj->m_objectArray[i].m_data);
+            }
+
+            // Reusing the cached source for an updated target
+            targetObj.m_objectArray[42].m_data = sourceObj.m_objectArray[42].m_data;
+            targetObj.m_intValue = 7;
+            EXPECT_TRUE(patch.Create(sourceCache, &sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+            generatedObj.reset(patch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+            EXPECT_EQ(7, generatedObj->m_intValue);
+            EXPECT_EQ(sourceObj.m_objectArray[42].m_data, generatedObj->m_objectArray[42].m_data);
+
+            // Reverting all changes results in an empty patch
+            targetObj.m_intValue = sourceObj.m_intValue;
+            EXPECT_TRUE(patch.Create(sourceCache, &sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get()));
+            EXPECT_FALSE(patch.IsData());
+        }
+
+        TEST_F(PatchingTest, CreateWithSourceCache_CompareIdenticalWithForceOverride_DataPatchHasData)
+        {
+            ObjectToPatch sourceObj;
+            ObjectToPatch targetObj;
+
+            DataPatch::AddressType forceOverrideAddress;
+            forceOverrideAddress.emplace_back(AZ_CRC("m_intValue"));
+
+            DataPatch::FlagsMap targetFlagsMap;
+            targetFlagsMap.emplace(forceOverrideAddress, DataPatch::Flag::ForceOverrideSet);
+
+            DataPatch::SourceCache sourceCache;
+            DataPatch patch;
+            patch.Create(sourceCache, &sourceObj, &targetObj, DataPatch::FlagsMap(), targetFlagsMap, m_serializeContext.get());
+            EXPECT_TRUE(patch.IsData());
+        }
+
+        TEST_F(PatchingTest, ApplyInPlace_ValueOverrides_ObjectMatchesTarget)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_intValue = 101;
+            sourceObj.m_objectArray.resize(3);
+            sourceObj.m_objectArrayNoPersistentId.resize(3);
+            for (size_t i = 0; i < sourceObj.m_objectArray.size(); ++i)
+            {
+                sourceObj.m_objectArray[i].m_persistentId = static_cast<int>(i + 10);
+                sourceObj.m_objectArray[i].m_data = static_cast<int>(i + 200);
+                sourceObj.m_objectArrayNoPersistentId[i].m_data = static_cast<int>(i + 300);
+            }
+
+            ObjectToPatch targetObj;
+            targetObj.m_intValue = 5;
+            targetObj.m_objectArray.resize(3);
+            targetObj.m_objectArrayNoPersistentId.resize(3);
+            for (size_t i = 0; i < targetObj.m_objectArray.size(); ++i)
+            {
+                targetObj.m_objectArray[i].m_persistentId = sourceObj.m_objectArray[i].m_persistentId;
+                targetObj.m_objectArray[i].m_data = sourceObj.m_objectArray[i].m_data;
+                targetObj.m_objectArrayNoPersistentId[i].m_data = sourceObj.m_objectArrayNoPersistentId[i].m_data;
+            }
+            targetObj.m_objectArray[1].m_data = 42;
+            targetObj.m_objectArrayNoPersistentId[2].m_data = 43;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            EXPECT_TRUE(patch.ApplyInPlace(&sourceObj, m_serializeContext.get()));
+            EXPECT_EQ(targetObj.m_intValue, sourceObj.m_intValue);
+            for (size_t i = 0; i < targetObj.m_objectArray.size(); ++i)
+            {
+                EXPECT_EQ(targetObj.m_objectArray[i].m_persistentId, sourceObj.m_objectArray[i].m_persistentId);
+                EXPECT_EQ(targetObj.m_objectArray[i].m_data, sourceObj.m_objectArray[i].m_data);
+                EXPECT_EQ(targetObj.m_objectArrayNoPersistentId[i].m_data, sourceObj.m_objectArrayNoPersistentId[i].m_data);
+            }
+        }
+
+        TEST_F(PatchingTest, ApplyInPlace_PreventOverrideOnSource_ValueIsNotPatched)
+        {
+            ObjectToPatch sourceObj;
+            ObjectToPatch targetObj;
+            targetObj.m_intValue = 43;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            DataPatch::AddressType preventOverrideAddress;
+            preventOverrideAddress.emplace_back(AZ_CRC("m_intValue"));
+            DataPatch::FlagsMap sourceFlagsMap;
+            sourceFlagsMap.emplace(preventOverrideAddress, DataPatch::Flag::PreventOverrideSet);
+
+            EXPECT_TRUE(patch.ApplyInPlace(&sourceObj, m_serializeContext.get(), sourceFlagsMap));
+            EXPECT_EQ(0, sourceObj.m_intValue);
+        }
+
+        TEST_F(PatchingTest, ApplyInPlace_PatchAddsAndRemovesElements_ReturnsFalseAndObjectIsUnchanged)
+        {
+            ObjectToPatch sourceObj;
+            sourceObj.m_objectArray.resize(2);
+            sourceObj.m_objectArray[0].m_persistentId = 1;
+            sourceObj.m_objectArray[1].m_persistentId = 2;
+
+            ObjectToPatch targetObj;
+            targetObj.m_intValue = 5;
+            targetObj.m_objectArray.resize(2);
+            targetObj.m_objectArray[0].m_persistentId = 1;
+            targetObj.m_objectArray[1].m_persistentId = 3;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            EXPECT_FALSE(patch.ApplyInPlace(&sourceObj, m_serializeContext.get()));
+            EXPECT_EQ(0, sourceObj.m_intValue);
+            ASSERT_EQ(2u, sourceObj.m_objectArray.size());
+            EXPECT_EQ(2u, sourceObj.m_objectArray[1].m_persistentId);
+
+            // The full apply still handles the patch
+            AZStd::unique_ptr<ObjectToPatch> generatedObj(patch.Apply(&sourceObj, m_serializeContext.get()));
+            ASSERT_TRUE(generatedObj);
+            EXPECT_EQ(5, generatedObj->m_intValue);
+        }
+
+        TEST_F(PatchingTest, ApplyInPlace_ValueFailsToLoad_ReturnsFalseAndObjectIsUnchanged)
+        {
+            ObjectWithFailingLoadValues::Reflect(*m_serializeContext);
+
+            ObjectWithFailingLoadValues sourceObj;
+            sourceObj.m_intValue = 1;
+            sourceObj.m_firstValue.m_value = 2;
+            sourceObj.m_secondValue.m_value = 3;
+
+            // The patch order is unspecified, the values written before the one that fails to load have to be restored
+            ObjectWithFailingLoadValues targetObj;
+            targetObj.m_intValue = 10;
+            targetObj.m_firstValue.m_value = 20;
+            targetObj.m_secondValue.m_value = -1;
+
+            DataPatch patch;
+            patch.Create(&sourceObj, &targetObj, DataPatch::FlagsMap(), DataPatch::FlagsMap(), m_serializeContext.get());
+
+            EXPECT_FALSE(patch.ApplyInPlace(&sourceObj, m_serializeContext.get()));
+            EXPECT_EQ(1, sourceObj.m_intValue);
+            EXPECT_EQ(2, sourceObj.m_firstValue.m_value);
+            EXPECT_EQ(3, sourceObj.m_secondValue.m_value);
+        }
+
         TEST_F(PatchingTest, CompareIdenticalWithForceOverride_DataPatchHasData)
         {
             ObjectToPatch sourceObj;
@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 2;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 4_kib;
+    constexpr AZ::u32 TestMaxIOChannels = 8;
+    constexpr AZ::u32 TestMaxIOThreads = 4;
+    constexpr AZ::s32 TestOverCommit = 0;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux(TestMaxFileHandles, TestPhysicalSectorSize, TestLogicalSectorSize,
+                TestMaxIOChannels, TestMaxIOThreads, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr char s_dummyFilename[] = "Dummy.bin";
+        static constexpr char s_fileCharacter = 'F';
+        static constexpr char s_chunkCharacter = 'C';
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_dummyFilepath;
+        AZ::IO::RequestPath m_dummyRequestPath;
+        AZStd::shared_ptr<StreamStackEntry> m_storageDrive{};
+        AZ::IO::StreamerContext* m_context = nullptr;
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+            PrepareTestFilepath();
+        }
+
+        void SetUp() override
+        {
+            m_dummyRequestPath.InitFromAbsolutePath(m_dummyFilepath);
+            m_context = new AZ::IO::StreamerContext();
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_minimalReporting = true;
+            m_storageDrive = AZStd::make_shared<AZ::IO::StorageDriveLinux>(TestMaxFileHandles, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestMaxIOChannels, TestMaxIOThreads, TestOverCommit, options);
+            m_storageDrive->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            m_storageDrive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            AZ::IO::SystemFile::Delete(m_dummyFilepath.c_str());
+        }
+
+        // Create a file filled with a single character. If chunkOffset is non-zero, it will write in a specific
+        // character every chunkOffset bytes till the end of file.
+        void CreateDummyFile(size_t fileSize, size_t chunkOffset = 0)
+        {
+            SystemFile file;
+            ASSERT_TRUE(file.Open(m_dummyFilepath.c_str(), SystemFile::OpenMode::SF_OPEN_CREATE | SystemFile::OpenMode::SF_OPEN_READ_WRITE));
+
+            AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+            ::memset(buffer.get(), s_fileCharacter, fileSize);
+            if (chunkOffset != 0)
+            {
+                for (size_t offset = 0; offset < fileSize; offset += chunkOffset)
+                {
+                    buffer[offset] = s_chunkCharacter;
+                }
+            }
+            ASSERT_EQ(fileSize, file.Write(buffer.get(), fileSize));
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_storageDrive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_storageDrive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+    private:
+        void PrepareTestFilepath()
+        {
+            char exePath[AZ_MAX_PATH_LEN] = { 0 };
+            auto result = AZ::Utils::GetExecutablePath(exePath, AZ_MAX_PATH_LEN);
+            if (result.m_pathStored != AZ::Utils::ExecutablePathResult::Success)
+            {
+                return;
+            }
+
+            AZStd::string filePath(exePath);
+            if (result.m_pathIncludesFilename)
+            {
+                AZ::StringFunc::Path::StripFullName(filePath);
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), "TestFiles", filePath);
+            if (!AZ::IO::SystemFile::Exists(filePath.c_str()))
+            {
+                if (!AZ::IO::SystemFile::CreateDir(filePath.c_str()))
+                {
+                    return;
+                }
+            }
+            AZ::StringFunc::Path::Join(filePath.c_str(), s_dummyFilename, m_dummyFilepath);
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileExistsRequest_FileExists_ReturnsCompletedWithFileFound)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileExistsCheck(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileExistsCheck = AZStd::get<FileRequest::FileExistsCheckData>(request.GetCommand());
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                EXPECT_TRUE(fileExistsCheck.m_found);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileDoesntExist_ReturnsFalse)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(path);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_FALSE(fileMetaData.m_found);
+                EXPECT_EQ(0, fileMetaData.m_fileSize);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FileMetaDataRetrievalRequest_FileExists_ReportsAccurateFileSize)
+    {
+        CreateDummyFile(4_kib);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateFileMetaDataRetrieval(m_dummyRequestPath);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                auto& fileMetaData = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request.GetCommand());
+                EXPECT_TRUE(fileMetaData.m_found);
+                EXPECT_EQ(4_kib, fileMetaData.m_fileSize);
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_FileDoesNotExist_RequestFails)
+    {
+        AZ::IO::RequestPath path;
+        path.InitFromAbsolutePath(m_dummyFilepath + ".disappear");
+
+        char buffer[16];
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), path, 0, sizeof(buffer));
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Failed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_UnalignedOffsetAndSize_ReturnsCorrectDataAndDoesNotWriteMore)
+    {
+        constexpr AZ::u64 unalignedOffset = 40;
+        constexpr AZ::u64 numChunksToRead = 7;
+        constexpr AZ::u64 unalignedSize = unalignedOffset * numChunksToRead;
+        constexpr size_t bufferSize = unalignedSize + 4;
+        constexpr char unexpectedChar = 'Z';
+
+        char* buffer = reinterpret_cast<char*>(azmalloc(bufferSize, TestPhysicalSectorSize));
+        ::memset(buffer, unexpectedChar, bufferSize);
+
+        CreateDummyFile(16_kib, unalignedOffset);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, bufferSize, m_dummyRequestPath, unalignedOffset, unalignedSize);
+        request->SetCompletionCallback([](const FileRequest& request)
+            {
+                EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            });
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        for (size_t offset = 0; offset < numChunksToRead; ++offset)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[offset * unalignedOffset]);
+            EXPECT_EQ(s_fileCharacter, buffer[(offset * unalignedOffset) + 1]);
+        }
+        for (size_t i = unalignedSize; i < bufferSize; ++i)
+        {
+            EXPECT_EQ(unexpectedChar, buffer[i]);
+        }
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadDataRequest_MoreReadsThanChannels_AllReadsCompleteWithCorrectData)
+    {
+        constexpr size_t chunkSize = 4_kib;
+        constexpr size_t numReads = TestMaxIOChannels * 4;
+        CreateDummyFile(chunkSize * numReads, chunkSize);
+
+        AZStd::vector<AZStd::unique_ptr<char[]>> buffers;
+        size_t numCompleted = 0;
+        for (size_t i = 0; i < numReads; ++i)
+        {
+            buffers.emplace_back(new char[chunkSize]);
+            AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffers.back().get(), chunkSize, m_dummyRequestPath, i * chunkSize, chunkSize);
+            request->SetCompletionCallback([&numCompleted](const FileRequest& request)
+                {
+                    EXPECT_EQ(AZ::IO::IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+                    numCompleted++;
+                });
+            m_storageDrive->QueueRequest(request);
+        }
+
+        WaitTillCompleted();
+
+        EXPECT_EQ(numReads, numCompleted);
+        for (const AZStd::unique_ptr<char[]>& buffer : buffers)
+        {
+            EXPECT_EQ(s_chunkCharacter, buffer[0]);
+            EXPECT_EQ(s_fileCharacter, buffer[chunkSize - 1]);
+        }
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, CollectStatistics_AfterReads_ReportsQueueDepth)
+    {
+        constexpr size_t fileSize = 16_kib;
+        AZStd::unique_ptr<char[]> buffer(new char[fileSize]);
+        CreateDummyFile(fileSize);
+
+        AZ::IO::FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), fileSize, m_dummyRequestPath, 0, fileSize);
+        m_storageDrive->QueueRequest(request);
+        WaitTillCompleted();
+
+        AZStd::vector<Statistic> statistics;
+        m_storageDrive->CollectStatistics(statistics);
+        auto it = AZStd::find_if(statistics.begin(), statistics.end(),
+            [](const Statistic& statistic) { return statistic.GetName() == "Queue depth (avg.)"; });
+        EXPECT_NE(statistics.end(), it);
+    }
+} // namespace AZ::IO
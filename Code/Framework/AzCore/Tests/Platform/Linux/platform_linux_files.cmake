@@ -6,6 +6,7 @@
 #
 
 set(FILES
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
     Tests/UtilsTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
 )
@@ -1849,6 +1849,19 @@ TEST_F(SerializeBasicTest, BasicTypeTest_Succeed)
             IO::FileIOStream stream(testBinFilePath.c_str(), IO::OpenMode::ModeRead);
             TestLoad(&stream);
         }
+
+        // Compiled binary version
+        AZ::IO::Path testCompiledBinFilePath = serializeTestFilePath / "serializebasictest.cbin";
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Writing as Compiled Binary...\n");
+            IO::FileIOStream stream(testCompiledBinFilePath.c_str(), IO::OpenMode::ModeWrite);
+            TestSave(&stream, ObjectStream::ST_BINARY_COMPILED);
+        }
+        {
+            AZ_TracePrintf("SerializeBasicTest", "Loading as Compiled Binary...\n");
+            IO::FileIOStream stream(testCompiledBinFilePath.c_str(), IO::OpenMode::ModeRead);
+            TestLoad(&stream);
+        }
     }
     /*
     * Test serialization of built-in container types
@@ -4491,6 +4504,11 @@ namespace UnitTest
         TestFileUtilsStream(ObjectStream::ST_BINARY);
     }
 
+    TEST_F(SerializationFileUtil, TestFileUtilsStream_CompiledBinary)
+    {
+        TestFileUtilsStream(ObjectStream::ST_BINARY_COMPILED);
+    }
+
     TEST_F(SerializationFileUtil, DISABLED_TestFileUtilsFile_XML)
     {
         TestFileUtilsFile(ObjectStream::ST_XML);
@@ -7696,6 +7714,195 @@ namespace UnitTest
         EXPECT_EQ(ClassThatAllocatesMemoryInDefaultCtor::InstanceTracker::s_instanceCount, 0);
     }
 
+    namespace CompiledBinaryTest
+    {
+        struct RawPair
+        {
+            AZ_TYPE_INFO(RawPair, "{FA90A89F-0FCE-4237-8340-5715BD56BAD5}");
+            float m_x = 0.0f;
+            float m_y = 0.0f;
+        };
+
+        class Shape
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Shape, SystemAllocator, 0);
+            AZ_RTTI(Shape, "{7A83AE11-2767-4A1E-AF53-6EBC27B15A0A}");
+            virtual ~Shape() = default;
+
+            int m_id = 0;
+        };
+
+        class Circle
+            : public Shape
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Circle, SystemAllocator, 0);
+            AZ_RTTI(Circle, "{68BB5D77-ADC3-4C6B-8E56-58FC162F2827}", Shape);
+
+            float m_radius = 0.0f;
+        };
+
+        class Scene
+        {
+        public:
+            AZ_CLASS_ALLOCATOR(Scene, SystemAllocator, 0);
+            AZ_TYPE_INFO(Scene, "{03563323-4702-4924-88D5-B8E0F971D4A4}");
+
+            ~Scene()
+            {
+                delete m_mainShape;
+                for (Shape* shape : m_shapes)
+                {
+                    delete shape;
+                }
+            }
+
+            AZStd::string m_name;
+            AZStd::vector<int> m_indices;
+            AZStd::vector<RawPair> m_points;
+            AZStd::array<float, 3> m_color = { { 0.0f, 0.0f, 0.0f } };
+            AZStd::unordered_map<AZStd::string, int> m_lookup;
+            AZStd::vector<Shape*> m_shapes;
+            Shape* m_mainShape = nullptr;
+            AZ::Uuid m_uuid = AZ::Uuid::CreateNull();
+            bool m_flag = false;
+        };
+
+        void Reflect(SerializeContext& sc, const char* rawPairYFieldName = "y")
+        {
+            sc.Class<RawPair>()
+                ->Field("x", &RawPair::m_x)
+                ->Field(rawPairYFieldName, &RawPair::m_y);
+            sc.Class<Shape>()
+                ->Field("id", &Shape::m_id);
+            sc.Class<Circle, Shape>()
+                ->Field("radius", &Circle::m_radius);
+            sc.Class<Scene>()
+                ->Field("name", &Scene::m_name)
+                ->Field("indices", &Scene::m_indices)
+                ->Field("points", &Scene::m_points)
+                ->Field("color", &Scene::m_color)
+                ->Field("lookup", &Scene::m_lookup)
+                ->Field("shapes", &Scene::m_shapes)
+                ->Field("mainShape", &Scene::m_mainShape)
+                ->Field("uuid", &Scene::m_uuid)
+                ->Field("flag", &Scene::m_flag);
+        }
+
+        void FillScene(Scene& scene)
+        {
+            scene.m_name = "Compiled";
+            for (int i = 0; i < 1000; ++i)
+            {
+                scene.m_indices.push_back(i * 3);
+            }
+            scene.m_points.resize(2);
+            scene.m_points[0].m_x = 1.0f;
+            scene.m_points[0].m_y = 2.0f;
+            scene.m_points[1].m_x = 3.0f;
+            scene.m_points[1].m_y = 4.0f;
+            scene.m_color = { { 0.25f, 0.5f, 0.75f } };
+            scene.m_lookup["one"] = 1;
+            scene.m_lookup["two"] = 2;
+            Circle* circle = aznew Circle();
+            circle->m_id = 7;
+            circle->m_radius = 2.5f;
+            scene.m_shapes.push_back(circle);
+            scene.m_shapes.push_back(aznew Shape());
+            scene.m_shapes.back()->m_id = 8;
+            scene.m_mainShape = aznew Circle();
+            scene.m_mainShape->m_id = 9;
+            scene.m_uuid = AZ::Uuid::CreateString("{9445969C-C586-444D-A2C4-0EC966E3809F}");
+            scene.m_flag = true;
+        }
+    }
+
+    TEST_F(Serialization, CompiledBinary_SaveAndLoad_MatchesSavedObject)
+    {
+        using namespace CompiledBinaryTest;
+        Reflect(*GetSerializeContext());
+
+        Scene scene;
+        FillScene(scene);
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(stream, ObjectStream::ST_BINARY_COMPILED, &scene, GetSerializeContext()));
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+        AZStd::unique_ptr<Scene> loaded(AZ::Utils::LoadObjectFromStream<Scene>(stream, GetSerializeContext()));
+        ASSERT_NE(nullptr, loaded);
+        EXPECT_EQ(scene.m_name, loaded->m_name);
+        EXPECT_EQ(scene.m_indices, loaded->m_indices);
+        ASSERT_EQ(scene.m_points.size(), loaded->m_points.size());
+        EXPECT_EQ(3.0f, loaded->m_points[1].m_x);
+        EXPECT_EQ(4.0f, loaded->m_points[1].m_y);
+        EXPECT_EQ(scene.m_color, loaded->m_color);
+        EXPECT_EQ(scene.m_lookup, loaded->m_lookup);
+        EXPECT_EQ(scene.m_uuid, loaded->m_uuid);
+        EXPECT_TRUE(loaded->m_flag);
+
+        ASSERT_EQ(2, loaded->m_shapes.size());
+        Circle* circle = azrtti_cast<Circle*>(loaded->m_shapes[0]);
+        ASSERT_NE(nullptr, circle);
+        EXPECT_EQ(7, circle->m_id);
+        EXPECT_EQ(2.5f, circle->m_radius);
+        EXPECT_EQ(nullptr, azrtti_cast<Circle*>(loaded->m_shapes[1]));
+        EXPECT_EQ(8, loaded->m_shapes[1]->m_id);
+        ASSERT_NE(nullptr, azrtti_cast<Circle*>(loaded->m_mainShape));
+        EXPECT_EQ(9, loaded->m_mainShape->m_id);
+    }
+
+    TEST_F(Serialization, CompiledBinary_LoadInPlace_ReplacesContainerElements)
+    {
+        using namespace CompiledBinaryTest;
+        Reflect(*GetSerializeContext());
+
+        AZStd::vector<int> saved = { 1, 2, 3 };
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(stream, ObjectStream::ST_BINARY_COMPILED, &saved, GetSerializeContext()));
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+        AZStd::vector<int> loaded = { 7, 8, 9, 10, 11 };
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, GetSerializeContext()));
+        EXPECT_EQ(saved, loaded);
+    }
+
+    TEST_F(Serialization, CompiledBinary_ReflectionChanged_FailsToLoad)
+    {
+        using namespace CompiledBinaryTest;
+        Reflect(*GetSerializeContext());
+
+        Scene scene;
+        FillScene(scene);
+
+        AZStd::vector<char> buffer;
+        IO::ByteContainerStream<AZStd::vector<char> > stream(&buffer);
+        EXPECT_TRUE(AZ::Utils::SaveObjectToStream(stream, ObjectStream::ST_BINARY_COMPILED, &scene, GetSerializeContext()));
+        stream.Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
+
+        // The compiled format has no version conversion, a change in the reflection of a nested trivially copyable class must be detected.
+        SerializeContext changedContext;
+        Reflect(changedContext, "z");
+
+        int loadedCount = 0;
+        ObjectStream::ClassReadyCB readyCB([&loadedCount](void* classPtr, const Uuid&, SerializeContext*)
+        {
+            ++loadedCount;
+            delete reinterpret_cast<Scene*>(classPtr);
+        });
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        EXPECT_FALSE(ObjectStream::LoadBlocking(&stream, changedContext, readyCB));
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+        EXPECT_EQ(0, loadedCount);
+
+        changedContext.EnableRemoveReflection();
+        Reflect(changedContext, "z");
+        changedContext.DisableRemoveReflection();
+    }
+
     // Test that loading containers in-place clears any existing data in the
     // containers (
     template <typename T>
@@ -7,7 +7,11 @@
 
 #include <AzCore/PlatformDef.h>
 
+#include <AzCore/IO/ByteContainerStream.h>
+#include <AzCore/IO/GenericStreams.h>
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/JSON/stringbuffer.h>
+#include <AzCore/JSON/writer.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -204,6 +208,80 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithoutDefaults_SucceedsAndObjectMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithoutDefaults();
+        AZ::IO::MemoryStream stream(description.m_json, strlen(description.m_json));
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, stream, *this->m_deserializationSettings);
+        ASSERT_EQ(Outcomes::Success, loadResult.GetOutcome());
+        EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, LoadFromStream_JsonWithAdditionalFields_ObjectMatchesLoadFromValue)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        this->m_jsonDocument->Parse(description.m_jsonWithStrippedDefaults);
+        this->InjectAdditionalFields(*this->m_jsonDocument, rapidjson::kStringType, this->m_jsonDocument->GetAllocator());
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        this->m_jsonDocument->Accept(writer);
+        AZ::IO::MemoryStream stream(buffer.GetString(), buffer.GetSize());
+
+        TypeParam expectedInstance;
+        ResultCode expectedResult = AZ::JsonSerialization::Load(expectedInstance, *this->m_jsonDocument, *this->m_deserializationSettings);
+
+        TypeParam loadInstance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(loadInstance, stream, *this->m_deserializationSettings);
+        EXPECT_EQ(expectedResult.GetOutcome(), loadResult.GetOutcome());
+        EXPECT_EQ(expectedResult.GetProcessing(), loadResult.GetProcessing());
+        EXPECT_TRUE(loadInstance.Equals(expectedInstance, this->m_fullyReflected));
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, StoreToStream_SerializeWithSomeDefaults_StoredSuccessfullyAndJsonMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        this->m_serializationSettings->m_keepDefaults = false;
+
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        AZStd::string json;
+        AZ::IO::ByteContainerStream<AZStd::string> stream(&json);
+        ResultCode result = AZ::JsonSerialization::Store(stream, *description.m_instance, *this->m_serializationSettings);
+
+        bool partialDefaultsSupported = TypeParam::SupportsPartialDefaults;
+        EXPECT_EQ(partialDefaultsSupported ? Outcomes::PartialDefaults : Outcomes::DefaultsUsed, result.GetOutcome());
+        this->m_jsonDocument->Parse(json.c_str(), json.size());
+        ASSERT_FALSE(this->m_jsonDocument->HasParseError());
+        this->Expect_DocStrEq(description.m_jsonWithStrippedDefaults);
+    }
+
+    TYPED_TEST(TypedJsonSerializationTests, StoreToStream_SerializeWithSomeDefaultsKept_StoredSuccessfullyAndJsonMatches)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        this->m_serializationSettings->m_keepDefaults = true;
+
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        AZStd::string json;
+        AZ::IO::ByteContainerStream<AZStd::string> stream(&json);
+        ResultCode result = AZ::JsonSerialization::Store(stream, *description.m_instance, *this->m_serializationSettings);
+
+        EXPECT_EQ(Outcomes::Success, result.GetOutcome());
+        this->m_jsonDocument->Parse(json.c_str(), json.size());
+        ASSERT_FALSE(this->m_jsonDocument->HasParseError());
+        this->Expect_DocStrEq(description.m_jsonWithKeptDefaults);
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -333,6 +411,37 @@ namespace JsonSerializationTests
         EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
     }
 
+    TEST_F(JsonSerializationTests, LoadFromStream_MalformedJson_ReturnsCatastrophic)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+        const char json[] = R"({ "var1": 88, "var2": )";
+        AZ::IO::MemoryStream stream(json, sizeof(json) - 1);
+
+        SimpleClass instance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Catastrophic, loadResult.GetOutcome());
+
+        m_serializeContext->EnableRemoveReflection();
+        SimpleClass::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(JsonSerializationTests, LoadFromStream_InvalidPointerName_FailsToConvert)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        ComplexNullInheritedPointer::Reflect(m_serializeContext, true);
+        const char json[] = R"({ "pointer": { "$type": "Invalid" } })";
+        AZ::IO::MemoryStream stream(json, sizeof(json) - 1);
+
+        ComplexNullInheritedPointer instance;
+        ResultCode loadResult = AZ::JsonSerialization::Load(instance, stream, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Unknown, loadResult.GetOutcome());
+        EXPECT_EQ(Processing::Halted, loadResult.GetProcessing());
+    }
+
     // Store
 
     TEST_F(JsonSerializationTests, Store_PrimitiveAtTheRoot_ReturnsSuccessAndTheValueAtTheRoot)
@@ -565,4 +674,87 @@ namespace JsonSerializationTests
 
         EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
     }
+
+    TEST_F(JsonSerializationTests, Load_ReflectionChangedBetweenLoads_UsesUpdatedReflection)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleClass::Reflect(m_serializeContext, true);
+        m_jsonDocument->Parse(R"({ "var1": 88, "var2": 88.0 })");
+
+        SimpleClass instance;
+        ResultCode result = AZ::JsonSerialization::Load(instance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Success, result.GetOutcome());
+        EXPECT_EQ(88, instance.m_var1);
+        EXPECT_FLOAT_EQ(88.0f, instance.m_var2);
+
+        // Reflect the class again with fewer fields to make sure the information that was cached during the first load isn't used.
+        m_serializeContext->EnableRemoveReflection();
+        SimpleClass::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+        m_serializeContext->Class<SimpleClass>()
+            ->Field("var1", &SimpleClass::m_var1);
+
+        SimpleClass secondInstance;
+        result = AZ::JsonSerialization::Load(secondInstance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Skipped, result.GetOutcome());
+        EXPECT_EQ(88, secondInstance.m_var1);
+        EXPECT_FLOAT_EQ(SimpleClass{}.m_var2, secondInstance.m_var2);
+
+        m_serializeContext->EnableRemoveReflection();
+        SimpleClass::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(JsonSerializationTests, Load_InvalidValueInBaseClass_ReportsPathToValue)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        SimpleInheritence::Reflect(m_serializeContext, true);
+        m_jsonDocument->Parse(R"({ "var1": 88, "base_var": [ 42 ] })");
+
+        AZStd::string reportedPath;
+        m_deserializationSettings->m_reporting = [&reportedPath](AZStd::string_view, ResultCode result, AZStd::string_view path)
+        {
+            if (result.GetOutcome() != Outcomes::Success && reportedPath.empty())
+            {
+                reportedPath = path;
+            }
+            return result;
+        };
+
+        SimpleInheritence instance;
+        AZ::JsonSerialization::Load(instance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(88, instance.m_var1);
+        EXPECT_STREQ("base_var", reportedPath.c_str());
+
+        m_serializeContext->EnableRemoveReflection();
+        SimpleInheritence::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+    }
+
+    TEST_F(JsonSerializationTests, GetSerializationPlan_ClassWithBaseClass_IncludesBaseClassFields)
+    {
+        SimpleInheritence::Reflect(m_serializeContext, true);
+
+        const AZ::SerializeContext::ClassData* classData = m_serializeContext->FindClassData(azrtti_typeid<SimpleInheritence>());
+        ASSERT_NE(nullptr, classData);
+        const AZ::JsonSerializationPlan& plan = m_jsonRegistrationContext->GetSerializationPlan(*m_serializeContext, *classData);
+        EXPECT_EQ(&plan, &m_jsonRegistrationContext->GetSerializationPlan(*m_serializeContext, *classData));
+
+        EXPECT_EQ(3u, plan.m_elementCount);
+        SimpleInheritence instance;
+        const AZ::JsonSerializationPlan::NamedField* baseField = plan.FindField(AZ::Crc32("base_var"));
+        ASSERT_NE(nullptr, baseField);
+        EXPECT_EQ(static_cast<size_t>(reinterpret_cast<char*>(&instance.m_baseVar) - reinterpret_cast<char*>(&instance)), baseField->m_offset);
+        const AZ::JsonSerializationPlan::NamedField* field = plan.FindField(AZ::Crc32("var1"));
+        ASSERT_NE(nullptr, field);
+        EXPECT_EQ(static_cast<size_t>(reinterpret_cast<char*>(&instance.m_var1) - reinterpret_cast<char*>(&instance)), field->m_offset);
+        EXPECT_NE(nullptr, field->m_field->m_serializer);
+        EXPECT_EQ(nullptr, plan.FindField(AZ::Crc32("var3")));
+
+        m_serializeContext->EnableRemoveReflection();
+        SimpleInheritence::Reflect(m_serializeContext, true);
+        m_serializeContext->DisableRemoveReflection();
+    }
 } // namespace JsonSerializationTests
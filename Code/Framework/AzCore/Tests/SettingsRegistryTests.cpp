@@ -12,6 +12,8 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -714,6 +716,175 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, type);
     }
 
+    //
+    // KeyHandle
+    //
+
+    TEST_F(SettingsRegistryTest, KeyHandle_ParsePath_TokensMatchPath)
+    {
+        AZ::SettingsRegistryInterface::KeyHandle key("/Object/Array/12/Value");
+        ASSERT_TRUE(key.IsValid());
+        ASSERT_EQ(4, key.GetTokenCount());
+        EXPECT_EQ("Object", key.GetTokenName(0));
+        EXPECT_EQ("Array", key.GetTokenName(1));
+        EXPECT_EQ("12", key.GetTokenName(2));
+        EXPECT_EQ(12, key.GetTokenIndex(2));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::KeyHandle::NotAnIndex, key.GetTokenIndex(3));
+    }
+
+    TEST_F(SettingsRegistryTest, KeyHandle_EscapedCharacters_TokensAreUnescaped)
+    {
+        AZ::SettingsRegistryInterface::KeyHandle key("/a~1b/c~0d");
+        ASSERT_TRUE(key.IsValid());
+        ASSERT_EQ(2, key.GetTokenCount());
+        EXPECT_EQ("a/b", key.GetTokenName(0));
+        EXPECT_EQ("c~d", key.GetTokenName(1));
+    }
+
+    TEST_F(SettingsRegistryTest, KeyHandle_EmptyPath_ReferencesRoot)
+    {
+        AZ::SettingsRegistryInterface::KeyHandle key("");
+        EXPECT_TRUE(key.IsValid());
+        EXPECT_EQ(0, key.GetTokenCount());
+    }
+
+    TEST_F(SettingsRegistryTest, KeyHandle_InvalidPath_IsNotValid)
+    {
+        EXPECT_FALSE(AZ::SettingsRegistryInterface::KeyHandle("#$%").IsValid());
+        EXPECT_FALSE(AZ::SettingsRegistryInterface::KeyHandle("Object/Value").IsValid());
+        EXPECT_FALSE(AZ::SettingsRegistryInterface::KeyHandle("/Object/~2").IsValid());
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_ValuesInRegistry_MatchesGetWithPath)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(
+            R"({ "Object": { "Bool": true, "Int": -42, "Double": 4.2, "String": "hello", "Array": [ 1, 2, 3 ] } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        bool boolValue = false;
+        EXPECT_TRUE(m_registry->Get(boolValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/Bool")));
+        EXPECT_TRUE(boolValue);
+        AZ::s64 intValue = 0;
+        EXPECT_TRUE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/Int")));
+        EXPECT_EQ(-42, intValue);
+        double doubleValue = 0.0;
+        EXPECT_TRUE(m_registry->Get(doubleValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/Double")));
+        EXPECT_DOUBLE_EQ(4.2, doubleValue);
+        AZ::SettingsRegistryInterface::FixedValueString stringValue;
+        EXPECT_TRUE(m_registry->Get(stringValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/String")));
+        EXPECT_STREQ("hello", stringValue.c_str());
+        AZ::u64 arrayValue = 0;
+        EXPECT_TRUE(m_registry->Get(arrayValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/Array/2")));
+        EXPECT_EQ(3, arrayValue);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, m_registry->GetType(AZ::SettingsRegistryInterface::KeyHandle("/Object/Array")));
+        EXPECT_FALSE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/Array/3")));
+        EXPECT_FALSE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("/Object/String")));
+        EXPECT_FALSE(m_registry->Get(intValue, AZ::SettingsRegistryInterface::KeyHandle("#$%")));
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_ValueChangedAfterMerge_ReturnsNewValue)
+    {
+        const AZ::SettingsRegistryInterface::KeyHandle key("/Object/Value");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(42, value);
+
+        ASSERT_TRUE(m_registry->Set("/Object/Value", aznumeric_cast<AZ::s64>(84)));
+        EXPECT_TRUE(m_registry->Get(value, key));
+        EXPECT_EQ(84, value);
+
+        ASSERT_TRUE(m_registry->Remove("/Object/Value"));
+        EXPECT_FALSE(m_registry->Get(value, key));
+    }
+
+    //
+    // Snapshot
+    //
+
+    TEST_F(SettingsRegistryTest, GetSnapshot_SettingsChangedAfterSnapshot_SnapshotIsUnchanged)
+    {
+        const AZ::SettingsRegistryInterface::KeyHandle key("/Object/Value");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZ::SettingsRegistryImpl::SnapshotPtr snapshot = m_registry->GetSnapshot();
+        ASSERT_NE(nullptr, snapshot);
+
+        ASSERT_TRUE(m_registry->Set("/Object/Value", aznumeric_cast<AZ::s64>(84)));
+        AZ::SettingsRegistryImpl::SnapshotPtr newSnapshot = m_registry->GetSnapshot();
+        ASSERT_NE(nullptr, newSnapshot);
+        EXPECT_LT(snapshot->GetVersion(), newSnapshot->GetVersion());
+
+        const rapidjson::Value* value = snapshot->Find(key);
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(42, value->GetInt64());
+        value = newSnapshot->Find(key);
+        ASSERT_NE(nullptr, value);
+        EXPECT_EQ(84, value->GetInt64());
+    }
+
+    TEST_F(SettingsRegistryTest, GetSnapshot_SettingsUnchanged_ReturnsSameSnapshot)
+    {
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "Value": 42 } })", AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        AZ::SettingsRegistryImpl::SnapshotPtr snapshot = m_registry->GetSnapshot();
+        EXPECT_EQ(snapshot, m_registry->GetSnapshot());
+    }
+
+    TEST_F(SettingsRegistryTest, GetWithKeyHandle_ReadWhileMerging_ReadsConsistentValues)
+    {
+        constexpr size_t ReaderCount = 4;
+        constexpr AZ::s64 MergeCount = 200;
+        const AZ::SettingsRegistryInterface::KeyHandle firstKey("/Object/First");
+        const AZ::SettingsRegistryInterface::KeyHandle secondKey("/Object/Second");
+        ASSERT_TRUE(m_registry->MergeSettings(R"({ "Object": { "First": 0, "Second": 0 } })",
+            AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+
+        AZStd::atomic_bool isMerging{ true };
+        AZStd::atomic_int mismatchCount{ 0 };
+        auto reader = [&]()
+        {
+            while (isMerging)
+            {
+                // Both values are changed by the same merge, so a snapshot never contains one without the other.
+                AZ::SettingsRegistryImpl::SnapshotPtr snapshot = m_registry->GetSnapshot();
+                const rapidjson::Value* first = snapshot->Find(firstKey);
+                const rapidjson::Value* second = snapshot->Find(secondKey);
+                if (!first || !second || first->GetInt64() != second->GetInt64())
+                {
+                    ++mismatchCount;
+                }
+
+                AZ::s64 value = -1;
+                if (!m_registry->Get(value, firstKey) || value < 0 || value > MergeCount)
+                {
+                    ++mismatchCount;
+                }
+            }
+        };
+
+        AZStd::vector<AZStd::thread> readers;
+        for (size_t i = 0; i < ReaderCount; ++i)
+        {
+            readers.emplace_back(reader);
+        }
+        for (AZ::s64 i = 1; i <= MergeCount; ++i)
+        {
+            AZStd::string patch = AZStd::string::format(R"({ "Object": { "First": %lld, "Second": %lld } })",
+                static_cast<long long>(i), static_cast<long long>(i));
+            EXPECT_TRUE(m_registry->MergeSettings(patch, AZ::SettingsRegistryInterface::Format::JsonMergePatch));
+        }
+        isMerging = false;
+        for (AZStd::thread& thread : readers)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(0, mismatchCount);
+        AZ::s64 value = 0;
+        EXPECT_TRUE(m_registry->Get(value, firstKey));
+        EXPECT_EQ(MergeCount, value);
+    }
+
     //
     // Visit
     //
@@ -1755,4 +1926,166 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_ManyFiles_FilesAppliedInAlphabeticOrder)
+    {
+        // Enough files to be loaded on multiple threads
+        constexpr int FileCount = 64;
+        for (int i = 0; i < FileCount; ++i)
+        {
+            CreateTestFile(AZStd::string::format("File%02d.setreg", i), AZStd::string::format(R"({ "Last": %d, "File%02d": true })", i, i));
+        }
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        EXPECT_TRUE(m_registry->MergeSettingsFolder(*m_testFolder, {}, {}, nullptr));
+
+        AZ::s64 last = -1;
+        EXPECT_TRUE(m_registry->Get(last, "/Last"));
+        EXPECT_EQ(FileCount - 1, last);
+        for (int i = 0; i < FileCount; ++i)
+        {
+            bool value = false;
+            EXPECT_TRUE(m_registry->Get(value, AZStd::string::format("/File%02d", i)));
+            AZStd::string history;
+            EXPECT_TRUE(m_registry->Get(history, AZStd::string::format(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/%d", i + 1)));
+            EXPECT_TRUE(history.ends_with(AZStd::string::format("File%02d.setreg", i)));
+        }
+    }
+
+    //
+    // MergeSettingsFolders
+    //
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolders_MultipleFolders_FoldersAppliedInOrder)
+    {
+        CreateTestFile("GemA/Memory.setreg", R"({ "Memory": 0, "GemA": true })");
+        CreateTestFile("GemA/Memory.editor.setreg", R"({ "Memory": 1 })");
+        CreateTestFile("GemB/Memory.setreg", R"({ "Memory": 2, "GemB": true })");
+        CreateTestFile("GemC/Memory.setreg", R"({ "Memory": 3, "GemC": true })");
+
+        AZStd::string registryFolder = AZStd::string::format("%s/%s/", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        AZStd::string gemA = registryFolder + "GemA";
+        AZStd::string gemB = registryFolder + "GemB";
+        AZStd::string gemC = registryFolder + "GemC";
+        EXPECT_TRUE(m_registry->MergeSettingsFolders({ gemA, gemC, gemB }, { "editor" }, {}, "", nullptr));
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(m_registry->Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+        bool value = false;
+        EXPECT_TRUE(m_registry->Get(value, "/GemA"));
+        EXPECT_TRUE(m_registry->Get(value, "/GemB"));
+        EXPECT_TRUE(m_registry->Get(value, "/GemC"));
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolders_OneFolderHasConflicts_OtherFoldersAreMerged)
+    {
+        CreateTestFile("GemA/Memory.test.editor.setreg", "{}");
+        CreateTestFile("GemA/Memory.editor.test.setreg", "{}");
+        CreateTestFile("GemB/Memory.setreg", R"({ "Memory": 2 })");
+
+        AZStd::string registryFolder = AZStd::string::format("%s/%s/", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        AZStd::string gemA = registryFolder + "GemA";
+        AZStd::string gemB = registryFolder + "GemB";
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        bool result = m_registry->MergeSettingsFolders({ gemA, gemB }, { "editor", "test" }, {}, "", nullptr);
+        EXPECT_GT(::UnitTest::TestRunner::Instance().StopAssertTests(), 0);
+        EXPECT_FALSE(result);
+
+        AZ::s64 memory = -1;
+        EXPECT_TRUE(m_registry->Get(memory, "/Memory"));
+        EXPECT_EQ(2, memory);
+    }
+
+    //
+    // MergeCache
+    //
+
+    TEST_F(SettingsRegistryTest, ReadMergeCache_FilesUnchanged_SettingsRestored)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1, "Name": "test", "Array": [ 1.5, -2, true, null ] })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}, "", nullptr));
+
+        AZStd::string cachePath = AZStd::string::format("%s/Cache/test.setregcache", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->WriteMergeCache(cachePath.c_str(), "key"));
+
+        AZ::SettingsRegistryImpl registry;
+        ASSERT_TRUE(registry.ReadMergeCache(cachePath.c_str(), "key"));
+        AZ::s64 memory = 0;
+        EXPECT_TRUE(registry.Get(memory, "/Memory"));
+        EXPECT_EQ(1, memory);
+        AZStd::string name;
+        EXPECT_TRUE(registry.Get(name, "/Name"));
+        EXPECT_STREQ("test", name.c_str());
+        double floatingPoint = 0.0;
+        EXPECT_TRUE(registry.Get(floatingPoint, "/Array/0"));
+        EXPECT_DOUBLE_EQ(1.5, floatingPoint);
+        AZ::s64 integer = 0;
+        EXPECT_TRUE(registry.Get(integer, "/Array/1"));
+        EXPECT_EQ(-2, integer);
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Boolean, registry.GetType("/Array/2"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Null, registry.GetType("/Array/3"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::Array, registry.GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY));
+    }
+
+    TEST_F(SettingsRegistryTest, ReadMergeCache_DifferentKey_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}, "", nullptr));
+
+        AZStd::string cachePath = AZStd::string::format("%s/Cache/test.setregcache", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->WriteMergeCache(cachePath.c_str(), "key"));
+
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.ReadMergeCache(cachePath.c_str(), "other key"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry.GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistryTest, ReadMergeCache_FileAddedToFolder_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}, "", nullptr));
+
+        AZStd::string cachePath = AZStd::string::format("%s/Cache/test.setregcache", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->WriteMergeCache(cachePath.c_str(), "key"));
+
+        CreateTestFile("Memory2.setreg", R"({ "Memory": 2 })");
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.ReadMergeCache(cachePath.c_str(), "key"));
+    }
+
+    TEST_F(SettingsRegistryTest, ReadMergeCache_FileChanged_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}, "", nullptr));
+
+        AZStd::string cachePath = AZStd::string::format("%s/Cache/test.setregcache", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->WriteMergeCache(cachePath.c_str(), "key"));
+
+        // A different size is detected even if the modification time has a low resolution
+        CreateTestFile("Memory.setreg", R"({ "Memory": 12 })");
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.ReadMergeCache(cachePath.c_str(), "key"));
+    }
+
+    TEST_F(SettingsRegistryTest, ReadMergeCache_FileChangedWithSameSize_ReturnsFalse)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 1 })");
+        AZStd::string registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+        ASSERT_TRUE(m_registry->MergeSettingsFolder(registryFolder, {}, {}, "", nullptr));
+
+        AZStd::string cachePath = AZStd::string::format("%s/Cache/test.setregcache", m_testFolder->c_str());
+        ASSERT_TRUE(m_registry->WriteMergeCache(cachePath.c_str(), "key"));
+
+        // The edit keeps the size and usually lands within the same modification time tick, so only the content hash catches it
+        CreateTestFile("Memory.setreg", R"({ "Memory": 2 })");
+        AZ::SettingsRegistryImpl registry;
+        EXPECT_FALSE(registry.ReadMergeCache(cachePath.c_str(), "key"));
+    }
 } // namespace SettingsRegistryTests
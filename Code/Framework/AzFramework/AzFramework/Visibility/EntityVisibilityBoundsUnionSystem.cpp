@@ -90,19 +90,28 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
 
+        if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+            visibilitySystem && UpdateVisibilityEntryBounds(entity, instance))
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+        }
+    }
+
+    bool EntityVisibilityBoundsUnionSystem::UpdateVisibilityEntryBounds(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance)
+    {
         if (const auto& localEntityBoundsUnions = instance.m_localEntityBoundsUnion; localEntityBoundsUnions.IsValid())
         {
             // note: worldEntityBounds will not be a 'tight-fit' Aabb but that of a transformed local aabb
             // there will be some wasted space but it should be sufficient for the visibility system
             AZ::TransformInterface* transformInterface = entity->GetTransform();
             const AZ::Aabb worldEntityBoundsUnion = localEntityBoundsUnions.GetTransformedAabb(transformInterface->GetWorldTM());
-            IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
-            if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
+            if (!worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
-                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+                return true;
             }
         }
+        return false;
     }
 
     void EntityVisibilityBoundsUnionSystem::RefreshEntityLocalBoundsUnion(const AZ::EntityId entityId)
@@ -137,17 +146,30 @@ namespace AzFramework
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::AzFramework);
 
+        IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
+
         // iterate over all entities whose bounds changed and recalculate them
+        m_pendingVisibilityEntries.clear();
         for (const auto& entity : m_entityBoundsDirty)
         {
             if (auto instance_it = m_entityVisibilityBoundsUnionInstanceMapping.find(entity);
                 instance_it != m_entityVisibilityBoundsUnionInstanceMapping.end())
             {
                 instance_it->second.m_localEntityBoundsUnion = CalculateEntityLocalBoundsUnion(entity);
-                UpdateVisibilitySystem(entity, instance_it->second);
+                if (visibilitySystem && UpdateVisibilityEntryBounds(entity, instance_it->second))
+                {
+                    m_pendingVisibilityEntries.push_back(&instance_it->second.m_visibilityEntry);
+                }
             }
         }
 
+        // update the visibility system with all the changed entries at once
+        if (!m_pendingVisibilityEntries.empty())
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntries(m_pendingVisibilityEntries);
+            m_pendingVisibilityEntries.clear();
+        }
+
         // clear dirty entities once the visibility system has been updated
         m_entityBoundsDirty.clear();
     }
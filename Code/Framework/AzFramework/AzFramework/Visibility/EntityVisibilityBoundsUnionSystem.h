@@ -51,9 +51,12 @@ namespace AzFramework
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
         void UpdateVisibilitySystem(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
+        //! Recalculates the world bounds of the visibility entry, returns true if they changed and the entry needs to be updated.
+        bool UpdateVisibilityEntryBounds(AZ::Entity* entity, EntityVisibilityBoundsUnionInstance& instance);
 
         EntityVisibilityBoundsUnionInstanceMapping m_entityVisibilityBoundsUnionInstanceMapping;
         UniqueEntities m_entityBoundsDirty;
+        AZStd::vector<VisibilityEntry*> m_pendingVisibilityEntries; //!< Entries to update in the visibility system, reused between ticks.
 
         AZ::EntityActivatedEvent::Handler m_entityActivatedEventHandler;
         AZ::EntityDeactivatedEvent::Handler m_entityDeactivatedEventHandler;
@@ -52,23 +52,39 @@ namespace AzFramework
         m_octreeDebug.Clear();
         m_visibleEntityIds.clear();
 
+        if (!ed_visibility_showDebug)
+        {
+            // The entries are culled by the visibility scene, so only the type of each entry needs to be checked
+            visSystem->GetDefaultVisibilityScene()->EnumerateEntries(
+                viewFrustum,
+                [&visibleEntityIdsOut = m_visibleEntityIds](const AzFramework::IVisibilityScene::NodeData& nodeData)
+                {
+                    visibleEntityIdsOut.reserve(visibleEntityIdsOut.size() + nodeData.m_entries.size());
+                    for (const auto* visibilityEntry : nodeData.m_entries)
+                    {
+                        if (visibilityEntry->m_typeFlags == AzFramework::VisibilityEntry::TYPE_Entity)
+                        {
+                            AZ::EntityId entityId = static_cast<AZ::Entity*>(visibilityEntry->m_userData)->GetId();
+                            visibleEntityIdsOut.push_back(entityId);
+                        }
+                    }
+                });
+            return;
+        }
+
+        // The debug display also shows the entries that are within the visited nodes but outside the frustum,
+        // so enumerate the nodes and cull the entries here
         visSystem->GetDefaultVisibilityScene()->Enumerate(
             viewFrustum,
             [&viewFrustum, &visibleEntityIdsOut = m_visibleEntityIds,
              &octreeDebug = m_octreeDebug](const AzFramework::IVisibilityScene::NodeData& nodeData)
             {
-                if (ed_visibility_showDebug)
-                {
-                    octreeDebug.m_nodeBounds.push_back(nodeData.m_bounds);
-                }
+                octreeDebug.m_nodeBounds.push_back(nodeData.m_bounds);
 
                 visibleEntityIdsOut.reserve(visibleEntityIdsOut.size() + nodeData.m_entries.size());
                 for (const auto* visibilityEntry : nodeData.m_entries)
                 {
-                    if (ed_visibility_showDebug)
-                    {
-                        octreeDebug.m_entryAabbsInBounds.push_back(visibilityEntry->m_boundingVolume);
-                    }
+                    octreeDebug.m_entryAabbsInBounds.push_back(visibilityEntry->m_boundingVolume);
 
                     if (visibilityEntry->m_typeFlags != AzFramework::VisibilityEntry::TYPE_Entity)
                     {
@@ -80,10 +96,7 @@ namespace AzFramework
                         continue;
                     }
 
-                    if (ed_visibility_showDebug)
-                    {
-                        octreeDebug.m_entryAabbsInFrustum.push_back(visibilityEntry->m_boundingVolume);
-                    }
+                    octreeDebug.m_entryAabbsInFrustum.push_back(visibilityEntry->m_boundingVolume);
 
                     AZ::EntityId entityId = static_cast<AZ::Entity*>(visibilityEntry->m_userData)->GetId();
                     visibleEntityIdsOut.push_back(entityId);
@@ -14,6 +14,7 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Sphere.h>
 #include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Name/Name.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/std/containers/vector.h>
@@ -59,6 +60,17 @@ namespace AzFramework
         };
         using EnumerateCallback = AZStd::function<void(const NodeData&)>;
 
+        //! The maximum number of frustums that can be passed to EnumerateMultiView, one bit per view in MultiViewNodeData::m_viewMasks.
+        static constexpr uint32_t MaxMultiViewFrustums = 32;
+
+        struct MultiViewNodeData
+        {
+            const AZ::Aabb m_bounds;
+            const AZStd::vector<VisibilityEntry*>& m_entries;
+            const AZStd::vector<uint32_t>& m_viewMasks; //< Bit N of m_viewMasks[i] is set if m_entries[i] overlaps frustum N
+        };
+        using MultiViewEnumerateCallback = AZStd::function<void(const MultiViewNodeData&)>;
+
         //! Get the unique scene name, used to look up the scene in the IVisibilitySystem. Duplicate names will assert on creation.
         virtual const AZ::Name& GetName() const = 0;
 
@@ -71,6 +83,17 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system, see InsertOrUpdateEntry.
+        //! Implementations can use this to take their locks once for the entire batch instead of once per entry.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries)
+        {
+            for (VisibilityEntry* visibilityEntry : visibilityEntries)
+            {
+                InsertOrUpdateEntry(*visibilityEntry);
+            }
+        }
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -93,6 +116,76 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, culling the individual entries as well as the nodes.
+        //! The callback is only invoked for nodes that have at least one entry overlapping the frustum, and NodeData::m_entries
+        //! only contains the overlapping entries. The entry list is only valid for the duration of the callback.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node has visible entries
+        virtual void EnumerateEntries(const AZ::Frustum& frustum, const EnumerateCallback& callback) const
+        {
+            AZStd::vector<VisibilityEntry*> visibleEntries;
+            Enumerate(frustum, [&frustum, &visibleEntries, &callback](const NodeData& nodeData)
+            {
+                visibleEntries.clear();
+                for (VisibilityEntry* visibilityEntry : nodeData.m_entries)
+                {
+                    if (AZ::ShapeIntersection::Overlaps(frustum, visibilityEntry->m_boundingVolume))
+                    {
+                        visibleEntries.push_back(visibilityEntry);
+                    }
+                }
+
+                if (!visibleEntries.empty())
+                {
+                    callback({ nodeData.m_bounds, visibleEntries });
+                }
+            });
+        }
+
+        //! Intersects several frustums against the visibility system in a single traversal.
+        //! Each node is tested against every frustum that partially overlaps its parent, and subtrees that are fully inside
+        //! or fully outside all of the frustums are not tested any further.
+        //! The callback is invoked for nodes that have at least one entry overlapping any of the frustums, NodeData::m_entries
+        //! only contains those entries and m_viewMasks holds the frustums each of them overlaps.
+        //! The entry and mask lists are only valid for the duration of the callback.
+        //! Implementations may split the traversal across the job system, so the callback can be invoked concurrently from multiple threads.
+        //! @param frustums the frustums to test against, at most MaxMultiViewFrustums
+        //! @param callback the callback to invoke when a node has visible entries
+        virtual void EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, const MultiViewEnumerateCallback& callback) const
+        {
+            AZ_Assert(frustums.size() <= MaxMultiViewFrustums, "EnumerateMultiView supports at most %u frustums", MaxMultiViewFrustums);
+
+            AZStd::vector<VisibilityEntry*> visibleEntries;
+            AZStd::vector<uint32_t> viewMasks;
+            EnumerateNoCull([&frustums, &visibleEntries, &viewMasks, &callback](const NodeData& nodeData)
+            {
+                visibleEntries.clear();
+                viewMasks.clear();
+                for (VisibilityEntry* visibilityEntry : nodeData.m_entries)
+                {
+                    uint32_t viewMask = 0;
+                    for (uint32_t view = 0; view < frustums.size() && view < MaxMultiViewFrustums; ++view)
+                    {
+                        if (AZ::ShapeIntersection::Overlaps(frustums[view], visibilityEntry->m_boundingVolume))
+                        {
+                            viewMask |= 1u << view;
+                        }
+                    }
+
+                    if (viewMask != 0)
+                    {
+                        visibleEntries.push_back(visibilityEntry);
+                        viewMasks.push_back(viewMask);
+                    }
+                }
+
+                if (!visibleEntries.empty())
+                {
+                    callback({ nodeData.m_bounds, visibleEntries, viewMasks });
+                }
+            });
+        }
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
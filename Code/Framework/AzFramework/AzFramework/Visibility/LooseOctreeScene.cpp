@@ -0,0 +1,911 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzFramework/Visibility/OctreeMultiView.h>
+#include <AzCore/Math/MathIntrinsics.h>
+#include <AzCore/Math/ShapeIntersection.h>
+
+namespace AzFramework
+{
+    // The loose octree shares its configuration with OctreeScene
+    AZ_CVAR_EXTERNED(bool, bg_octreeUseQuadtree);
+    AZ_CVAR_EXTERNED(float, bg_octreeMaxWorldExtents);
+    AZ_CVAR_EXTERNED(uint32_t, bg_octreeNodeMaxEntries);
+    AZ_CVAR_EXTERNED(uint32_t, bg_octreeNodeMinEntries);
+
+    // Prevents endless splitting when many tiny entries share the same position
+    static constexpr uint32_t LooseOctreeMaxDepth = 20;
+
+    static constexpr uint32_t LooseQuadtreeNodeChildCount = 4;
+    static constexpr uint32_t LooseOctreeNodeChildCount   = 8;
+
+    static uint32_t GetLooseOctreeChildNodeCount()
+    {
+        return (bg_octreeUseQuadtree) ? LooseQuadtreeNodeChildCount : LooseOctreeNodeChildCount;
+    }
+
+
+    static AZ::Aabb GetLooseBoundsForCell(const AZ::Aabb& cellBounds)
+    {
+        // A looseness factor of 2, the loose bounds are twice the size of the cell
+        const AZ::Vector3 halfExtents = cellBounds.GetExtents() * 0.5f;
+        return AZ::Aabb::CreateFromMinMax(cellBounds.GetMin() - halfExtents, cellBounds.GetMax() + halfExtents);
+    }
+
+
+    static bool FitsInCell(const AZ::Aabb& cellBounds, const AZ::Aabb& boundingVolume)
+    {
+        // If the center of the entry is within the cell and the entry is no larger than the cell,
+        // the entry is guaranteed to be contained by the loose bounds of the cell
+        return cellBounds.Contains(boundingVolume.GetCenter()) && boundingVolume.GetExtents().IsLessEqualThan(cellBounds.GetExtents());
+    }
+
+
+    static AZ::Aabb GetChildCellBounds(const AZ::Aabb& cellBounds, uint32_t child)
+    {
+        // In QuadTree mode the cells are only split along the X/Y plane, because we use a Z-up ground plane
+        AZ::Vector3 childExtent = cellBounds.GetExtents() * 0.5f;
+        if (bg_octreeUseQuadtree)
+        {
+            childExtent.SetZ(cellBounds.GetExtents().GetZ());
+        }
+
+        AZ::Vector3 childOffset = AZ::Vector3::CreateZero();
+        if (child & 0x01)
+        {
+            childOffset.SetX(childExtent.GetX());
+        }
+
+        if (child & 0x02)
+        {
+            childOffset.SetY(childExtent.GetY());
+        }
+
+        if (child & 0x04)
+        {
+            childOffset.SetZ(childExtent.GetZ());
+        }
+
+        const AZ::Vector3 childMin = cellBounds.GetMin() + childOffset;
+        return AZ::Aabb::CreateFromMinMax(childMin, childMin + childExtent);
+    }
+
+
+    void LooseOctreeBoundsBlock::Set(uint32_t lane, const AZ::Aabb& aabb)
+    {
+        AZ_Assert(lane < Width, "Lane index out of range");
+        m_minX[lane] = aabb.GetMin().GetX();
+        m_minY[lane] = aabb.GetMin().GetY();
+        m_minZ[lane] = aabb.GetMin().GetZ();
+        m_maxX[lane] = aabb.GetMax().GetX();
+        m_maxY[lane] = aabb.GetMax().GetY();
+        m_maxZ[lane] = aabb.GetMax().GetZ();
+    }
+
+
+    void LooseOctreeBoundsBlock::Copy(uint32_t lane, const LooseOctreeBoundsBlock& source, uint32_t sourceLane)
+    {
+        AZ_Assert(lane < Width && sourceLane < Width, "Lane index out of range");
+        m_minX[lane] = source.m_minX[sourceLane];
+        m_minY[lane] = source.m_minY[sourceLane];
+        m_minZ[lane] = source.m_minZ[sourceLane];
+        m_maxX[lane] = source.m_maxX[sourceLane];
+        m_maxY[lane] = source.m_maxY[sourceLane];
+        m_maxZ[lane] = source.m_maxZ[sourceLane];
+    }
+
+
+    LooseOctreeFrustumPlanes::LooseOctreeFrustumPlanes(const AZ::Frustum& frustum)
+    {
+        for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+        {
+            const AZ::Plane plane = frustum.GetPlane(planeId);
+            const AZ::Vector3 normal = plane.GetNormal();
+            m_normalX[planeId] = AZ::Simd::Vec4::Splat(normal.GetX());
+            m_normalY[planeId] = AZ::Simd::Vec4::Splat(normal.GetY());
+            m_normalZ[planeId] = AZ::Simd::Vec4::Splat(normal.GetZ());
+            m_absNormalX[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetX()));
+            m_absNormalY[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetY()));
+            m_absNormalZ[planeId] = AZ::Simd::Vec4::Splat(AZ::GetAbs(normal.GetZ()));
+            m_distance[planeId] = AZ::Simd::Vec4::Splat(plane.GetDistance());
+        }
+    }
+
+
+    void LooseOctreeFrustumPlanes::Classify(const LooseOctreeBoundsBlock& block, uint32_t laneCount, uint32_t& outsideMask, uint32_t& insideMask) const
+    {
+        using AZ::Simd::Vec4;
+
+        // This is the same test as ShapeIntersection::Overlaps and ShapeIntersection::Contains for a frustum and an AABB,
+        // extents.Dot(planeAbs) is the projection interval radius of the AABB onto the plane normal
+        const Vec4::FloatType half = Vec4::Splat(0.5f);
+        const Vec4::FloatType minX = Vec4::LoadAligned(block.m_minX);
+        const Vec4::FloatType minY = Vec4::LoadAligned(block.m_minY);
+        const Vec4::FloatType minZ = Vec4::LoadAligned(block.m_minZ);
+        const Vec4::FloatType maxX = Vec4::LoadAligned(block.m_maxX);
+        const Vec4::FloatType maxY = Vec4::LoadAligned(block.m_maxY);
+        const Vec4::FloatType maxZ = Vec4::LoadAligned(block.m_maxZ);
+        const Vec4::FloatType centerX = Vec4::Mul(Vec4::Add(minX, maxX), half);
+        const Vec4::FloatType centerY = Vec4::Mul(Vec4::Add(minY, maxY), half);
+        const Vec4::FloatType centerZ = Vec4::Mul(Vec4::Add(minZ, maxZ), half);
+        const Vec4::FloatType extentsX = Vec4::Mul(Vec4::Sub(maxX, minX), half);
+        const Vec4::FloatType extentsY = Vec4::Mul(Vec4::Sub(maxY, minY), half);
+        const Vec4::FloatType extentsZ = Vec4::Mul(Vec4::Sub(maxZ, minZ), half);
+
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        Vec4::FloatType outside = Vec4::CmpNeq(zero, zero);
+        Vec4::FloatType inside = Vec4::CmpEq(zero, zero);
+        for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+        {
+            const Vec4::FloatType distance = Vec4::Madd(m_normalX[planeId], centerX,
+                Vec4::Madd(m_normalY[planeId], centerY, Vec4::Madd(m_normalZ[planeId], centerZ, m_distance[planeId])));
+            const Vec4::FloatType radius = Vec4::Madd(m_absNormalX[planeId], extentsX,
+                Vec4::Madd(m_absNormalY[planeId], extentsY, Vec4::Mul(m_absNormalZ[planeId], extentsZ)));
+            outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(distance, radius), zero));
+            inside = Vec4::And(inside, Vec4::CmpGtEq(Vec4::Sub(distance, radius), zero));
+        }
+
+        AZ_ALIGN(int32_t outsideLanes[LooseOctreeBoundsBlock::Width], 16);
+        AZ_ALIGN(int32_t insideLanes[LooseOctreeBoundsBlock::Width], 16);
+        Vec4::StoreAligned(outsideLanes, Vec4::CastToInt(outside));
+        Vec4::StoreAligned(insideLanes, Vec4::CastToInt(inside));
+
+        outsideMask = 0;
+        insideMask = 0;
+        for (uint32_t lane = 0; lane < laneCount; ++lane)
+        {
+            outsideMask |= (outsideLanes[lane] != 0) ? (1u << lane) : 0u;
+            insideMask |= (insideLanes[lane] != 0) ? (1u << lane) : 0u;
+        }
+    }
+
+
+    // Classifies the first laneCount AABBs in the block against each of the active views.
+    // Bit N of overlapViewMasks[lane] is set if view N overlaps the AABB, bit N of insideViewMasks[lane] is set if view N fully contains it.
+    static void ClassifyMultiView(const AZStd::vector<LooseOctreeFrustumPlanes>& planes, uint32_t activeViewMask,
+        const LooseOctreeBoundsBlock& block, uint32_t laneCount,
+        uint32_t (&overlapViewMasks)[LooseOctreeBoundsBlock::Width], uint32_t (&insideViewMasks)[LooseOctreeBoundsBlock::Width])
+    {
+        for (uint32_t lane = 0; lane < LooseOctreeBoundsBlock::Width; ++lane)
+        {
+            overlapViewMasks[lane] = 0;
+            insideViewMasks[lane] = 0;
+        }
+
+        for (uint32_t views = activeViewMask; views != 0; views &= views - 1)
+        {
+            const uint32_t view = az_ctz_u32(views);
+            uint32_t outsideMask = 0;
+            uint32_t insideMask = 0;
+            planes[view].Classify(block, laneCount, outsideMask, insideMask);
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                overlapViewMasks[lane] |= (outsideMask & (1u << lane)) ? 0u : (1u << view);
+                insideViewMasks[lane] |= (insideMask & (1u << lane)) ? (1u << view) : 0u;
+            }
+        }
+    }
+
+
+    LooseOctreeNode::LooseOctreeNode(const AZ::Aabb& cellBounds, LooseOctreeNode* parent, uint32_t depth)
+        : m_cellBounds(cellBounds)
+        , m_looseBounds(GetLooseBoundsForCell(cellBounds))
+        , m_parent(parent)
+        , m_depth(depth)
+    {
+        ;
+    }
+
+
+    void LooseOctreeNode::Insert(LooseOctreeScene& scene, VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == nullptr, "Double-insertion: Insert invoked for an entry already bound to the LooseOctreeScene");
+
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
+        const AZ::Vector3 center = boundingVolume.GetCenter();
+
+        // Walk down the tree as long as the entry fits into the child cell containing its center
+        LooseOctreeNode* node = this;
+        while (true)
+        {
+            const uint32_t child = node->GetChildIndex(center);
+            if (node->IsLeaf() && (node->m_entries.size() >= bg_octreeNodeMaxEntries) && (node->m_depth < LooseOctreeMaxDepth) &&
+                FitsInCell(GetChildCellBounds(node->m_cellBounds, child), boundingVolume))
+            {
+                // If our entry list gets too large and the new entry can be pushed down, split this node
+                node->Split(scene);
+            }
+
+            if (!node->IsLeaf() && node->m_children[child].Fits(boundingVolume))
+            {
+                node = &node->m_children[child];
+                continue;
+            }
+
+            node->AddEntry(entry);
+            return;
+        }
+    }
+
+
+    void LooseOctreeNode::Update(LooseOctreeScene& scene, VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == this, "Update invoked for an entry bound to a different LooseOctreeNode");
+
+        const AZ::Aabb boundingVolume = entry->m_boundingVolume;
+        if (Fits(boundingVolume) && (IsLeaf() || !m_children[GetChildIndex(boundingVolume.GetCenter())].Fits(boundingVolume)))
+        {
+            // Entry moved, but is still bound to the correct node, so only the stored bounds need to be refreshed
+            const uint32_t entryIndex = entry->m_internalNodeIndex;
+            m_entryBounds[entryIndex / LooseOctreeBoundsBlock::Width].Set(entryIndex % LooseOctreeBoundsBlock::Width, boundingVolume);
+            return;
+        }
+
+        RemoveEntry(entry);
+
+        // Traverse up our ancestor nodes to find the first node that the entry fits into, or the root node
+        // This strategy assumes an entry will typically move a small distance relative to the total world
+        LooseOctreeNode* insertCheck = this;
+        while (insertCheck->m_parent != nullptr && !insertCheck->Fits(boundingVolume))
+        {
+            insertCheck = insertCheck->m_parent;
+        }
+        insertCheck->Insert(scene, entry);
+
+        // The entry may have left a node that can now be merged
+        MergeAfterRemoval(scene);
+    }
+
+
+    void LooseOctreeNode::Remove(LooseOctreeScene& scene, VisibilityEntry* entry)
+    {
+        AZ_Assert(entry->m_internalNode == this, "Remove invoked for an entry bound to a different LooseOctreeNode");
+
+        RemoveEntry(entry);
+        MergeAfterRemoval(scene);
+    }
+
+
+    template <typename T>
+    static void EnumerateLooseOctreeNode(const LooseOctreeNode& node, const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback)
+    {
+        // Invoke the callback for the current node
+        if (!node.GetEntries().empty())
+        {
+            callback({node.GetLooseBounds(), node.GetEntries()});
+        }
+
+        // The loose bounds of the children overlap each other, so every child needs to be tested
+        const LooseOctreeNode* children = node.GetChildren();
+        if (children != nullptr)
+        {
+            const uint32_t childCount = GetLooseOctreeChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (AZ::ShapeIntersection::Overlaps(boundingVolume, children[child].GetLooseBounds()))
+                {
+                    EnumerateLooseOctreeNode(children[child], boundingVolume, callback);
+                }
+            }
+        }
+    }
+
+
+    void LooseOctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateLooseOctreeNode(*this, aabb, callback);
+    }
+
+
+    void LooseOctreeNode::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        EnumerateLooseOctreeNode(*this, sphere, callback);
+    }
+
+
+    void LooseOctreeNode::Enumerate(const LooseOctreeFrustumPlanes& planes, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_looseBounds, m_entries});
+        }
+
+        if (m_children != nullptr)
+        {
+            // Cull the children four at a time, children that are fully inside the frustum don't need any further tests
+            const uint32_t childCount = GetLooseOctreeChildNodeCount();
+            for (uint32_t firstChild = 0; firstChild < childCount; firstChild += LooseOctreeBoundsBlock::Width)
+            {
+                const uint32_t laneCount = AZStd::min(childCount - firstChild, LooseOctreeBoundsBlock::Width);
+                uint32_t outsideMask = 0;
+                uint32_t insideMask = 0;
+                planes.Classify(m_childBounds[firstChild / LooseOctreeBoundsBlock::Width], laneCount, outsideMask, insideMask);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    const LooseOctreeNode& child = m_children[firstChild + lane];
+                    if (insideMask & (1u << lane))
+                    {
+                        child.EnumerateNoCull(callback);
+                    }
+                    else if (!(outsideMask & (1u << lane)))
+                    {
+                        child.Enumerate(planes, callback);
+                    }
+                }
+            }
+        }
+    }
+
+
+    void LooseOctreeNode::EnumerateEntries(const LooseOctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& scratch,
+        const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Cull the entries of the current node four at a time
+        if (!m_entries.empty())
+        {
+            scratch.clear();
+            const uint32_t entryCount = aznumeric_cast<uint32_t>(m_entries.size());
+            for (uint32_t firstEntry = 0; firstEntry < entryCount; firstEntry += LooseOctreeBoundsBlock::Width)
+            {
+                const uint32_t laneCount = AZStd::min(entryCount - firstEntry, LooseOctreeBoundsBlock::Width);
+                uint32_t outsideMask = 0;
+                uint32_t insideMask = 0;
+                planes.Classify(m_entryBounds[firstEntry / LooseOctreeBoundsBlock::Width], laneCount, outsideMask, insideMask);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    if (!(outsideMask & (1u << lane)))
+                    {
+                        scratch.push_back(m_entries[firstEntry + lane]);
+                    }
+                }
+            }
+
+            if (!scratch.empty())
+            {
+                callback({m_looseBounds, scratch});
+            }
+        }
+
+        if (m_children != nullptr)
+        {
+            const uint32_t childCount = GetLooseOctreeChildNodeCount();
+            for (uint32_t firstChild = 0; firstChild < childCount; firstChild += LooseOctreeBoundsBlock::Width)
+            {
+                const uint32_t laneCount = AZStd::min(childCount - firstChild, LooseOctreeBoundsBlock::Width);
+                uint32_t outsideMask = 0;
+                uint32_t insideMask = 0;
+                planes.Classify(m_childBounds[firstChild / LooseOctreeBoundsBlock::Width], laneCount, outsideMask, insideMask);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    const LooseOctreeNode& child = m_children[firstChild + lane];
+                    if (insideMask & (1u << lane))
+                    {
+                        // Every entry in a node that is fully inside the frustum is visible
+                        child.EnumerateNoCull(callback);
+                    }
+                    else if (!(outsideMask & (1u << lane)))
+                    {
+                        child.EnumerateEntries(planes, scratch, callback);
+                    }
+                }
+            }
+        }
+    }
+
+
+    void LooseOctreeNode::EnumerateMultiView(const AZStd::vector<LooseOctreeFrustumPlanes>& planes, uint32_t activeViewMask, uint32_t insideViewMask,
+        AZStd::vector<VisibilityEntry*>& scratchEntries, AZStd::vector<uint32_t>& scratchViewMasks,
+        const IVisibilityScene::MultiViewEnumerateCallback& callback, AZ::JobContext* jobContext) const
+    {
+        // Cull the entries of the current node four at a time, against the views that partially overlap this node only
+        if (!m_entries.empty())
+        {
+            scratchEntries.clear();
+            scratchViewMasks.clear();
+            const uint32_t entryCount = aznumeric_cast<uint32_t>(m_entries.size());
+            for (uint32_t firstEntry = 0; firstEntry < entryCount; firstEntry += LooseOctreeBoundsBlock::Width)
+            {
+                const uint32_t laneCount = AZStd::min(entryCount - firstEntry, LooseOctreeBoundsBlock::Width);
+                uint32_t overlapViewMasks[LooseOctreeBoundsBlock::Width];
+                uint32_t insideViewMasks[LooseOctreeBoundsBlock::Width];
+                ClassifyMultiView(planes, activeViewMask, m_entryBounds[firstEntry / LooseOctreeBoundsBlock::Width], laneCount,
+                    overlapViewMasks, insideViewMasks);
+                for (uint32_t lane = 0; lane < laneCount; ++lane)
+                {
+                    const uint32_t viewMask = insideViewMask | overlapViewMasks[lane];
+                    if (viewMask != 0)
+                    {
+                        scratchEntries.push_back(m_entries[firstEntry + lane]);
+                        scratchViewMasks.push_back(viewMask);
+                    }
+                }
+            }
+
+            if (!scratchEntries.empty())
+            {
+                callback({m_looseBounds, scratchEntries, scratchViewMasks});
+            }
+        }
+
+        if (m_children == nullptr)
+        {
+            return;
+        }
+
+        // Views that fully contain a child are not tested again anywhere below it
+        const uint32_t childCount = GetLooseOctreeChildNodeCount();
+        uint32_t childActiveViewMasks[LooseOctreeNodeChildCount];
+        uint32_t childInsideViewMasks[LooseOctreeNodeChildCount];
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += LooseOctreeBoundsBlock::Width)
+        {
+            const uint32_t laneCount = AZStd::min(childCount - firstChild, LooseOctreeBoundsBlock::Width);
+            uint32_t overlapViewMasks[LooseOctreeBoundsBlock::Width];
+            uint32_t insideViewMasks[LooseOctreeBoundsBlock::Width];
+            ClassifyMultiView(planes, activeViewMask, m_childBounds[firstChild / LooseOctreeBoundsBlock::Width], laneCount,
+                overlapViewMasks, insideViewMasks);
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                childActiveViewMasks[firstChild + lane] = overlapViewMasks[lane] & ~insideViewMasks[lane];
+                childInsideViewMasks[firstChild + lane] = insideViewMask | insideViewMasks[lane];
+            }
+        }
+
+        EnumerateMultiViewChildren(m_children, childCount, childActiveViewMasks, childInsideViewMasks, planes,
+            scratchEntries, scratchViewMasks, callback, jobContext);
+    }
+
+
+    void LooseOctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_looseBounds, m_entries});
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children
+            const uint32_t childCount = GetLooseOctreeChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                m_children[child].EnumerateNoCull(callback);
+            }
+        }
+    }
+
+
+    const AZStd::vector<VisibilityEntry*>& LooseOctreeNode::GetEntries() const
+    {
+        return m_entries;
+    }
+
+
+    const AZ::Aabb& LooseOctreeNode::GetCellBounds() const
+    {
+        return m_cellBounds;
+    }
+
+
+    const AZ::Aabb& LooseOctreeNode::GetLooseBounds() const
+    {
+        return m_looseBounds;
+    }
+
+
+    LooseOctreeNode* LooseOctreeNode::GetChildren() const
+    {
+        return m_children;
+    }
+
+
+    bool LooseOctreeNode::IsLeaf() const
+    {
+        return m_children == nullptr;
+    }
+
+
+    bool LooseOctreeNode::Fits(const AZ::Aabb& boundingVolume) const
+    {
+        return FitsInCell(m_cellBounds, boundingVolume);
+    }
+
+
+    uint32_t LooseOctreeNode::GetChildIndex(const AZ::Vector3& position) const
+    {
+        // Matches the child ordering used by GetChildCellBounds
+        const AZ::Vector3 cellCenter = m_cellBounds.GetCenter();
+        uint32_t child = 0;
+        child |= (position.GetX() >= cellCenter.GetX()) ? 0x01 : 0x00;
+        child |= (position.GetY() >= cellCenter.GetY()) ? 0x02 : 0x00;
+        if (!bg_octreeUseQuadtree)
+        {
+            child |= (position.GetZ() >= cellCenter.GetZ()) ? 0x04 : 0x00;
+        }
+        return child;
+    }
+
+
+    void LooseOctreeNode::AddEntry(VisibilityEntry* entry)
+    {
+        const uint32_t entryIndex = aznumeric_cast<uint32_t>(m_entries.size());
+        if ((entryIndex % LooseOctreeBoundsBlock::Width) == 0)
+        {
+            m_entryBounds.emplace_back();
+        }
+        m_entryBounds[entryIndex / LooseOctreeBoundsBlock::Width].Set(entryIndex % LooseOctreeBoundsBlock::Width, entry->m_boundingVolume);
+
+        m_entries.push_back(entry);
+        entry->m_internalNode = this;
+        entry->m_internalNodeIndex = entryIndex;
+    }
+
+
+    void LooseOctreeNode::RemoveEntry(VisibilityEntry* entry)
+    {
+        AZ_Assert(m_entries[entry->m_internalNodeIndex] == entry, "Visibility entry data is corrupt");
+
+        // Swap and pop the removed entry, along with its bounds
+        const uint32_t removeIndex = entry->m_internalNodeIndex;
+        const uint32_t lastIndex = aznumeric_cast<uint32_t>(m_entries.size() - 1);
+        entry->m_internalNode = nullptr;
+        entry->m_internalNodeIndex = 0;
+        if (removeIndex < lastIndex)
+        {
+            m_entries[removeIndex] = m_entries[lastIndex];
+            m_entries[removeIndex]->m_internalNodeIndex = removeIndex;
+            m_entryBounds[removeIndex / LooseOctreeBoundsBlock::Width].Copy(removeIndex % LooseOctreeBoundsBlock::Width,
+                m_entryBounds[lastIndex / LooseOctreeBoundsBlock::Width], lastIndex % LooseOctreeBoundsBlock::Width);
+        }
+        m_entries.pop_back();
+
+        if ((lastIndex % LooseOctreeBoundsBlock::Width) == 0)
+        {
+            m_entryBounds.pop_back();
+        }
+    }
+
+
+    void LooseOctreeNode::MergeAfterRemoval(LooseOctreeScene& scene)
+    {
+        // Entries are also bound to non-leaf nodes, so a removal can make either this node or our parent mergeable
+        LooseOctreeNode* mergeCheck = IsLeaf() ? m_parent : this;
+        if (mergeCheck != nullptr)
+        {
+            mergeCheck->TryMerge(scene);
+        }
+    }
+
+
+    void LooseOctreeNode::TryMerge(LooseOctreeScene& scene)
+    {
+        if (IsLeaf())
+        {
+            return;
+        }
+
+        uint32_t potentialNodeCount = aznumeric_cast<uint32_t>(m_entries.size());
+
+        // Only merge once all of our children are leaves
+        const uint32_t childCount = GetLooseOctreeChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if (!m_children[child].IsLeaf())
+            {
+                return;
+            }
+            potentialNodeCount += aznumeric_cast<uint32_t>(m_children[child].m_entries.size());
+        }
+
+        if (potentialNodeCount <= bg_octreeNodeMinEntries)
+        {
+            Merge(scene);
+
+            // Merging may have made our parent mergeable as well
+            if (m_parent != nullptr)
+            {
+                m_parent->TryMerge(scene);
+            }
+        }
+    }
+
+
+    void LooseOctreeNode::Split(LooseOctreeScene& scene)
+    {
+        AZ_Assert(m_children == nullptr, "Split invoked on a LooseOctreeScene node that has already been split");
+        m_childNodeIndex = scene.AllocateChildNodes();
+        m_children = scene.GetChildNodesAtIndex(m_childNodeIndex);
+
+        // Set child cell bounds and store their loose bounds next to this node for culling
+        const uint32_t childCount = GetLooseOctreeChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            m_children[child] = LooseOctreeNode(GetChildCellBounds(m_cellBounds, child), this, m_depth + 1);
+            m_childBounds[child / LooseOctreeBoundsBlock::Width].Set(child % LooseOctreeBoundsBlock::Width, m_children[child].m_looseBounds);
+        }
+
+        // Re-partition our entry set across ourself and our child nodes
+        AZStd::vector<VisibilityEntry*> entrySet(AZStd::move(m_entries));
+        m_entries.clear();
+        m_entryBounds.clear();
+        for (VisibilityEntry* entry : entrySet)
+        {
+            entry->m_internalNode = nullptr;
+            entry->m_internalNodeIndex = 0;
+            Insert(scene, entry);
+        }
+    }
+
+
+    void LooseOctreeNode::Merge(LooseOctreeScene& scene)
+    {
+        AZ_Assert(m_children != nullptr, "Merge invoked on a LooseOctreeScene node that does not have children");
+
+        // Move all child entries to our own entry set, the loose bounds of this node contain the loose bounds of the children
+        const uint32_t childCount = GetLooseOctreeChildNodeCount();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            for (VisibilityEntry* childEntry : m_children[child].m_entries)
+            {
+                AddEntry(childEntry);
+            }
+            m_children[child].m_entries.clear();
+            m_children[child].m_entryBounds.clear();
+        }
+
+        scene.ReleaseChildNodes(m_childNodeIndex);
+        m_childNodeIndex = InvalidChildNodeIndex;
+        m_children = nullptr;
+    }
+
+
+    LooseOctreeScene::LooseOctreeScene(const AZ::Name& sceneName)
+        : m_sceneName(sceneName)
+        , m_root(AZ::Aabb::CreateFromMinMax(AZ::Vector3(-bg_octreeMaxWorldExtents), AZ::Vector3(bg_octreeMaxWorldExtents)), nullptr, 0)
+    {
+        AZ_Assert(!sceneName.IsEmpty(), "sceneName must be a valid string");
+    }
+
+
+    LooseOctreeScene::~LooseOctreeScene()
+    {
+        for (auto page : m_nodeCache)
+        {
+            delete page;
+        }
+        m_nodeCache.reserve(0);
+        m_nodeCache.shrink_to_fit();
+    }
+
+
+    const AZ::Name& LooseOctreeScene::GetName() const
+    {
+        return m_sceneName;
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryNoLock(entry);
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryNoLock(*entry);
+        }
+    }
+
+
+    void LooseOctreeScene::InsertOrUpdateEntryNoLock(VisibilityEntry& entry)
+    {
+        if (entry.m_internalNode != nullptr)
+        {
+            static_cast<LooseOctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
+        }
+        else
+        {
+            m_root.Insert(*this, &entry);
+            ++m_entryCount;
+        }
+    }
+
+
+    void LooseOctreeScene::RemoveEntry(VisibilityEntry& entry)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        if (entry.m_internalNode)
+        {
+            static_cast<LooseOctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
+            --m_entryCount;
+        }
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.Enumerate(aabb, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.Enumerate(sphere, callback);
+    }
+
+
+    void LooseOctreeScene::Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        const LooseOctreeFrustumPlanes planes(frustum);
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.Enumerate(planes, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        const LooseOctreeFrustumPlanes planes(frustum);
+        AZStd::vector<VisibilityEntry*> scratch;
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateEntries(planes, scratch, callback);
+    }
+
+
+    void LooseOctreeScene::EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, const IVisibilityScene::MultiViewEnumerateCallback& callback) const
+    {
+        AZ_Assert(frustums.size() <= MaxMultiViewFrustums, "EnumerateMultiView supports at most %u frustums", MaxMultiViewFrustums);
+        if (frustums.empty())
+        {
+            return;
+        }
+
+        const uint32_t viewCount = AZStd::min(aznumeric_cast<uint32_t>(frustums.size()), MaxMultiViewFrustums);
+        AZStd::vector<LooseOctreeFrustumPlanes> planes;
+        planes.reserve(viewCount);
+        for (uint32_t view = 0; view < viewCount; ++view)
+        {
+            planes.emplace_back(frustums[view]);
+        }
+
+        // Entries outside of the world bounds are still bound to the root node, so every view starts out as partially overlapping it
+        const uint32_t viewMask = (viewCount == MaxMultiViewFrustums) ? 0xFFFFFFFF : (1u << viewCount) - 1;
+
+        AZStd::vector<VisibilityEntry*> scratchEntries;
+        AZStd::vector<uint32_t> scratchViewMasks;
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateMultiView(planes, viewMask, 0, scratchEntries, scratchViewMasks, callback, GetOctreeMultiViewJobContext());
+    }
+
+
+    void LooseOctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateNoCull(callback);
+    }
+
+
+    uint32_t LooseOctreeScene::GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetNodeCount() const
+    {
+        return m_nodeCount;
+    }
+
+
+    uint32_t LooseOctreeScene::GetFreeNodeCount() const
+    {
+        // Each entry represents GetChildNodeCount() nodes
+        return aznumeric_cast<uint32_t>(m_freeNodes.size() * GetChildNodeCount());
+    }
+
+
+    uint32_t LooseOctreeScene::GetPageCount() const
+    {
+        return aznumeric_cast<uint32_t>(m_nodeCache.size());
+    }
+
+
+    uint32_t LooseOctreeScene::GetChildNodeCount() const
+    {
+        return GetLooseOctreeChildNodeCount();
+    }
+
+
+    void LooseOctreeScene::DumpStats()
+    {
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::EntryCount = %u", GetName().GetCStr(), GetEntryCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::NodeCount = %u", GetName().GetCStr(), GetNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::FreeNodeCount = %u", GetName().GetCStr(), GetFreeNodeCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::PageCount = %u", GetName().GetCStr(), GetPageCount());
+        AZ_TracePrintf("Console", "LooseOctreeScene[\"%s\"]::ChildNodeCount = %u", GetName().GetCStr(), GetChildNodeCount());
+    }
+
+
+    // The page is stored in the upper 16-bits of the child node index, the offset into the page is the lower 16-bits
+    static inline uint32_t CreateLooseNodeIndex(uint32_t page, uint32_t offset)
+    {
+        AZ_Assert(page <= 0xFFFF && offset <= 0xFFFF, "Out of range values passed to CreateLooseNodeIndex");
+        return (page << 16) | offset;
+    }
+
+
+    static inline void ExtractPageAndOffsetFromLooseNodeIndex(uint32_t index, uint32_t& page, uint32_t& offset)
+    {
+        offset = index & 0x0000FFFF;
+        page = index >> 16;
+    }
+
+
+    uint32_t LooseOctreeScene::AllocateChildNodes()
+    {
+        const uint32_t childCount = GetChildNodeCount();
+        m_nodeCount += childCount;
+
+        if (m_nodeCache.empty())
+        {
+            m_nodeCache.push_back(new LooseOctreeNodePage);
+        }
+
+        uint32_t nextChildPage = aznumeric_cast<uint32_t>(m_nodeCache.size() - 1);
+        uint32_t nextChildOffset = aznumeric_cast<uint32_t>(m_nodeCache[nextChildPage]->size());
+
+        if (!m_freeNodes.empty())
+        {
+            // Take a free block of child nodes from our free list
+            ExtractPageAndOffsetFromLooseNodeIndex(m_freeNodes.top(), nextChildPage, nextChildOffset);
+            m_freeNodes.pop();
+        }
+        else
+        {
+            if (nextChildOffset + childCount > BlockSize)
+            {
+                // Our last page is already full, so we need to allocate a new page
+                m_nodeCache.push_back(new LooseOctreeNodePage);
+                ++nextChildPage;
+                nextChildOffset = 0;
+            }
+
+            // We resize_no_construct to prevent fixed_vector from using copy or assignment operators, but this means we have to explicitly construct nodes ourselves
+            m_nodeCache[nextChildPage]->resize_no_construct(nextChildOffset + childCount);
+            LooseOctreeNode* childNodes = &(*m_nodeCache[nextChildPage])[nextChildOffset];
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                new (&childNodes[child]) LooseOctreeNode;
+            }
+        }
+
+        return CreateLooseNodeIndex(nextChildPage, nextChildOffset);
+    }
+
+
+    void LooseOctreeScene::ReleaseChildNodes(uint32_t nodeIndex)
+    {
+        m_nodeCount -= GetChildNodeCount();
+        m_freeNodes.push(nodeIndex);
+    }
+
+
+    LooseOctreeNode* LooseOctreeScene::GetChildNodesAtIndex(uint32_t nodeIndex) const
+    {
+        uint32_t childPage;
+        uint32_t childOffset;
+        ExtractPageAndOffsetFromLooseNodeIndex(nodeIndex, childPage, childOffset);
+        return &(*m_nodeCache[childPage])[childOffset];
+    }
+}
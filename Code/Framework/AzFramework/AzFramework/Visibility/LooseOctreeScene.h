@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/containers/stack.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace AZ
+{
+    class JobContext;
+}
+
+namespace AzFramework
+{
+    class LooseOctreeScene;
+
+    //! The bounds of up to four AABBs stored as a structure of arrays.
+    //! This allows four AABBs to be tested against a single plane using one SIMD operation per component.
+    struct alignas(16) LooseOctreeBoundsBlock
+    {
+        static constexpr uint32_t Width = 4;
+
+        void Set(uint32_t lane, const AZ::Aabb& aabb);
+        void Copy(uint32_t lane, const LooseOctreeBoundsBlock& source, uint32_t sourceLane);
+
+        float m_minX[Width] = {};
+        float m_minY[Width] = {};
+        float m_minZ[Width] = {};
+        float m_maxX[Width] = {};
+        float m_maxY[Width] = {};
+        float m_maxZ[Width] = {};
+    };
+
+    //! The planes of a frustum, splatted for testing against a LooseOctreeBoundsBlock.
+    struct LooseOctreeFrustumPlanes
+    {
+        explicit LooseOctreeFrustumPlanes(const AZ::Frustum& frustum);
+
+        //! Tests the first laneCount AABBs in the block against the frustum.
+        //! @param outsideMask bit N is set if AABB N is fully outside the frustum.
+        //! @param insideMask bit N is set if AABB N is fully inside the frustum.
+        void Classify(const LooseOctreeBoundsBlock& block, uint32_t laneCount, uint32_t& outsideMask, uint32_t& insideMask) const;
+
+        AZ::Simd::Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+    };
+
+    //! A node within a loose octree.
+    //! Each node owns a cell of space, and its loose bounds are the cell expanded by half its size on every side.
+    //! Entries are bound to the deepest node whose cell contains their center and is at least as large as the entry,
+    //! so entries that straddle cell boundaries no longer accumulate in large parent nodes.
+    //! The bounds of the entries and of the child nodes are stored as LooseOctreeBoundsBlocks next to the node.
+    class LooseOctreeNode
+        : public VisibilityNode
+    {
+    public:
+        LooseOctreeNode() = default;
+        LooseOctreeNode(const AZ::Aabb& cellBounds, LooseOctreeNode* parent, uint32_t depth);
+
+        //! Inserts a VisibilityEntry into this node or one of its descendants, potentially triggering a split.
+        void Insert(LooseOctreeScene& scene, VisibilityEntry* entry);
+
+        //! Updates a VisibilityEntry that is currently bound to this node.
+        //! The provided entry must be bound to this node, but may no longer be bound to this node upon function exit.
+        void Update(LooseOctreeScene& scene, VisibilityEntry* entry);
+
+        //! Removes a VisibilityEntry from this node.
+        //! The provided entry must be bound to this node.
+        void Remove(LooseOctreeScene& scene, VisibilityEntry* entry);
+
+        //! Recursively enumerates any nodes whose loose bounds intersect the provided bounding volume.
+        //! @{
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const;
+        void Enumerate(const LooseOctreeFrustumPlanes& planes, const IVisibilityScene::EnumerateCallback& callback) const;
+        //! @}
+
+        //! Recursively enumerates the entries that intersect the frustum, culling each entry individually.
+        void EnumerateEntries(const LooseOctreeFrustumPlanes& planes, AZStd::vector<VisibilityEntry*>& scratch,
+            const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Recursively enumerates the entries that overlap any of the frustums, see IVisibilityScene::EnumerateMultiView.
+        //! @param activeViewMask the frustums that partially overlap this node and still need to be tested.
+        //! @param insideViewMask the frustums that fully contain this node.
+        //! @param jobContext if not nullptr, the child nodes are enumerated on jobs and on the calling thread.
+        void EnumerateMultiView(const AZStd::vector<LooseOctreeFrustumPlanes>& planes, uint32_t activeViewMask, uint32_t insideViewMask,
+            AZStd::vector<VisibilityEntry*>& scratchEntries, AZStd::vector<uint32_t>& scratchViewMasks,
+            const IVisibilityScene::MultiViewEnumerateCallback& callback, AZ::JobContext* jobContext = nullptr) const;
+
+        //! Recursively enumerate *all* nodes that have any entries in them (without any culling).
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Returns the set of entries bound to this node.
+        const AZStd::vector<VisibilityEntry*>& GetEntries() const;
+
+        //! Returns the bounds of the cell owned by this node.
+        const AZ::Aabb& GetCellBounds() const;
+
+        //! Returns the loose bounds of this node, every entry bound to this node or its descendants is contained by these bounds.
+        const AZ::Aabb& GetLooseBounds() const;
+
+        //! Returns the array of child nodes for this node, may be nullptr if this node is a leaf node.
+        LooseOctreeNode* GetChildren() const;
+
+        //! Returns true if this is a leaf node.
+        bool IsLeaf() const;
+
+    private:
+        bool Fits(const AZ::Aabb& boundingVolume) const;
+        uint32_t GetChildIndex(const AZ::Vector3& position) const;
+
+        void AddEntry(VisibilityEntry* entry);
+        void RemoveEntry(VisibilityEntry* entry);
+
+        void MergeAfterRemoval(LooseOctreeScene& scene);
+        void TryMerge(LooseOctreeScene& scene);
+        void Split(LooseOctreeScene& scene);
+        void Merge(LooseOctreeScene& scene);
+
+        static constexpr uint32_t InvalidChildNodeIndex = 0xFFFFFFFF;
+        static constexpr uint32_t MaxChildBlocks = 2;
+
+        AZ::Aabb m_cellBounds = AZ::Aabb::CreateNull();
+        AZ::Aabb m_looseBounds = AZ::Aabb::CreateNull();
+        LooseOctreeNode* m_parent = nullptr;
+        LooseOctreeNode* m_children = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
+        uint32_t m_childNodeIndex = InvalidChildNodeIndex;
+        uint32_t m_depth = 0;
+        AZStd::vector<VisibilityEntry*> m_entries;
+        AZStd::vector<LooseOctreeBoundsBlock> m_entryBounds; //< Bounds of m_entries, entry N is stored in lane N % 4 of block N / 4
+        LooseOctreeBoundsBlock m_childBounds[MaxChildBlocks]; //< Loose bounds of the child nodes
+    };
+
+    //! Implementation of the visibility scene interface using a loose octree.
+    //! Compared to OctreeScene this keeps large and boundary straddling entries out of the upper levels of the tree,
+    //! allows entries to move within the loose bounds of their node without being re-bound, and culls frustums
+    //! against four nodes or entries at a time.
+    class LooseOctreeScene
+        : public IVisibilityScene
+    {
+    public:
+        AZ_RTTI(LooseOctreeScene, "{5C7A2A0E-3B9F-4D6A-9E1B-0F6B2E8C4D17}", IVisibilityScene);
+        AZ_CLASS_ALLOCATOR(LooseOctreeScene, AZ::SystemAllocator, 0);
+        AZ_DISABLE_COPY_MOVE(LooseOctreeScene);
+
+        explicit LooseOctreeScene(const AZ::Name& sceneName);
+        virtual ~LooseOctreeScene();
+
+        //! IVisibilityScene overrides.
+        //! @{
+        const AZ::Name& GetName() const override;
+        void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
+        void RemoveEntry(VisibilityEntry& entry) override;
+        void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateEntries(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, const IVisibilityScene::MultiViewEnumerateCallback& callback) const override;
+        void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
+        uint32_t GetEntryCount() const override;
+        //! @}
+
+        //! Stats
+        //! @{
+        uint32_t GetNodeCount() const;
+        uint32_t GetFreeNodeCount() const;
+        uint32_t GetPageCount() const;
+        uint32_t GetChildNodeCount() const;
+        void DumpStats();
+        //! @}
+
+    private:
+        void InsertOrUpdateEntryNoLock(VisibilityEntry& entry);
+
+        uint32_t AllocateChildNodes();
+        void ReleaseChildNodes(uint32_t nodeIndex);
+        LooseOctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
+
+        mutable AZStd::shared_mutex m_sharedMutex;
+
+        AZ::Name m_sceneName; //< The uniquely identifying name for the visibility scene.
+        LooseOctreeNode m_root; //< The root node for the loose octree.
+
+        uint32_t m_entryCount = 0; //< Metric tracking the number of entries inserted into the loose octree.
+        uint32_t m_nodeCount = 1; //< Metric tracking the number of nodes allocated by the loose octree, at least one for the root node.
+
+        static constexpr uint32_t BlockSize = 4096; //< This represents the number of nodes that can be stored in each page
+        static_assert(BlockSize < 0xFFFF, "BlockSize must be less than 2^16");
+
+        using LooseOctreeNodePage = AZStd::fixed_vector<LooseOctreeNode, BlockSize>;
+        AZStd::vector<LooseOctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
+        AZStd::stack<uint32_t> m_freeNodes; //< Indices of free nodes, each entry represents a contiguous block of free child nodes.
+
+        friend class LooseOctreeNode; // For access to the node allocator methods
+    };
+}
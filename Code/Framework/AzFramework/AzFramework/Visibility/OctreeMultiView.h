@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzFramework/Visibility/IVisibilitySystem.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AzFramework
+{
+    //! Returns the job context that OctreeScene and LooseOctreeScene use to enumerate the children of their root node in parallel
+    //! in EnumerateMultiView, or nullptr for a serial traversal if bg_octreeMultiViewUseJobs is false or there is no job manager.
+    AZ::JobContext* GetOctreeMultiViewJobContext();
+
+    //! Enumerates the child nodes of an octree node that overlap any view, see IVisibilityScene::EnumerateMultiView.
+    //! @tparam NodeType the node type, its EnumerateMultiView is called for each child that overlaps a view.
+    //! @tparam FrustumType the frustum representation that NodeType culls against.
+    //! @param childActiveViewMasks per child, the views that partially overlap the child.
+    //! @param childInsideViewMasks per child, the views that fully contain the child.
+    //! @param jobContext if not nullptr, the children are enumerated on jobs and on the calling thread.
+    template<typename NodeType, typename FrustumType, uint32_t MaxChildCount>
+    void EnumerateMultiViewChildren(const NodeType* childNodes, uint32_t childCount,
+        const uint32_t (&childActiveViewMasks)[MaxChildCount], const uint32_t (&childInsideViewMasks)[MaxChildCount],
+        const AZStd::vector<FrustumType>& frustums, AZStd::vector<VisibilityEntry*>& scratchEntries, AZStd::vector<uint32_t>& scratchViewMasks,
+        const IVisibilityScene::MultiViewEnumerateCallback& callback, AZ::JobContext* jobContext)
+    {
+        AZ_Assert(childCount <= MaxChildCount, "EnumerateMultiViewChildren supports at most %u children", MaxChildCount);
+
+        if (jobContext == nullptr)
+        {
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if ((childActiveViewMasks[child] | childInsideViewMasks[child]) != 0)
+                {
+                    childNodes[child].EnumerateMultiView(frustums, childActiveViewMasks[child], childInsideViewMasks[child],
+                        scratchEntries, scratchViewMasks, callback);
+                }
+            }
+            return;
+        }
+
+        // The calling thread holds the scene's read lock, so it must not wait on the job system: it could run a job on this thread
+        // that takes the write lock (e.g. InsertOrUpdateEntry) and deadlock. Instead, the calling thread and the jobs claim children
+        // through an atomic index, and the calling thread only waits for children that a running job has already claimed.
+        // Jobs that start after every child was claimed exit without touching the scene.
+        struct MultiViewChildren
+        {
+            const NodeType* m_nodes[MaxChildCount];
+            uint32_t m_activeViewMasks[MaxChildCount];
+            uint32_t m_insideViewMasks[MaxChildCount];
+            uint32_t m_count = 0;
+            AZStd::atomic<uint32_t> m_nextIndex{ 0 };
+            AZStd::atomic<uint32_t> m_completedCount{ 0 };
+        };
+
+        auto children = AZStd::make_shared<MultiViewChildren>();
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            if ((childActiveViewMasks[child] | childInsideViewMasks[child]) != 0)
+            {
+                children->m_nodes[children->m_count] = &childNodes[child];
+                children->m_activeViewMasks[children->m_count] = childActiveViewMasks[child];
+                children->m_insideViewMasks[children->m_count] = childInsideViewMasks[child];
+                ++children->m_count;
+            }
+        }
+
+        auto enumerateChildren = [children, &frustums, &callback]()
+        {
+            AZStd::vector<VisibilityEntry*> jobEntries;
+            AZStd::vector<uint32_t> jobViewMasks;
+            for (uint32_t index = children->m_nextIndex++; index < children->m_count; index = children->m_nextIndex++)
+            {
+                children->m_nodes[index]->EnumerateMultiView(frustums, children->m_activeViewMasks[index], children->m_insideViewMasks[index],
+                    jobEntries, jobViewMasks, callback);
+                ++children->m_completedCount;
+            }
+        };
+
+        // The calling thread enumerates children as well, so one job less than there are children is enough
+        for (uint32_t job = 1; job < children->m_count; ++job)
+        {
+            AZ::CreateJobFunction(enumerateChildren, true, jobContext)->Start();
+        }
+        enumerateChildren();
+
+        while (children->m_completedCount < children->m_count)
+        {
+            AZStd::this_thread::yield();
+        }
+    }
+} // namespace AzFramework
@@ -6,6 +6,10 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzFramework/Visibility/OctreeMultiView.h>
+#include <AzCore/Jobs/JobManagerBus.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/ShapeIntersection.h>
 
 namespace AzFramework
@@ -14,16 +18,31 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,       64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,       32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(bool,     bg_octreeUseLooseOctree,     false, nullptr, AZ::ConsoleFunctorFlags::ReadOnly, "If set to true, visibility scenes will be created as loose octrees, which are better suited to large numbers of moving entries");
+    AZ_CVAR(bool,     bg_octreeMultiViewUseJobs,    true, nullptr, AZ::ConsoleFunctorFlags::Null, "If set to true, multi-view enumeration will traverse the children of the root node in parallel using the job system");
 
 
+    static constexpr uint32_t QuadtreeNodeChildCount = 4;
+    static constexpr uint32_t OctreeNodeChildCount   = 8;
+
     static uint32_t GetChildNodeCount()
     {
-        constexpr uint32_t QuadtreeNodeChildCount = 4;
-        constexpr uint32_t OctreeNodeChildCount   = 8;
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
 
+    AZ::JobContext* GetOctreeMultiViewJobContext()
+    {
+        // Fall back to a serial traversal if there is no job manager, e.g. in tools and unit tests
+        AZ::JobContext* jobContext = nullptr;
+        if (bg_octreeMultiViewUseJobs)
+        {
+            AZ::JobManagerBus::BroadcastResult(jobContext, &AZ::JobManagerEvents::GetGlobalContext);
+        }
+        return jobContext;
+    }
+
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -169,6 +188,72 @@ namespace AzFramework
     }
 
 
+    void OctreeNode::EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, uint32_t activeViewMask, uint32_t insideViewMask,
+        AZStd::vector<VisibilityEntry*>& scratchEntries, AZStd::vector<uint32_t>& scratchViewMasks,
+        const IVisibilityScene::MultiViewEnumerateCallback& callback, AZ::JobContext* jobContext) const
+    {
+        // Entries only need to be tested against the frustums that partially overlap this node
+        if (!m_entries.empty())
+        {
+            scratchEntries.clear();
+            scratchViewMasks.clear();
+            for (VisibilityEntry* entry : m_entries)
+            {
+                uint32_t viewMask = insideViewMask;
+                for (uint32_t views = activeViewMask; views != 0; views &= views - 1)
+                {
+                    const uint32_t view = az_ctz_u32(views);
+                    if (AZ::ShapeIntersection::Overlaps(frustums[view], entry->m_boundingVolume))
+                    {
+                        viewMask |= 1u << view;
+                    }
+                }
+
+                if (viewMask != 0)
+                {
+                    scratchEntries.push_back(entry);
+                    scratchViewMasks.push_back(viewMask);
+                }
+            }
+
+            if (!scratchEntries.empty())
+            {
+                callback({m_bounds, scratchEntries, scratchViewMasks});
+            }
+        }
+
+        if (m_children == nullptr)
+        {
+            return;
+        }
+
+        // Classify the children against the partially overlapping frustums, frustums that fully contain a child are not tested again below it
+        const uint32_t childCount = GetChildNodeCount();
+        uint32_t childActiveViewMasks[OctreeNodeChildCount];
+        uint32_t childInsideViewMasks[OctreeNodeChildCount];
+        for (uint32_t child = 0; child < childCount; ++child)
+        {
+            childActiveViewMasks[child] = 0;
+            childInsideViewMasks[child] = insideViewMask;
+            for (uint32_t views = activeViewMask; views != 0; views &= views - 1)
+            {
+                const uint32_t view = az_ctz_u32(views);
+                if (AZ::ShapeIntersection::Contains(frustums[view], m_children[child].m_bounds))
+                {
+                    childInsideViewMasks[child] |= 1u << view;
+                }
+                else if (AZ::ShapeIntersection::Overlaps(frustums[view], m_children[child].m_bounds))
+                {
+                    childActiveViewMasks[child] |= 1u << view;
+                }
+            }
+        }
+
+        EnumerateMultiViewChildren(m_children, childCount, childActiveViewMasks, childInsideViewMasks, frustums,
+            scratchEntries, scratchViewMasks, callback, jobContext);
+    }
+
+
     void OctreeNode::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         // Invoke the callback for the current node
@@ -358,6 +443,22 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryNoLock(entry);
+    }
+
+
+    void OctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryNoLock(*entry);
+        }
+    }
+
+
+    void OctreeScene::InsertOrUpdateEntryNoLock(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -402,6 +503,25 @@ namespace AzFramework
     }
 
 
+    void OctreeScene::EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, const IVisibilityScene::MultiViewEnumerateCallback& callback) const
+    {
+        AZ_Assert(frustums.size() <= MaxMultiViewFrustums, "EnumerateMultiView supports at most %u frustums", MaxMultiViewFrustums);
+        if (frustums.empty())
+        {
+            return;
+        }
+
+        // The root node spans the whole world, so every frustum starts out as partially overlapping it
+        const uint32_t viewCount = AZStd::min(aznumeric_cast<uint32_t>(frustums.size()), MaxMultiViewFrustums);
+        const uint32_t viewMask = (viewCount == MaxMultiViewFrustums) ? 0xFFFFFFFF : (1u << viewCount) - 1;
+
+        AZStd::vector<VisibilityEntry*> scratchEntries;
+        AZStd::vector<uint32_t> scratchViewMasks;
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateMultiView(frustums, viewMask, 0, scratchEntries, scratchViewMasks, callback, GetOctreeMultiViewJobContext());
+    }
+
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -550,7 +670,7 @@ namespace AzFramework
         AZ::Interface<IVisibilitySystem>::Register(this);
         IVisibilitySystemRequestBus::Handler::BusConnect();
 
-        m_defaultScene = aznew OctreeScene(AZ::Name("DefaultVisibilityScene"));
+        m_defaultScene = CreateScene(AZ::Name("DefaultVisibilityScene"));
     }
 
 
@@ -576,6 +696,15 @@ namespace AzFramework
         ;
     }
 
+    IVisibilityScene* OctreeSystemComponent::CreateScene(const AZ::Name& sceneName) const
+    {
+        if (bg_octreeUseLooseOctree)
+        {
+            return aznew LooseOctreeScene(sceneName);
+        }
+        return aznew OctreeScene(sceneName);
+    }
+
     IVisibilityScene* OctreeSystemComponent::GetDefaultVisibilityScene()
     {
         return m_defaultScene;
@@ -584,7 +713,7 @@ namespace AzFramework
     IVisibilityScene* OctreeSystemComponent::CreateVisibilityScene(const AZ::Name& sceneName)
     {
         AZ_Assert(FindVisibilityScene(sceneName) == nullptr, "Scene with same name already created!");
-        OctreeScene* newScene = aznew OctreeScene(sceneName);
+        IVisibilityScene* newScene = CreateScene(sceneName);
         m_scenes.push_back(newScene);
         return newScene;
     }
@@ -607,7 +736,7 @@ namespace AzFramework
 
     IVisibilityScene* OctreeSystemComponent::FindVisibilityScene(const AZ::Name& sceneName)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             if(scene->GetName() == sceneName)
             {
@@ -620,10 +749,17 @@ namespace AzFramework
 
     void OctreeSystemComponent::DumpStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
     {
-        for (OctreeScene* scene : m_scenes)
+        for (IVisibilityScene* scene : m_scenes)
         {
             AZ_TracePrintf("Console", "============================================");
-            scene->DumpStats();
+            if (OctreeScene* octreeScene = azrtti_cast<OctreeScene*>(scene))
+            {
+                octreeScene->DumpStats();
+            }
+            else if (LooseOctreeScene* looseOctreeScene = azrtti_cast<LooseOctreeScene*>(scene))
+            {
+                looseOctreeScene->DumpStats();
+            }
         }
         AZ_TracePrintf("Console", "============================================");
     }
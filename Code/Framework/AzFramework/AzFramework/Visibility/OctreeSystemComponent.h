@@ -15,6 +15,11 @@
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
+namespace AZ
+{
+    class JobContext;
+}
+
 namespace AzFramework
 {
     class OctreeSystemComponent;
@@ -53,6 +58,14 @@ namespace AzFramework
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
         //! @}
 
+        //! Recursively enumerates the entries that overlap any of the frustums, see IVisibilityScene::EnumerateMultiView.
+        //! @param activeViewMask the frustums that partially overlap this OctreeNode and still need to be tested.
+        //! @param insideViewMask the frustums that fully contain this OctreeNode.
+        //! @param jobContext if not nullptr, the child OctreeNodes are enumerated on jobs and on the calling thread.
+        void EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, uint32_t activeViewMask, uint32_t insideViewMask,
+            AZStd::vector<VisibilityEntry*>& scratchEntries, AZStd::vector<uint32_t>& scratchViewMasks,
+            const IVisibilityScene::MultiViewEnumerateCallback& callback, AZ::JobContext* jobContext = nullptr) const;
+
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
@@ -102,10 +115,12 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateMultiView(const AZStd::vector<AZ::Frustum>& frustums, const IVisibilityScene::MultiViewEnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -120,6 +135,8 @@ namespace AzFramework
         //! @}
 
     private:
+        void InsertOrUpdateEntryNoLock(VisibilityEntry& entry);
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
@@ -177,11 +194,14 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Creates either an OctreeScene or a LooseOctreeScene, depending on bg_octreeUseLooseOctree.
+        IVisibilityScene* CreateScene(const AZ::Name& sceneName) const;
+
         //! The default scene used for most entities (e.g. gameplay, networking)
-        OctreeScene* m_defaultScene = nullptr;
+        IVisibilityScene* m_defaultScene = nullptr;
 
         //! Other scenes (e.g. each rendering scene) are stored here and looked up by name.
-        AZStd::vector<OctreeScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
+        AZStd::vector<IVisibilityScene*> m_scenes;   //using a vector<> here because we'll generally have a small number of scenes
         
     };
 }
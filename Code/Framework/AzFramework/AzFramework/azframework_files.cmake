@@ -404,6 +404,9 @@ set(FILES
     Visibility/IVisibilitySystem.h
     Visibility/OctreeSystemComponent.h
     Visibility/OctreeSystemComponent.cpp
+    Visibility/LooseOctreeScene.h
+    Visibility/LooseOctreeScene.cpp
+    Visibility/OctreeMultiView.h
     Visibility/BoundsBus.h
     Visibility/BoundsBus.cpp
     Visibility/VisibilityDebug.h
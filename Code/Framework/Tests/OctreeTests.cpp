@@ -10,7 +10,14 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Jobs/JobManagerBus.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzFramework/Visibility/LooseOctreeScene.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
 #include <random>
 
 using namespace AzFramework;
@@ -419,4 +426,361 @@ namespace UnitTest
         // Expect all the entries to be in the scene
         ValidateEntryCountEqualsExpectedCount(m_octreeScene, visEntries.size());
     }
+
+    class LooseOctreeTests
+        : public OctreeTests
+    {
+    public:
+        void SetUp() override
+        {
+            OctreeTests::SetUp();
+            m_looseOctreeScene = aznew LooseOctreeScene(AZ::Name("LooseOctreeUnitTestScene"));
+        }
+
+        void TearDown() override
+        {
+            delete m_looseOctreeScene;
+            m_looseOctreeScene = nullptr;
+            OctreeTests::TearDown();
+        }
+
+        AZStd::vector<VisibilityEntry> CreateRandomEntries(uint32_t entryCount)
+        {
+            // Entries of varying size scattered over the -1,-1,-1 to 1,1,1 world volume, some of which straddle the node boundaries
+            std::mt19937 generator(1234);
+            std::uniform_real_distribution<float> positionDistribution(-1.0f, 1.0f);
+            std::uniform_real_distribution<float> sizeDistribution(0.01f, 0.5f);
+
+            AZStd::vector<VisibilityEntry> entries(entryCount);
+            for (VisibilityEntry& entry : entries)
+            {
+                const AZ::Vector3 center(positionDistribution(generator), positionDistribution(generator), positionDistribution(generator));
+                entry.m_boundingVolume = AZ::Aabb::CreateCenterHalfExtents(center, AZ::Vector3(sizeDistribution(generator)));
+            }
+            return entries;
+        }
+
+        LooseOctreeScene* m_looseOctreeScene = nullptr;
+    };
+
+    TEST_F(LooseOctreeTests, InsertDeleteSingleEntry)
+    {
+        AzFramework::VisibilityEntry visEntry;
+        visEntry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3::CreateZero(), AZ::Vector3::CreateOne());
+
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry.m_internalNodeIndex == 0);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 1);
+
+        m_looseOctreeScene->RemoveEntry(visEntry);
+        EXPECT_TRUE(visEntry.m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, InsertDeleteManyEntries_SplitsAndMergesBackToRoot)
+    {
+        AZStd::vector<VisibilityEntry> visEntries = CreateRandomEntries(256);
+        for (VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->InsertOrUpdateEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, aznumeric_cast<uint32_t>(visEntries.size()));
+        EXPECT_GT(m_looseOctreeScene->GetNodeCount(), 1);
+
+        for (VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+            EXPECT_TRUE(entry.m_internalNode == nullptr);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+        EXPECT_EQ(m_looseOctreeScene->GetNodeCount(), 1);
+    }
+
+    TEST_F(LooseOctreeTests, UpdateEntryWithinLooseBounds_EntryStaysInNode)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.8f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.2f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[0]);
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]); // This should force a split of the root node
+
+        const VisibilityNode* node = visEntry[1].m_internalNode;
+        EXPECT_TRUE(node != nullptr);
+
+        // Moving the entry a small amount keeps its center inside the same cell, so it shouldn't be re-bound
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.15f), AZ::Vector3(0.25f));
+        m_looseOctreeScene->InsertOrUpdateEntry(visEntry[1]);
+        EXPECT_EQ(visEntry[1].m_internalNode, node);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 2);
+
+        m_looseOctreeScene->RemoveEntry(visEntry[0]);
+        m_looseOctreeScene->RemoveEntry(visEntry[1]);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    TEST_F(LooseOctreeTests, InsertOrUpdateEntries_MatchesSingleUpdates)
+    {
+        AZStd::vector<VisibilityEntry> visEntries = CreateRandomEntries(128);
+        AZStd::vector<VisibilityEntry*> visEntryPointers;
+        for (VisibilityEntry& entry : visEntries)
+        {
+            visEntryPointers.push_back(&entry);
+        }
+
+        m_looseOctreeScene->InsertOrUpdateEntries(visEntryPointers);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, aznumeric_cast<uint32_t>(visEntries.size()));
+
+        // Move every entry and update them as a batch, the entry count shouldn't change
+        for (VisibilityEntry& entry : visEntries)
+        {
+            entry.m_boundingVolume.Translate(AZ::Vector3(0.05f, -0.05f, 0.1f));
+        }
+        m_looseOctreeScene->InsertOrUpdateEntries(visEntryPointers);
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, aznumeric_cast<uint32_t>(visEntries.size()));
+
+        for (VisibilityEntry& entry : visEntries)
+        {
+            m_looseOctreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_looseOctreeScene, 0);
+    }
+
+    void ValidateEnumerateEntriesMatchesBruteForce(IVisibilityScene* visScene, AZStd::vector<VisibilityEntry>& visEntries, const AZ::Frustum& frustum)
+    {
+        for (VisibilityEntry& entry : visEntries)
+        {
+            visScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZStd::vector<VisibilityEntry*> expectedEntries;
+        for (VisibilityEntry& entry : visEntries)
+        {
+            if (AZ::ShapeIntersection::Overlaps(frustum, entry.m_boundingVolume))
+            {
+                expectedEntries.push_back(&entry);
+            }
+        }
+
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        visScene->EnumerateEntries(frustum, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(gatheredEntries, nodeData); });
+
+        AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+        AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+        EXPECT_EQ(gatheredEntries, expectedEntries);
+
+        // Enumerating nodes should return a superset of the visible entries
+        AZStd::vector<VisibilityEntry*> nodeEntries;
+        visScene->Enumerate(frustum, [&nodeEntries](const AzFramework::IVisibilityScene::NodeData& nodeData) { AppendEntries(nodeEntries, nodeData); });
+        for (VisibilityEntry* entry : expectedEntries)
+        {
+            EXPECT_NE(AZStd::find(nodeEntries.begin(), nodeEntries.end(), entry), nodeEntries.end());
+        }
+
+        for (VisibilityEntry& entry : visEntries)
+        {
+            visScene->RemoveEntry(entry);
+        }
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateEntries_MatchesBruteForceFrustumCulling)
+    {
+        AZ::Vector3 frustumOrigin = AZ::Vector3(0.0f, -2.0f, 0.0f);
+        AZ::Quaternion frustumDirection = AZ::Quaternion::CreateIdentity();
+        AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+        AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.3f), 1.5f, 2.5f));
+
+        AZStd::vector<VisibilityEntry> visEntries = CreateRandomEntries(512);
+        ValidateEnumerateEntriesMatchesBruteForce(m_looseOctreeScene, visEntries, frustum);
+        ValidateEnumerateEntriesMatchesBruteForce(m_octreeScene, visEntries, frustum);
+    }
+
+    void ValidateEnumerateMultiViewMatchesBruteForce(IVisibilityScene* visScene, AZStd::vector<VisibilityEntry>& visEntries, const AZStd::vector<AZ::Frustum>& frustums)
+    {
+        for (VisibilityEntry& entry : visEntries)
+        {
+            visScene->InsertOrUpdateEntry(entry);
+        }
+
+        AZStd::vector<uint32_t> expectedViewMasks(visEntries.size(), 0);
+        for (size_t entryIndex = 0; entryIndex < visEntries.size(); ++entryIndex)
+        {
+            for (uint32_t view = 0; view < frustums.size(); ++view)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustums[view], visEntries[entryIndex].m_boundingVolume))
+                {
+                    expectedViewMasks[entryIndex] |= 1u << view;
+                }
+            }
+        }
+
+        // Every visible entry should be reported exactly once, with a non-zero view mask
+        AZStd::vector<uint32_t> gatheredViewMasks(visEntries.size(), 0);
+        AZStd::vector<uint32_t> gatheredCounts(visEntries.size(), 0);
+        visScene->EnumerateMultiView(frustums, [&visEntries, &gatheredViewMasks, &gatheredCounts](const AzFramework::IVisibilityScene::MultiViewNodeData& nodeData)
+        {
+            ASSERT_EQ(nodeData.m_entries.size(), nodeData.m_viewMasks.size());
+            for (size_t i = 0; i < nodeData.m_entries.size(); ++i)
+            {
+                const size_t entryIndex = nodeData.m_entries[i] - visEntries.data();
+                EXPECT_NE(nodeData.m_viewMasks[i], 0u);
+                gatheredViewMasks[entryIndex] |= nodeData.m_viewMasks[i];
+                ++gatheredCounts[entryIndex];
+            }
+        });
+
+        EXPECT_EQ(gatheredViewMasks, expectedViewMasks);
+        for (size_t entryIndex = 0; entryIndex < visEntries.size(); ++entryIndex)
+        {
+            EXPECT_EQ(gatheredCounts[entryIndex], (expectedViewMasks[entryIndex] != 0) ? 1u : 0u);
+        }
+
+        for (VisibilityEntry& entry : visEntries)
+        {
+            visScene->RemoveEntry(entry);
+        }
+    }
+
+    AZStd::vector<AZ::Frustum> CreateMultiViewFrustums()
+    {
+        AZStd::vector<AZ::Frustum> frustums;
+
+        // A narrow frustum looking down +Y, the same frustum looking down -Y, and a wide frustum that fully contains parts of the tree
+        const AZ::Transform forwardTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), AZ::Vector3(0.0f, -2.0f, 0.0f));
+        frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(forwardTransform, 1.0f, 2.0f * atanf(0.3f), 1.5f, 2.5f)));
+        const AZ::Transform backwardTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateRotationZ(AZ::Constants::Pi), AZ::Vector3(0.0f, 2.0f, 0.0f));
+        frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(backwardTransform, 1.0f, 2.0f * atanf(0.3f), 1.5f, 2.5f)));
+        const AZ::Transform wideTransform = AZ::Transform::CreateFromQuaternionAndTranslation(AZ::Quaternion::CreateIdentity(), AZ::Vector3(0.0f, -4.0f, 0.0f));
+        frustums.push_back(AZ::Frustum(AZ::ViewFrustumAttributes(wideTransform, 1.0f, 2.0f * atanf(1.0f), 0.5f, 5.0f)));
+        return frustums;
+    }
+
+    TEST_F(LooseOctreeTests, EnumerateMultiView_MatchesBruteForceFrustumCulling)
+    {
+        const AZStd::vector<AZ::Frustum> frustums = CreateMultiViewFrustums();
+        AZStd::vector<VisibilityEntry> visEntries = CreateRandomEntries(512);
+        ValidateEnumerateMultiViewMatchesBruteForce(m_looseOctreeScene, visEntries, frustums);
+        ValidateEnumerateMultiViewMatchesBruteForce(m_octreeScene, visEntries, frustums);
+    }
+
+    //! Provides a job manager through the JobManagerBus, so EnumerateMultiView enumerates the children of the root node on jobs
+    class OctreeMultiViewJobTests
+        : public LooseOctreeTests
+        , public AZ::JobManagerBus::Handler
+    {
+    public:
+        void SetUp() override
+        {
+            LooseOctreeTests::SetUp();
+
+            // Jobs are allocated from the pool allocators, create them if not available
+            if (!AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::IsReady())
+            {
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+                m_ownsPoolAllocators = true;
+            }
+
+            AZ::JobManagerDesc jobDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+            for (int i = 0; i < 4; ++i)
+            {
+                jobDesc.m_workerThreads.push_back(threadDesc);
+            }
+            m_jobManager = aznew AZ::JobManager(jobDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobManagerBus::Handler::BusConnect();
+
+            m_console->GetCvarValue("bg_octreeMultiViewUseJobs", m_savedMultiViewUseJobs);
+        }
+
+        void TearDown() override
+        {
+            m_console->PerformCommand(m_savedMultiViewUseJobs ? "bg_octreeMultiViewUseJobs true" : "bg_octreeMultiViewUseJobs false");
+
+            AZ::JobManagerBus::Handler::BusDisconnect();
+            delete m_jobContext;
+            m_jobContext = nullptr;
+            delete m_jobManager;
+            m_jobManager = nullptr;
+
+            if (m_ownsPoolAllocators)
+            {
+                AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+                AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+                m_ownsPoolAllocators = false;
+            }
+
+            LooseOctreeTests::TearDown();
+        }
+
+        // JobManagerBus
+        AZ::JobManager* GetManager() override { return m_jobManager; }
+        AZ::JobContext* GetGlobalContext() override { return m_jobContext; }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+        bool m_savedMultiViewUseJobs = true;
+        bool m_ownsPoolAllocators = false;
+    };
+
+    void GatherMultiViewMasks(const IVisibilityScene* visScene, const AZStd::vector<VisibilityEntry>& visEntries, const AZStd::vector<AZ::Frustum>& frustums,
+        AZStd::vector<uint32_t>& gatheredViewMasks, AZStd::vector<uint32_t>& gatheredCounts)
+    {
+        // The callback runs on jobs as well as on the calling thread
+        AZStd::mutex gatherMutex;
+        gatheredViewMasks.assign(visEntries.size(), 0);
+        gatheredCounts.assign(visEntries.size(), 0);
+        visScene->EnumerateMultiView(frustums, [&](const AzFramework::IVisibilityScene::MultiViewNodeData& nodeData)
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(gatherMutex);
+            for (size_t i = 0; i < nodeData.m_entries.size(); ++i)
+            {
+                const size_t entryIndex = nodeData.m_entries[i] - visEntries.data();
+                gatheredViewMasks[entryIndex] |= nodeData.m_viewMasks[i];
+                ++gatheredCounts[entryIndex];
+            }
+        });
+    }
+
+    TEST_F(OctreeMultiViewJobTests, EnumerateMultiView_WithJobs_MatchesSerialEnumeration)
+    {
+        const AZStd::vector<AZ::Frustum> frustums = CreateMultiViewFrustums();
+        AZStd::vector<VisibilityEntry> visEntries = CreateRandomEntries(512);
+
+        for (IVisibilityScene* visScene : { static_cast<IVisibilityScene*>(m_looseOctreeScene), static_cast<IVisibilityScene*>(m_octreeScene) })
+        {
+            for (VisibilityEntry& entry : visEntries)
+            {
+                visScene->InsertOrUpdateEntry(entry);
+            }
+
+            // With one entry per node the tree is several levels deep, so the jobs enumerate whole subtrees
+            uint32_t nodeCount = 0;
+            visScene->EnumerateNoCull([&nodeCount](const AzFramework::IVisibilityScene::NodeData&) { ++nodeCount; });
+            EXPECT_GT(nodeCount, 64u);
+
+            AZStd::vector<uint32_t> serialViewMasks;
+            AZStd::vector<uint32_t> serialCounts;
+            m_console->PerformCommand("bg_octreeMultiViewUseJobs false");
+            GatherMultiViewMasks(visScene, visEntries, frustums, serialViewMasks, serialCounts);
+
+            AZStd::vector<uint32_t> jobViewMasks;
+            AZStd::vector<uint32_t> jobCounts;
+            m_console->PerformCommand("bg_octreeMultiViewUseJobs true");
+            GatherMultiViewMasks(visScene, visEntries, frustums, jobViewMasks, jobCounts);
+
+            EXPECT_EQ(jobViewMasks, serialViewMasks);
+            EXPECT_EQ(jobCounts, serialCounts);
+
+            for (VisibilityEntry& entry : visEntries)
+            {
+                visScene->RemoveEntry(entry);
+            }
+        }
+
+        // The jobbed enumeration also matches brute force culling
+        ValidateEnumerateMultiViewMatchesBruteForce(m_looseOctreeScene, visEntries, frustums);
+        ValidateEnumerateMultiViewMatchesBruteForce(m_octreeScene, visEntries, frustums);
+    }
 }
@@ -131,35 +131,7 @@ namespace ImageProcessingAtom
 
         IImageObjectPtr dstImage(m_img->AllocateImage(fmtTo));
 
-        AZ_Assert(srcImage->GetPixelCount(0) == dstImage->GetPixelCount(0), "dest image has different size than source image");
-
-        //create pixel operation function for src and dst images
-        IPixelOperationPtr srcOp = CreatePixelOperation(srcFmt);
-        IPixelOperationPtr dstOp = CreatePixelOperation(dstFmt);
-
-        //get count of bytes per pixel for both src and dst images
-        uint32 srcPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
-        uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
-
-        const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
-        for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
-        {
-            uint8* srcPixelBuf;
-            uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
-            uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
-
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
-
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
-            {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
-        }
+        ConvertPixelRows(srcImage, dstImage);
 
         m_img = dstImage;
     }
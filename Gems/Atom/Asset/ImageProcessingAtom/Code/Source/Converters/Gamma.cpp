@@ -25,6 +25,7 @@ namespace ImageProcessingAtom
     // then the original function is called.
     // Otherwise, a value from the table (linearly interpolated)
     // is returned.
+    // The table is filled on construction, so compute() can be called from several threads.
     template <int TABLE_SIZE>
     class FunctionLookupTable
     {
@@ -34,11 +35,11 @@ namespace ImageProcessingAtom
             , m_xMin(xMin)
             , m_fMaxDiff(maxAllowedDifference)
         {
+            Initialize();
         }
 
-        void Initialize() const
+        void Initialize()
         {
-            m_initialized = true;
             AZ_Assert(m_xMin >= 0.0f, "wrong initial data for m_xMin");
             for (int i = 0; i <= TABLE_SIZE; ++i)
             {
@@ -59,11 +60,6 @@ namespace ImageProcessingAtom
 
             const int i = int(f);
 
-            if (!m_initialized)
-            {
-                Initialize();
-            }
-
             if (i >= TABLE_SIZE)
             {
                 return m_table[TABLE_SIZE];
@@ -113,8 +109,7 @@ namespace ImageProcessingAtom
     private:
         float(* m_fn)(float x);
         float m_xMin;
-        mutable float m_table[TABLE_SIZE + 1];
-        mutable bool m_initialized = false;
+        float m_table[TABLE_SIZE + 1];
         float m_fMaxDiff = 0.0f;
     };
 
@@ -155,40 +150,20 @@ namespace ImageProcessingAtom
         EPixelFormat dstFmt = ePixelFormat_R32G32B32A32F;
         IImageObjectPtr dstImage(m_img->AllocateImage(dstFmt));
 
-        //create pixel operation function for src and dst images
-        IPixelOperationPtr srcOp = CreatePixelOperation(srcFmt);
-        IPixelOperationPtr dstOp = CreatePixelOperation(dstFmt);
-
-        //get count of bytes per pixel for both src and dst images
-        uint32 srcPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
-        uint32 dstPixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(dstFmt)->bitsPerBlock / 8;
-
-        const uint32 dwMips = dstImage->GetMipCount();
-        float r, g, b, a;
-        for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
+        PixelRowFunction deGamma;
+        if (bDeGamma)
         {
-            uint8* srcPixelBuf;
-            uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
-            uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
-
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
-
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += srcPixelBytes, dstPixelBuf += dstPixelBytes)
+            deGamma = [](float* rgba, uint32 pixelCount)
             {
-                srcOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                if (bDeGamma)
+                for (uint32 i = 0; i < pixelCount; ++i, rgba += 4)
                 {
-                    r = s_lutGammaToLinear.compute(r);
-                    g = s_lutGammaToLinear.compute(g);
-                    b = s_lutGammaToLinear.compute(b);
+                    rgba[0] = s_lutGammaToLinear.compute(rgba[0]);
+                    rgba[1] = s_lutGammaToLinear.compute(rgba[1]);
+                    rgba[2] = s_lutGammaToLinear.compute(rgba[2]);
                 }
-
-                dstOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
+            };
         }
+        ConvertPixelRows(srcImage, dstImage, deGamma);
 
         m_img = dstImage;
 
@@ -218,34 +193,15 @@ namespace ImageProcessingAtom
 
         IImageObjectPtr dstImage(m_img->AllocateImage(srcFmt));
 
-        //create pixel operation function
-        IPixelOperationPtr pixelOp = CreatePixelOperation(srcFmt);
-
-        //get count of bytes per pixel for both src and dst images
-        uint32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(srcFmt)->bitsPerBlock / 8;
-
-        const uint32 dwMips = srcImage->GetMipCount();
-        float r, g, b, a;
-        for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
-        {
-            uint8* srcPixelBuf;
-            uint32 srcPitch;
-            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
-            uint8* dstPixelBuf;
-            uint32 dstPitch;
-            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
-
-            const uint32 pixelCount = srcImage->GetPixelCount(dwMip);
-
-            for (uint32 i = 0; i < pixelCount; ++i, srcPixelBuf += pixelBytes, dstPixelBuf += pixelBytes)
+        ConvertPixelRows(srcImage, dstImage, [](float* rgba, uint32 pixelCount)
             {
-                pixelOp->GetRGBA(srcPixelBuf, r, g, b, a);
-                r = s_lutLinearToGamma.compute(r);
-                g = s_lutLinearToGamma.compute(g);
-                b = s_lutLinearToGamma.compute(b);
-                pixelOp->SetRGBA(dstPixelBuf, r, g, b, a);
-            }
-        }
+                for (uint32 i = 0; i < pixelCount; ++i, rgba += 4)
+                {
+                    rgba[0] = s_lutLinearToGamma.compute(rgba[0]);
+                    rgba[1] = s_lutLinearToGamma.compute(rgba[1]);
+                    rgba[2] = s_lutLinearToGamma.compute(rgba[2]);
+                }
+            });
 
         m_img = dstImage;
         Get()->AddImageFlags(EIF_SRGBRead);
@@ -40,32 +40,34 @@ namespace ImageProcessingAtom
         Histogram<binCount>::Bins bins;
         Histogram<binCount>::clearBins(bins);
 
-        //get count of bytes per pixel
-        AZ::u32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(pixelFormat)->bitsPerBlock / 8;
-
         const  AZ::u32 mipCount = imageObject->GetMipCount();
-        float color[4];
+        AZStd::vector<float> rgba;
         for (uint32 mip = 0; mip < mipCount; ++mip)
         {
             AZ::u8* pixelBuf;
             AZ::u32 pitch;
             imageObject->GetImagePointer(mip, pixelBuf, pitch);
-            const uint32 pixelCount = imageObject->GetPixelCount(mip);
+            const uint32 width = imageObject->GetWidth(mip);
+            const uint32 height = imageObject->GetHeight(mip);
+            rgba.resize(width * 4);
 
-            for (uint32 i = 0; i < pixelCount; ++i, pixelBuf += pixelBytes)
+            for (uint32 row = 0; row < height; ++row, pixelBuf += pitch)
             {
-                pixelOp->GetRGBA(pixelBuf, color[0], color[1], color[2], color[3]);
+                pixelOp->GetRGBARow(pixelBuf, rgba.data(), width);
 
-                const float luminance = AZ::GetClamp(GetLuminance(color[0], color[1], color[2]), 0.0f, 1.0f);
-                const float f = luminance * binCount;
-                if (f <= 0)
-                {
-                    ++bins[0];
-                }
-                else
+                for (const float* color = rgba.data(); color != rgba.data() + width * 4; color += 4)
                 {
-                    const int bin = int(f);
-                    ++bins[(bin < binCount) ? bin : binCount - 1];
+                    const float luminance = AZ::GetClamp(GetLuminance(color[0], color[1], color[2]), 0.0f, 1.0f);
+                    const float f = luminance * binCount;
+                    if (f <= 0)
+                    {
+                        ++bins[0];
+                    }
+                    else
+                    {
+                        const int bin = int(f);
+                        ++bins[(bin < binCount) ? bin : binCount - 1];
+                    }
                 }
             }
         }
@@ -7,6 +7,10 @@
 
 #include <ImageProcessing_precompiled.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 
 #include <Processing/ImageObjectImpl.h>
@@ -50,6 +54,79 @@ namespace ImageProcessingAtom
         return SHalf(in);
     }
 
+    namespace
+    {
+        // U8ToF32 for all 256 values
+        struct U8ToF32Table
+        {
+            U8ToF32Table()
+            {
+                for (uint32 i = 0; i < 256; ++i)
+                {
+                    m_values[i] = U8ToF32(static_cast<uint8>(i));
+                }
+            }
+
+            float m_values[256];
+        };
+
+        const U8ToF32Table s_u8ToF32Table;
+
+        void ConvertU8ToF32(const uint8* in, float* out, uint32 count)
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                out[i] = s_u8ToF32Table.m_values[in[i]];
+            }
+        }
+
+        // Same results as F32ToU8: values are clamped to [0, 1] and rounded half away from zero
+        void ConvertF32ToU8(const float* in, uint8* out, uint32 count)
+        {
+            using AZ::Simd::Vec4;
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType half = Vec4::Splat(0.5f);
+            const Vec4::FloatType scale = Vec4::Splat(255.0f);
+
+            uint32 i = 0;
+            for (; i + 4 <= count; i += 4)
+            {
+                const Vec4::FloatType scaled = Vec4::Mul(Vec4::Clamp(Vec4::LoadUnaligned(in + i), zero, one), scale);
+                const Vec4::FloatType floor = Vec4::Floor(scaled);
+                const Vec4::FloatType roundUp = Vec4::CmpGtEq(Vec4::Sub(scaled, floor), half);
+                const Vec4::FloatType rounded = Vec4::Select(Vec4::Add(floor, one), floor, roundUp);
+
+                alignas(16) int32_t values[4];
+                Vec4::StoreAligned(values, Vec4::ConvertToInt(rounded));
+                out[i] = static_cast<uint8>(values[0]);
+                out[i + 1] = static_cast<uint8>(values[1]);
+                out[i + 2] = static_cast<uint8>(values[2]);
+                out[i + 3] = static_cast<uint8>(values[3]);
+            }
+            for (; i < count; ++i)
+            {
+                out[i] = F32ToU8(in[i]);
+            }
+        }
+    }
+
+    void IPixelOperation::GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount)
+    {
+        for (uint32 i = 0; i < pixelCount; ++i, buf += m_pixelBytes, rgba += 4)
+        {
+            GetRGBA(buf, rgba[0], rgba[1], rgba[2], rgba[3]);
+        }
+    }
+
+    void IPixelOperation::SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount)
+    {
+        for (uint32 i = 0; i < pixelCount; ++i, buf += m_pixelBytes, rgba += 4)
+        {
+            SetRGBA(buf, rgba[0], rgba[1], rgba[2], rgba[3]);
+        }
+    }
+
     //stucture for RGBE pixel format
     struct RgbE
     {
@@ -126,6 +203,16 @@ namespace ImageProcessingAtom
             data[2] = F32ToU8(b);
             data[3] = F32ToU8(a);
         }
+
+        void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount) override
+        {
+            ConvertU8ToF32(buf, rgba, pixelCount * 4);
+        }
+
+        void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount) override
+        {
+            ConvertF32ToU8(rgba, buf, pixelCount * 4);
+        }
     };
 
     //ePixelFormat_R8G8B8X8
@@ -149,6 +236,24 @@ namespace ImageProcessingAtom
             data[2] = F32ToU8(b);
             data[3] = 0xff;
         }
+
+        void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount) override
+        {
+            ConvertU8ToF32(buf, rgba, pixelCount * 4);
+            for (uint32 i = 0; i < pixelCount; ++i)
+            {
+                rgba[i * 4 + 3] = 1.f;
+            }
+        }
+
+        void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount) override
+        {
+            ConvertF32ToU8(rgba, buf, pixelCount * 4);
+            for (uint32 i = 0; i < pixelCount; ++i)
+            {
+                buf[i * 4 + 3] = 0xff;
+            }
+        }
     };
 
     //ePixelFormat_B8G8R8A8
@@ -385,6 +490,16 @@ namespace ImageProcessingAtom
             data[2] = b;
             data[3] = a;
         }
+
+        void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount) override
+        {
+            memcpy(rgba, buf, pixelCount * 4 * sizeof(float));
+        }
+
+        void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount) override
+        {
+            memcpy(buf, rgba, pixelCount * 4 * sizeof(float));
+        }
     };
 
     //ePixelFormat_R32G32F
@@ -452,6 +567,24 @@ namespace ImageProcessingAtom
             data[2] = SHalf(b);
             data[3] = SHalf(a);
         }
+
+        void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount) override
+        {
+            const SHalf* data = (SHalf*)(buf);
+            for (uint32 i = 0; i < pixelCount * 4; ++i)
+            {
+                rgba[i] = data[i];
+            }
+        }
+
+        void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount) override
+        {
+            SHalf* data = (SHalf*)(buf);
+            for (uint32 i = 0; i < pixelCount * 4; ++i)
+            {
+                data[i] = SHalf(rgba[i]);
+            }
+        }
     };
 
     //ePixelFormat_R16G16F
@@ -495,52 +628,167 @@ namespace ImageProcessingAtom
             SHalf* data = (SHalf*)(buf);
             data[0] = SHalf(r);
         }
+
+        void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount) override
+        {
+            const SHalf* data = (SHalf*)(buf);
+            for (uint32 i = 0; i < pixelCount; ++i, rgba += 4)
+            {
+                rgba[0] = data[i];
+                rgba[1] = 0.f;
+                rgba[2] = 0.f;
+                rgba[3] = 1.f;
+            }
+        }
+
+        void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount) override
+        {
+            SHalf* data = (SHalf*)(buf);
+            for (uint32 i = 0; i < pixelCount; ++i, rgba += 4)
+            {
+                data[i] = SHalf(rgba[0]);
+            }
+        }
     };
 
     IPixelOperationPtr CreatePixelOperation(EPixelFormat pixelFmt)
     {
+        IPixelOperationPtr pixelOp;
         switch (pixelFmt)
         {
         case ePixelFormat_R8G8B8A8:
-            return AZStd::make_shared<PixelOperationR8G8B8A8>();
+            pixelOp = AZStd::make_shared<PixelOperationR8G8B8A8>();
+            break;
         case ePixelFormat_R8G8B8X8:
-            return AZStd::make_shared<PixelOperationR8G8B8X8>();
+            pixelOp = AZStd::make_shared<PixelOperationR8G8B8X8>();
+            break;
         case ePixelFormat_B8G8R8A8:
-            return AZStd::make_shared<PixelOperationB8G8R8A8>();
+            pixelOp = AZStd::make_shared<PixelOperationB8G8R8A8>();
+            break;
         case ePixelFormat_B8G8R8:
-            return AZStd::make_shared<PixelOperationB8G8R8>();
+            pixelOp = AZStd::make_shared<PixelOperationB8G8R8>();
+            break;
         case ePixelFormat_R8G8B8:
-            return AZStd::make_shared<PixelOperationR8G8B8>();
+            pixelOp = AZStd::make_shared<PixelOperationR8G8B8>();
+            break;
         case ePixelFormat_R8G8:
-            return AZStd::make_shared<PixelOperationR8G8>();
+            pixelOp = AZStd::make_shared<PixelOperationR8G8>();
+            break;
         case ePixelFormat_R8:
-            return AZStd::make_shared<PixelOperationR8>();
+            pixelOp = AZStd::make_shared<PixelOperationR8>();
+            break;
         case ePixelFormat_A8:
-            return AZStd::make_shared<PixelOperationA8>();
+            pixelOp = AZStd::make_shared<PixelOperationA8>();
+            break;
         case ePixelFormat_R16G16B16A16:
-            return AZStd::make_shared<PixelOperationR16G16B16A16>();
+            pixelOp = AZStd::make_shared<PixelOperationR16G16B16A16>();
+            break;
         case ePixelFormat_R16G16:
-            return AZStd::make_shared<PixelOperationR16G16>();
+            pixelOp = AZStd::make_shared<PixelOperationR16G16>();
+            break;
         case ePixelFormat_R16:
-            return AZStd::make_shared<PixelOperationR16>();
+            pixelOp = AZStd::make_shared<PixelOperationR16>();
+            break;
         case ePixelFormat_R9G9B9E5:
-            return AZStd::make_shared<PixelOperationR9G9B9E5>();
+            pixelOp = AZStd::make_shared<PixelOperationR9G9B9E5>();
+            break;
         case ePixelFormat_R32G32B32A32F:
-            return AZStd::make_shared<PixelOperationR32G32B32A32F>();
+            pixelOp = AZStd::make_shared<PixelOperationR32G32B32A32F>();
+            break;
         case ePixelFormat_R32G32F:
-            return AZStd::make_shared<PixelOperationR32G32F>();
+            pixelOp = AZStd::make_shared<PixelOperationR32G32F>();
+            break;
         case ePixelFormat_R32F:
-            return AZStd::make_shared<PixelOperationR32F>();
+            pixelOp = AZStd::make_shared<PixelOperationR32F>();
+            break;
         case ePixelFormat_R16G16B16A16F:
-            return AZStd::make_shared<PixelOperationR16G16B16A16F>();
+            pixelOp = AZStd::make_shared<PixelOperationR16G16B16A16F>();
+            break;
         case ePixelFormat_R16G16F:
-            return AZStd::make_shared<PixelOperationR16G16F>();
+            pixelOp = AZStd::make_shared<PixelOperationR16G16F>();
+            break;
         case ePixelFormat_R16F:
-            return AZStd::make_shared<PixelOperationR16F>();
+            pixelOp = AZStd::make_shared<PixelOperationR16F>();
+            break;
         default:
             AZ_Assert(false, "This function should be only called for uncompressed pixel format");
             break;
         }
-        return nullptr;
+
+        if (pixelOp)
+        {
+            pixelOp->m_pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(pixelFmt)->bitsPerBlock / 8;
+        }
+        return pixelOp;
+    }
+
+    void ConvertPixelRows(IImageObjectPtr srcImage, IImageObjectPtr dstImage, const PixelRowFunction& rowFunction)
+    {
+        const EPixelFormat srcFmt = srcImage->GetPixelFormat();
+        const EPixelFormat dstFmt = dstImage->GetPixelFormat();
+        if (!(CPixelFormats::GetInstance().IsPixelFormatUncompressed(srcFmt)
+              && CPixelFormats::GetInstance().IsPixelFormatUncompressed(dstFmt)))
+        {
+            AZ_Assert(false, "both source and dest images' pixel format need to be uncompressed");
+            return;
+        }
+
+        AZ_Assert(srcImage->GetPixelCount(0) == dstImage->GetPixelCount(0), "dest image has different size than source image");
+
+        //create pixel operation function for src and dst images. They have no state, the jobs share them
+        IPixelOperationPtr srcOp = CreatePixelOperation(srcFmt);
+        IPixelOperationPtr dstOp = CreatePixelOperation(dstFmt);
+
+        //rows are converted in bands of about this many pixels per job. Smaller mips are converted on the calling thread
+        const uint32 pixelsPerJob = 64 * 1024;
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+
+        const uint32 dwMips = dstImage->GetMipCount();
+        for (uint32 dwMip = 0; dwMip < dwMips; ++dwMip)
+        {
+            uint8* srcPixelBuf;
+            uint32 srcPitch;
+            srcImage->GetImagePointer(dwMip, srcPixelBuf, srcPitch);
+            uint8* dstPixelBuf;
+            uint32 dstPitch;
+            dstImage->GetImagePointer(dwMip, dstPixelBuf, dstPitch);
+
+            const uint32 width = srcImage->GetWidth(dwMip);
+            const uint32 height = srcImage->GetHeight(dwMip);
+
+            auto convertRows = [&srcOp, &dstOp, &rowFunction, srcPixelBuf, srcPitch, dstPixelBuf, dstPitch, width](uint32 firstRow, uint32 rowCount)
+            {
+                AZStd::vector<float> rgba(width * 4);
+                for (uint32 row = firstRow; row < firstRow + rowCount; ++row)
+                {
+                    srcOp->GetRGBARow(srcPixelBuf + row * srcPitch, rgba.data(), width);
+                    if (rowFunction)
+                    {
+                        rowFunction(rgba.data(), width);
+                    }
+                    dstOp->SetRGBARow(dstPixelBuf + row * dstPitch, rgba.data(), width);
+                }
+            };
+
+            const uint32 rowsPerJob = AZStd::max(1u, pixelsPerJob / AZStd::max(1u, width));
+            if (!jobContext || height <= rowsPerJob)
+            {
+                convertRows(0, height);
+                continue;
+            }
+
+            AZ::JobCompletion jobCompletion(jobContext);
+            for (uint32 firstRow = 0; firstRow < height; firstRow += rowsPerJob)
+            {
+                const uint32 rowCount = AZStd::min(rowsPerJob, height - firstRow);
+                AZ::Job* job = AZ::CreateJobFunction([&convertRows, firstRow, rowCount]()
+                    {
+                        convertRows(firstRow, rowCount);
+                    }, true, jobContext);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+        }
     }
 } // namespace ImageProcessingAtom
@@ -7,10 +7,16 @@
 
 #pragma once
 
+#include <Atom/ImageProcessing/ImageObject.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
 
+#include <AzCore/std/functional.h>
+
 namespace ImageProcessingAtom
 {
+    class IPixelOperation;
+    typedef AZStd::shared_ptr<IPixelOperation> IPixelOperationPtr;
+
     class IPixelOperation
     {
     public:
@@ -18,8 +24,24 @@ namespace ImageProcessingAtom
 
         virtual void GetRGBA(const uint8* buf, float& r, float& g, float& b, float& a) = 0;
         virtual void SetRGBA(uint8* buf, const float& r, const float& g, const float& b, const float& a) = 0;
+
+        //! Converts a row of pixels to float RGBA, four floats per pixel. Pixel operations of the common formats
+        //! override these with vectorized kernels, the default calls GetRGBA/SetRGBA for each pixel.
+        virtual void GetRGBARow(const uint8* buf, float* rgba, uint32 pixelCount);
+        virtual void SetRGBARow(uint8* buf, const float* rgba, uint32 pixelCount);
+
+    private:
+        friend IPixelOperationPtr CreatePixelOperation(EPixelFormat pixelFmt);
+
+        uint32 m_pixelBytes = 0;
     };
 
-    typedef AZStd::shared_ptr<IPixelOperation> IPixelOperationPtr;
     IPixelOperationPtr CreatePixelOperation(EPixelFormat pixelFmt);
+
+    //! Function applied to a row of pixels in float RGBA, between reading them from the source and writing them to the destination.
+    typedef AZStd::function<void(float* rgba, uint32 pixelCount)> PixelRowFunction;
+
+    //! Converts all mips of an uncompressed image to another image of the same size and an uncompressed format, one row at a time.
+    //! Bands of rows are converted on the job system, so rowFunction (if set) must be safe to call from several threads.
+    void ConvertPixelRows(IImageObjectPtr srcImage, IImageObjectPtr dstImage, const PixelRowFunction& rowFunction = nullptr);
 }// namespace ImageProcessingAtom
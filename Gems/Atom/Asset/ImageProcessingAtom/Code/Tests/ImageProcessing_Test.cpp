@@ -37,6 +37,7 @@
 #include <Compressors/Compressor.h>
 
 #include <Converters/Cubemap.h>
+#include <Converters/PixelOperation.h>
 
 #include <BuilderSettings/BuilderSettingManager.h>
 #include <BuilderSettings/CubemapSettings.h>
@@ -783,6 +784,49 @@ namespace UnitTest
         ASSERT_TRUE(dstImage3->CompareImage(dstImage1));
     }
 
+    TEST_F(ImageProcessingTest, PixelOperationRows_CommonFormats_MatchPerPixelConversion)
+    {
+        //not a multiple of the vector width, so the remainder of the row is covered too
+        const uint32 pixelCount = 37;
+
+        //values halfway between 8 bit steps, plus some out of the [0, 1] range
+        AZStd::vector<float> source(pixelCount * 4);
+        for (uint32 i = 0; i < source.size(); ++i)
+        {
+            source[i] = (i % 7 == 0) ? 1.2f : (i * 0.5f - 5.0f) / 255.f;
+        }
+
+        const EPixelFormat formats[] = { ePixelFormat_R8G8B8A8, ePixelFormat_R8G8B8X8, ePixelFormat_R32G32B32A32F,
+            ePixelFormat_R16G16B16A16F, ePixelFormat_R16F, ePixelFormat_B8G8R8A8 };
+        for (EPixelFormat format : formats)
+        {
+            IPixelOperationPtr pixelOp = CreatePixelOperation(format);
+            const uint32 pixelBytes = CPixelFormats::GetInstance().GetPixelFormatInfo(format)->bitsPerBlock / 8;
+
+            AZStd::vector<uint8> rowPixels(pixelCount * pixelBytes);
+            AZStd::vector<uint8> pixels(pixelCount * pixelBytes);
+            pixelOp->SetRGBARow(rowPixels.data(), source.data(), pixelCount);
+            for (uint32 i = 0; i < pixelCount; ++i)
+            {
+                const float* rgba = &source[i * 4];
+                pixelOp->SetRGBA(&pixels[i * pixelBytes], rgba[0], rgba[1], rgba[2], rgba[3]);
+            }
+            EXPECT_TRUE(rowPixels == pixels);
+
+            AZStd::vector<float> rowRgba(pixelCount * 4);
+            pixelOp->GetRGBARow(pixels.data(), rowRgba.data(), pixelCount);
+            for (uint32 i = 0; i < pixelCount; ++i)
+            {
+                float rgba[4];
+                pixelOp->GetRGBA(&pixels[i * pixelBytes], rgba[0], rgba[1], rgba[2], rgba[3]);
+                EXPECT_EQ(rgba[0], rowRgba[i * 4]);
+                EXPECT_EQ(rgba[1], rowRgba[i * 4 + 1]);
+                EXPECT_EQ(rgba[2], rowRgba[i * 4 + 2]);
+                EXPECT_EQ(rgba[3], rowRgba[i * 4 + 3]);
+            }
+        }
+    }
+
     TEST_F(ImageProcessingTest, DISABLED_TestConvertPVRTC)
     {
         //source image
@@ -54,6 +54,11 @@ namespace AZ
             /// be called from a single thread as a sync point between the append / consume phases.
             void FinalizeLists();
 
+            /// Coalesces the draw list associated with the provided tag, it no-ops if the tag is not present in the
+            /// internal draw list mask. Lists of different tags can be finalized concurrently, e.g. to merge and sort
+            /// each list in its own job. Like FinalizeLists, no draw items may be added while this is running.
+            void FinalizeList(DrawListTag drawListTag);
+
             /// Returns the draw list associated with the provided tag.
             DrawListView GetList(DrawListTag drawListTag) const;
 
@@ -10,6 +10,7 @@
 #include <Atom/RHI/PipelineLibrary.h>
 #include <Atom/RHI/ThreadLocalContext.h>
 #include <AzCore/std/containers/bitset.h>
+#include <AzCore/std/functional.h>
 #include <AzCore/Utils/TypeHash.h>
 
 namespace UnitTest
@@ -129,6 +130,12 @@ namespace AZ
             /// Returns the serialized data for the library, which can be used to re-initialize it.
             ConstPtr<PipelineLibraryData> GetLibrarySerializedData(PipelineLibraryHandle handle) const;
 
+            /**
+             * Calls the visitor with the descriptor of each pipeline state in the library, for example to record the pipeline
+             * states to pre-compile in a later run. Only pipeline states merged into the read-only cache by Compact are visited.
+             */
+            void ForEachLibraryPipelineState(PipelineLibraryHandle handle, const AZStd::function<void(const PipelineStateDescriptor&)>& visitor) const;
+
             /**
              * Acquires a pipeline state (either draw or dispatch variants) from the cache. Pipeline states are associated
              * to a specific library handle. Successive calls with the same pipeline state descriptor hash will return the same
@@ -68,6 +68,7 @@ namespace AZ
 
             ConstPtr<PlatformLimitsDescriptor> m_platformLimitsDescriptor = nullptr;
             RHI::CpuProfilerImpl m_cpuProfiler;
+            bool m_createdFrameArenaAllocator = false;
         };
     } // namespace RPI
 } // namespace AZ
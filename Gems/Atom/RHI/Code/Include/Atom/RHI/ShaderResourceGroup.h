@@ -8,11 +8,27 @@
 
 #include <Atom/RHI/Resource.h>
 #include <Atom/RHI/ShaderResourceGroupData.h>
+#include <Atom/RHI.Reflect/Interval.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        //! Parts of the shader resource group data that changed since the group was last compiled.
+        enum class ShaderResourceGroupDirtyFlags : uint32_t
+        {
+            None                        = 0,
+            Constants                   = AZ_BIT(0),
+            ImageViews                  = AZ_BIT(1),
+            BufferViews                 = AZ_BIT(2),
+            Samplers                    = AZ_BIT(3),
+            ImageViewUnboundedArrays    = AZ_BIT(4),
+            BufferViewUnboundedArrays   = AZ_BIT(5),
+            All                         = Constants | ImageViews | BufferViews | Samplers | ImageViewUnboundedArrays | BufferViewUnboundedArrays
+        };
+
+        AZ_DEFINE_ENUM_BITWISE_OPERATORS(AZ::RHI::ShaderResourceGroupDirtyFlags);
+
          //! This class is a platform-independent base class for a shader resource group. It has a
          //! pointer to the resource group pool, if the user initialized the group onto a pool.
         class ShaderResourceGroup
@@ -52,14 +68,53 @@ namespace AZ
             //! Returns whether the group is currently queued for compilation.
             bool IsQueuedForCompile() const;
 
+            //! Returns the types of data that changed since the group was last compiled, IsShaderInputDirty tells which
+            //! shader inputs changed. Platforms can use this in CompileGroupInternal to skip unchanged parts, as long as
+            //! the compiled data they write to still holds the previous contents. The flags are cleared once the group is compiled.
+            ShaderResourceGroupDirtyFlags GetDirtyFlags() const;
+
+            //! Returns the [min, max) byte interval of the constant data that changed since the group was last compiled.
+            //! The interval is empty if the constants are not dirty.
+            Interval GetDirtyConstantInterval() const;
+
+            //! Returns whether the views or samplers bound to a shader input changed since the group was last compiled.
+            //! @{
+            bool IsShaderInputDirty(ShaderInputImageIndex inputIndex) const;
+            bool IsShaderInputDirty(ShaderInputBufferIndex inputIndex) const;
+            bool IsShaderInputDirty(ShaderInputSamplerIndex inputIndex) const;
+            bool IsShaderInputDirty(ShaderInputImageUnboundedArrayIndex inputIndex) const;
+            bool IsShaderInputDirty(ShaderInputBufferUnboundedArrayIndex inputIndex) const;
+            //! @}
+
         protected:
             ShaderResourceGroup() = default;
 
         private:
             void SetData(const ShaderResourceGroupData& data);
 
+            // Marks all of the data as changed, so the next compile writes the whole group.
+            void SetAllDirty();
+
+            // Clears the dirty state after the group is compiled.
+            void ClearDirty();
+
+            // Returns the number of view and sampler shader inputs, and how many of them are dirty.
+            uint32_t GetShaderInputCount() const;
+            uint32_t GetDirtyShaderInputCount() const;
+
             ShaderResourceGroupData m_data;
 
+            // Parts of m_data that changed since the last compile.
+            ShaderResourceGroupDirtyFlags m_dirtyFlags = ShaderResourceGroupDirtyFlags::All;
+            Interval m_dirtyConstantInterval;
+
+            // A dirty bit per shader input index of each view and sampler type, sized from the layout.
+            AZStd::vector<bool> m_dirtyImageInputs;
+            AZStd::vector<bool> m_dirtyBufferInputs;
+            AZStd::vector<bool> m_dirtySamplerInputs;
+            AZStd::vector<bool> m_dirtyImageUnboundedArrayInputs;
+            AZStd::vector<bool> m_dirtyBufferUnboundedArrayInputs;
+
             // The binding slot cached from the layout.
             uint32_t m_bindingSlot = (uint32_t)-1;
 
@@ -12,12 +12,35 @@
 #include <Atom/RHI/ShaderResourceGroupInvalidateRegistry.h>
 #include <Atom/RHI/ResourcePool.h>
 
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/containers/concurrent_vector.h>
 
 namespace AZ
 {
     namespace RHI
     {
+        //! Statistics of the shader resource groups compiled by a pool over a frame.
+        struct ShaderResourceGroupCompileStatistics
+        {
+            //! Number of groups compiled.
+            uint32_t m_compiledGroupCount = 0;
+
+            //! Number of compile requests that were skipped because the group data did not change.
+            uint32_t m_skippedGroupCount = 0;
+
+            //! Bytes of constant data written by the compiled groups.
+            uint64_t m_compiledConstantBytes = 0;
+
+            //! Bytes of constant data within the dirty intervals of the compiled groups.
+            uint64_t m_dirtyConstantBytes = 0;
+
+            //! Number of view and sampler shader inputs of the compiled groups.
+            uint32_t m_compiledShaderInputCount = 0;
+
+            //! Number of view and sampler shader inputs of the compiled groups whose bound views or samplers changed.
+            uint32_t m_dirtyShaderInputCount = 0;
+        };
+
          //! The platform-independent base class for ShaderResourceGroupPools. Platforms
          //! should inherit from this class to implement platform-dependent pooling of
          //! shader resource groups.
@@ -72,6 +95,10 @@ namespace AZ
             //! Returns whether groups in this pool have a sampler table.
             bool HasSamplerGroup() const;
 
+            //! Returns the statistics of the groups compiled up to the last CompileGroupsEnd() call,
+            //! since the CompileGroupsEnd() call before it.
+            const ShaderResourceGroupCompileStatistics& GetCompileStatistics() const;
+
         protected:
             ShaderResourceGroupPool();
 
@@ -99,6 +126,15 @@ namespace AZ
 
             // Calculate diffs for updating the resource registry.
             void CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData);
+
+            // Adds the parts of the new data that differ from the current data of the group to its dirty state.
+            void CalculateGroupDirtyState(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData) const;
+
+            // Compiles a group with its current data, clears its dirty state and adds it to the statistics.
+            void CompileGroup(ShaderResourceGroup& shaderResourceGroup, ShaderResourceGroupCompileStatistics& statistics);
+
+            // Adds statistics gathered by a compile to the running statistics of the pool.
+            void AddCompileStatistics(const ShaderResourceGroupCompileStatistics& statistics);
           
             //////////////////////////////////////////////////////////////////////////
             // Platform API
@@ -129,6 +165,17 @@ namespace AZ
 
             AZStd::mutex m_invalidateRegistryMutex;
             ShaderResourceGroupInvalidateRegistry m_invalidateRegistry;
+
+            // Running compile statistics, groups can be compiled from several jobs at once.
+            AZStd::atomic<uint32_t> m_compiledGroupCount{ 0 };
+            AZStd::atomic<uint32_t> m_skippedGroupCount{ 0 };
+            AZStd::atomic<uint64_t> m_compiledConstantBytes{ 0 };
+            AZStd::atomic<uint64_t> m_dirtyConstantBytes{ 0 };
+            AZStd::atomic<uint32_t> m_compiledShaderInputCount{ 0 };
+            AZStd::atomic<uint32_t> m_dirtyShaderInputCount{ 0 };
+
+            // Statistics captured by the last CompileGroupsEnd() call.
+            ShaderResourceGroupCompileStatistics m_compileStatistics;
         };
     }
 }
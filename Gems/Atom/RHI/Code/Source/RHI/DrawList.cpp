@@ -6,6 +6,8 @@
  */
 #include <Atom/RHI/DrawList.h>
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -25,8 +27,152 @@ namespace AZ
             return DrawListView(&drawList[itemOffset], itemCount);
         }
 
+        namespace
+        {
+            // Lists smaller than this are sorted with a comparison sort, the radix sort passes don't pay off for them.
+            constexpr size_t RadixSortThreshold = 256;
+
+            constexpr uint32_t RadixBits = 8;
+            constexpr uint32_t RadixBucketCount = 1 << RadixBits;
+            constexpr uint32_t SortKeyDigitCount = sizeof(uint64_t) * 8 / RadixBits;
+            constexpr uint32_t DepthDigitCount = sizeof(uint32_t) * 8 / RadixBits;
+
+            // Draw item sort key and depth as unsigned integers that sort in the same order, plus the index of the item in the list.
+            struct RadixSortEntry
+            {
+                uint64_t m_sortKey;
+                uint32_t m_depth;
+                uint32_t m_index;
+            };
+
+            using RadixSortEntryList = AZStd::vector<RadixSortEntry, FrameArenaStdAllocator>;
+
+            uint64_t GetRadixSortKey(DrawItemSortKey sortKey)
+            {
+                // Flipping the sign bit maps the signed range to the unsigned range in the same order.
+                return static_cast<uint64_t>(sortKey) ^ (uint64_t(1) << 63);
+            }
+
+            uint32_t GetRadixSortDepth(float depth, bool reverseDepth)
+            {
+                // Positive floats sort like their bits once the sign bit is set, negative floats sort in the reverse order
+                // of their bits, so all of their bits are flipped.
+                uint32_t bits;
+                memcpy(&bits, &depth, sizeof(bits));
+                bits = (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+                return reverseDepth ? ~bits : bits;
+            }
+
+            template<typename KeyType>
+            void BuildHistograms(KeyType key, uint32_t (*histograms)[RadixBucketCount])
+            {
+                for (uint32_t digitIndex = 0; digitIndex < sizeof(KeyType) * 8 / RadixBits; ++digitIndex)
+                {
+                    ++histograms[digitIndex][(key >> (digitIndex * RadixBits)) & (RadixBucketCount - 1)];
+                }
+            }
+
+            // One pass of the radix sort, scatters the entries into the buckets of the digit at the shift.
+            template<typename KeyType, KeyType RadixSortEntry::*Key>
+            void RadixSortPass(const RadixSortEntryList& entries, RadixSortEntryList& sortedEntries, uint32_t* histogram, uint32_t shift)
+            {
+                // Turn the counts into the offsets of the buckets
+                uint32_t offset = 0;
+                for (uint32_t bucketIndex = 0; bucketIndex < RadixBucketCount; ++bucketIndex)
+                {
+                    const uint32_t count = histogram[bucketIndex];
+                    histogram[bucketIndex] = offset;
+                    offset += count;
+                }
+
+                for (const RadixSortEntry& entry : entries)
+                {
+                    sortedEntries[histogram[(entry.*Key >> shift) & (RadixBucketCount - 1)]++] = entry;
+                }
+            }
+
+            /**
+             * Sorts the draw list with a LSD radix sort on the combined (sort key, depth) key, in the order of the sort type.
+             * The histograms of all digits are built in a single pass, and digits that are the same for all items are skipped,
+             * which leaves only a few passes in the common cases (e.g. all items with the same sort key, or no depth).
+             * The sort is stable.
+             */
+            void RadixSortDrawList(DrawList& drawList, DrawListSortType sortType)
+            {
+                const bool depthFirst = sortType == DrawListSortType::DepthThenKey || sortType == DrawListSortType::ReverseDepthThenKey;
+                const bool reverseDepth = sortType == DrawListSortType::KeyThenReverseDepth || sortType == DrawListSortType::ReverseDepthThenKey;
+                const uint32_t itemCount = aznumeric_cast<uint32_t>(drawList.size());
+
+                FrameArenaScope frameArenaScope;
+                RadixSortEntryList entries(itemCount);
+                RadixSortEntryList scratchEntries(itemCount);
+
+                uint32_t sortKeyHistograms[SortKeyDigitCount][RadixBucketCount] = {};
+                uint32_t depthHistograms[DepthDigitCount][RadixBucketCount] = {};
+                for (uint32_t i = 0; i < itemCount; ++i)
+                {
+                    RadixSortEntry& entry = entries[i];
+                    entry.m_sortKey = GetRadixSortKey(drawList[i].m_sortKey);
+                    entry.m_depth = GetRadixSortDepth(drawList[i].m_depth, reverseDepth);
+                    entry.m_index = i;
+
+                    BuildHistograms(entry.m_sortKey, sortKeyHistograms);
+                    BuildHistograms(entry.m_depth, depthHistograms);
+                }
+
+                // Sorts by one digit, unless all items have the same digit and the pass wouldn't change the order
+                const auto sortDigit = [&](bool isDepthDigit, uint32_t digitIndex)
+                {
+                    const uint32_t shift = digitIndex * RadixBits;
+                    if (isDepthDigit)
+                    {
+                        uint32_t* histogram = depthHistograms[digitIndex];
+                        if (histogram[(entries[0].m_depth >> shift) & (RadixBucketCount - 1)] != itemCount)
+                        {
+                            RadixSortPass<uint32_t, &RadixSortEntry::m_depth>(entries, scratchEntries, histogram, shift);
+                            entries.swap(scratchEntries);
+                        }
+                    }
+                    else
+                    {
+                        uint32_t* histogram = sortKeyHistograms[digitIndex];
+                        if (histogram[(entries[0].m_sortKey >> shift) & (RadixBucketCount - 1)] != itemCount)
+                        {
+                            RadixSortPass<uint64_t, &RadixSortEntry::m_sortKey>(entries, scratchEntries, histogram, shift);
+                            entries.swap(scratchEntries);
+                        }
+                    }
+                };
+
+                // Least significant digits first, the secondary key is sorted before the primary one
+                const uint32_t secondaryDigitCount = depthFirst ? SortKeyDigitCount : DepthDigitCount;
+                const uint32_t primaryDigitCount = depthFirst ? DepthDigitCount : SortKeyDigitCount;
+                for (uint32_t digitIndex = 0; digitIndex < secondaryDigitCount; ++digitIndex)
+                {
+                    sortDigit(!depthFirst, digitIndex);
+                }
+                for (uint32_t digitIndex = 0; digitIndex < primaryDigitCount; ++digitIndex)
+                {
+                    sortDigit(depthFirst, digitIndex);
+                }
+
+                AZStd::vector<DrawItemProperties, FrameArenaStdAllocator> unsortedItems(drawList.begin(), drawList.end());
+                for (uint32_t i = 0; i < itemCount; ++i)
+                {
+                    drawList[i] = unsortedItems[entries[i].m_index];
+                }
+            }
+        }
+
         void SortDrawList(DrawList& drawList, DrawListSortType sortType)
         {
+            // The radix sort takes its scratch memory from the frame arena, use the comparison sort if there is none
+            if (drawList.size() >= RadixSortThreshold && AllocatorInstance<FrameArenaAllocator>::IsReady())
+            {
+                RadixSortDrawList(drawList, sortType);
+                return;
+            }
+
             switch (sortType)
             {
             case DrawListSortType::KeyThenDepth:
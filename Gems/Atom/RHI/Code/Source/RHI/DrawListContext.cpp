@@ -85,11 +85,25 @@ namespace AZ
 
         void DrawListContext::FinalizeLists()
         {
+            // Count the items first, so each merged list is allocated once
+            AZStd::array<size_t, RHI::Limits::Pipeline::DrawListTagCountMax> itemCounts = {};
+            m_threadListsByTag.ForEach([this, &itemCounts](DrawListsByTag& drawListsByTag)
+            {
+                for (size_t i = 0; i < drawListsByTag.size(); ++i)
+                {
+                    if (m_drawListMask[i])
+                    {
+                        itemCounts[i] += drawListsByTag[i].size();
+                    }
+                }
+            });
+
             for (size_t i = 0; i < m_mergedListsByTag.size(); ++i)
             {
                 if (m_drawListMask[i])
                 {
                     m_mergedListsByTag[i].clear();
+                    m_mergedListsByTag[i].reserve(itemCounts[i]);
                 }
             }
 
@@ -109,6 +123,32 @@ namespace AZ
             });
         }
 
+        void DrawListContext::FinalizeList(DrawListTag drawListTag)
+        {
+            const size_t tagIndex = drawListTag.GetIndex();
+            if (!m_drawListMask[tagIndex])
+            {
+                return;
+            }
+
+            size_t itemCount = 0;
+            m_threadListsByTag.ForEach([tagIndex, &itemCount](DrawListsByTag& drawListsByTag)
+            {
+                itemCount += drawListsByTag[tagIndex].size();
+            });
+
+            DrawList& resultList = m_mergedListsByTag[tagIndex];
+            resultList.clear();
+            resultList.reserve(itemCount);
+
+            m_threadListsByTag.ForEach([tagIndex, &resultList](DrawListsByTag& drawListsByTag)
+            {
+                DrawList& sourceList = drawListsByTag[tagIndex];
+                resultList.insert(resultList.end(), sourceList.begin(), sourceList.end());
+                sourceList.clear();
+            });
+        }
+
         DrawListView DrawListContext::GetList(DrawListTag drawListTag) const
         {
             if (drawListTag.IsValid())
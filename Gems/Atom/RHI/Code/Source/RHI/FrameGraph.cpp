@@ -18,6 +18,7 @@
 #include <Atom/RHI/SwapChain.h>
 #include <Atom/RHI/SwapChainFrameAttachment.h>
 #include <AzCore/Debug/EventTrace.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ
@@ -438,15 +439,19 @@ namespace AZ
                 uint16_t m_groupId;
             };
 
-            AZStd::vector<NodeId> unblockedNodes;
+            // The sort is redone every frame, keep its temporary containers in the frame arena.
+            FrameArenaScope frameArenaScope;
+            using EdgeList = AZStd::list<uint32_t, FrameArenaStdAllocator>;
+
+            AZStd::vector<NodeId, FrameArenaStdAllocator> unblockedNodes;
             unblockedNodes.reserve(m_graphNodes.size());
 
             // Build a list with the edges for each producer node.
-            AZStd::vector<AZStd::list<uint32_t>> graphEdges(m_graphNodes.size());
+            AZStd::vector<EdgeList, FrameArenaStdAllocator> graphEdges(m_graphNodes.size());
             for (uint32_t edgeIndex = 0; edgeIndex < m_graphEdges.size(); ++edgeIndex)
             {
                 const GraphEdge& edge = m_graphEdges[edgeIndex];
-                AZStd::list<uint32_t>& edgeList = graphEdges[edge.m_producerIndex];
+                EdgeList& edgeList = graphEdges[edge.m_producerIndex];
                 // Push group edges at the front so they are processed before the single ones.
                 // We need this so nodes in the same group are together.
                 switch (edge.m_type)
@@ -515,7 +520,7 @@ namespace AZ
             if (Validation::IsEnabled())
             {
                 AZStd::string cycleInfoString = "Error, a cycle exists in the graph. Failed to topologically sort. Remaining Edges:\n";
-                for (const AZStd::list<uint32_t>& edgeList : graphEdges)
+                for (const EdgeList& edgeList : graphEdges)
                 {
                     for (uint32_t edgeIndex : edgeList)
                     {
@@ -202,6 +202,25 @@ namespace AZ
             return nullptr;
         }
 
+        void PipelineStateCache::ForEachLibraryPipelineState(PipelineLibraryHandle handle, const AZStd::function<void(const PipelineStateDescriptor&)>& visitor) const
+        {
+            if (handle.IsNull())
+            {
+                return;
+            }
+
+            AZStd::shared_lock<AZStd::shared_mutex> lock(m_mutex);
+
+            const GlobalLibraryEntry& entry = m_globalLibrarySet[handle.GetIndex()];
+            for (const PipelineStateEntry& pipelineStateEntry : entry.m_readOnlyCache)
+            {
+                AZStd::visit([&visitor](const auto& descriptor)
+                {
+                    visitor(descriptor);
+                }, pipelineStateEntry.m_pipelineStateDescriptorVariant);
+            }
+        }
+
         void PipelineStateCache::Compact()
         {
             AZStd::unique_lock<AZStd::shared_mutex> lock(m_mutex);
@@ -12,6 +12,7 @@
 #include <Atom/RHI/RHIUtils.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 
 #include <AzFramework/API/ApplicationAPI.h>
 #include <AzFramework/CommandLine/CommandLine.h>
@@ -37,6 +38,13 @@ namespace AZ
         {
             m_cpuProfiler.Init();
 
+            // Frame graph compilation and culling keep their temporary data in the frame arena.
+            if (!AllocatorInstance<FrameArenaAllocator>::IsReady())
+            {
+                AllocatorInstance<FrameArenaAllocator>::Create();
+                m_createdFrameArenaAllocator = true;
+            }
+
             RHI::FrameSchedulerDescriptor frameSchedulerDescriptor;
             if (descriptor.m_platformLimits)
             {
@@ -204,6 +212,12 @@ namespace AZ
             }
 
             m_cpuProfiler.Shutdown();
+
+            if (m_createdFrameArenaAllocator)
+            {
+                AllocatorInstance<FrameArenaAllocator>::Destroy();
+                m_createdFrameArenaAllocator = false;
+            }
         }
 
         void RHISystem::FrameUpdate(FrameGraphCallback frameGraphCallback)
@@ -8,6 +8,7 @@
 #include <Atom/RHI/ShaderResourceGroupPool.h>
 #include <Atom/RHI/BufferView.h>
 #include <Atom/RHI/ImageView.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
@@ -39,6 +40,88 @@ namespace AZ
             return m_isQueuedForCompile;
         }
 
+        ShaderResourceGroupDirtyFlags ShaderResourceGroup::GetDirtyFlags() const
+        {
+            return m_dirtyFlags;
+        }
+
+        Interval ShaderResourceGroup::GetDirtyConstantInterval() const
+        {
+            return m_dirtyConstantInterval;
+        }
+
+        bool ShaderResourceGroup::IsShaderInputDirty(ShaderInputImageIndex inputIndex) const
+        {
+            return m_dirtyImageInputs[inputIndex.GetIndex()];
+        }
+
+        bool ShaderResourceGroup::IsShaderInputDirty(ShaderInputBufferIndex inputIndex) const
+        {
+            return m_dirtyBufferInputs[inputIndex.GetIndex()];
+        }
+
+        bool ShaderResourceGroup::IsShaderInputDirty(ShaderInputSamplerIndex inputIndex) const
+        {
+            return m_dirtySamplerInputs[inputIndex.GetIndex()];
+        }
+
+        bool ShaderResourceGroup::IsShaderInputDirty(ShaderInputImageUnboundedArrayIndex inputIndex) const
+        {
+            return m_dirtyImageUnboundedArrayInputs[inputIndex.GetIndex()];
+        }
+
+        bool ShaderResourceGroup::IsShaderInputDirty(ShaderInputBufferUnboundedArrayIndex inputIndex) const
+        {
+            return m_dirtyBufferUnboundedArrayInputs[inputIndex.GetIndex()];
+        }
+
+        void ShaderResourceGroup::SetAllDirty()
+        {
+            m_dirtyFlags = ShaderResourceGroupDirtyFlags::All;
+            m_dirtyConstantInterval = Interval(0, static_cast<uint32_t>(m_data.GetConstantData().size()));
+
+            if (const ShaderResourceGroupLayout* layout = m_data.GetLayout())
+            {
+                m_dirtyImageInputs.assign(layout->GetShaderInputListForImages().size(), true);
+                m_dirtyBufferInputs.assign(layout->GetShaderInputListForBuffers().size(), true);
+                m_dirtySamplerInputs.assign(layout->GetShaderInputListForSamplers().size(), true);
+                m_dirtyImageUnboundedArrayInputs.assign(layout->GetShaderInputListForImageUnboundedArrays().size(), true);
+                m_dirtyBufferUnboundedArrayInputs.assign(layout->GetShaderInputListForBufferUnboundedArrays().size(), true);
+            }
+        }
+
+        void ShaderResourceGroup::ClearDirty()
+        {
+            m_dirtyFlags = ShaderResourceGroupDirtyFlags::None;
+            m_dirtyConstantInterval = Interval();
+
+            for (AZStd::vector<bool>* dirtyInputs : { &m_dirtyImageInputs, &m_dirtyBufferInputs, &m_dirtySamplerInputs,
+                &m_dirtyImageUnboundedArrayInputs, &m_dirtyBufferUnboundedArrayInputs })
+            {
+                AZStd::fill(dirtyInputs->begin(), dirtyInputs->end(), false);
+            }
+        }
+
+        uint32_t ShaderResourceGroup::GetShaderInputCount() const
+        {
+            return static_cast<uint32_t>(m_dirtyImageInputs.size() + m_dirtyBufferInputs.size() + m_dirtySamplerInputs.size() +
+                m_dirtyImageUnboundedArrayInputs.size() + m_dirtyBufferUnboundedArrayInputs.size());
+        }
+
+        uint32_t ShaderResourceGroup::GetDirtyShaderInputCount() const
+        {
+            uint32_t dirtyCount = 0;
+            for (const AZStd::vector<bool>* dirtyInputs : { &m_dirtyImageInputs, &m_dirtyBufferInputs, &m_dirtySamplerInputs,
+                &m_dirtyImageUnboundedArrayInputs, &m_dirtyBufferUnboundedArrayInputs })
+            {
+                for (bool isDirty : *dirtyInputs)
+                {
+                    dirtyCount += isDirty ? 1 : 0;
+                }
+            }
+            return dirtyCount;
+        }
+
         const ShaderResourceGroupPool* ShaderResourceGroup::GetPool() const
         {
             return static_cast<const ShaderResourceGroupPool*>(Resource::GetPool());
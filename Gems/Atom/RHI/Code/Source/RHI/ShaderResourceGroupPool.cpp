@@ -69,6 +69,9 @@ namespace AZ
                 // Pre-initialize the data so that we can build view diffs later.
                 group.m_data = ShaderResourceGroupData(layout);
 
+                // The group has never been compiled, the first compile must write all of it.
+                group.SetAllDirty();
+
                 // Cache off the binding slot for one less indirection.
                 group.m_bindingSlot = layout->GetBindingSlot();
             }
@@ -112,6 +115,14 @@ namespace AZ
 
             AZ_Assert(!shaderResourceGroup.IsQueuedForCompile(), "Attempting to compile an SRG that's already been queued for compile. Only compile an SRG once per frame.");            
 
+            CalculateGroupDirtyState(shaderResourceGroup, groupData);
+            if (shaderResourceGroup.GetDirtyFlags() == ShaderResourceGroupDirtyFlags::None)
+            {
+                // Nothing changed since the last compile, the compiled data is still valid.
+                m_skippedGroupCount.fetch_add(1, AZStd::memory_order_relaxed);
+                return;
+            }
+
             CalculateGroupDataDiff(shaderResourceGroup, groupData);
 
             shaderResourceGroup.SetData(groupData);
@@ -122,6 +133,9 @@ namespace AZ
         void ShaderResourceGroupPool::QueueForCompile(ShaderResourceGroup& group)
         {
             AZStd::lock_guard<AZStd::shared_mutex> lock(m_groupsToCompileMutex);
+
+            // A resource the group references was invalidated, so none of the compiled data can be reused.
+            group.SetAllDirty();
             QueueForCompileNoLock(group);
         }
 
@@ -146,9 +160,157 @@ namespace AZ
 
         void ShaderResourceGroupPool::Compile(ShaderResourceGroup& group, const ShaderResourceGroupData& groupData)
         {
+            CalculateGroupDirtyState(group, groupData);
             CalculateGroupDataDiff(group, groupData);
             group.SetData(groupData);
+
+            ShaderResourceGroupCompileStatistics statistics;
+            CompileGroup(group, statistics);
+            AddCompileStatistics(statistics);
+        }
+
+        void ShaderResourceGroupPool::CompileGroup(ShaderResourceGroup& group, ShaderResourceGroupCompileStatistics& statistics)
+        {
             CompileGroupInternal(group, group.GetData());
+
+            const Interval dirtyConstantInterval = group.GetDirtyConstantInterval();
+            ++statistics.m_compiledGroupCount;
+            statistics.m_compiledConstantBytes += group.GetData().GetConstantData().size();
+            statistics.m_dirtyConstantBytes += dirtyConstantInterval.m_max - dirtyConstantInterval.m_min;
+            statistics.m_compiledShaderInputCount += group.GetShaderInputCount();
+            statistics.m_dirtyShaderInputCount += group.GetDirtyShaderInputCount();
+
+            group.ClearDirty();
+        }
+
+        void ShaderResourceGroupPool::AddCompileStatistics(const ShaderResourceGroupCompileStatistics& statistics)
+        {
+            m_compiledGroupCount.fetch_add(statistics.m_compiledGroupCount, AZStd::memory_order_relaxed);
+            m_skippedGroupCount.fetch_add(statistics.m_skippedGroupCount, AZStd::memory_order_relaxed);
+            m_compiledConstantBytes.fetch_add(statistics.m_compiledConstantBytes, AZStd::memory_order_relaxed);
+            m_dirtyConstantBytes.fetch_add(statistics.m_dirtyConstantBytes, AZStd::memory_order_relaxed);
+            m_compiledShaderInputCount.fetch_add(statistics.m_compiledShaderInputCount, AZStd::memory_order_relaxed);
+            m_dirtyShaderInputCount.fetch_add(statistics.m_dirtyShaderInputCount, AZStd::memory_order_relaxed);
+        }
+
+        void ShaderResourceGroupPool::CalculateGroupDirtyState(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData) const
+        {
+            const ShaderResourceGroupData& currentData = shaderResourceGroup.GetData();
+            const ShaderResourceGroupLayout& layout = *GetLayout();
+
+            const auto ViewsDiffer = [](const auto& viewGroupOld, const auto& viewGroupNew)
+            {
+                if (viewGroupOld.size() != viewGroupNew.size())
+                {
+                    return true;
+                }
+                for (size_t i = 0; i < viewGroupOld.size(); ++i)
+                {
+                    if (viewGroupOld[i].get() != viewGroupNew[i].get())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
+
+            ShaderResourceGroupDirtyFlags dirtyFlags = ShaderResourceGroupDirtyFlags::None;
+
+            if (HasConstants())
+            {
+                AZStd::array_view<uint8_t> constantsOld = currentData.GetConstantData();
+                AZStd::array_view<uint8_t> constantsNew = groupData.GetConstantData();
+                AZ_Assert(constantsOld.size() == constantsNew.size(), "ShaderResourceGroupData layouts do not match.");
+
+                const uint32_t constantsSize = static_cast<uint32_t>(constantsNew.size());
+                if (memcmp(constantsOld.data(), constantsNew.data(), constantsSize) != 0)
+                {
+                    // Narrow the change down to the bytes between the first and the last one that differ.
+                    uint32_t changedMin = 0;
+                    while (constantsOld[changedMin] == constantsNew[changedMin])
+                    {
+                        ++changedMin;
+                    }
+                    uint32_t changedMax = constantsSize;
+                    while (constantsOld[changedMax - 1] == constantsNew[changedMax - 1])
+                    {
+                        --changedMax;
+                    }
+
+                    Interval& dirtyInterval = shaderResourceGroup.m_dirtyConstantInterval;
+                    if (dirtyInterval.m_min == dirtyInterval.m_max)
+                    {
+                        dirtyInterval = Interval(changedMin, changedMax);
+                    }
+                    else
+                    {
+                        dirtyInterval = Interval(AZStd::min(dirtyInterval.m_min, changedMin), AZStd::max(dirtyInterval.m_max, changedMax));
+                    }
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::Constants;
+                }
+            }
+
+            // Views and samplers are compared per shader input, so the group knows which inputs have to be written again.
+            const uint32_t imageInputCount = static_cast<uint32_t>(layout.GetShaderInputListForImages().size());
+            for (uint32_t i = 0; i < imageInputCount; ++i)
+            {
+                const ShaderInputImageIndex inputIndex(i);
+                if (ViewsDiffer(currentData.GetImageViewArray(inputIndex), groupData.GetImageViewArray(inputIndex)))
+                {
+                    shaderResourceGroup.m_dirtyImageInputs[i] = true;
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::ImageViews;
+                }
+            }
+
+            const uint32_t bufferInputCount = static_cast<uint32_t>(layout.GetShaderInputListForBuffers().size());
+            for (uint32_t i = 0; i < bufferInputCount; ++i)
+            {
+                const ShaderInputBufferIndex inputIndex(i);
+                if (ViewsDiffer(currentData.GetBufferViewArray(inputIndex), groupData.GetBufferViewArray(inputIndex)))
+                {
+                    shaderResourceGroup.m_dirtyBufferInputs[i] = true;
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::BufferViews;
+                }
+            }
+
+            const uint32_t samplerInputCount = static_cast<uint32_t>(layout.GetShaderInputListForSamplers().size());
+            for (uint32_t i = 0; i < samplerInputCount; ++i)
+            {
+                // Sampler states are hashed by their bytes, so comparing the bytes matches their identity.
+                const ShaderInputSamplerIndex inputIndex(i);
+                AZStd::array_view<SamplerState> samplersOld = currentData.GetSamplerArray(inputIndex);
+                AZStd::array_view<SamplerState> samplersNew = groupData.GetSamplerArray(inputIndex);
+                if (samplersOld.size() != samplersNew.size() ||
+                    memcmp(samplersOld.data(), samplersNew.data(), samplersNew.size() * sizeof(SamplerState)) != 0)
+                {
+                    shaderResourceGroup.m_dirtySamplerInputs[i] = true;
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::Samplers;
+                }
+            }
+
+            const uint32_t imageUnboundedArrayCount = static_cast<uint32_t>(layout.GetShaderInputListForImageUnboundedArrays().size());
+            for (uint32_t i = 0; i < imageUnboundedArrayCount; ++i)
+            {
+                const ShaderInputImageUnboundedArrayIndex inputIndex(i);
+                if (ViewsDiffer(currentData.GetImageViewUnboundedArray(inputIndex), groupData.GetImageViewUnboundedArray(inputIndex)))
+                {
+                    shaderResourceGroup.m_dirtyImageUnboundedArrayInputs[i] = true;
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::ImageViewUnboundedArrays;
+                }
+            }
+
+            const uint32_t bufferUnboundedArrayCount = static_cast<uint32_t>(layout.GetShaderInputListForBufferUnboundedArrays().size());
+            for (uint32_t i = 0; i < bufferUnboundedArrayCount; ++i)
+            {
+                const ShaderInputBufferUnboundedArrayIndex inputIndex(i);
+                if (ViewsDiffer(currentData.GetBufferViewUnboundedArray(inputIndex), groupData.GetBufferViewUnboundedArray(inputIndex)))
+                {
+                    shaderResourceGroup.m_dirtyBufferUnboundedArrayInputs[i] = true;
+                    dirtyFlags |= ShaderResourceGroupDirtyFlags::BufferViewUnboundedArrays;
+                }
+            }
+
+            shaderResourceGroup.m_dirtyFlags |= dirtyFlags;
         }
 
         void ShaderResourceGroupPool::CalculateGroupDataDiff(ShaderResourceGroup& shaderResourceGroup, const ShaderResourceGroupData& groupData)
@@ -232,6 +394,14 @@ namespace AZ
             AZ_Assert(m_isCompiling, "CompileGroupsBegin() was never called.");
             m_isCompiling = false;
             m_groupsToCompile.clear();
+
+            m_compileStatistics.m_compiledGroupCount = m_compiledGroupCount.exchange(0);
+            m_compileStatistics.m_skippedGroupCount = m_skippedGroupCount.exchange(0);
+            m_compileStatistics.m_compiledConstantBytes = m_compiledConstantBytes.exchange(0);
+            m_compileStatistics.m_dirtyConstantBytes = m_dirtyConstantBytes.exchange(0);
+            m_compileStatistics.m_compiledShaderInputCount = m_compiledShaderInputCount.exchange(0);
+            m_compileStatistics.m_dirtyShaderInputCount = m_dirtyShaderInputCount.exchange(0);
+
             m_groupsToCompileMutex.unlock();
         }
 
@@ -251,12 +421,14 @@ namespace AZ
                 interval.m_max <= static_cast<uint32_t>(m_groupsToCompile.size()),
                 "You must specify a valid interval for compilation");
 
+            ShaderResourceGroupCompileStatistics statistics;
             for (uint32_t i = interval.m_min; i < interval.m_max; ++i)
             {
                 ShaderResourceGroup* group = m_groupsToCompile[i];
-                CompileGroupInternal(*group, group->GetData());
+                CompileGroup(*group, statistics);
                 group->m_isQueuedForCompile = false;
             }
+            AddCompileStatistics(statistics);
         }
 
         ResultCode ShaderResourceGroupPool::InitInternal(Device&, const ShaderResourceGroupPoolDescriptor&)
@@ -299,5 +471,10 @@ namespace AZ
         {
             return m_hasSamplerGroup;
         }
+
+        const ShaderResourceGroupCompileStatistics& ShaderResourceGroupPool::GetCompileStatistics() const
+        {
+            return m_compileStatistics;
+        }
     }
 }
@@ -13,6 +13,7 @@
 #include <Atom/RHI/DrawListTagRegistry.h>
 #include <Atom/RHI/PipelineState.h>
 
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/sort.h>
 
@@ -156,6 +157,57 @@ namespace UnitTest
         AZStd::vector<DrawItemData> m_drawItemDatas;
     };
 
+    // Builds a list of draw items with random sort keys and depths, the draw item pointers are only used to identify the items.
+    RHI::DrawList BuildRandomDrawList(SimpleLcgRandom& random, size_t itemCount, uint32_t sortKeyCount)
+    {
+        RHI::DrawList drawList;
+        drawList.reserve(itemCount);
+        for (size_t i = 0; i < itemCount; ++i)
+        {
+            // Either a few distinct sort keys, or keys spread over the whole range
+            const RHI::DrawItemSortKey sortKey = sortKeyCount
+                ? static_cast<RHI::DrawItemSortKey>(random.GetRandom() % sortKeyCount)
+                : static_cast<RHI::DrawItemSortKey>((static_cast<uint64_t>(random.GetRandom()) << 32) | random.GetRandom());
+
+            RHI::DrawItemProperties drawItem(reinterpret_cast<const RHI::DrawItem*>(i + 1), sortKey);
+            drawItem.m_depth = (random.GetRandomFloat() - 0.5f) * 1000.0f;
+            drawList.push_back(drawItem);
+        }
+        return drawList;
+    }
+
+    bool IsDrawListSorted(const RHI::DrawList& drawList, RHI::DrawListSortType sortType)
+    {
+        for (size_t i = 1; i < drawList.size(); ++i)
+        {
+            const RHI::DrawItemProperties& a = drawList[i - 1];
+            const RHI::DrawItemProperties& b = drawList[i];
+
+            bool inOrder = true;
+            switch (sortType)
+            {
+            case RHI::DrawListSortType::KeyThenDepth:
+                inOrder = a.m_sortKey < b.m_sortKey || (a.m_sortKey == b.m_sortKey && a.m_depth <= b.m_depth);
+                break;
+            case RHI::DrawListSortType::KeyThenReverseDepth:
+                inOrder = a.m_sortKey < b.m_sortKey || (a.m_sortKey == b.m_sortKey && a.m_depth >= b.m_depth);
+                break;
+            case RHI::DrawListSortType::DepthThenKey:
+                inOrder = a.m_depth < b.m_depth || (a.m_depth == b.m_depth && a.m_sortKey <= b.m_sortKey);
+                break;
+            case RHI::DrawListSortType::ReverseDepthThenKey:
+                inOrder = a.m_depth > b.m_depth || (a.m_depth == b.m_depth && a.m_sortKey <= b.m_sortKey);
+                break;
+            }
+
+            if (!inOrder)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     class DrawPacketTest
         : public RHITestFixture
     {
@@ -417,6 +469,183 @@ namespace UnitTest
 
         delete drawPacket;
     }
+
+    TEST_F(DrawPacketTest, SortDrawList_LargeLists_SortedInOrderOfSortType)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+
+        const RHI::DrawListSortType sortTypes[] =
+        {
+            RHI::DrawListSortType::KeyThenDepth,
+            RHI::DrawListSortType::KeyThenReverseDepth,
+            RHI::DrawListSortType::DepthThenKey,
+            RHI::DrawListSortType::ReverseDepthThenKey
+        };
+
+        // Lists big enough for the radix sort, with both narrow and full range sort keys
+        for (uint32_t sortKeyCount : { 0u, 1u, 16u })
+        {
+            for (RHI::DrawListSortType sortType : sortTypes)
+            {
+                RHI::DrawList drawList = BuildRandomDrawList(random, 4096, sortKeyCount);
+
+                RHI::DrawList expectedItems = drawList;
+                AZStd::sort(expectedItems.begin(), expectedItems.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                {
+                    return a.m_item < b.m_item;
+                });
+
+                RHI::SortDrawList(drawList, sortType);
+                EXPECT_TRUE(IsDrawListSorted(drawList, sortType));
+
+                // Same items as before the sort
+                AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+                {
+                    return a.m_item < b.m_item;
+                });
+                EXPECT_EQ(expectedItems, drawList);
+            }
+        }
+    }
+
+    TEST_F(DrawPacketTest, DrawListContextFinalizeList_EachTagSeparately_MatchesFinalizeLists)
+    {
+        AZ::SimpleLcgRandom random(s_randomSeed);
+        const RHI::DrawListTag tagA(0);
+        const RHI::DrawListTag tagB(1);
+        const RHI::DrawListTag tagFiltered(2);
+
+        RHI::DrawListContext drawListContext;
+        drawListContext.Init(RHI::DrawListMask{}.set(tagA.GetIndex()).set(tagB.GetIndex()));
+
+        // Finalize the lists of each tag separately, the way the view does when finalizing in parallel, and compare
+        // the merged lists with the ones from FinalizeLists.
+        AZStd::array<RHI::DrawList, 2> expectedDrawLists;
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            for (RHI::DrawListTag tag : { tagA, tagB, tagFiltered })
+            {
+                for (const RHI::DrawItemProperties& drawItem : BuildRandomDrawList(random, 300, 16))
+                {
+                    drawListContext.AddDrawItem(tag, drawItem);
+                }
+            }
+
+            if (pass == 0)
+            {
+                drawListContext.FinalizeLists();
+            }
+            else
+            {
+                drawListContext.FinalizeList(tagA);
+                drawListContext.FinalizeList(tagB);
+                drawListContext.FinalizeList(tagFiltered);
+            }
+
+            EXPECT_TRUE(drawListContext.GetList(tagFiltered).empty());
+            for (RHI::DrawListTag tag : { tagA, tagB })
+            {
+                RHI::DrawListView drawListView = drawListContext.GetList(tag);
+                EXPECT_EQ(300u, drawListView.size());
+
+                RHI::DrawList drawList(drawListView.begin(), drawListView.end());
+                RHI::SortDrawList(drawList, RHI::DrawListSortType::KeyThenDepth);
+                EXPECT_TRUE(IsDrawListSorted(drawList, RHI::DrawListSortType::KeyThenDepth));
+                if (pass == 0)
+                {
+                    expectedDrawLists[tag.GetIndex()] = drawList;
+                }
+                else
+                {
+                    // The random generator was reset, so the second pass added the same items
+                    EXPECT_EQ(expectedDrawLists[tag.GetIndex()], drawList);
+                }
+            }
+            random.SetSeed(s_randomSeed);
+        }
+
+        drawListContext.Shutdown();
+    }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    using namespace AZ;
+
+    class DrawListSortBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using UnitTest::AllocatorsBenchmarkFixture::SetUp;
+        using UnitTest::AllocatorsBenchmarkFixture::TearDown;
+
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AllocatorInstance<FrameArenaAllocator>::Create();
+
+            SimpleLcgRandom random(1234);
+            m_drawList = UnitTest::BuildRandomDrawList(random, aznumeric_cast<size_t>(state.range(0)), 64);
+        }
+
+        void TearDown(::benchmark::State& state) override
+        {
+            m_drawList = {};
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        RHI::DrawList m_drawList;
+    };
+
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, BM_SortDrawList)(::benchmark::State& state)
+    {
+        RHI::DrawList drawList;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            drawList = m_drawList;
+            state.ResumeTiming();
+
+            RHI::SortDrawList(drawList, static_cast<RHI::DrawListSortType>(state.range(1)));
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Comparison sort of the same lists, as a baseline for the radix sort
+    BENCHMARK_DEFINE_F(DrawListSortBenchmark, BM_ComparisonSortDrawList)(::benchmark::State& state)
+    {
+        RHI::DrawList drawList;
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+            drawList = m_drawList;
+            state.ResumeTiming();
+
+            AZStd::sort(drawList.begin(), drawList.end(), [](const RHI::DrawItemProperties& a, const RHI::DrawItemProperties& b)
+            {
+                if (a.m_sortKey != b.m_sortKey)
+                {
+                    return a.m_sortKey < b.m_sortKey;
+                }
+                return a.m_depth < b.m_depth;
+            });
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, BM_SortDrawList)
+        ->Args({ 1024, static_cast<int64_t>(RHI::DrawListSortType::KeyThenDepth) })
+        ->Args({ 16384, static_cast<int64_t>(RHI::DrawListSortType::KeyThenDepth) })
+        ->Args({ 131072, static_cast<int64_t>(RHI::DrawListSortType::KeyThenDepth) })
+        ->Args({ 131072, static_cast<int64_t>(RHI::DrawListSortType::ReverseDepthThenKey) })
+        ->Unit(::benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(DrawListSortBenchmark, BM_ComparisonSortDrawList)
+        ->Arg(1024)->Arg(16384)->Arg(131072)
+        ->Unit(::benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -13,6 +13,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Driller/Driller.h>
 #include <AzCore/Memory/MemoryDriller.h>
 #include <AzCore/Memory/AllocationRecords.h>
@@ -63,6 +64,8 @@ namespace UnitTest
                 AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create(desc);
             }
 
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create();
+
             if constexpr (EnableLeakTracking)
             {
                 AZ::Debug::AllocationRecords* records = AZ::AllocatorInstance<AZ::SystemAllocator>::GetAllocator().GetRecords();
@@ -81,6 +84,7 @@ namespace UnitTest
 
         virtual ~RHITestFixture()
         {
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
             AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
             AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
         }
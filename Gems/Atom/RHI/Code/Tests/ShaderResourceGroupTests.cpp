@@ -10,6 +10,7 @@
 #include <Tests/Factory.h>
 #include <Tests/Device.h>
 #include <Atom/RHI/Factory.h>
+#include <Atom/RHI/ImagePool.h>
 #include <Atom/RHI.Reflect/ReflectSystemComponent.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/ObjectStream.h>
@@ -636,6 +637,129 @@ namespace UnitTest
         TestShaderResourceGroupPools();
     }
 
+    TEST_F(ShaderResourceGroupTests, CompileGroup_UnchangedOrPartiallyChangedData_OnlyDirtyPartsAreCompiled)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+        EXPECT_EQ(RHI::ShaderResourceGroupDirtyFlags::All, srg->GetDirtyFlags());
+
+        const auto CompileQueuedGroups = [&srgPool]()
+        {
+            srgPool->CompileGroupsBegin();
+            srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+            srgPool->CompileGroupsEnd();
+        };
+
+        RHI::ShaderResourceGroupData srgData(*srgPool);
+        const uint32_t constantDataSize = static_cast<uint32_t>(srgData.GetConstantData().size());
+
+        // The first compile writes the whole group.
+        srg->Compile(srgData);
+        EXPECT_TRUE(srg->IsQueuedForCompile());
+        EXPECT_EQ(RHI::Interval(0, constantDataSize), srg->GetDirtyConstantInterval());
+        CompileQueuedGroups();
+        EXPECT_FALSE(srg->IsQueuedForCompile());
+        EXPECT_EQ(RHI::ShaderResourceGroupDirtyFlags::None, srg->GetDirtyFlags());
+        EXPECT_EQ(1u, srgPool->GetCompileStatistics().m_compiledGroupCount);
+        EXPECT_EQ(constantDataSize, srgPool->GetCompileStatistics().m_compiledConstantBytes);
+        EXPECT_EQ(constantDataSize, srgPool->GetCompileStatistics().m_dirtyConstantBytes);
+
+        // Compiling the same data again is skipped.
+        srg->Compile(srgData);
+        EXPECT_FALSE(srg->IsQueuedForCompile());
+        CompileQueuedGroups();
+        EXPECT_EQ(0u, srgPool->GetCompileStatistics().m_compiledGroupCount);
+        EXPECT_EQ(1u, srgPool->GetCompileStatistics().m_skippedGroupCount);
+
+        // Changing one constant only dirties the bytes of that constant.
+        const RHI::ShaderInputConstantIndex vector4Index = srgData.FindShaderInputConstantIndex(Name("m_vector4"));
+        EXPECT_TRUE(srgData.SetConstant(vector4Index, Vector4(1.0f, 2.0f, 3.0f, 4.0f)));
+        srg->Compile(srgData);
+        EXPECT_TRUE(srg->IsQueuedForCompile());
+        EXPECT_EQ(RHI::ShaderResourceGroupDirtyFlags::Constants, srg->GetDirtyFlags());
+
+        const RHI::Interval vector4Interval = srgLayout->GetConstantInterval(vector4Index);
+        const RHI::Interval dirtyConstantInterval = srg->GetDirtyConstantInterval();
+        EXPECT_GE(dirtyConstantInterval.m_min, vector4Interval.m_min);
+        EXPECT_LE(dirtyConstantInterval.m_max, vector4Interval.m_max);
+        EXPECT_LT(dirtyConstantInterval.m_min, dirtyConstantInterval.m_max);
+
+        CompileQueuedGroups();
+        EXPECT_EQ(1u, srgPool->GetCompileStatistics().m_compiledGroupCount);
+        EXPECT_EQ(constantDataSize, srgPool->GetCompileStatistics().m_compiledConstantBytes);
+        EXPECT_EQ(dirtyConstantInterval.m_max - dirtyConstantInterval.m_min, srgPool->GetCompileStatistics().m_dirtyConstantBytes);
+    }
+
+    TEST_F(ShaderResourceGroupTests, CompileGroup_OneImageViewChanged_OnlyThatShaderInputIsDirty)
+    {
+        RHI::Ptr<RHI::Device> device = MakeTestDevice();
+        RHI::ConstPtr<RHI::ShaderResourceGroupLayout> srgLayout = CreateLayout();
+
+        RHI::Ptr<RHI::ShaderResourceGroupPool> srgPool = RHI::Factory::Get().CreateShaderResourceGroupPool();
+        RHI::ShaderResourceGroupPoolDescriptor descriptor;
+        descriptor.m_layout = srgLayout.get();
+        srgPool->Init(*device, descriptor);
+
+        RHI::Ptr<RHI::ShaderResourceGroup> srg = RHI::Factory::Get().CreateShaderResourceGroup();
+        srgPool->InitGroup(*srg);
+
+        RHI::Ptr<RHI::ImagePool> imagePool = RHI::Factory::Get().CreateImagePool();
+        RHI::ImagePoolDescriptor imagePoolDesc;
+        imagePoolDesc.m_bindFlags = RHI::ImageBindFlags::ShaderRead;
+        imagePool->Init(*device, imagePoolDesc);
+
+        RHI::Ptr<RHI::Image> image = RHI::Factory::Get().CreateImage();
+        RHI::ImageInitRequest initRequest;
+        initRequest.m_image = image.get();
+        initRequest.m_descriptor = RHI::ImageDescriptor::Create2D(RHI::ImageBindFlags::ShaderRead, 8, 8, RHI::Format::R8G8B8A8_UNORM);
+        imagePool->InitImage(initRequest);
+        RHI::Ptr<RHI::ImageView> imageView = image->GetImageView(RHI::ImageViewDescriptor{});
+
+        const auto CompileQueuedGroups = [&srgPool]()
+        {
+            srgPool->CompileGroupsBegin();
+            srgPool->CompileGroupsForInterval(RHI::Interval(0, srgPool->GetGroupsToCompileCount()));
+            srgPool->CompileGroupsEnd();
+        };
+
+        // All of the shader inputs are dirty until the first compile.
+        RHI::ShaderResourceGroupData srgData(*srgPool);
+        const RHI::ShaderInputImageIndex readImageIndex = srgData.FindShaderInputImageIndex(Name("m_readImage"));
+        const RHI::ShaderInputImageIndex readWriteImageIndex = srgData.FindShaderInputImageIndex(Name("m_readWriteImage"));
+        const RHI::ShaderInputBufferIndex readBufferIndex = srgData.FindShaderInputBufferIndex(Name("m_readBuffer"));
+        EXPECT_TRUE(srg->IsShaderInputDirty(readImageIndex));
+        EXPECT_TRUE(srg->IsShaderInputDirty(readWriteImageIndex));
+        EXPECT_TRUE(srg->IsShaderInputDirty(readBufferIndex));
+
+        srg->Compile(srgData);
+        CompileQueuedGroups();
+        const uint32_t shaderInputCount = srgPool->GetCompileStatistics().m_compiledShaderInputCount;
+        EXPECT_EQ(shaderInputCount, srgPool->GetCompileStatistics().m_dirtyShaderInputCount);
+        EXPECT_FALSE(srg->IsShaderInputDirty(readImageIndex));
+
+        // Binding a view to one element of an image array only dirties that shader input.
+        EXPECT_TRUE(srgData.SetImageView(readImageIndex, imageView.get(), 2));
+        srg->Compile(srgData);
+        EXPECT_TRUE(srg->IsQueuedForCompile());
+        EXPECT_EQ(RHI::ShaderResourceGroupDirtyFlags::ImageViews, srg->GetDirtyFlags());
+        EXPECT_TRUE(srg->IsShaderInputDirty(readImageIndex));
+        EXPECT_FALSE(srg->IsShaderInputDirty(readWriteImageIndex));
+        EXPECT_FALSE(srg->IsShaderInputDirty(readBufferIndex));
+
+        CompileQueuedGroups();
+        EXPECT_EQ(shaderInputCount, srgPool->GetCompileStatistics().m_compiledShaderInputCount);
+        EXPECT_EQ(1u, srgPool->GetCompileStatistics().m_dirtyShaderInputCount);
+        EXPECT_FALSE(srg->IsShaderInputDirty(readImageIndex));
+    }
+
 
     TEST_F(ShaderResourceGroupTests, SRGDataSetConstant_Vectors_ValidOutput)
     {
@@ -19,6 +19,7 @@
 #include <AzCore/Console/IConsole.h>
 #include <AzCore/Console/Console.h>
 #include <AzCore/Math/Obb.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/std/limits.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/containers/vector.h>
@@ -195,6 +196,46 @@ namespace AZ
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
         uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
 
+        //! Adds the DrawPackets of the lod(s) selected by an already computed screen coverage to the view.
+        uint32_t AddLodDataToView(const Vector3& pos, float approxScreenPercentage, const Cullable::LodData& lodData, RPI::View& view);
+
+        //! The bounding spheres and lod selection radii of up to four cullables, stored as a structure of arrays.
+        //! This allows four cullables to be tested against a frustum plane, or to have their screen coverage computed,
+        //! using one SIMD operation per component.
+        struct alignas(16) CullableBoundsBlock
+        {
+            static constexpr uint32_t Width = 4;
+
+            void Set(uint32_t lane, const Cullable& cullable);
+
+            float m_centerX[Width] = {};
+            float m_centerY[Width] = {};
+            float m_centerZ[Width] = {};
+            float m_radius[Width] = {};
+            float m_lodSelectionRadius[Width] = {};
+        };
+
+        //! The planes of a view frustum, splatted for testing against a CullableBoundsBlock.
+        struct CullingFrustumPlanes
+        {
+            explicit CullingFrustumPlanes(const Frustum& frustum);
+
+            //! Tests the bounding spheres of the first laneCount cullables in the block against the frustum,
+            //! with the same results as Frustum::IntersectSphere.
+            //! @param outsideMask bit N is set if sphere N is fully outside the frustum.
+            //! @param insideMask bit N is set if sphere N is fully inside the frustum.
+            void ClassifySpheres(const CullableBoundsBlock& block, uint32_t laneCount, uint32_t& outsideMask, uint32_t& insideMask) const;
+
+            Simd::Vec4::FloatType m_normalX[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_normalY[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_normalZ[Frustum::PlaneId::MAX];
+            Simd::Vec4::FloatType m_distance[Frustum::PlaneId::MAX];
+        };
+
+        //! Computes ModelLodUtils::ApproxScreenPercentage for the lod selection spheres of all the cullables in the block.
+        void ApproxScreenPercentages(const CullableBoundsBlock& block, const Vector3& cameraPosition, float yScale, bool isPerspective,
+            float (&screenPercentages)[CullableBoundsBlock::Width]);
+
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
         //! access the CullingScene via their parent Scene.
@@ -11,6 +11,7 @@
 
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+#include <Atom/RPI.Reflect/Shader/ShaderPipelineStateCacheData.h>
 #include <Atom/RPI.Reflect/Shader/IShaderVariantFinder.h>
 
 #include <Atom/RHI/DrawListTagRegistry.h>
@@ -19,9 +20,17 @@
 #include <AtomCore/Instance/InstanceData.h>
 
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace UnitTest
+{
+    class ShaderTests;
+}
 
 namespace AZ
 {
+    class JobCompletion;
+
     namespace RHI
     {
         class PipelineStateCache;
@@ -38,6 +47,10 @@ namespace AZ
          * lifetime is determined by the lifetime of the Shader (unless an explicit reference is taken). If
          * an asset reload event occurs, the pipeline state cache is reset.
          *
+         * The pipeline library and the pipeline states used by the shader are saved to the user cache when the
+         * shader shuts down. When the shader is created again, those pipeline states are compiled on a background
+         * job, so they are usually ready by the time they are first used for rendering.
+         *
          * To use Shader:
          *  1) Construct a ShaderOptionGroup instance using CreateShaderOptionGroup.
          *  2) Configure the group by setting values on shader options.
@@ -56,6 +69,7 @@ namespace AZ
             , public ShaderReloadNotificationBus::Handler
         {
             friend class ShaderSystem;
+            friend class UnitTest::ShaderTests;
         public:
             AZ_INSTANCE_DATA(Shader, "{232D8BD6-3BD4-4842-ABD2-F380BD5B0863}");
             AZ_CLASS_ALLOCATOR(Shader, SystemAllocator, 0);
@@ -151,8 +165,46 @@ namespace AZ
 
             void Shutdown();
 
-            ConstPtr<RHI::PipelineLibraryData> LoadPipelineLibrary() const;
-            void SavePipelineLibrary() const;
+            using PipelineStateCacheEntry = ShaderPipelineStateCacheData::PipelineStateEntry;
+
+            //! Loads the pipeline library and pipeline states saved by a previous run. Returns null if there is no
+            //! data, or if it was saved with a different build of the shader asset.
+            AZStd::unique_ptr<ShaderPipelineStateCacheData> LoadPipelineLibrary() const;
+            void SavePipelineLibrary();
+
+            //! Finds the variant a pipeline state descriptor was configured with. Returns false if the variant is not loaded.
+            bool FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor, ShaderVariantStableId& shaderVariantStableId);
+
+            //! Compiles pipeline states saved by a previous run on a background job. If deferLoadingVariants is true, pipeline
+            //! states of variants that are still loading are compiled once the variant is ready, otherwise they are dropped.
+            //! Pipeline states of variants that are older than the shader asset are dropped.
+            void WarmUpPipelineStates(AZStd::vector<PipelineStateCacheEntry>&& pipelineStates, bool deferLoadingVariants);
+
+            enum class WarmUpVariantState
+            {
+                Ready,
+                Loading,
+                OutOfDate
+            };
+
+            //! Copies the variant to rebuild a saved pipeline state with, queuing a load of the variant if it isn't loaded.
+            //! The variant is copied because the cache entry can be replaced or erased once m_variantCacheMutex is released.
+            WarmUpVariantState CopyWarmUpVariant(ShaderVariantStableId shaderVariantStableId, ShaderVariant& shaderVariant);
+
+            //! Rebuilds the descriptor of a saved pipeline state from the variant, and compiles it if it still matches.
+            void WarmUpPipelineState(const PipelineStateCacheEntry& pipelineState, const ShaderVariant& shaderVariant) const;
+
+            //! Waits for the pipeline state warm-up jobs to finish, and drops the pipeline states still waiting for their variant.
+            void WaitForPipelineStateWarmUp();
+
+            //! Waits for the pipeline state warm-up jobs to finish, pipeline states waiting for their variant stay pending.
+            void WaitForPipelineStateWarmUpJobs();
+
+            //! Returns the number of saved pipeline states waiting for their variant to load.
+            size_t GetPendingWarmUpPipelineStateCount();
+
+            //! Clears the local cache of variants, except for the root variant.
+            void ClearShaderVariants();
 
             ///////////////////////////////////////////////////////////////////
             /// AssetBus overrides
@@ -205,6 +257,15 @@ namespace AZ
             
             //! DrawListTag associated with this shader.
             RHI::DrawListTag m_drawListTag;
+
+            //! Guards the pipeline state warm-up state below.
+            AZStd::mutex m_warmUpMutex;
+
+            //! Saved pipeline states waiting for their variant to load before they can be warmed up.
+            AZStd::vector<PipelineStateCacheEntry> m_pendingWarmUpPipelineStates;
+
+            //! Tracks the pipeline state warm-up jobs, null if none were started.
+            AZ::JobCompletion* m_warmUpCompletion = nullptr;
         };
     }
 }
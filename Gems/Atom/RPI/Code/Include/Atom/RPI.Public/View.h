@@ -9,6 +9,7 @@
 
 #include <Atom/RHI/ShaderResourceGroup.h>
 #include <Atom/RHI/DrawListContext.h>
+#include <Atom/RHI.Reflect/FrameSchedulerEnums.h>
 
 #include <Atom/RPI.Public/Base.h>
 #include <Atom/RPI.Public/Pass/Pass.h>
@@ -95,8 +96,9 @@ namespace AZ
             AZ::Transform GetCameraTransform() const;
 
             //! Finalize draw lists in this view. This function should only be called when all
-            //! draw packets for current frame are added. 
-            void FinalizeDrawLists();
+            //! draw packets for current frame are added. With the parallel job policy, each draw list
+            //! is merged and sorted in its own job.
+            void FinalizeDrawLists(RHI::JobPolicy jobPolicy = RHI::JobPolicy::Parallel);
 
             bool HasDrawListTag(RHI::DrawListTag drawListTag);
 
@@ -140,6 +142,9 @@ namespace AZ
             //! Sorts the finalized draw lists in this view
             void SortFinalizedDrawLists();
 
+            //! Merges and sorts the draw list of a single tag
+            void FinalizeDrawList(RHI::DrawListTag tag);
+
             //! Sorts a drawList using the sort function from a pass with the corresponding drawListTag
             void SortDrawList(RHI::DrawList& drawList, RHI::DrawListTag tag);
 
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <Atom/RPI.Reflect/Shader/ShaderVariantKey.h>
+
+#include <Atom/RHI.Reflect/InputStreamLayout.h>
+#include <Atom/RHI.Reflect/RenderAttachmentLayout.h>
+#include <Atom/RHI.Reflect/RenderStates.h>
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/time.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! The pipeline states a shader used in a previous run of the application, along with its serialized
+        //! pipeline library. Shader saves it to the user cache when it shuts down, and loads it when it initializes
+        //! again to compile the pipeline states on a background job, before they are first requested for rendering.
+        struct ShaderPipelineStateCacheData
+        {
+            AZ_TYPE_INFO(ShaderPipelineStateCacheData, "{B53C8C02-AD83-4D2F-8E54-86C269D3F27C}");
+            AZ_CLASS_ALLOCATOR(ShaderPipelineStateCacheData, SystemAllocator, 0);
+            static void Reflect(ReflectContext* context);
+
+            //! The state needed to rebuild a pipeline state descriptor. Everything else comes from the shader variant.
+            struct PipelineStateEntry
+            {
+                AZ_TYPE_INFO(PipelineStateEntry, "{7A9EA68F-4B3E-401B-8D74-B5722EF96676}");
+
+                ShaderVariantStableId m_shaderVariantStableId;
+
+                //! Hash of the complete descriptor. A rebuilt descriptor with a different hash (e.g. because
+                //! the shader code changed) is not compiled.
+                uint64_t m_descriptorHash = 0;
+
+                //! Runtime state of draw pipeline states, unused for dispatch pipeline states.
+                RHI::RenderStates m_renderStates;
+                RHI::InputStreamLayout m_inputStreamLayout;
+                RHI::RenderAttachmentConfiguration m_renderAttachmentConfiguration;
+            };
+
+            //! Build timestamp of the shader asset the data was saved with. The data is discarded if the shader was rebuilt.
+            AZStd::sys_time_t m_shaderAssetBuildTimestamp = 0;
+
+            //! Platform-specific data from RHI::PipelineLibrary::GetSerializedData.
+            AZStd::vector<uint8_t> m_pipelineLibraryData;
+
+            AZStd::vector<PipelineStateEntry> m_pipelineStates;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -15,6 +15,7 @@
 
 #include <Atom/RHI/CpuProfiler.h>
 
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Casting/numeric_cast.h>
@@ -24,6 +25,7 @@
 #include <AzCore/Debug/Timer.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Jobs/Job.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <Atom_RPI_Traits_Platform.h>
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
@@ -266,6 +268,93 @@ namespace AZ
             return m_visScene->GetEntryCount();
         }
 
+        void CullableBoundsBlock::Set(uint32_t lane, const Cullable& cullable)
+        {
+            AZ_Assert(lane < Width, "Lane index out of range");
+            const Vector3& center = cullable.m_cullData.m_boundingSphere.GetCenter();
+            m_centerX[lane] = center.GetX();
+            m_centerY[lane] = center.GetY();
+            m_centerZ[lane] = center.GetZ();
+            m_radius[lane] = cullable.m_cullData.m_boundingSphere.GetRadius();
+            m_lodSelectionRadius[lane] = cullable.m_lodData.m_lodSelectionRadius;
+        }
+
+        CullingFrustumPlanes::CullingFrustumPlanes(const Frustum& frustum)
+        {
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Plane plane = frustum.GetPlane(planeId);
+                const Vector3 normal = plane.GetNormal();
+                m_normalX[planeId] = Simd::Vec4::Splat(normal.GetX());
+                m_normalY[planeId] = Simd::Vec4::Splat(normal.GetY());
+                m_normalZ[planeId] = Simd::Vec4::Splat(normal.GetZ());
+                m_distance[planeId] = Simd::Vec4::Splat(plane.GetDistance());
+            }
+        }
+
+        void CullingFrustumPlanes::ClassifySpheres(const CullableBoundsBlock& block, uint32_t laneCount, uint32_t& outsideMask, uint32_t& insideMask) const
+        {
+            using Simd::Vec4;
+
+            const Vec4::FloatType centerX = Vec4::LoadAligned(block.m_centerX);
+            const Vec4::FloatType centerY = Vec4::LoadAligned(block.m_centerY);
+            const Vec4::FloatType centerZ = Vec4::LoadAligned(block.m_centerZ);
+            const Vec4::FloatType radius = Vec4::LoadAligned(block.m_radius);
+            const Vec4::FloatType negativeRadius = Vec4::Sub(Vec4::ZeroFloat(), radius);
+
+            // Same as Frustum::IntersectSphere, a sphere is outside if it is behind any plane,
+            // and it straddles the frustum if it crosses any plane
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            Vec4::FloatType outside = Vec4::CmpNeq(zero, zero);
+            Vec4::FloatType straddling = Vec4::CmpNeq(zero, zero);
+            for (Frustum::PlaneId planeId = Frustum::PlaneId::Near; planeId < Frustum::PlaneId::MAX; ++planeId)
+            {
+                const Vec4::FloatType distance = Vec4::Madd(m_normalX[planeId], centerX,
+                    Vec4::Madd(m_normalY[planeId], centerY, Vec4::Madd(m_normalZ[planeId], centerZ, m_distance[planeId])));
+                outside = Vec4::Or(outside, Vec4::CmpLt(distance, negativeRadius));
+                straddling = Vec4::Or(straddling, Vec4::CmpLt(Vec4::Abs(distance), radius));
+            }
+
+            AZ_ALIGN(int32_t outsideLanes[CullableBoundsBlock::Width], 16);
+            AZ_ALIGN(int32_t straddlingLanes[CullableBoundsBlock::Width], 16);
+            Vec4::StoreAligned(outsideLanes, Vec4::CastToInt(outside));
+            Vec4::StoreAligned(straddlingLanes, Vec4::CastToInt(straddling));
+
+            outsideMask = 0;
+            insideMask = 0;
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                outsideMask |= (outsideLanes[lane] != 0) ? (1u << lane) : 0u;
+                insideMask |= (outsideLanes[lane] == 0 && straddlingLanes[lane] == 0) ? (1u << lane) : 0u;
+            }
+        }
+
+        void ApproxScreenPercentages(const CullableBoundsBlock& block, const Vector3& cameraPosition, float yScale, bool isPerspective,
+            float (&screenPercentages)[CullableBoundsBlock::Width])
+        {
+            using Simd::Vec4;
+
+            // See ModelLodUtils::ApproxScreenPercentage for the derivation
+            const Vec4::FloatType projectedRadius = Vec4::Mul(Vec4::Splat(yScale), Vec4::LoadAligned(block.m_lodSelectionRadius));
+            Vec4::FloatType screenPercentage = projectedRadius;
+            if (isPerspective)
+            {
+                const Vec4::FloatType toCenterX = Vec4::Sub(Vec4::Splat(cameraPosition.GetX()), Vec4::LoadAligned(block.m_centerX));
+                const Vec4::FloatType toCenterY = Vec4::Sub(Vec4::Splat(cameraPosition.GetY()), Vec4::LoadAligned(block.m_centerY));
+                const Vec4::FloatType toCenterZ = Vec4::Sub(Vec4::Splat(cameraPosition.GetZ()), Vec4::LoadAligned(block.m_centerZ));
+                const Vec4::FloatType distance = Vec4::Sqrt(Vec4::Madd(toCenterX, toCenterX,
+                    Vec4::Madd(toCenterY, toCenterY, Vec4::Mul(toCenterZ, toCenterZ))));
+                screenPercentage = Vec4::Div(projectedRadius, distance);
+            }
+
+            AZ_ALIGN(float lanes[CullableBoundsBlock::Width], 16);
+            Vec4::StoreAligned(lanes, Vec4::Min(screenPercentage, Vec4::Splat(1.0f)));
+            for (uint32_t lane = 0; lane < CullableBoundsBlock::Width; ++lane)
+            {
+                screenPercentages[lane] = lanes[lane];
+            }
+        }
+
         class AddObjectsToViewJob final
             : public Job
         {
@@ -302,6 +391,7 @@ namespace AZ
 
                 const View::UsageFlags viewFlags = m_jobData->m_view->GetUsageFlags();
                 const RHI::DrawListMask drawListMask = m_jobData->m_view->GetDrawListMask();
+                const CullingFrustumPlanes frustumPlanes(m_jobData->m_frustum);
                 uint32_t numDrawPackets = 0;
                 uint32_t numVisibleCullables = 0;
 
@@ -315,69 +405,38 @@ namespace AZ
                         m_view->GetName().GetCStr(), nodeIsContainedInFrustum ? 1 : 0);
 #endif
 
-                    if (nodeIsContainedInFrustum || !m_jobData->m_debugCtx->m_enableFrustumCulling)
+                    const bool cullEntries = !nodeIsContainedInFrustum && m_jobData->m_debugCtx->m_enableFrustumCulling;
+
+                    //Pack the bounds of the cullables that pass the mask checks into blocks, which are culled and lod selected a block at a time
+                    CullableBlock block;
+                    for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
                     {
-                        //Add all objects within this node to the view, without any extra culling
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
+                        if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
                         {
-                            {
-                                if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                                {
-                                    Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
+                            Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
 
-                                    if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                        c->m_cullData.m_hideFlags & viewFlags ||
-                                        c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                        c->m_isHidden)
-                                    {
-                                        continue;
-                                    }
+                            if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
+                                c->m_cullData.m_hideFlags & viewFlags ||
+                                c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
+                                c->m_isHidden)
+                            {
+                                continue;
+                            }
 
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                    }
-                                }
+                            block.m_bounds.Set(block.m_count, *c);
+                            block.m_cullables[block.m_count] = c;
+                            block.m_entries[block.m_count] = visibleEntry;
+                            if (++block.m_count == CullableBoundsBlock::Width)
+                            {
+                                ProcessBlock(block, frustumPlanes, cullEntries, numDrawPackets, numVisibleCullables);
+                                block.m_count = 0;
                             }
                         }
                     }
-                    else
-                    {
-                        //Do fine-grained culling before adding objects to the view
-                        for (AzFramework::VisibilityEntry* visibleEntry : nodeData.m_entries)
-                        {
-                            if (visibleEntry->m_typeFlags & AzFramework::VisibilityEntry::TYPE_RPI_Cullable)
-                            {
-                                Cullable* c = static_cast<Cullable*>(visibleEntry->m_userData);
-
-                                if ((c->m_cullData.m_drawListMask & drawListMask).none() ||
-                                    c->m_cullData.m_hideFlags & viewFlags ||
-                                    c->m_cullData.m_scene != m_jobData->m_scene ||       //[GFX_TODO][ATOM-13796] once the IVisibilitySystem supports multiple octree scenes, remove this
-                                    c->m_isHidden)
-                                {
-                                    continue;
-                                }
 
-                                IntersectResult res = ShapeIntersection::Classify(m_jobData->m_frustum, c->m_cullData.m_boundingSphere);
-                                if (res == IntersectResult::Exterior)
-                                {
-                                    continue;
-                                }
-                                else if (res == IntersectResult::Interior || ShapeIntersection::Overlaps(m_jobData->m_frustum, c->m_cullData.m_boundingObb))
-                                {
-#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
-                                    if (TestOcclusionCulling(visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
-#endif
-                                    {
-                                        numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *m_jobData->m_view);
-                                        ++numVisibleCullables;
-                                    }
-                                }
-                            }
-                        }
+                    if (block.m_count > 0)
+                    {
+                        ProcessBlock(block, frustumPlanes, cullEntries, numDrawPackets, numVisibleCullables);
                     }
 
                     if (m_jobData->m_debugCtx->m_debugDraw && (m_jobData->m_view->GetName() == m_jobData->m_debugCtx->m_currentViewSelectionName))
@@ -444,6 +503,73 @@ namespace AZ
                 }
             }
 
+        private:
+            struct CullableBlock
+            {
+                CullableBoundsBlock m_bounds;
+                Cullable* m_cullables[CullableBoundsBlock::Width];
+                AzFramework::VisibilityEntry* m_entries[CullableBoundsBlock::Width];
+                uint32_t m_count = 0;
+            };
+
+            //Culls a block of cullables and adds the draw packets of the visible ones to the view
+            void ProcessBlock(const CullableBlock& block, const CullingFrustumPlanes& frustumPlanes, bool cullEntries, uint32_t& numDrawPackets, uint32_t& numVisibleCullables)
+            {
+                uint32_t visibleMask = (1u << block.m_count) - 1;
+
+                if (cullEntries)
+                {
+                    uint32_t outsideMask = 0;
+                    uint32_t insideMask = 0;
+                    frustumPlanes.ClassifySpheres(block.m_bounds, block.m_count, outsideMask, insideMask);
+                    visibleMask &= ~outsideMask;
+
+                    //Spheres that straddle the frustum get the tighter obb test
+                    for (uint32_t straddlingMask = visibleMask & ~insideMask; straddlingMask != 0; straddlingMask &= straddlingMask - 1)
+                    {
+                        const uint32_t lane = az_ctz_u32(straddlingMask);
+                        if (!ShapeIntersection::Overlaps(m_jobData->m_frustum, block.m_cullables[lane]->m_cullData.m_boundingObb))
+                        {
+                            visibleMask &= ~(1u << lane);
+                        }
+                    }
+                }
+
+#if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
+                for (uint32_t testMask = visibleMask; testMask != 0; testMask &= testMask - 1)
+                {
+                    const uint32_t lane = az_ctz_u32(testMask);
+                    if (TestOcclusionCulling(block.m_entries[lane]) != MaskedOcclusionCulling::CullingResult::VISIBLE)
+                    {
+                        visibleMask &= ~(1u << lane);
+                    }
+                }
+#endif
+
+                if (visibleMask == 0)
+                {
+                    return;
+                }
+
+                View& view = *m_jobData->m_view;
+                const Matrix4x4& viewToClip = view.GetViewToClipMatrix();
+                //the [1][1] element of a perspective projection matrix stores cot(FovY/2), see AddLodDataToView()
+                const float yScale = viewToClip.GetElement(1, 1);
+                const bool isPerspective = viewToClip.GetElement(3, 3) == 0.f;
+                const Vector3 cameraPos = view.GetViewToWorldMatrix().GetTranslation();
+
+                float screenPercentages[CullableBoundsBlock::Width];
+                ApproxScreenPercentages(block.m_bounds, cameraPos, yScale, isPerspective, screenPercentages);
+
+                for (; visibleMask != 0; visibleMask &= visibleMask - 1)
+                {
+                    const uint32_t lane = az_ctz_u32(visibleMask);
+                    const Cullable* c = block.m_cullables[lane];
+                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), screenPercentages[lane], c->m_lodData, view);
+                    ++numVisibleCullables;
+                }
+            }
+
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
             MaskedOcclusionCulling::CullingResult TestOcclusionCulling(AzFramework::VisibilityEntry* visibleEntry)
             {
@@ -538,9 +664,10 @@ namespace AZ
             MaskedOcclusionCulling* maskedOcclusionCulling = m_occlusionPlanes.empty() ? nullptr : view.GetMaskedOcclusionCulling();
             if (maskedOcclusionCulling)
             {
-                // frustum cull occlusion planes
+                // frustum cull occlusion planes, the visible list only lives for this view so keep it in the frame arena
+                FrameArenaScope frameArenaScope;
                 using VisibleOcclusionPlane = AZStd::pair<OcclusionPlane, float>;
-                AZStd::vector<VisibleOcclusionPlane> visibleOccluders;
+                AZStd::vector<VisibleOcclusionPlane, FrameArenaStdAllocator> visibleOccluders;
                 for (const auto& occlusionPlane : m_occlusionPlanes)
                 {
                     if (ShapeIntersection::Overlaps(frustum, occlusionPlane.m_aabb))
@@ -655,6 +782,11 @@ namespace AZ
             const float approxScreenPercentage = ModelLodUtils::ApproxScreenPercentage(
                 pos, lodData.m_lodSelectionRadius, cameraPos, yScale, isPerspective);
 
+            return AddLodDataToView(pos, approxScreenPercentage, lodData, view);
+        }
+
+        uint32_t AddLodDataToView(const Vector3& pos, float approxScreenPercentage, const Cullable::LodData& lodData, RPI::View& view)
+        {
             uint32_t numVisibleDrawPackets = 0;
 
             auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
@@ -536,7 +536,7 @@ namespace AZ
                 {
                     for (auto& view : m_renderPacket.m_views)
                     {
-                        view->FinalizeDrawLists();
+                        view->FinalizeDrawLists(jobPolicy);
                     }
                 }
                 else
@@ -544,9 +544,9 @@ namespace AZ
                     AZ::JobCompletion* finalizeDrawListsCompletion = aznew AZ::JobCompletion();
                     for (auto& view : m_renderPacket.m_views)
                     {
-                        const auto finalizeDrawListsLambda = [view]()
+                        const auto finalizeDrawListsLambda = [view, jobPolicy]()
                         {
-                            view->FinalizeDrawLists();
+                            view->FinalizeDrawLists(jobPolicy);
                         };
 
                         AZ::Job* finalizeDrawListsJob = AZ::CreateJobFunction(AZStd::move(finalizeDrawListsLambda), true, nullptr);     //auto-deletes
@@ -16,6 +16,8 @@
 #include <AtomCore/Instance/InstanceDatabase.h>
 
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/RPI.Public/Shader/ShaderReloadDebugTracker.h>
 
@@ -80,18 +82,19 @@ namespace AZ
             ShaderReloadNotificationBus::Handler::BusDisconnect();
             ShaderVariantFinderNotificationBus::Handler::BusDisconnect();
 
+            // Warm-up jobs of a previous Init read the variants that are reset below.
+            WaitForPipelineStateWarmUp();
+
             RHI::RHISystemInterface* rhiSystem = RHI::RHISystemInterface::Get();
             RHI::DrawListTagRegistry* drawListTagRegistry = rhiSystem->GetDrawListTagRegistry();
 
             m_asset = { &shaderAsset, AZ::Data::AssetLoadBehavior::PreLoad };
             m_pipelineStateType = shaderAsset.GetPipelineStateType();
 
-            {
-                AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
-                m_shaderVariants.clear();
-            }
+            ClearShaderVariants();
             m_rootVariant.Init(Data::Asset<ShaderAsset>{&shaderAsset, AZ::Data::AssetLoadBehavior::PreLoad}, shaderAsset.GetRootVariant(m_supervariantIndex), m_supervariantIndex);
 
+            AZStd::unique_ptr<ShaderPipelineStateCacheData> pipelineStateCacheData;
             if (m_pipelineLibraryHandle.IsNull())
             {
                 // We set up a pipeline library only once for the lifetime of the Shader instance.
@@ -100,7 +103,12 @@ namespace AZ
                 // in a new pipeline library every time.
 
                 RHI::PipelineStateCache* pipelineStateCache = rhiSystem->GetPipelineStateCache();
-                ConstPtr<RHI::PipelineLibraryData> serializedData = LoadPipelineLibrary();
+                pipelineStateCacheData = LoadPipelineLibrary();
+                ConstPtr<RHI::PipelineLibraryData> serializedData;
+                if (pipelineStateCacheData && !pipelineStateCacheData->m_pipelineLibraryData.empty())
+                {
+                    serializedData = RHI::PipelineLibraryData::Create(AZStd::move(pipelineStateCacheData->m_pipelineLibraryData));
+                }
                 RHI::PipelineLibraryHandle pipelineLibraryHandle = pipelineStateCache->CreateLibrary(serializedData.get());
 
                 if (pipelineLibraryHandle.IsNull())
@@ -127,6 +135,12 @@ namespace AZ
             Data::AssetBus::Handler::BusConnect(m_asset.GetId());
             ShaderReloadNotificationBus::Handler::BusConnect(m_asset.GetId());
 
+            // Started after connecting to the variant finder, so pipeline states waiting for a variant don't miss its notification.
+            if (pipelineStateCacheData)
+            {
+                WarmUpPipelineStates(AZStd::move(pipelineStateCacheData->m_pipelineStates), true);
+            }
+
             return RHI::ResultCode::Success;
         }
 
@@ -136,6 +150,8 @@ namespace AZ
             Data::AssetBus::Handler::BusDisconnect();
             ShaderReloadNotificationBus::Handler::BusDisconnect();
 
+            WaitForPipelineStateWarmUp();
+
             if (m_pipelineLibraryHandle.IsValid())
             {
                 SavePipelineLibrary();
@@ -227,6 +243,29 @@ namespace AZ
 
             // [GFX TODO] It might make more sense to call OnShaderReinitialized here
             ShaderReloadNotificationBus::Event(m_asset.GetId(), &ShaderReloadNotificationBus::Events::OnShaderVariantReinitialized, updatedVariant);
+
+            // The variant won't be reported again, so its pending pipeline states are compiled now or dropped.
+            AZStd::vector<PipelineStateCacheEntry> readyPipelineStates;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_warmUpMutex);
+                for (size_t i = 0; i < m_pendingWarmUpPipelineStates.size();)
+                {
+                    if (m_pendingWarmUpPipelineStates[i].m_shaderVariantStableId == stableId)
+                    {
+                        readyPipelineStates.push_back(AZStd::move(m_pendingWarmUpPipelineStates[i]));
+                        m_pendingWarmUpPipelineStates[i] = AZStd::move(m_pendingWarmUpPipelineStates.back());
+                        m_pendingWarmUpPipelineStates.pop_back();
+                    }
+                    else
+                    {
+                        ++i;
+                    }
+                }
+            }
+            if (!isError)
+            {
+                WarmUpPipelineStates(AZStd::move(readyPipelineStates), false);
+            }
         }
         ///////////////////////////////////////////////////////////////////
 
@@ -248,27 +287,58 @@ namespace AZ
         ///////////////////////////////////////////////////////////////////
 
 
-        ConstPtr<RHI::PipelineLibraryData> Shader::LoadPipelineLibrary() const
+        AZStd::unique_ptr<ShaderPipelineStateCacheData> Shader::LoadPipelineLibrary() const
         {
             if (IO::FileIOBase::GetInstance())
             {
-                return Utils::LoadObjectFromFile<RHI::PipelineLibraryData>(GetPipelineLibraryPath());
+                AZStd::unique_ptr<ShaderPipelineStateCacheData> pipelineStateCacheData(
+                    Utils::LoadObjectFromFile<ShaderPipelineStateCacheData>(GetPipelineLibraryPath()));
+
+                // The pipeline states were built from a different version of the shader, the descriptors won't match anymore.
+                if (pipelineStateCacheData && pipelineStateCacheData->m_shaderAssetBuildTimestamp == m_asset->GetShaderAssetBuildTimestamp())
+                {
+                    return pipelineStateCacheData;
+                }
             }
             return nullptr;
         }
 
-        void Shader::SavePipelineLibrary() const
+        void Shader::SavePipelineLibrary()
         {
             if (auto* fileIOBase = IO::FileIOBase::GetInstance())
             {
                 RHI::ConstPtr<RHI::PipelineLibraryData> serializedData = m_pipelineStateCache->GetLibrarySerializedData(m_pipelineLibraryHandle);
                 if (serializedData)
                 {
+                    ShaderPipelineStateCacheData pipelineStateCacheData;
+                    pipelineStateCacheData.m_shaderAssetBuildTimestamp = m_asset->GetShaderAssetBuildTimestamp();
+                    pipelineStateCacheData.m_pipelineLibraryData.assign(serializedData->GetData().begin(), serializedData->GetData().end());
+
+                    m_pipelineStateCache->ForEachLibraryPipelineState(m_pipelineLibraryHandle,
+                        [this, &pipelineStateCacheData](const RHI::PipelineStateDescriptor& descriptor)
+                        {
+                            PipelineStateCacheEntry pipelineState;
+                            if (!FindPipelineStateVariantStableId(descriptor, pipelineState.m_shaderVariantStableId))
+                            {
+                                return;
+                            }
+
+                            pipelineState.m_descriptorHash = static_cast<uint64_t>(descriptor.GetHash());
+                            if (descriptor.GetType() == RHI::PipelineStateType::Draw)
+                            {
+                                const auto& descriptorForDraw = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor);
+                                pipelineState.m_renderStates = descriptorForDraw.m_renderStates;
+                                pipelineState.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+                                pipelineState.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+                            }
+                            pipelineStateCacheData.m_pipelineStates.push_back(AZStd::move(pipelineState));
+                        });
+
                     const AZStd::string pipelineLibraryPath = GetPipelineLibraryPath();
 
                     char pipelineLibraryPathResolved[AZ_MAX_PATH_LEN] = { 0 };
                     fileIOBase->ResolvePath(pipelineLibraryPath.c_str(), pipelineLibraryPathResolved, AZ_MAX_PATH_LEN);
-                    Utils::SaveObjectToFile(pipelineLibraryPathResolved, DataStream::ST_BINARY, serializedData.get());
+                    Utils::SaveObjectToFile(pipelineLibraryPathResolved, DataStream::ST_BINARY, &pipelineStateCacheData);
                 }
             }
             else
@@ -277,6 +347,189 @@ namespace AZ
             }
         }
 
+        bool Shader::FindPipelineStateVariantStableId(const RHI::PipelineStateDescriptor& descriptor, ShaderVariantStableId& shaderVariantStableId)
+        {
+            // Variants are told apart by their shader code, the first stage of the pipeline is enough to find the variant.
+            const RHI::ShaderStageFunction* shaderFunction = nullptr;
+            RHI::ShaderStage shaderStage = RHI::ShaderStage::Unknown;
+            switch (descriptor.GetType())
+            {
+            case RHI::PipelineStateType::Draw:
+                shaderFunction = static_cast<const RHI::PipelineStateDescriptorForDraw&>(descriptor).m_vertexFunction.get();
+                shaderStage = RHI::ShaderStage::Vertex;
+                break;
+            case RHI::PipelineStateType::Dispatch:
+                shaderFunction = static_cast<const RHI::PipelineStateDescriptorForDispatch&>(descriptor).m_computeFunction.get();
+                shaderStage = RHI::ShaderStage::Compute;
+                break;
+            default:
+                // Ray tracing pipeline states are built from several shaders, they are not saved.
+                return false;
+            }
+
+            if (!shaderFunction)
+            {
+                return false;
+            }
+
+            if (m_rootVariant.GetShaderVariantAsset()->GetShaderStageFunction(shaderStage) == shaderFunction)
+            {
+                shaderVariantStableId = ShaderAsset::RootShaderVariantStableId;
+                return true;
+            }
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            for (const auto& shaderVariantEntry : m_shaderVariants)
+            {
+                if (shaderVariantEntry.second.GetShaderVariantAsset()->GetShaderStageFunction(shaderStage) == shaderFunction)
+                {
+                    shaderVariantStableId = shaderVariantEntry.first;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Shader::WarmUpPipelineStates(AZStd::vector<PipelineStateCacheEntry>&& pipelineStates, bool deferLoadingVariants)
+        {
+            if (pipelineStates.empty())
+            {
+                return;
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_warmUpMutex);
+            if (!m_warmUpCompletion)
+            {
+                m_warmUpCompletion = aznew AZ::JobCompletion();
+            }
+
+            auto warmUpLambda = [this, pipelineStates = AZStd::move(pipelineStates), deferLoadingVariants]()
+            {
+                AZ_PROFILE_SCOPE_DYNAMIC(Debug::ProfileCategory::AzRender, "Shader: WarmUpPipelineStates %s", m_asset->GetName().GetCStr());
+
+                for (const PipelineStateCacheEntry& pipelineState : pipelineStates)
+                {
+                    // The check happens under m_warmUpMutex, so if the variant is still loading,
+                    // OnShaderVariantAssetReady will find the pending pipeline state.
+                    ShaderVariant shaderVariant;
+                    {
+                        AZStd::lock_guard<AZStd::mutex> pendingLock(m_warmUpMutex);
+                        const WarmUpVariantState variantState = CopyWarmUpVariant(pipelineState.m_shaderVariantStableId, shaderVariant);
+                        if (variantState == WarmUpVariantState::Loading && deferLoadingVariants)
+                        {
+                            m_pendingWarmUpPipelineStates.push_back(pipelineState);
+                        }
+                        if (variantState != WarmUpVariantState::Ready)
+                        {
+                            continue;
+                        }
+                    }
+                    WarmUpPipelineState(pipelineState, shaderVariant);
+                }
+            };
+
+            AZ::Job* job = AZ::CreateJobFunction(AZStd::move(warmUpLambda), true, nullptr);
+            job->SetDependent(m_warmUpCompletion);
+            job->Start();
+        }
+
+        Shader::WarmUpVariantState Shader::CopyWarmUpVariant(ShaderVariantStableId shaderVariantStableId, ShaderVariant& shaderVariant)
+        {
+            if (!shaderVariantStableId.IsValid() || shaderVariantStableId == ShaderAsset::RootShaderVariantStableId)
+            {
+                // The root variant is only reset by Init, which waits for the warm-up jobs first.
+                shaderVariant = m_rootVariant;
+                return WarmUpVariantState::Ready;
+            }
+
+            // Adds the variant to the cache if its asset is loaded, or queues a load of the asset.
+            GetVariant(shaderVariantStableId);
+
+            AZStd::shared_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            auto findIt = m_shaderVariants.find(shaderVariantStableId);
+            if (findIt == m_shaderVariants.end())
+            {
+                return WarmUpVariantState::Loading;
+            }
+
+            // The saved pipeline state was built with the current shader asset, an older variant won't match it.
+            if (findIt->second.GetBuildTimestamp() < m_asset->GetShaderAssetBuildTimestamp())
+            {
+                return WarmUpVariantState::OutOfDate;
+            }
+
+            shaderVariant = findIt->second;
+            return WarmUpVariantState::Ready;
+        }
+
+        void Shader::WarmUpPipelineState(const PipelineStateCacheEntry& pipelineState, const ShaderVariant& shaderVariant) const
+        {
+            switch (m_pipelineStateType)
+            {
+            case RHI::PipelineStateType::Draw:
+            {
+                RHI::PipelineStateDescriptorForDraw descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                descriptor.m_renderStates = pipelineState.m_renderStates;
+                descriptor.m_inputStreamLayout = pipelineState.m_inputStreamLayout;
+                descriptor.m_renderAttachmentConfiguration = pipelineState.m_renderAttachmentConfiguration;
+                if (static_cast<uint64_t>(descriptor.GetHash()) == pipelineState.m_descriptorHash)
+                {
+                    AcquirePipelineState(descriptor);
+                }
+                break;
+            }
+            case RHI::PipelineStateType::Dispatch:
+            {
+                RHI::PipelineStateDescriptorForDispatch descriptor;
+                shaderVariant.ConfigurePipelineState(descriptor);
+                if (static_cast<uint64_t>(descriptor.GetHash()) == pipelineState.m_descriptorHash)
+                {
+                    AcquirePipelineState(descriptor);
+                }
+                break;
+            }
+            default:
+                break;
+            }
+        }
+
+        void Shader::WaitForPipelineStateWarmUp()
+        {
+            WaitForPipelineStateWarmUpJobs();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_warmUpMutex);
+            m_pendingWarmUpPipelineStates.clear();
+        }
+
+        void Shader::WaitForPipelineStateWarmUpJobs()
+        {
+            AZ::JobCompletion* warmUpCompletion = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_warmUpMutex);
+                warmUpCompletion = m_warmUpCompletion;
+                m_warmUpCompletion = nullptr;
+            }
+
+            if (warmUpCompletion)
+            {
+                warmUpCompletion->StartAndWaitForCompletion();
+                delete warmUpCompletion;
+            }
+        }
+
+        size_t Shader::GetPendingWarmUpPipelineStateCount()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_warmUpMutex);
+            return m_pendingWarmUpPipelineStates.size();
+        }
+
+        void Shader::ClearShaderVariants()
+        {
+            AZStd::unique_lock<decltype(m_variantCacheMutex)> lock(m_variantCacheMutex);
+            m_shaderVariants.clear();
+        }
+
         AZStd::string Shader::GetPipelineLibraryPath() const
         {
             const Data::InstanceId& instanceId = GetId();
@@ -286,7 +539,7 @@ namespace AZ
             AZStd::string uuidString;
             instanceId.m_guid.ToString<AZStd::string>(uuidString, false, false);
 
-            return AZStd::string::format("@user@/Atom/PipelineStateCache/%s/%s_%s_%d.bin", platformName.GetCStr(), shaderName.GetCStr(), uuidString.data(), instanceId.m_subId);
+            return AZStd::string::format("@user@/Atom/PipelineStateCache/%s/%s_%s_%d.psocache", platformName.GetCStr(), shaderName.GetCStr(), uuidString.data(), instanceId.m_subId);
         }
 
         ShaderOptionGroup Shader::CreateShaderOptionGroup() const
@@ -14,6 +14,7 @@
 #include <Atom/RPI.Reflect/Asset/AssetUtils.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderOptionGroup.h>
+#include <Atom/RPI.Reflect/Shader/ShaderPipelineStateCacheData.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantAsset.h>
 #include <Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h>
 #include <Atom/RPI.Reflect/Shader/PrecompiledShaderAssetSourceData.h>
@@ -39,6 +40,7 @@ namespace AZ
             ShaderOutputContract::Reflect(context);
             ShaderVariantAsset::Reflect(context);
             ShaderVariantTreeAsset::Reflect(context);
+            ShaderPipelineStateCacheData::Reflect(context);
             ReflectShaderStageType(context);
             PrecompiledShaderAssetSourceData::Reflect(context);
         }
@@ -16,8 +16,10 @@
 
 #include <AzCore/Casting/lossy_cast.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Jobs/Algorithms.h>
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <Atom_RPI_Traits_Platform.h>
 
 #if AZ_TRAIT_MASKED_OCCLUSION_CULLING_SUPPORTED
@@ -241,11 +243,43 @@ namespace AZ
             return m_drawListContext.GetList(drawListTag);
         }
 
-        void View::FinalizeDrawLists()
+        void View::FinalizeDrawLists(RHI::JobPolicy jobPolicy)
         {
             AZ_PROFILE_FUNCTION(Debug::ProfileCategory::AzRender);
-            m_drawListContext.FinalizeLists();
-            SortFinalizedDrawLists();
+
+            AZStd::fixed_vector<RHI::DrawListTag, RHI::Limits::Pipeline::DrawListTagCountMax> drawListTags;
+            for (size_t idx = 0; idx < m_drawListMask.size(); ++idx)
+            {
+                if (m_drawListMask[idx])
+                {
+                    drawListTags.push_back(RHI::DrawListTag(idx));
+                }
+            }
+
+            if (jobPolicy == RHI::JobPolicy::Serial || drawListTags.size() < 2)
+            {
+                m_drawListContext.FinalizeLists();
+                SortFinalizedDrawLists();
+            }
+            else
+            {
+                // The draw lists are independent of each other, so each one is merged and sorted in its own job
+                AZ::parallel_for(size_t(0), drawListTags.size(), [this, &drawListTags](size_t idx)
+                {
+                    FinalizeDrawList(drawListTags[idx]);
+                });
+            }
+        }
+
+        void View::FinalizeDrawList(RHI::DrawListTag tag)
+        {
+            m_drawListContext.FinalizeList(tag);
+
+            RHI::DrawList& drawList = m_drawListContext.GetMergedDrawListsByTag()[tag.GetIndex()];
+            if (drawList.size() > 1)
+            {
+                SortDrawList(drawList, tag);
+            }
         }
 
         void View::SortFinalizedDrawLists()
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Shader/ShaderPipelineStateCacheData.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        void ShaderPipelineStateCacheData::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<PipelineStateEntry>()
+                    ->Version(0)
+                    ->Field("m_shaderVariantStableId", &PipelineStateEntry::m_shaderVariantStableId)
+                    ->Field("m_descriptorHash", &PipelineStateEntry::m_descriptorHash)
+                    ->Field("m_renderStates", &PipelineStateEntry::m_renderStates)
+                    ->Field("m_inputStreamLayout", &PipelineStateEntry::m_inputStreamLayout)
+                    ->Field("m_renderAttachmentConfiguration", &PipelineStateEntry::m_renderAttachmentConfiguration)
+                    ;
+
+                serializeContext->Class<ShaderPipelineStateCacheData>()
+                    ->Version(0)
+                    ->Field("m_shaderAssetBuildTimestamp", &ShaderPipelineStateCacheData::m_shaderAssetBuildTimestamp)
+                    ->Field("m_pipelineLibraryData", &ShaderPipelineStateCacheData::m_pipelineLibraryData)
+                    ->Field("m_pipelineStates", &ShaderPipelineStateCacheData::m_pipelineStates)
+                    ;
+            }
+        }
+    } // namespace RPI
+} // namespace AZ
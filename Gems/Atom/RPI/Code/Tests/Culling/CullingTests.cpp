@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Model/ModelLodUtils.h>
+
+#include <AzCore/Math/Frustum.h>
+#include <AzCore/Math/Matrix4x4.h>
+#include <AzCore/Math/Random.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::RPI;
+
+    class CullingTests
+        : public AllocatorsTestFixture
+    {
+    protected:
+        // Fills the block with random spheres around the frustum, so all three intersect results show up
+        void FillRandomBlock(SimpleLcgRandom& random, CullableBoundsBlock& block)
+        {
+            for (uint32_t lane = 0; lane < CullableBoundsBlock::Width; ++lane)
+            {
+                block.m_centerX[lane] = (random.GetRandomFloat() - 0.5f) * 60.0f;
+                block.m_centerY[lane] = (random.GetRandomFloat() - 0.5f) * 60.0f;
+                block.m_centerZ[lane] = -random.GetRandomFloat() * 120.0f + 10.0f;
+                block.m_radius[lane] = random.GetRandomFloat() * 10.0f;
+                block.m_lodSelectionRadius[lane] = block.m_radius[lane] * 0.5f;
+            }
+        }
+    };
+
+    TEST_F(CullingTests, ClassifySpheres_RandomSpheres_MatchesFrustumIntersectSphere)
+    {
+        const Matrix4x4 viewToClip = Matrix4x4::CreateProjection(DegToRad(60.0f), 1.5f, 0.1f, 100.0f);
+        const Frustum frustum = Frustum::CreateFromMatrixColumnMajor(viewToClip);
+        const CullingFrustumPlanes frustumPlanes(frustum);
+
+        SimpleLcgRandom random(1234);
+        uint32_t resultCounts[3] = {};
+        for (int iteration = 0; iteration < 1000; ++iteration)
+        {
+            CullableBoundsBlock block;
+            FillRandomBlock(random, block);
+
+            // Lanes past laneCount must never be reported
+            const uint32_t laneCount = 1 + iteration % CullableBoundsBlock::Width;
+            uint32_t outsideMask = 0;
+            uint32_t insideMask = 0;
+            frustumPlanes.ClassifySpheres(block, laneCount, outsideMask, insideMask);
+            EXPECT_EQ(0u, (outsideMask | insideMask) >> laneCount);
+
+            for (uint32_t lane = 0; lane < laneCount; ++lane)
+            {
+                const Vector3 center(block.m_centerX[lane], block.m_centerY[lane], block.m_centerZ[lane]);
+                const IntersectResult expected = frustum.IntersectSphere(center, block.m_radius[lane]);
+                const bool isOutside = (outsideMask & (1u << lane)) != 0;
+                const bool isInside = (insideMask & (1u << lane)) != 0;
+                EXPECT_EQ(expected == IntersectResult::Exterior, isOutside);
+                EXPECT_EQ(expected == IntersectResult::Interior, isInside);
+                ++resultCounts[static_cast<int>(expected)];
+            }
+        }
+
+        EXPECT_GT(resultCounts[static_cast<int>(IntersectResult::Interior)], 0u);
+        EXPECT_GT(resultCounts[static_cast<int>(IntersectResult::Overlaps)], 0u);
+        EXPECT_GT(resultCounts[static_cast<int>(IntersectResult::Exterior)], 0u);
+    }
+
+    TEST_F(CullingTests, ApproxScreenPercentages_RandomSpheres_MatchesModelLodUtils)
+    {
+        const Vector3 cameraPosition(1.0f, 2.0f, 3.0f);
+        const float yScale = 1.7f;
+
+        SimpleLcgRandom random(4321);
+        for (int iteration = 0; iteration < 100; ++iteration)
+        {
+            CullableBoundsBlock block;
+            FillRandomBlock(random, block);
+
+            for (bool isPerspective : { true, false })
+            {
+                float screenPercentages[CullableBoundsBlock::Width];
+                ApproxScreenPercentages(block, cameraPosition, yScale, isPerspective, screenPercentages);
+
+                for (uint32_t lane = 0; lane < CullableBoundsBlock::Width; ++lane)
+                {
+                    const Vector3 center(block.m_centerX[lane], block.m_centerY[lane], block.m_centerZ[lane]);
+                    const float expected = ModelLodUtils::ApproxScreenPercentage(
+                        center, block.m_lodSelectionRadius[lane], cameraPosition, yScale, isPerspective);
+                    EXPECT_NEAR(expected, screenPercentages[lane], 1e-5f);
+                }
+            }
+        }
+    }
+}
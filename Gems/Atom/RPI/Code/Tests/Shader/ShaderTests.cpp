@@ -6,6 +6,7 @@
  */
 
 #include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
 
 #include <Atom/RHI.Reflect/RenderAttachmentLayoutBuilder.h>
 #include <Atom/RHI.Reflect/ShaderStageFunction.h>
@@ -23,7 +24,9 @@
 #include <Common/ErrorMessageFinder.h>
 #include <Common/SerializeTester.h>
 
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/Utils.h>
 #include <AzCore/Utils/TypeHash.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/std/string/conversions.h>
@@ -564,6 +567,82 @@ namespace UnitTest
             EXPECT_NE(pipelineState, nullptr);
         }
 
+        //! Creates a saved pipeline state of a draw descriptor configured with the shader variant.
+        AZ::RPI::ShaderPipelineStateCacheData::PipelineStateEntry CreatePipelineStateEntry(const AZ::RPI::ShaderVariant& shaderVariant)
+        {
+            using namespace AZ;
+
+            RHI::PipelineStateDescriptorForDraw descriptorForDraw;
+            shaderVariant.ConfigurePipelineState(descriptorForDraw);
+            descriptorForDraw.m_inputStreamLayout.SetTopology(RHI::PrimitiveTopology::TriangleList);
+            descriptorForDraw.m_inputStreamLayout.Finalize();
+            RHI::RenderAttachmentLayoutBuilder builder;
+            builder.AddSubpass()
+                ->RenderTargetAttachment(RHI::Format::R8G8B8A8_SNORM)
+                ->DepthStencilAttachment(RHI::Format::R32_FLOAT);
+            builder.End(descriptorForDraw.m_renderAttachmentConfiguration.m_renderAttachmentLayout);
+
+            RPI::ShaderPipelineStateCacheData::PipelineStateEntry pipelineState;
+            pipelineState.m_shaderVariantStableId = shaderVariant.GetStableId();
+            pipelineState.m_descriptorHash = static_cast<uint64_t>(descriptorForDraw.GetHash());
+            pipelineState.m_renderStates = descriptorForDraw.m_renderStates;
+            pipelineState.m_inputStreamLayout = descriptorForDraw.m_inputStreamLayout;
+            pipelineState.m_renderAttachmentConfiguration = descriptorForDraw.m_renderAttachmentConfiguration;
+            return pipelineState;
+        }
+
+        // The pipeline state warm-up of Shader is private, the tests reach it through the helpers below.
+
+        AZStd::string GetPipelineLibraryPath(const AZ::Data::Instance<AZ::RPI::Shader>& shader)
+        {
+            return shader->GetPipelineLibraryPath();
+        }
+
+        AZStd::unique_ptr<AZ::RPI::ShaderPipelineStateCacheData> LoadPipelineLibrary(const AZ::Data::Instance<AZ::RPI::Shader>& shader)
+        {
+            return shader->LoadPipelineLibrary();
+        }
+
+        void WarmUpPipelineStates(const AZ::Data::Instance<AZ::RPI::Shader>& shader,
+            AZStd::vector<AZ::RPI::ShaderPipelineStateCacheData::PipelineStateEntry> pipelineStates)
+        {
+            shader->WarmUpPipelineStates(AZStd::move(pipelineStates), true);
+        }
+
+        //! Waits for the warm-up jobs without dropping the pipeline states still waiting for their variant.
+        void WaitForWarmUpJobs(const AZ::Data::Instance<AZ::RPI::Shader>& shader)
+        {
+            shader->WaitForPipelineStateWarmUpJobs();
+        }
+
+        size_t GetPendingWarmUpPipelineStateCount(const AZ::Data::Instance<AZ::RPI::Shader>& shader)
+        {
+            return shader->GetPendingWarmUpPipelineStateCount();
+        }
+
+        void ClearShaderVariants(const AZ::Data::Instance<AZ::RPI::Shader>& shader)
+        {
+            shader->ClearShaderVariants();
+        }
+
+        //! Returns how many pipeline states with the descriptor hash the shader's pipeline library holds.
+        size_t CountLibraryPipelineStates(const AZ::Data::Instance<AZ::RPI::Shader>& shader, uint64_t descriptorHash)
+        {
+            // Only pipeline states merged by Compact are visited.
+            shader->m_pipelineStateCache->Compact();
+
+            size_t count = 0;
+            shader->m_pipelineStateCache->ForEachLibraryPipelineState(shader->m_pipelineLibraryHandle,
+                [descriptorHash, &count](const AZ::RHI::PipelineStateDescriptor& descriptor)
+                {
+                    if (static_cast<uint64_t>(descriptor.GetHash()) == descriptorHash)
+                    {
+                        ++count;
+                    }
+                });
+            return count;
+        }
+
         AZStd::array<AZ::RPI::ShaderOptionDescriptor, 4> m_bindings;
 
         AZ::Name m_name;
@@ -1295,6 +1374,131 @@ namespace UnitTest
         ValidateShader(shader);
     }
 
+    TEST_F(ShaderTests, ShaderPipelineStateCacheData_SaveLoad_Test)
+    {
+        using namespace AZ;
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        const AZStd::string filePath = tempDirectory.Resolve("TestShader.psocache");
+
+        RPI::ShaderPipelineStateCacheData pipelineStateCacheData;
+        pipelineStateCacheData.m_shaderAssetBuildTimestamp = AZStd::sys_time_t(5);
+        pipelineStateCacheData.m_pipelineLibraryData = { 1, 2, 3, 4 };
+
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(CreateShaderAsset());
+        pipelineStateCacheData.m_pipelineStates.push_back(CreatePipelineStateEntry(shader->GetRootVariant()));
+
+        RPI::ShaderPipelineStateCacheData::PipelineStateEntry dispatchPipelineState;
+        dispatchPipelineState.m_shaderVariantStableId = RPI::ShaderVariantStableId{ 2 };
+        dispatchPipelineState.m_descriptorHash = 0x1234;
+        pipelineStateCacheData.m_pipelineStates.push_back(dispatchPipelineState);
+
+        EXPECT_TRUE(Utils::SaveObjectToFile(filePath, DataStream::ST_BINARY, &pipelineStateCacheData, GetSerializeContext()));
+
+        AZStd::unique_ptr<RPI::ShaderPipelineStateCacheData> loadedData(
+            Utils::LoadObjectFromFile<RPI::ShaderPipelineStateCacheData>(filePath, GetSerializeContext()));
+        ASSERT_TRUE(loadedData);
+
+        EXPECT_EQ(loadedData->m_shaderAssetBuildTimestamp, pipelineStateCacheData.m_shaderAssetBuildTimestamp);
+        EXPECT_EQ(loadedData->m_pipelineLibraryData, pipelineStateCacheData.m_pipelineLibraryData);
+        ASSERT_EQ(loadedData->m_pipelineStates.size(), pipelineStateCacheData.m_pipelineStates.size());
+
+        for (size_t i = 0; i < loadedData->m_pipelineStates.size(); ++i)
+        {
+            const auto& loadedPipelineState = loadedData->m_pipelineStates[i];
+            const auto& savedPipelineState = pipelineStateCacheData.m_pipelineStates[i];
+            EXPECT_EQ(loadedPipelineState.m_shaderVariantStableId, savedPipelineState.m_shaderVariantStableId);
+            EXPECT_EQ(loadedPipelineState.m_descriptorHash, savedPipelineState.m_descriptorHash);
+            EXPECT_EQ(loadedPipelineState.m_renderStates.GetHash(), savedPipelineState.m_renderStates.GetHash());
+            EXPECT_EQ(loadedPipelineState.m_inputStreamLayout.GetHash(), savedPipelineState.m_inputStreamLayout.GetHash());
+            EXPECT_EQ(loadedPipelineState.m_renderAttachmentConfiguration.GetHash(), savedPipelineState.m_renderAttachmentConfiguration.GetHash());
+        }
+    }
+
+    TEST_F(ShaderTests, Shader_LoadPipelineLibrary_BuildTimestampMismatch_DataDiscarded)
+    {
+        using namespace AZ;
+
+        AZ::Test::ScopedAutoTempDirectory tempDirectory;
+        IO::FileIOBase::GetInstance()->SetAlias("@user@", tempDirectory.GetDirectory());
+
+        RPI::ShaderAssetCreator creator;
+        BeginCreatingTestShaderAsset(creator);
+        creator.SetShaderAssetBuildTimestamp(AZStd::sys_time_t(2));
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(EndCreatingTestShaderAsset(creator));
+        ASSERT_TRUE(shader);
+
+        RPI::ShaderPipelineStateCacheData pipelineStateCacheData;
+        pipelineStateCacheData.m_shaderAssetBuildTimestamp = AZStd::sys_time_t(2);
+        pipelineStateCacheData.m_pipelineStates.push_back(CreatePipelineStateEntry(shader->GetRootVariant()));
+
+        EXPECT_TRUE(Utils::SaveObjectToFile(GetPipelineLibraryPath(shader), DataStream::ST_BINARY, &pipelineStateCacheData, GetSerializeContext()));
+        AZStd::unique_ptr<RPI::ShaderPipelineStateCacheData> loadedData = LoadPipelineLibrary(shader);
+        ASSERT_TRUE(loadedData);
+        EXPECT_EQ(loadedData->m_pipelineStates.size(), 1);
+
+        // Saved with an older build of the shader asset.
+        pipelineStateCacheData.m_shaderAssetBuildTimestamp = AZStd::sys_time_t(1);
+
+        EXPECT_TRUE(Utils::SaveObjectToFile(GetPipelineLibraryPath(shader), DataStream::ST_BINARY, &pipelineStateCacheData, GetSerializeContext()));
+        EXPECT_FALSE(LoadPipelineLibrary(shader));
+    }
+
+    TEST_F(ShaderTests, Shader_WarmUpPipelineStates_VariantLoading_CompiledWhenVariantIsReady)
+    {
+        using namespace AZ;
+
+        Data::Asset<RPI::ShaderAsset> shaderAsset = CreateShaderAsset();
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(shaderAsset);
+        ASSERT_TRUE(shader);
+
+        const RPI::ShaderVariantStableId stableId{ 1 };
+        Data::Asset<RPI::ShaderVariantAsset> shaderVariantAsset = CreateTestShaderVariantAsset(RPI::ShaderVariantId{}, stableId, false);
+
+        // Builds the saved pipeline state from the variant, then forgets the variant so the warm-up has to wait for it.
+        RPI::ShaderVariantFinderNotificationBus::Event(shaderAsset.GetId(),
+            &RPI::ShaderVariantFinderNotification::OnShaderVariantAssetReady, shaderVariantAsset, false);
+        const RPI::ShaderPipelineStateCacheData::PipelineStateEntry pipelineState = CreatePipelineStateEntry(shader->GetVariant(stableId));
+        ASSERT_EQ(pipelineState.m_shaderVariantStableId, stableId);
+        ClearShaderVariants(shader);
+
+        WarmUpPipelineStates(shader, { pipelineState });
+        WaitForWarmUpJobs(shader);
+        EXPECT_EQ(GetPendingWarmUpPipelineStateCount(shader), 1);
+        EXPECT_EQ(CountLibraryPipelineStates(shader, pipelineState.m_descriptorHash), 0);
+
+        RPI::ShaderVariantFinderNotificationBus::Event(shaderAsset.GetId(),
+            &RPI::ShaderVariantFinderNotification::OnShaderVariantAssetReady, shaderVariantAsset, false);
+        WaitForWarmUpJobs(shader);
+        EXPECT_EQ(GetPendingWarmUpPipelineStateCount(shader), 0);
+        EXPECT_EQ(CountLibraryPipelineStates(shader, pipelineState.m_descriptorHash), 1);
+    }
+
+    TEST_F(ShaderTests, Shader_WarmUpPipelineStates_VariantOutOfDate_Dropped)
+    {
+        using namespace AZ;
+
+        // The variant is built before the shader asset, and is out of date.
+        RPI::ShaderAssetCreator creator;
+        BeginCreatingTestShaderAsset(creator);
+        creator.SetShaderAssetBuildTimestamp(AZStd::sys_time_t(2));
+        Data::Asset<RPI::ShaderAsset> shaderAsset = EndCreatingTestShaderAsset(creator);
+        Data::Instance<RPI::Shader> shader = RPI::Shader::FindOrCreate(shaderAsset);
+        ASSERT_TRUE(shader);
+
+        const RPI::ShaderVariantStableId stableId{ 1 };
+        Data::Asset<RPI::ShaderVariantAsset> shaderVariantAsset = CreateTestShaderVariantAsset(RPI::ShaderVariantId{}, stableId, false);
+        RPI::ShaderVariantFinderNotificationBus::Event(shaderAsset.GetId(),
+            &RPI::ShaderVariantFinderNotification::OnShaderVariantAssetReady, shaderVariantAsset, false);
+
+        RPI::ShaderPipelineStateCacheData::PipelineStateEntry pipelineState = CreatePipelineStateEntry(shader->GetRootVariant());
+        pipelineState.m_shaderVariantStableId = stableId;
+
+        WarmUpPipelineStates(shader, { pipelineState });
+        WaitForWarmUpJobs(shader);
+        EXPECT_EQ(GetPendingWarmUpPipelineStateCount(shader), 0);
+    }
+
     TEST_F(ShaderTests, ValidateShaderVariantIdMath)
     {
         RPI::ShaderVariantId           idSmall;
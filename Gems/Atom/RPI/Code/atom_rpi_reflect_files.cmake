@@ -79,6 +79,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Shader/ShaderOptionGroup.h
     Include/Atom/RPI.Reflect/Shader/ShaderOptionGroupLayout.h
     Include/Atom/RPI.Reflect/Shader/ShaderOutputContract.h
+    Include/Atom/RPI.Reflect/Shader/ShaderPipelineStateCacheData.h
     Include/Atom/RPI.Reflect/Shader/ShaderOptionTypes.h
     Include/Atom/RPI.Reflect/Shader/ShaderVariantKey.h
     Include/Atom/RPI.Reflect/Shader/ShaderVariantTreeAsset.h
@@ -149,6 +150,7 @@ set(FILES
     Source/RPI.Reflect/Shader/ShaderOptionGroup.cpp
     Source/RPI.Reflect/Shader/ShaderOptionGroupLayout.cpp
     Source/RPI.Reflect/Shader/ShaderOutputContract.cpp
+    Source/RPI.Reflect/Shader/ShaderPipelineStateCacheData.cpp
     Source/RPI.Reflect/Shader/ShaderVariantKey.cpp
     Source/RPI.Reflect/Shader/ShaderVariantTreeAsset.cpp
     Source/RPI.Reflect/Shader/ShaderVariantAsset.cpp
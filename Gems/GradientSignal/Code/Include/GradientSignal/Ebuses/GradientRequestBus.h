@@ -9,6 +9,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -48,6 +49,25 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. This has the same thread-safety requirements as GetValue.
+        * Gradients should override this when they can evaluate many positions more efficiently than with repeated
+        * calls to GetValue, for instance by doing per-call setup such as locking or transform lookups only once.
+        * @param positions The positions to generate values for.
+        * @param outValues The generated values. Must be the same size as positions.
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -27,6 +28,22 @@ namespace GradientSignal
         virtual ~GradientTransformRequests() = default;
 
         virtual void TransformPositionToUVW(const AZ::Vector3& inPosition, AZ::Vector3& outUVW, const bool shouldNormalizeOutput, bool& wasPointRejected) const = 0;
+
+        //! Batched version of TransformPositionToUVW. All output vectors need to be the same size as inPositions.
+        virtual void TransformPositionsToUVW(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<AZ::Vector3>& outUVWs,
+            const bool shouldNormalizeOutput, AZStd::vector<bool>& wasPointRejected) const
+        {
+            AZ_Assert(inPositions.size() == outUVWs.size() && inPositions.size() == wasPointRejected.size(),
+                "The input and output vectors need to be the same size.");
+
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                bool rejected = false;
+                TransformPositionToUVW(inPositions[index], outUVWs[index], shouldNormalizeOutput, rejected);
+                wasPointRejected[index] = rejected;
+            }
+        }
+
         virtual void GetGradientLocalBounds(AZ::Aabb& bounds) const = 0;
         virtual void GetGradientEncompassingBounds(AZ::Aabb& bounds) const = 0;
     };
@@ -13,6 +13,7 @@
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
@@ -31,6 +32,8 @@ namespace GradientSignal
         static void Reflect(AZ::ReflectContext* context);
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
+        //! Batched version of GetValue. outValues needs to be the same size as positions.
+        inline void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
 
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
@@ -145,4 +148,73 @@ namespace GradientSignal
 
         return output * m_opacity;
     }
+
+    inline void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        //apply transform if set, building the transform once for the entire batch
+        const AZStd::vector<AZ::Vector3>* samplePositions = &positions;
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        if (m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this))
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.resize_no_construct(positions.size());
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                transformedPositions[index] = matrix3x4 * positions[index];
+            }
+            samplePositions = &transformedPositions;
+        }
+
+        {
+            // See GetValue for why the surface data mutex is locked before checking "isRequestInProgress".
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            // Values are left at zero if there's no gradient connected, matching GetValue.
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            GradientRequestBus::Event(m_gradientId, &GradientRequestBus::Events::GetValues, *samplePositions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        const bool applyLevels = m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this);
+        for (float& output : outValues)
+        {
+            if (m_invertInput)
+            {
+                output = 1.0f - output;
+            }
+
+            //apply levels if set
+            if (applyLevels)
+            {
+                output = GetLevels(output, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+            }
+
+            output *= m_opacity;
+        }
+    }
 }
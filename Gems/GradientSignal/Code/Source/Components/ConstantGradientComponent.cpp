@@ -134,6 +134,12 @@ namespace GradientSignal
         return m_configuration.m_value;
     }
 
+    void ConstantGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+        AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
@@ -260,6 +260,53 @@ namespace GradientSignal
         return value > d ? 1.0f : 0.0f;
     }
 
+    void DitherGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+        // The points per unit are the same for every position so only look them up once.
+        float pointsPerUnit = m_configuration.m_pointsPerUnit;
+        if (m_configuration.m_useSystemPointsPerUnit)
+        {
+            SectorDataRequestBus::Broadcast(&SectorDataRequestBus::Events::GetPointsPerMeter, pointsPerUnit);
+        }
+        pointsPerUnit = AZ::GetMax(pointsPerUnit, 0.0001f);
+
+        AZStd::vector<AZ::Vector3> flooredCoordinates;
+        flooredCoordinates.resize_no_construct(positions.size());
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3 scaledCoordinate = positions[index] * pointsPerUnit;
+            flooredCoordinates[index] = AZ::Vector3(
+                std::floor(scaledCoordinate.GetX()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetY()) / pointsPerUnit,
+                std::floor(scaledCoordinate.GetZ()) / pointsPerUnit);
+        }
+
+        m_configuration.m_gradientSampler.GetValues(flooredCoordinates, outValues);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            const AZ::Vector3 patternCoordinate = (positions[index] * pointsPerUnit) + m_configuration.m_patternOffset;
+
+            float d = 0.0f;
+            switch (m_configuration.m_patternType)
+            {
+            default:
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_4x4:
+                d = GetDitherValue4x4(patternCoordinate);
+                break;
+            case DitherGradientConfig::BayerPatternType::PATTERN_SIZE_8x8:
+                d = GetDitherValue8x8(patternCoordinate);
+                break;
+            }
+
+            outValues[index] = outValues[index] > d ? 1.0f : 0.0f;
+        }
+    }
+
     bool DitherGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
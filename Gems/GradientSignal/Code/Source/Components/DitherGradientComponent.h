@@ -76,6 +76,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const override;
 
         //////////////////////////////////////////////////////////////////////////
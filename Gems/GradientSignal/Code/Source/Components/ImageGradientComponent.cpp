@@ -208,6 +208,27 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void ImageGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = true;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        // Hold the image lock for the entire batch instead of taking it for every sample.
+        AZStd::lock_guard<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = wasPointRejected[index] ? 0.0f :
+                GetValueFromImageAsset(m_configuration.m_imageAsset, uvws[index], m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+        }
+    }
+
     AZStd::string ImageGradientComponent::GetImageAssetPath() const
     {
         AZStd::string assetPathString;
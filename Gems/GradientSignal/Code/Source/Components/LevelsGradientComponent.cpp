@@ -187,6 +187,24 @@ namespace GradientSignal
         return output;
     }
 
+    void LevelsGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        for (float& value : outValues)
+        {
+            value = GetLevels(
+                value,
+                m_configuration.m_inputMid,
+                m_configuration.m_inputMin,
+                m_configuration.m_inputMax,
+                m_configuration.m_outputMin,
+                m_configuration.m_outputMax);
+        }
+    }
+
     bool LevelsGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
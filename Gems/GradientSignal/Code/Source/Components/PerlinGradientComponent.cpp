@@ -192,6 +192,33 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void PerlinGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // Transform all the positions with a single bus call so the transform lookup and locking only happen once per batch.
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = wasPointRejected[index] ? 0.0f :
+                m_perlinImprovedNoise->GenerateOctaveNoise(uvws[index].GetX(), uvws[index].GetY(), uvws[index].GetZ(),
+                    m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency);
+        }
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
@@ -174,6 +174,26 @@ namespace GradientSignal
         return GetRatio(m_configuration.m_falloffWidth, 0.0f, distance);
     }
 
+    void ShapeAreaFalloffGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The positions and outValues vectors need to be the same size.");
+
+        // Query the shape once for the entire batch. Distances stay at 0 if there's no shape, matching GetValue.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch, positions, outValues);
+
+        const float falloffWidth = m_configuration.m_falloffWidth;
+        for (float& value : outValues)
+        {
+            // See GetValue for the special case of 0 falloff.
+            const float distance = sqrtf(value);
+            value = (falloffWidth == 0.0f) ? ((distance > 0.0f) ? 0.0f : 1.0f) : GetRatio(falloffWidth, 0.0f, distance);
+        }
+    }
+
     AZ::EntityId ShapeAreaFalloffGradientComponent::GetShapeEntityId() const
     {
         return m_configuration.m_shapeEntityId;
@@ -20,6 +20,7 @@
 #include <AzCore/std/containers/array.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeIntersectionUtil.h>
 #include <random>
 
 namespace LmbrCentral
@@ -146,6 +147,34 @@ namespace LmbrCentral
         return m_intersectionDataCache.m_obb.GetDistanceSq(point);
     }
 
+    void BoxShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            ShapeIntersectionUtil::IsPointInsideAabb(m_intersectionDataCache.m_aabb, points, outIsInside);
+        }
+        else
+        {
+            ShapeIntersectionUtil::IsPointInsideObb(m_intersectionDataCache.m_obb, points, outIsInside);
+        }
+    }
+
+    void BoxShape::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
+
+        if (m_intersectionDataCache.m_axisAligned)
+        {
+            ShapeIntersectionUtil::DistanceSquaredFromPointAabb(m_intersectionDataCache.m_aabb, points, outDistancesSquared);
+        }
+        else
+        {
+            ShapeIntersectionUtil::DistanceSquaredFromPointObb(m_intersectionDataCache.m_obb, points, outDistancesSquared);
+        }
+    }
+
     bool BoxShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_boxShapeConfig, m_currentNonUniformScale);
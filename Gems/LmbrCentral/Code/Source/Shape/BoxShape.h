@@ -46,6 +46,8 @@ namespace LmbrCentral
         void GetTransformAndLocalBounds(AZ::Transform& transform, AZ::Aabb& bounds) override;
         bool IsPointInside(const AZ::Vector3& point) override;
         float DistanceSquaredFromPoint(const AZ::Vector3& point) override;
+        void IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside) override;
+        void DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared) override;
         AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution) override;
         bool IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance) override;
 
@@ -14,6 +14,7 @@
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <MathConversion.h>
+#include <Shape/ShapeIntersectionUtil.h>
 
 namespace LmbrCentral
 {
@@ -174,6 +175,25 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void CapsuleShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        ShapeIntersectionUtil::IsPointInsideCapsule(
+            m_intersectionDataCache.m_basePlaneCenterPoint, m_intersectionDataCache.m_topPlaneCenterPoint,
+            m_intersectionDataCache.m_axisVector, powf(m_intersectionDataCache.m_internalHeight, 2.0f),
+            powf(m_intersectionDataCache.m_radius, 2.0f), m_intersectionDataCache.m_isSphere, points, outIsInside);
+    }
+
+    void CapsuleShape::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
+
+        ShapeIntersectionUtil::DistanceSquaredFromPointCapsule(
+            m_intersectionDataCache.m_basePlaneCenterPoint, m_intersectionDataCache.m_topPlaneCenterPoint,
+            m_intersectionDataCache.m_radius, points, outDistancesSquared);
+    }
+
     bool CapsuleShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_capsuleShapeConfig);
@@ -18,6 +18,7 @@
 #include <AzCore/Math/Sfmt.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeIntersectionUtil.h>
 
 #include "Cry_GeoDistance.h"
 #include <random>
@@ -250,6 +251,36 @@ namespace LmbrCentral
             m_intersectionDataCache.m_radius);
     }
 
+    void CylinderShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        ShapeIntersectionUtil::IsPointInsideCylinder(
+            m_intersectionDataCache.m_baseCenterPoint,
+            m_intersectionDataCache.m_axisVector,
+            powf(m_intersectionDataCache.m_height, 2.0f),
+            powf(m_intersectionDataCache.m_radius, 2.0f),
+            points, outIsInside);
+    }
+
+    void CylinderShape::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
+
+        if (m_cylinderShapeConfig.m_height <= 0.0f || m_cylinderShapeConfig.m_radius <= 0.0f)
+        {
+            ShapeIntersectionUtil::DistanceSquaredFromPointSphere(
+                m_intersectionDataCache.m_baseCenterPoint, 0.0f, points, outDistancesSquared);
+            return;
+        }
+
+        ShapeIntersectionUtil::DistanceSquaredFromPointCylinder(
+            m_intersectionDataCache.m_baseCenterPoint,
+            m_intersectionDataCache.m_baseCenterPoint + m_intersectionDataCache.m_axisVector,
+            m_intersectionDataCache.m_radius,
+            points, outDistancesSquared);
+    }
+
     bool CylinderShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_cylinderShapeConfig);
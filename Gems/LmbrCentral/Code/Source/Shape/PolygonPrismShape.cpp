@@ -374,6 +374,35 @@ namespace LmbrCentral
         return PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, point, m_currentTransform);;
     }
 
+    void PolygonPrismShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZ_Assert(points.size() == outIsInside.size(), "The points and outIsInside vectors need to be the same size.");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        // the cache is up to date for the entire batch, so the encompassing aabb only has to be looked up once
+        const AZ::Aabb aabb = m_intersectionDataCache.m_aabb;
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            // initial early aabb rejection test
+            // note: will implicitly do height test too
+            outIsInside[index] = aabb.Contains(points[index]) &&
+                PolygonPrismUtil::IsPointInside(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
+    void PolygonPrismShape::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZ_Assert(points.size() == outDistancesSquared.size(), "The points and outDistancesSquared vectors need to be the same size.");
+
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            outDistancesSquared[index] = PolygonPrismUtil::DistanceSquaredFromPoint(*m_polygonPrism, points[index], m_currentTransform);
+        }
+    }
+
     bool PolygonPrismShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, *m_polygonPrism, m_currentNonUniformScale);
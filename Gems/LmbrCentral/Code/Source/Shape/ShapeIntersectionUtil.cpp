@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "LmbrCentral_precompiled.h"
+#include "ShapeIntersectionUtil.h"
+
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+
+namespace LmbrCentral
+{
+    namespace ShapeIntersectionUtil
+    {
+        namespace
+        {
+            using Vec4 = AZ::Simd::Vec4;
+            using FloatType = AZ::Simd::Vec4::FloatType;
+            using FloatArgType = AZ::Simd::Vec4::FloatArgType;
+
+            /// Up to four points in structure of arrays layout.
+            struct Points4
+            {
+                FloatType m_x;
+                FloatType m_y;
+                FloatType m_z;
+            };
+
+            /// Groups of fewer than four points are padded by repeating the last point.
+            Points4 LoadPoints(const AZ::Vector3* points, size_t count)
+            {
+                const AZ::Vector3& p0 = points[0];
+                const AZ::Vector3& p1 = points[AZStd::min<size_t>(1, count - 1)];
+                const AZ::Vector3& p2 = points[AZStd::min<size_t>(2, count - 1)];
+                const AZ::Vector3& p3 = points[AZStd::min<size_t>(3, count - 1)];
+                return Points4{
+                    Vec4::LoadImmediate(p0.GetX(), p1.GetX(), p2.GetX(), p3.GetX()),
+                    Vec4::LoadImmediate(p0.GetY(), p1.GetY(), p2.GetY(), p3.GetY()),
+                    Vec4::LoadImmediate(p0.GetZ(), p1.GetZ(), p2.GetZ(), p3.GetZ()) };
+            }
+
+            FloatType Dot(FloatArgType x, FloatArgType y, FloatArgType z, const AZ::Vector3& v)
+            {
+                return Vec4::Madd(z, Vec4::Splat(v.GetZ()), Vec4::Madd(y, Vec4::Splat(v.GetY()), Vec4::Mul(x, Vec4::Splat(v.GetX()))));
+            }
+
+            FloatType LengthSq(FloatArgType x, FloatArgType y, FloatArgType z)
+            {
+                return Vec4::Madd(z, z, Vec4::Madd(y, y, Vec4::Mul(x, x)));
+            }
+
+            /// Calls kernel for every group of four points and stores the resulting comparison masks as booleans.
+            template<typename Kernel>
+            void ComputeMasks(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside, Kernel&& kernel)
+            {
+                AZ_Assert(points.size() == outIsInside.size(), "The points and outIsInside vectors need to be the same size.");
+
+                const FloatType one = Vec4::Splat(1.0f);
+                const FloatType zero = Vec4::ZeroFloat();
+                alignas(16) float results[4];
+                for (size_t index = 0; index < points.size(); index += 4)
+                {
+                    const size_t count = AZStd::min<size_t>(4, points.size() - index);
+                    Vec4::StoreAligned(results, Vec4::Select(one, zero, kernel(LoadPoints(&points[index], count))));
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        outIsInside[index + i] = results[i] != 0.0f;
+                    }
+                }
+            }
+
+            /// Calls kernel for every group of four points and stores the resulting values.
+            template<typename Kernel>
+            void ComputeValues(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outValues, Kernel&& kernel)
+            {
+                AZ_Assert(points.size() == outValues.size(), "The points and outValues vectors need to be the same size.");
+
+                alignas(16) float results[4];
+                for (size_t index = 0; index < points.size(); index += 4)
+                {
+                    const size_t count = AZStd::min<size_t>(4, points.size() - index);
+                    if (count == 4)
+                    {
+                        Vec4::StoreUnaligned(&outValues[index], kernel(LoadPoints(&points[index], count)));
+                    }
+                    else
+                    {
+                        Vec4::StoreAligned(results, kernel(LoadPoints(&points[index], count)));
+                        AZStd::copy(results, results + count, outValues.begin() + index);
+                    }
+                }
+            }
+
+            /// Splatted local frame of an oriented box.
+            struct ObbFrame
+            {
+                explicit ObbFrame(const AZ::Obb& obb)
+                    : m_axisX(obb.GetAxisX())
+                    , m_axisY(obb.GetAxisY())
+                    , m_axisZ(obb.GetAxisZ())
+                    , m_position(obb.GetPosition())
+                    , m_halfX(Vec4::Splat(obb.GetHalfLengthX()))
+                    , m_halfY(Vec4::Splat(obb.GetHalfLengthY()))
+                    , m_halfZ(Vec4::Splat(obb.GetHalfLengthZ()))
+                {
+                }
+
+                /// Transforms the points into the local space of the box.
+                Points4 ToLocal(const Points4& points) const
+                {
+                    const FloatType x = Vec4::Sub(points.m_x, Vec4::Splat(m_position.GetX()));
+                    const FloatType y = Vec4::Sub(points.m_y, Vec4::Splat(m_position.GetY()));
+                    const FloatType z = Vec4::Sub(points.m_z, Vec4::Splat(m_position.GetZ()));
+                    return Points4{ Dot(x, y, z, m_axisX), Dot(x, y, z, m_axisY), Dot(x, y, z, m_axisZ) };
+                }
+
+                AZ::Vector3 m_axisX;
+                AZ::Vector3 m_axisY;
+                AZ::Vector3 m_axisZ;
+                AZ::Vector3 m_position;
+                FloatType m_halfX;
+                FloatType m_halfY;
+                FloatType m_halfZ;
+            };
+
+            FloatType SphereMask(const Points4& points, const AZ::Vector3& center, FloatArgType radiusSquared)
+            {
+                const FloatType x = Vec4::Sub(points.m_x, Vec4::Splat(center.GetX()));
+                const FloatType y = Vec4::Sub(points.m_y, Vec4::Splat(center.GetY()));
+                const FloatType z = Vec4::Sub(points.m_z, Vec4::Splat(center.GetZ()));
+                return Vec4::CmpLt(LengthSq(x, y, z), radiusSquared);
+            }
+
+            FloatType CylinderMask(
+                const Points4& points, const AZ::Vector3& baseCenterPoint, const AZ::Vector3& axisVector,
+                FloatArgType axisLengthSquared, FloatArgType radiusSquared)
+            {
+                const FloatType x = Vec4::Sub(points.m_x, Vec4::Splat(baseCenterPoint.GetX()));
+                const FloatType y = Vec4::Sub(points.m_y, Vec4::Splat(baseCenterPoint.GetY()));
+                const FloatType z = Vec4::Sub(points.m_z, Vec4::Splat(baseCenterPoint.GetZ()));
+                const FloatType dot = Dot(x, y, z, axisVector);
+                const FloatType distanceSquared = Vec4::Sub(LengthSq(x, y, z), Vec4::Div(Vec4::Mul(dot, dot), axisLengthSquared));
+
+                const FloatType betweenCaps = Vec4::And(Vec4::CmpGtEq(dot, Vec4::ZeroFloat()), Vec4::CmpLtEq(dot, axisLengthSquared));
+                return Vec4::And(betweenCaps, Vec4::CmpLtEq(distanceSquared, radiusSquared));
+            }
+        } // namespace
+
+        void IsPointInsideAabb(const AZ::Aabb& aabb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            const AZ::Vector3& min = aabb.GetMin();
+            const AZ::Vector3& max = aabb.GetMax();
+            const FloatType minX = Vec4::Splat(min.GetX());
+            const FloatType minY = Vec4::Splat(min.GetY());
+            const FloatType minZ = Vec4::Splat(min.GetZ());
+            const FloatType maxX = Vec4::Splat(max.GetX());
+            const FloatType maxY = Vec4::Splat(max.GetY());
+            const FloatType maxZ = Vec4::Splat(max.GetZ());
+
+            ComputeMasks(points, outIsInside, [&](const Points4& p)
+            {
+                const FloatType insideX = Vec4::And(Vec4::CmpGtEq(p.m_x, minX), Vec4::CmpLtEq(p.m_x, maxX));
+                const FloatType insideY = Vec4::And(Vec4::CmpGtEq(p.m_y, minY), Vec4::CmpLtEq(p.m_y, maxY));
+                const FloatType insideZ = Vec4::And(Vec4::CmpGtEq(p.m_z, minZ), Vec4::CmpLtEq(p.m_z, maxZ));
+                return Vec4::And(insideX, Vec4::And(insideY, insideZ));
+            });
+        }
+
+        void DistanceSquaredFromPointAabb(
+            const AZ::Aabb& aabb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            const AZ::Vector3& min = aabb.GetMin();
+            const AZ::Vector3& max = aabb.GetMax();
+            const FloatType minX = Vec4::Splat(min.GetX());
+            const FloatType minY = Vec4::Splat(min.GetY());
+            const FloatType minZ = Vec4::Splat(min.GetZ());
+            const FloatType maxX = Vec4::Splat(max.GetX());
+            const FloatType maxY = Vec4::Splat(max.GetY());
+            const FloatType maxZ = Vec4::Splat(max.GetZ());
+
+            ComputeValues(points, outDistancesSquared, [&](const Points4& p)
+            {
+                const FloatType x = Vec4::Sub(p.m_x, Vec4::Clamp(p.m_x, minX, maxX));
+                const FloatType y = Vec4::Sub(p.m_y, Vec4::Clamp(p.m_y, minY, maxY));
+                const FloatType z = Vec4::Sub(p.m_z, Vec4::Clamp(p.m_z, minZ, maxZ));
+                return LengthSq(x, y, z);
+            });
+        }
+
+        void IsPointInsideObb(const AZ::Obb& obb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            const ObbFrame frame(obb);
+
+            ComputeMasks(points, outIsInside, [&frame](const Points4& p)
+            {
+                const Points4 local = frame.ToLocal(p);
+                const FloatType insideX = Vec4::CmpLtEq(Vec4::Abs(local.m_x), frame.m_halfX);
+                const FloatType insideY = Vec4::CmpLtEq(Vec4::Abs(local.m_y), frame.m_halfY);
+                const FloatType insideZ = Vec4::CmpLtEq(Vec4::Abs(local.m_z), frame.m_halfZ);
+                return Vec4::And(insideX, Vec4::And(insideY, insideZ));
+            });
+        }
+
+        void DistanceSquaredFromPointObb(
+            const AZ::Obb& obb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            const ObbFrame frame(obb);
+
+            ComputeValues(points, outDistancesSquared, [&frame](const Points4& p)
+            {
+                const Points4 local = frame.ToLocal(p);
+                const FloatType x = Vec4::Sub(local.m_x, Vec4::Clamp(local.m_x, Vec4::Sub(Vec4::ZeroFloat(), frame.m_halfX), frame.m_halfX));
+                const FloatType y = Vec4::Sub(local.m_y, Vec4::Clamp(local.m_y, Vec4::Sub(Vec4::ZeroFloat(), frame.m_halfY), frame.m_halfY));
+                const FloatType z = Vec4::Sub(local.m_z, Vec4::Clamp(local.m_z, Vec4::Sub(Vec4::ZeroFloat(), frame.m_halfZ), frame.m_halfZ));
+                return LengthSq(x, y, z);
+            });
+        }
+
+        void IsPointInsideSphere(
+            const AZ::Vector3& center, float radiusSquared, const AZStd::vector<AZ::Vector3>& points,
+            AZStd::vector<bool>& outIsInside)
+        {
+            const FloatType radiusSquaredSplat = Vec4::Splat(radiusSquared);
+
+            ComputeMasks(points, outIsInside, [&](const Points4& p)
+            {
+                return SphereMask(p, center, radiusSquaredSplat);
+            });
+        }
+
+        void DistanceSquaredFromPointSphere(
+            const AZ::Vector3& center, float radius, const AZStd::vector<AZ::Vector3>& points,
+            AZStd::vector<float>& outDistancesSquared)
+        {
+            const FloatType radiusSplat = Vec4::Splat(radius);
+
+            ComputeValues(points, outDistancesSquared, [&](const Points4& p)
+            {
+                const FloatType x = Vec4::Sub(p.m_x, Vec4::Splat(center.GetX()));
+                const FloatType y = Vec4::Sub(p.m_y, Vec4::Splat(center.GetY()));
+                const FloatType z = Vec4::Sub(p.m_z, Vec4::Splat(center.GetZ()));
+                const FloatType distance = Vec4::Max(Vec4::Sub(Vec4::Sqrt(LengthSq(x, y, z)), radiusSplat), Vec4::ZeroFloat());
+                return Vec4::Mul(distance, distance);
+            });
+        }
+
+        void IsPointInsideCylinder(
+            const AZ::Vector3& baseCenterPoint, const AZ::Vector3& axisVector, float axisLengthSquared, float radiusSquared,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            // If the cylinder shape has no volume then the point cannot be inside.
+            if (axisLengthSquared <= 0.0f || radiusSquared <= 0.0f)
+            {
+                AZStd::fill(outIsInside.begin(), outIsInside.end(), false);
+                return;
+            }
+
+            const FloatType axisLengthSquaredSplat = Vec4::Splat(axisLengthSquared);
+            const FloatType radiusSquaredSplat = Vec4::Splat(radiusSquared);
+
+            ComputeMasks(points, outIsInside, [&](const Points4& p)
+            {
+                return CylinderMask(p, baseCenterPoint, axisVector, axisLengthSquaredSplat, radiusSquaredSplat);
+            });
+        }
+
+        void DistanceSquaredFromPointCylinder(
+            const AZ::Vector3& cylinderAxisEndA, const AZ::Vector3& cylinderAxisEndB, float radius,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            // Same approach as Distance::Point_CylinderSq, but the Voronoi regions are resolved without branches by
+            // clamping the distances beyond the radius and beyond the end discs to zero.
+            const AZ::Vector3 cylinderAxis = cylinderAxisEndB - cylinderAxisEndA;
+            const AZ::Vector3 cylinderAxisUnit = cylinderAxis.GetNormalized();
+            const AZ::Vector3 centerPoint = cylinderAxisEndA + cylinderAxis * 0.5f;
+            const FloatType halfLength = Vec4::Splat(cylinderAxis.GetLength() * 0.5f);
+            const FloatType radiusSplat = Vec4::Splat(radius);
+
+            ComputeValues(points, outDistancesSquared, [&](const Points4& p)
+            {
+                const FloatType x = Vec4::Sub(p.m_x, Vec4::Splat(centerPoint.GetX()));
+                const FloatType y = Vec4::Sub(p.m_y, Vec4::Splat(centerPoint.GetY()));
+                const FloatType z = Vec4::Sub(p.m_z, Vec4::Splat(centerPoint.GetZ()));
+
+                // distance from the center projected onto the axis and squared distance perpendicular to the axis
+                const FloatType axial = Vec4::Abs(Dot(x, y, z, cylinderAxisUnit));
+                const FloatType radialSquared = Vec4::Max(Vec4::Sub(LengthSq(x, y, z), Vec4::Mul(axial, axial)), Vec4::ZeroFloat());
+
+                const FloatType beyondRadius = Vec4::Max(Vec4::Sub(Vec4::Sqrt(radialSquared), radiusSplat), Vec4::ZeroFloat());
+                const FloatType beyondEnds = Vec4::Max(Vec4::Sub(axial, halfLength), Vec4::ZeroFloat());
+                return Vec4::Madd(beyondEnds, beyondEnds, Vec4::Mul(beyondRadius, beyondRadius));
+            });
+        }
+
+        void IsPointInsideCapsule(
+            const AZ::Vector3& basePlaneCenterPoint, const AZ::Vector3& topPlaneCenterPoint, const AZ::Vector3& axisVector,
+            float internalHeightSquared, float radiusSquared, bool isSphere,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            const FloatType radiusSquaredSplat = Vec4::Splat(radiusSquared);
+            const FloatType internalHeightSquaredSplat = Vec4::Splat(internalHeightSquared);
+            // matches AZ::Intersect::PointCylinder, a cylinder without volume can't contain any points
+            const bool hasCylinder = !isSphere && internalHeightSquared > 0.0f && radiusSquared > 0.0f;
+
+            ComputeMasks(points, outIsInside, [&](const Points4& p)
+            {
+                FloatType inside = SphereMask(p, basePlaneCenterPoint, radiusSquaredSplat);
+                if (!isSphere)
+                {
+                    inside = Vec4::Or(inside, SphereMask(p, topPlaneCenterPoint, radiusSquaredSplat));
+                }
+                if (hasCylinder)
+                {
+                    inside = Vec4::Or(inside,
+                        CylinderMask(p, basePlaneCenterPoint, axisVector, internalHeightSquaredSplat, radiusSquaredSplat));
+                }
+                return inside;
+            });
+        }
+
+        void DistanceSquaredFromPointCapsule(
+            const AZ::Vector3& basePlaneCenterPoint, const AZ::Vector3& topPlaneCenterPoint, float radius,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            // Distance to the line segment between the end-points of the internal cylinder, minus the radius.
+            const AZ::Vector3 segment = topPlaneCenterPoint - basePlaneCenterPoint;
+            const float segmentLengthSquared = segment.GetLengthSq();
+            const FloatType inverseSegmentLengthSquared =
+                Vec4::Splat(segmentLengthSquared > 1e-7f ? 1.0f / segmentLengthSquared : 0.0f);
+            const FloatType radiusSplat = Vec4::Splat(radius);
+            const FloatType zero = Vec4::ZeroFloat();
+            const FloatType one = Vec4::Splat(1.0f);
+
+            ComputeValues(points, outDistancesSquared, [&](const Points4& p)
+            {
+                const FloatType x = Vec4::Sub(p.m_x, Vec4::Splat(basePlaneCenterPoint.GetX()));
+                const FloatType y = Vec4::Sub(p.m_y, Vec4::Splat(basePlaneCenterPoint.GetY()));
+                const FloatType z = Vec4::Sub(p.m_z, Vec4::Splat(basePlaneCenterPoint.GetZ()));
+
+                const FloatType t = Vec4::Clamp(Vec4::Mul(Dot(x, y, z, segment), inverseSegmentLengthSquared), zero, one);
+                const FloatType dx = Vec4::Sub(x, Vec4::Mul(t, Vec4::Splat(segment.GetX())));
+                const FloatType dy = Vec4::Sub(y, Vec4::Mul(t, Vec4::Splat(segment.GetY())));
+                const FloatType dz = Vec4::Sub(z, Vec4::Mul(t, Vec4::Splat(segment.GetZ())));
+
+                const FloatType distance = Vec4::Max(Vec4::Sub(Vec4::Sqrt(LengthSq(dx, dy, dz)), radiusSplat), zero);
+                return Vec4::Mul(distance, distance);
+            });
+        }
+    } // namespace ShapeIntersectionUtil
+} // namespace LmbrCentral
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Obb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace LmbrCentral
+{
+    /// Batched point queries used to implement ShapeComponentRequests::IsPointInsideBatch and
+    /// ShapeComponentRequests::DistanceSquaredFromPointBatch. The points are processed four at a time using AZ::Simd::Vec4.
+    /// All functions expect the output vector to be the same size as the points vector.
+    namespace ShapeIntersectionUtil
+    {
+        /// Batched version of AZ::Aabb::Contains.
+        void IsPointInsideAabb(
+            const AZ::Aabb& aabb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside);
+
+        /// Batched version of AZ::Aabb::GetDistanceSq.
+        void DistanceSquaredFromPointAabb(
+            const AZ::Aabb& aabb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared);
+
+        /// Batched version of AZ::Obb::Contains.
+        void IsPointInsideObb(
+            const AZ::Obb& obb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside);
+
+        /// Batched version of AZ::Obb::GetDistanceSq.
+        void DistanceSquaredFromPointObb(
+            const AZ::Obb& obb, const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared);
+
+        /// Batched version of AZ::Intersect::PointSphere.
+        void IsPointInsideSphere(
+            const AZ::Vector3& center, float radiusSquared, const AZStd::vector<AZ::Vector3>& points,
+            AZStd::vector<bool>& outIsInside);
+
+        /// Squared distance from each point to the surface of a sphere, or 0 if the point is inside the sphere.
+        void DistanceSquaredFromPointSphere(
+            const AZ::Vector3& center, float radius, const AZStd::vector<AZ::Vector3>& points,
+            AZStd::vector<float>& outDistancesSquared);
+
+        /// Batched version of AZ::Intersect::PointCylinder.
+        void IsPointInsideCylinder(
+            const AZ::Vector3& baseCenterPoint, const AZ::Vector3& axisVector, float axisLengthSquared, float radiusSquared,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside);
+
+        /// Batched version of Distance::Point_CylinderSq. The cylinder axis must have a non-zero length.
+        void DistanceSquaredFromPointCylinder(
+            const AZ::Vector3& cylinderAxisEndA, const AZ::Vector3& cylinderAxisEndB, float radius,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared);
+
+        /// Tests if points are inside a capsule, built from a sphere at both end-points of the internal cylinder
+        /// and the internal cylinder itself. If isSphere is true, only the sphere at the base is tested.
+        void IsPointInsideCapsule(
+            const AZ::Vector3& basePlaneCenterPoint, const AZ::Vector3& topPlaneCenterPoint, const AZ::Vector3& axisVector,
+            float internalHeightSquared, float radiusSquared, bool isSphere,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside);
+
+        /// Squared distance from each point to the surface of a capsule, or 0 if the point is inside the capsule.
+        void DistanceSquaredFromPointCapsule(
+            const AZ::Vector3& basePlaneCenterPoint, const AZ::Vector3& topPlaneCenterPoint, float radius,
+            const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared);
+    } // namespace ShapeIntersectionUtil
+} // namespace LmbrCentral
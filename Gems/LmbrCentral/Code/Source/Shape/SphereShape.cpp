@@ -15,6 +15,7 @@
 #include <AzCore/Math/IntersectSegment.h>
 #include <AzFramework/Entity/EntityDebugDisplayBus.h>
 #include <Shape/ShapeDisplay.h>
+#include <Shape/ShapeIntersectionUtil.h>
 
 namespace LmbrCentral
 {
@@ -118,6 +119,22 @@ namespace LmbrCentral
         return powf(AZStd::max(distance, 0.0f), 2.0f);
     }
 
+    void SphereShape::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        ShapeIntersectionUtil::IsPointInsideSphere(
+            m_intersectionDataCache.m_position, powf(m_intersectionDataCache.m_radius, 2.0f), points, outIsInside);
+    }
+
+    void SphereShape::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
+
+        ShapeIntersectionUtil::DistanceSquaredFromPointSphere(
+            m_intersectionDataCache.m_position, m_intersectionDataCache.m_radius, points, outDistancesSquared);
+    }
+
     bool SphereShape::IntersectRay(const AZ::Vector3& src, const AZ::Vector3& dir, float& distance)
     {
         m_intersectionDataCache.UpdateIntersectionParams(m_currentTransform, m_sphereShapeConfig);
@@ -17,6 +17,7 @@
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AZTestShared/Math/MathTestHelpers.h>
 #include <AzFramework/UnitTest/TestDebugDisplayRequests.h>
+#include "ShapeTestUtils.h"
 
 namespace UnitTest
 {
@@ -652,4 +653,22 @@ namespace UnitTest
         EXPECT_THAT(debugDrawAabb.GetMin(), IsClose(shapeAabb.GetMin()));
         EXPECT_THAT(debugDrawAabb.GetMax(), IsClose(shapeAabb.GetMax()));
     }
+
+    TEST_F(BoxShapeTest, BatchQueriesMatchSingleQueries)
+    {
+        // axis aligned
+        AZ::Entity entity;
+        CreateBox(AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 37.0f, 32.0f)), AZ::Vector3(6.0f, 4.0f, 2.0f), entity);
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+
+        // object aligned
+        AZ::Entity rotatedEntity;
+        CreateBox(
+            AZ::Transform::CreateTranslation(AZ::Vector3(10.0f, 37.0f, 32.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(0.5f),
+            AZ::Vector3(24.0f, 4.0f, 20.0f), rotatedEntity);
+        ExpectBatchQueriesMatchSingleQueries(rotatedEntity.GetId());
+    }
 }
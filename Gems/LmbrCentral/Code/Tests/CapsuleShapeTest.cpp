@@ -13,6 +13,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CapsuleShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include "ShapeTestUtils.h"
 
 namespace UnitTest
 {
@@ -349,4 +350,20 @@ namespace UnitTest
 
         EXPECT_NEAR(distance, 2.0f, 1e-2f);
     }
+
+    TEST_F(CapsuleShapeTest, BatchQueriesMatchSingleQueries)
+    {
+        AZ::Entity entity;
+        CreateCapsule(
+            AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateRotationY(AZ::Constants::QuarterPi),
+            1.5f, 8.0f, entity);
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+
+        // capsule that is just a sphere
+        AZ::Entity sphereEntity;
+        CreateCapsule(AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)), 2.0f, 3.0f, sphereEntity);
+        ExpectBatchQueriesMatchSingleQueries(sphereEntity.GetId());
+    }
 }
@@ -14,6 +14,7 @@
 #include <AzFramework/Components/TransformComponent.h>
 #include <Shape/CylinderShapeComponent.h>
 #include <AzCore/UnitTest/TestTypes.h>
+#include "ShapeTestUtils.h"
 
 namespace UnitTest
 {
@@ -544,4 +545,16 @@ namespace UnitTest
         CylinderShapeDistanceFromPointTest,
         ::testing::ValuesIn(CylinderShapeDistanceFromPointTest::ShouldPass)
     );
+
+    TEST_F(CylinderShapeTest, BatchQueriesMatchSingleQueries)
+    {
+        AZ::Entity entity;
+        CreateCylinder(
+            AZ::Transform::CreateTranslation(AZ::Vector3(27.0f, 28.0f, 38.0f)) *
+            AZ::Transform::CreateRotationX(AZ::Constants::QuarterPi) *
+            AZ::Transform::CreateUniformScale(0.5f),
+            2.5f, 9.0f, entity);
+
+        ExpectBatchQueriesMatchSingleQueries(entity.GetId());
+    }
 }
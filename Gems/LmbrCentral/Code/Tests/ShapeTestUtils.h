@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project. For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzTest/AzTest.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/containers/vector.h>
+#include <LmbrCentral/Shape/ShapeComponentBus.h>
+
+namespace UnitTest
+{
+    /// Checks that the batched shape queries give the same results as the single point queries for a grid of points
+    /// covering the shape's encompassing aabb and some space around it. The number of points is deliberately not a
+    /// multiple of four so partially filled groups are exercised as well.
+    inline void ExpectBatchQueriesMatchSingleQueries(AZ::EntityId entityId)
+    {
+        AZ::Aabb aabb = AZ::Aabb::CreateNull();
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(
+            aabb, entityId, &LmbrCentral::ShapeComponentRequests::GetEncompassingAabb);
+        aabb.Expand(AZ::Vector3(1.0f));
+
+        constexpr int stepCount = 7;
+        const AZ::Vector3 step = aabb.GetExtents() / static_cast<float>(stepCount - 1);
+        AZStd::vector<AZ::Vector3> points;
+        for (int z = 0; z < stepCount; ++z)
+        {
+            for (int y = 0; y < stepCount; ++y)
+            {
+                for (int x = 0; x < stepCount; ++x)
+                {
+                    points.push_back(aabb.GetMin() + step * AZ::Vector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z)));
+                }
+            }
+        }
+
+        AZStd::vector<bool> isInside(points.size(), false);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entityId, &LmbrCentral::ShapeComponentRequests::IsPointInsideBatch, points, isInside);
+        AZStd::vector<float> distancesSquared(points.size(), -1.0f);
+        LmbrCentral::ShapeComponentRequestsBus::Event(
+            entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPointBatch, points, distancesSquared);
+
+        for (size_t index = 0; index < points.size(); ++index)
+        {
+            bool expectedIsInside = false;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                expectedIsInside, entityId, &LmbrCentral::ShapeComponentRequests::IsPointInside, points[index]);
+            EXPECT_EQ(expectedIsInside, isInside[index]);
+
+            float expectedDistanceSquared = 0.0f;
+            LmbrCentral::ShapeComponentRequestsBus::EventResult(
+                expectedDistanceSquared, entityId, &LmbrCentral::ShapeComponentRequests::DistanceSquaredFromPoint, points[index]);
+            EXPECT_NEAR(expectedDistanceSquared, distancesSquared[index], 1e-3f * AZ::GetMax(1.0f, expectedDistanceSquared));
+        }
+    }
+} // namespace UnitTest
@@ -11,6 +11,7 @@
 #include <AzCore/Math/Color.h>
 #include <AzCore/Math/Transform.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <AzFramework/Viewport/ViewportColors.h>
 
@@ -143,6 +144,32 @@ namespace LmbrCentral
         /// @return float indicating square distance point is from shape
         virtual float DistanceSquaredFromPoint(const AZ::Vector3& point) = 0;
 
+        /// @brief Checks for each point in a list if it's inside the shape or outside it.
+        /// Prefer this over repeated calls to IsPointInside when testing many points against the same shape.
+        /// @param points List of points to be tested
+        /// @param outIsInside Indicates for each point whether the point is inside or out. Must be the same size as points.
+        virtual void IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+        {
+            AZ_Assert(points.size() == outIsInside.size(), "The points and outIsInside vectors need to be the same size.");
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outIsInside[index] = IsPointInside(points[index]);
+            }
+        }
+
+        /// @brief Returns the min squared distance each point in a list is from the shape.
+        /// Prefer this over repeated calls to DistanceSquaredFromPoint when querying many points against the same shape.
+        /// @param points List of points to calculate the square distance from
+        /// @param outDistancesSquared Square distance of each point from the shape. Must be the same size as points.
+        virtual void DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+        {
+            AZ_Assert(points.size() == outDistancesSquared.size(), "The points and outDistancesSquared vectors need to be the same size.");
+            for (size_t index = 0; index < points.size(); ++index)
+            {
+                outDistancesSquared[index] = DistanceSquaredFromPoint(points[index]);
+            }
+        }
+
         /// @brief Returns a random position inside the volume.
         /// @param randomDistribution An enum representing the different random distributions to use.
         virtual AZ::Vector3 GenerateRandomPointInside(AZ::RandomDistributionType /*randomDistribution*/)
@@ -142,6 +142,8 @@ set(FILES
     Source/Shape/ShapeComponentConverters.inl
     Source/Shape/ShapeGeometryUtil.h
     Source/Shape/ShapeGeometryUtil.cpp
+    Source/Shape/ShapeIntersectionUtil.h
+    Source/Shape/ShapeIntersectionUtil.cpp
     Source/Unhandled/Material/MaterialAssetTypeInfo.cpp
     Source/Unhandled/Material/MaterialAssetTypeInfo.h
     Source/Unhandled/Other/AudioAssetTypeInfo.cpp
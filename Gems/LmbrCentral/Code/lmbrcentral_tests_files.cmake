@@ -19,6 +19,7 @@ set(FILES
     Tests/LmbrCentralReflectionTest.cpp
     Tests/LmbrCentralTest.cpp
     Tests/ShapeGeometryUtilTest.cpp
+    Tests/ShapeTestUtils.h
     Tests/SpawnerComponentTest.cpp
     Tests/SplineComponentTests.cpp
     Tests/DiskShapeTest.cpp
@@ -30,6 +30,21 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        //! Batched version of GetSurfacePoints, used when querying entire regions so that providers can amortize their
+        //! per-query setup (locks, cached data, bus lookups) across all of the positions.
+        //! Every generated point is appended to surfacePointList, and the index of the input position that generated it
+        //! is appended to positionIndices, so both lists always grow by the same amount.
+        virtual void GetSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointList& surfacePointList, AZStd::vector<size_t>& positionIndices) const
+        {
+            AZ_Assert(surfacePointList.size() == positionIndices.size(), "The surface point list and position indices are out of sync.");
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                GetSurfacePoints(inPositions[index], surfacePointList);
+                positionIndices.resize(surfacePointList.size(), index);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
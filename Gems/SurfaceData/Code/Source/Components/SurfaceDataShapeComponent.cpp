@@ -147,6 +147,28 @@ namespace SurfaceData
 
         AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
 
+        GetSurfacePointNoLock(inPosition, surfacePointList);
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointList& surfacePointList, AZStd::vector<size_t>& positionIndices) const
+    {
+        AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            for (size_t index = 0; index < inPositions.size(); ++index)
+            {
+                GetSurfacePointNoLock(inPositions[index], surfacePointList);
+                positionIndices.resize(surfacePointList.size(), index);
+            }
+        }
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePointNoLock(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    {
         if (m_shapeBoundsIsValid)
         {
             const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
@@ -174,17 +196,35 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
         {
+            // Gather every point that could be inside the shape so that the shape can test all of them in a single query.
             const AZ::EntityId entityId = GetEntityId();
-            for (auto& point : surfacePointList)
+            AZStd::vector<AZ::Vector3> candidatePositions;
+            AZStd::vector<size_t> candidateIndices;
+            candidatePositions.reserve(surfacePointList.size());
+            candidateIndices.reserve(surfacePointList.size());
+            for (size_t index = 0; index < surfacePointList.size(); ++index)
             {
+                const SurfacePoint& point = surfacePointList[index];
                 if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
                 {
-                    bool inside = false;
-                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-                    if (inside)
-                    {
-                        AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
-                    }
+                    candidatePositions.emplace_back(point.m_position);
+                    candidateIndices.emplace_back(index);
+                }
+            }
+
+            if (candidatePositions.empty())
+            {
+                return;
+            }
+
+            AZStd::vector<bool> inside(candidatePositions.size(), false);
+            LmbrCentral::ShapeComponentRequestsBus::Event(
+                entityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInsideBatch, candidatePositions, inside);
+            for (size_t candidate = 0; candidate < candidateIndices.size(); ++candidate)
+            {
+                if (inside[candidate])
+                {
+                    AddMaxValueForMasks(surfacePointList[candidateIndices[candidate]].m_masks, m_configuration.m_modifierTags, 1.0f);
                 }
             }
         }
@@ -64,6 +64,8 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointList& surfacePointList, AZStd::vector<size_t>& positionIndices) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
@@ -83,6 +85,7 @@ namespace SurfaceData
     private:
         void OnCompositionChanged();
         void UpdateShapeData();
+        void GetSurfacePointNoLock(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
 
         SurfaceDataShapeConfig m_configuration;
 
@@ -249,9 +249,17 @@ namespace SurfaceData
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
+        // The registration mutex is recursive, so a provider or modifier could potentially issue another region query on this
+        // thread while we're in the middle of one.  In that case fall back to local scratch memory instead of the shared one.
+        RegionScratch localScratch;
+        const bool useSharedScratch = !m_regionScratchInUse;
+        RegionScratch& scratch = useSharedScratch ? m_regionScratch : localScratch;
+        m_regionScratchInUse = true;
+        scratch.Clear();
+
         // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // AABB bounds just once per provider, instead of once per point.  The list of positions within the provider bounds is sent
+        // to the provider in a single call, and all generated points are gathered into one flat list.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -261,16 +269,36 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                scratch.m_providerPositions.clear();
+                scratch.m_providerPositionIndices.clear();
+                for (size_t positionIndex = 0; positionIndex < surfacePointListPerPosition.size(); ++positionIndex)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
+                    const auto& point2d = surfacePointListPerPosition[positionIndex].first;
                     AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        scratch.m_providerPositions.emplace_back(point3d);
+                        scratch.m_providerPositionIndices.emplace_back(positionIndex);
                     }
                 }
+
+                if (scratch.m_providerPositions.empty())
+                {
+                    continue;
+                }
+
+                const size_t firstNewPoint = scratch.m_points.size();
+                SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList,
+                    scratch.m_providerPositions, scratch.m_points, scratch.m_pointPositionIndices);
+                AZ_Assert(scratch.m_points.size() == scratch.m_pointPositionIndices.size(),
+                    "Surface data provider returned a mismatched number of points and position indices.");
+
+                // The provider reports indices into the list of positions we sent it, so remap them to region position indices.
+                for (size_t pointIndex = firstNewPoint; pointIndex < scratch.m_pointPositionIndices.size(); ++pointIndex)
+                {
+                    size_t& positionIndex = scratch.m_pointPositionIndices[pointIndex];
+                    positionIndex = scratch.m_providerPositionIndices[positionIndex];
+                }
             }
         }
 
@@ -279,29 +307,76 @@ namespace SurfaceData
         // create new surface points, but surface data *modifiers* simply annotate points that have already been created.  The modifiers
         // are used to annotate points that occur within a volume.  A common example is marking points as "underwater" for points that occur
         // within a water volume.
-        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        // Modifiers that cover the entire region receive the entire point list in one call.  Modifiers that only partially overlap the
+        // region receive one list containing just the points within their bounds.
+        if (!scratch.m_points.empty())
         {
-            const SurfaceDataRegistryEntry& entry = entryPair.second;
-            bool alwaysApplies = !entry.m_bounds.IsValid();
-
-            if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
+            for (const auto& entryPair : m_registeredSurfaceDataModifiers)
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                const SurfaceDataRegistryEntry& entry = entryPair.second;
+                bool alwaysApplies = !entry.m_bounds.IsValid() ||
+                    (AabbContains2D(entry.m_bounds, inRegion.GetMin()) && AabbContains2D(entry.m_bounds, inRegion.GetMax()));
+
+                if (alwaysApplies)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, scratch.m_points);
+                    AZ_Assert(scratch.m_points.size() == scratch.m_pointPositionIndices.size(),
+                        "Surface data modifiers are expected to annotate points, not add or remove them.");
+                }
+                else if (AabbOverlaps2D(entry.m_bounds, inRegion))
+                {
+                    scratch.m_modifierPoints.clear();
+                    scratch.m_modifierPointIndices.clear();
+                    for (size_t pointIndex = 0; pointIndex < scratch.m_points.size(); ++pointIndex)
                     {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
-                        if (alwaysApplies || entry.m_bounds.Contains(point3d))
+                        const auto& point2d = surfacePointListPerPosition[scratch.m_pointPositionIndices[pointIndex]].first;
+                        if (AabbContains2D(entry.m_bounds, point2d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            scratch.m_modifierPoints.emplace_back(AZStd::move(scratch.m_points[pointIndex]));
+                            scratch.m_modifierPointIndices.emplace_back(pointIndex);
+                        }
+                    }
+
+                    if (!scratch.m_modifierPoints.empty())
+                    {
+                        SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, scratch.m_modifierPoints);
+                        AZ_Assert(scratch.m_modifierPoints.size() == scratch.m_modifierPointIndices.size(),
+                            "Surface data modifiers are expected to annotate points, not add or remove them.");
+
+                        for (size_t modifierPointIndex = 0; modifierPointIndex < scratch.m_modifierPointIndices.size(); ++modifierPointIndex)
+                        {
+                            scratch.m_points[scratch.m_modifierPointIndices[modifierPointIndex]] = AZStd::move(scratch.m_modifierPoints[modifierPointIndex]);
                         }
                     }
                 }
             }
         }
 
+        // Distribute the flat point list back out to the per-position lists.  Points keep their relative order, so the results
+        // are identical to querying each position separately.
+        scratch.m_pointCountPerPosition.resize(surfacePointListPerPosition.size(), 0);
+        for (const size_t positionIndex : scratch.m_pointPositionIndices)
+        {
+            ++scratch.m_pointCountPerPosition[positionIndex];
+        }
+        for (size_t positionIndex = 0; positionIndex < surfacePointListPerPosition.size(); ++positionIndex)
+        {
+            if (scratch.m_pointCountPerPosition[positionIndex] > 0)
+            {
+                surfacePointListPerPosition[positionIndex].second.reserve(scratch.m_pointCountPerPosition[positionIndex]);
+            }
+        }
+        for (size_t pointIndex = 0; pointIndex < scratch.m_points.size(); ++pointIndex)
+        {
+            surfacePointListPerPosition[scratch.m_pointPositionIndices[pointIndex]].second.emplace_back(AZStd::move(scratch.m_points[pointIndex]));
+        }
+
+        scratch.Clear();
+        if (useSharedScratch)
+        {
+            m_regionScratchInUse = false;
+        }
+
         // After we've finished creating and annotating all the surface points, combine any points together that have effectively the
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
@@ -316,6 +391,18 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataSystemComponent::RegionScratch::Clear()
+    {
+        // Only the sizes are reset, the capacity is kept for the next query.
+        m_points.clear();
+        m_pointPositionIndices.clear();
+        m_providerPositions.clear();
+        m_providerPositionIndices.clear();
+        m_modifierPoints.clear();
+        m_modifierPointIndices.clear();
+        m_pointCountPerPosition.clear();
+    }
+
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
     {
         AZ_PROFILE_FUNCTION(AZ::Debug::ProfileCategory::Entity);
@@ -50,6 +50,26 @@ namespace SurfaceData
 
         void RefreshSurfaceData(const AZ::Aabb& dirtyArea) override;
     private:
+        //! Scratch memory used by GetSurfacePointsFromRegion. All points generated for a region are kept in one flat list
+        //! instead of one list per position, so that each provider and modifier can be called once for the entire region.
+        //! The memory is kept between queries so that steady-state region queries don't allocate.
+        struct RegionScratch
+        {
+            void Clear();
+
+            //! Every surface point generated for the region, with the index of the region position it belongs to.
+            SurfacePointList m_points;
+            AZStd::vector<size_t> m_pointPositionIndices;
+            //! The positions sent to a single provider, with the index of the region position each one came from.
+            AZStd::vector<AZ::Vector3> m_providerPositions;
+            AZStd::vector<size_t> m_providerPositionIndices;
+            //! The subset of points sent to a modifier whose bounds only partially overlap the region.
+            SurfacePointList m_modifierPoints;
+            AZStd::vector<size_t> m_modifierPointIndices;
+            //! The number of points generated for each region position.
+            AZStd::vector<size_t> m_pointCountPerPosition;
+        };
+
         void CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProviderInternal(const SurfaceDataRegistryEntry& entry);
@@ -69,5 +89,9 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //region scratch memory reserved for reuse, guarded by m_registrationMutex
+        mutable RegionScratch m_regionScratch;
+        mutable bool m_regionScratchInUse = false;
     };
 }
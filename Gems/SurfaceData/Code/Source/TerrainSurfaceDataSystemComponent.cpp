@@ -182,6 +182,42 @@ namespace SurfaceData
         }
     }
 
+    void TerrainSurfaceDataSystemComponent::GetSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointList& surfacePointList, AZStd::vector<size_t>& positionIndices) const
+    {
+        if (m_terrainBoundsIsValid)
+        {
+            // Look up the terrain handler and its bounds once for the entire list instead of once per position.
+            auto enumerationCallback = [&](AzFramework::Terrain::TerrainDataRequests* terrain) -> bool
+            {
+                const AZ::Aabb terrainAabb = terrain->GetTerrainAabb();
+                const AZ::EntityId entityId = GetEntityId();
+                for (size_t index = 0; index < inPositions.size(); ++index)
+                {
+                    const AZ::Vector3& inPosition = inPositions[index];
+                    if (terrainAabb.Contains(inPosition))
+                    {
+                        bool isTerrainValidAtPoint = false;
+                        const float terrainHeight = terrain->GetHeight(inPosition, AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR, &isTerrainValidAtPoint);
+                        const bool isHole = !isTerrainValidAtPoint;
+
+                        SurfacePoint point;
+                        point.m_entityId = entityId;
+                        point.m_position = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), terrainHeight);
+                        point.m_normal = terrain->GetNormal(inPosition);
+                        const AZ::Crc32 terrainTag = isHole ? Constants::s_terrainHoleTagCrc : Constants::s_terrainTagCrc;
+                        AddMaxValueForMasks(point.m_masks, terrainTag, 1.0f);
+                        surfacePointList.push_back(point);
+                        positionIndices.push_back(index);
+                    }
+                }
+                // Only one handler should exist.
+                return false;
+            };
+            AzFramework::Terrain::TerrainDataRequestBus::EnumerateHandlers(enumerationCallback);
+        }
+    }
+
     AZ::Aabb TerrainSurfaceDataSystemComponent::GetSurfaceAabb() const
     {
         auto terrain = AzFramework::Terrain::TerrainDataRequestBus::FindFirstHandler();
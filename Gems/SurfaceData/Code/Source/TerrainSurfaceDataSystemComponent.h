@@ -58,6 +58,8 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void GetSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointList& surfacePointList, AZStd::vector<size_t>& positionIndices) const override;
 
         ////////////////////////////////////////////////////////////////////////////
         // CrySystemEvents
@@ -652,6 +652,51 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_ProviderModif
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_PartiallyOverlappingModifier)
+{
+    // This test verifies that a SurfaceDataModifier that only covers part of the query region modifies the points
+    // within its bounds, and that every point in the region is still returned for the correct query position.
+
+    // Create a mock Surface Provider that covers from (0,0) - (8, 8) in space.
+    // It defines points spaced 1 apart, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Create a mock Surface Modifier that covers from (0,0) - (2, 8) in space.
+    // It will modify points spaced 1 apart, with heights of 0 and 4, and add the tag "test_surface2".
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(2.0f, 8.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Query for all the surface points from (0, 0) - (4, 4) with a step size of 1.
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    EXPECT_TRUE(ValidateRegionListSize(regionBounds, stepSize, availablePointsPerPosition));
+
+    // We expect every entry in the output list to have two surface points at the query position.  Only the points
+    // with X values inside the modifier bounds should have picked up the modifier tag.
+    for (auto& queryPosition : availablePointsPerPosition)
+    {
+        const SurfaceData::SurfacePointList& pointList = queryPosition.second;
+        const size_t expectedMaskCount = (queryPosition.first.GetX() < 2.0f) ? 2 : 1;
+        EXPECT_EQ(pointList.size(), 2);
+        for (auto& point : pointList)
+        {
+            EXPECT_TRUE(queryPosition.first.GetX() == point.m_position.GetX());
+            EXPECT_TRUE(queryPosition.first.GetY() == point.m_position.GetY());
+            EXPECT_EQ(point.m_masks.size(), expectedMaskCount);
+        }
+    }
+}
+
 TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_SimilarPointsMergeTogether)
 {
     // This test verifies that if two separate providers create points at very similar heights, the
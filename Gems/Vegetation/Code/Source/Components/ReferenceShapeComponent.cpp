@@ -273,6 +273,32 @@ namespace Vegetation
         return result;
     }
 
+    void ReferenceShapeComponent::IsPointInsideBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<bool>& outIsInside)
+    {
+        AZStd::fill(outIsInside.begin(), outIsInside.end(), false);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInsideBatch, points, outIsInside);
+            m_isRequestInProgress = false;
+        }
+    }
+
+    void ReferenceShapeComponent::DistanceSquaredFromPointBatch(const AZStd::vector<AZ::Vector3>& points, AZStd::vector<float>& outDistancesSquared)
+    {
+        AZStd::fill(outDistancesSquared.begin(), outDistancesSquared.end(), FLT_MAX);
+
+        AZ_WarningOnce("Vegetation", !m_isRequestInProgress, "Detected cyclic dependences with vegetation entity references");
+        if (AllowRequest())
+        {
+            m_isRequestInProgress = true;
+            LmbrCentral::ShapeComponentRequestsBus::Event(m_configuration.m_shapeEntityId, &LmbrCentral::ShapeComponentRequestsBus::Events::DistanceSquaredFromPointBatch, points, outDistancesSquared);
+            m_isRequestInProgress = false;
+        }
+    }
+
     AZ::Vector3 ReferenceShapeComponent::GenerateRandomPointInside(AZ::RandomDistributionType randomDistribution)
     {
         AZ::Vector3 result = AZ::Vector3::CreateZero();